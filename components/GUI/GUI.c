@@ -7,11 +7,15 @@
 #include "freertos/task.h"
 #include "esp_freertos_hooks.h"
 #include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
 
 #include "GUI.h"
 //#include "st7789.h"
 #include "display_HAL.h"
 #include "GUI_frontend.h"
+#include "GUI_icons.h"
+#include "system_manager.h"
 
 #include "LVGL/lvgl.h"
 
@@ -19,12 +23,14 @@
  *      DEFINES
  *********************/
 #define LV_TICK_PERIOD_MS 10
-#define DISP_BUF_SIZE   240*20 // Horizontal Res * 40 vetical pixels
+#define DISP_BUF_SIZE   240*20 // Horizontal Res * 20 vetical pixels
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_tick_task(void *arg);
+static void lv_monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px);
+static lv_color_t * disp_buf_alloc(void);
 static lv_disp_drv_t disp_drv;
 
 /**********************
@@ -32,6 +38,8 @@ static lv_disp_drv_t disp_drv;
  **********************/
 static SemaphoreHandle_t xGuiSemaphore;
 
+static const char *TAG = "GUI";
+
 /**********************
 *   GLOBAL FUNCTIONS
 **********************/
@@ -42,20 +50,23 @@ void GUI_init(void){
 
     // LVGL Initialization
     lv_init();
+    GUI_icons_init();
 
-    //Screen Buffer initialization
-    static EXT_RAM_ATTR lv_color_t * buf1[DISP_BUF_SIZE];
-   // static EXT_RAM_ATTR lv_color_t * buf2[DISP_BUF_SIZE];
+    //Screen Buffer initialization. Two buffers, so LVGL draws on one while the other is sent by DMA.
+    lv_color_t * buf1 = disp_buf_alloc();
+    lv_color_t * buf2 = disp_buf_alloc();
+    if(buf2 == NULL) ESP_LOGW(TAG, "Only one draw buffer available");
 
     static lv_disp_buf_t disp_buf;
     uint32_t size_in_px = DISP_BUF_SIZE; 
 
-    lv_disp_buf_init(&disp_buf, buf1, NULL, size_in_px);
+    lv_disp_buf_init(&disp_buf, buf1, buf2, size_in_px);
 
     // Initialize LVGL display and attach the flush function
     
     lv_disp_drv_init(&disp_drv);
     disp_drv.flush_cb = display_HAL_flush;
+    disp_drv.monitor_cb = lv_monitor_cb;
 
     disp_drv.buffer = &disp_buf;
     lv_disp_drv_register(&disp_drv);
@@ -86,9 +97,35 @@ void GUI_async_message(){
     async_battery_alert();
 }
 
+void GUI_resume_game(uint8_t console, const char * game_name){
+    GUI_frontend_resume_game(console, game_name);
+}
+
+void GUI_start(TaskHandle_t gui_task){
+    xTaskNotifyGive(gui_task);
+}
+
 void GUI_task(void *arg){
 
+    // The objects are built while the boot animation is using the display
+    uint8_t stage = system_boot_stage_start("GUI build");
     GUI_init();
+    system_boot_stage_end(stage);
+
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    // The first refresh draws the whole menu, once it's sent the device is interactive
+    stage = system_boot_stage_start("First frame");
+    GUI_frontend_start();
+    lv_task_handler();
+    system_boot_stage_end(stage);
+
+    struct BOOT_STAGE timeline[BOOT_STAGE_MAX];
+    uint8_t stage_num = system_boot_timeline(timeline);
+    for(uint8_t i = 0; i < stage_num; i++){
+        ESP_LOGI(TAG, "Boot stage %s: %u-%u ms", timeline[i].name, timeline[i].start, timeline[i].end);
+    }
+
     while (1) {
         lv_task_handler();
     }
@@ -107,3 +144,16 @@ static void lv_tick_task(void *arg) {
     lv_tick_inc(LV_TICK_PERIOD_MS);
 }
 
+// Time spent on each screen refresh, set the GUI log level to debug to see it
+static void lv_monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px){
+    ESP_LOGD(TAG, "Refresh: %u px in %u ms", px, time);
+}
+
+// The internal RAM is DMA capable, the SPIRAM one is only used if it's full
+static lv_color_t * disp_buf_alloc(void){
+    lv_color_t * buf = heap_caps_malloc(DISP_BUF_SIZE * sizeof(lv_color_t), MALLOC_CAP_DMA);
+    if(buf == NULL) buf = heap_caps_malloc(DISP_BUF_SIZE * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+
+    return buf;
+}
+
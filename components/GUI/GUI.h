@@ -1,7 +1,16 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
 #define MSG_LOW_BATTERY_GAME    0x00
 #define MSG_LOW_BATTERY         0x01
 
 
+// Builds the menu and waits for GUI_start to draw it
 void GUI_task(void *arg);
+// Called once the boot screen released the display and the peripherals are ready.
+// gui_task is the handle given by xTaskCreatePinnedToCore, GUI_task may not have run yet.
+void GUI_start(TaskHandle_t gui_task);
+// A game was started by the quick resume, the GUI starts on its on game menu
+void GUI_resume_game(uint8_t console, const char * game_name);
 void GUI_refresh();
 void GUI_async_message();
@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <time.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -13,8 +14,11 @@
 #include "lvgl.h"
 
 #include "GUI.h"
+#include "GUI_vlist.h"
 #include "system_manager.h"
 #include "sd_storage.h"
+#include "sd_worker.h"
+#include "sd_slots.h"
 #include "user_input.h"
 #include "sound_driver.h"
 #include "backlight_ctrl.h"
@@ -24,21 +28,9 @@
  *   ICONS IMAGES
  *********************/
 
-/* Emulator lib icons */
-#include "icons/emulators_icon.h"
-#include "icons/gameboycolor_icon.h"
-#include "icons/gameboy_icon.h"
-#include "icons/nes_icon.h"
-#include "icons/snes_icon.h"
-#include "icons/sega_icon.h"
-#include "icons/nogame_icon.h"
-#include "icons/GG_icon.h"
-
-/* Wi-Fi lib manager icons */
-#include "icons/ext_application_icon.h"
-
-/* Configuration icons */
-#include "icons/settings_icon.h"
+/* Emulator lib, Wi-Fi lib manager and configuration icons, RLE compressed from the
+   icons folder at build time */
+#include "icons_rle.h"
 
 /*********************
  *      DEFINES
@@ -52,6 +44,7 @@
 // Tasks
 static bool user_input_task(lv_indev_drv_t * indev_drv, lv_indev_data_t * data);
 static void battery_status_task(lv_task_t * task);
+static void storage_task(lv_task_t * task);
 
 // Emulators menu
 static void emulators_menu(lv_obj_t * parent);
@@ -61,17 +54,25 @@ static void game_execute_cb(lv_obj_t * parent, lv_event_t e);
 static void game_menu_cb(lv_obj_t * parent, lv_event_t e);
 static void msgbox_no_game_cb(lv_obj_t * msgbox, lv_event_t e);
 static void game_list_cb(lv_obj_t * parent, lv_event_t e);
+static const char * game_library_text(void * source, uint32_t index);
+static void game_list_show(struct sd_game_library * library);
+static void game_options_add_save();
 
 // On game menu
 static void on_game_menu();
 static void slider_volume_cb(lv_obj_t * slider, lv_event_t e);
 static void slider_brightness_cb(lv_obj_t * slider, lv_event_t e);
 static void list_game_menu_cb(lv_obj_t * parent, lv_event_t e);
+static void slot_menu(bool save);
+static void slot_list_show(struct sd_slot_index * index);
+static void slot_execute_cb(lv_obj_t * parent, lv_event_t e);
+static void slot_menu_close();
 
 // External app menu
 static void external_app_menu(lv_obj_t * parent);
 static void external_app_cb(lv_obj_t * parent, lv_event_t e);
 static void app_execute_cb(lv_obj_t * parent, lv_event_t e);
+static void external_app_show(char ** app_list, uint8_t app_num);
 
 // Configuration menu
 void config_menu(lv_obj_t * parent);
@@ -79,6 +80,7 @@ static void configuration_cb(lv_obj_t * parent, lv_event_t e);
 static void config_option_cb(lv_obj_t * parent, lv_event_t e);
 static void mbox_config_cb(lv_obj_t * parent, lv_event_t e);
 static void fw_update_cb(lv_obj_t * parent, lv_event_t e);
+static void fw_update_show(char ** app_list, uint8_t app_num);
 
 //Extra functions
 static void GUI_theme_color(uint8_t color_selected);
@@ -139,18 +141,22 @@ static lv_obj_t * list_emulators_main;
 static lv_obj_t * btn_emulator_lib;
 static lv_obj_t * container_header_game_icon;
 static lv_obj_t * list_game_emulator;
+static struct sd_game_library game_library;    // Kept open while list_game_emulator exists
 static lv_obj_t * list_game_options;
 static lv_obj_t * mbox_game_options;
 //Buttons of the game initialization list
 static lv_obj_t * btn_game_new;
 static lv_obj_t * btn_game_resume;
 static lv_obj_t * btn_game_delete;
+static lv_obj_t * label_loading;
 
 // On-game menu objects
 
 static lv_obj_t * list_on_game;
 static lv_obj_t * mbox_volume;
 static lv_obj_t * mbox_brightness;
+static lv_obj_t * mbox_slots;
+static lv_obj_t * list_slots;
 
 // External app menu objects
 
@@ -167,6 +173,24 @@ static lv_obj_t * mbox_about;
 static lv_obj_t * mbox_color;
 
 
+// Requests sent to the storage worker and not answered yet, 0 if none
+static uint32_t library_request = 0;
+static uint32_t sav_request = 0;
+static uint32_t app_request = 0;
+static uint32_t fw_update_request = 0;
+static uint32_t slot_request = 0;
+
+// Game started by the quick resume before the GUI was shown
+static bool game_resumed = false;
+static char game_running[200] = "";    // Name of the game being played, for its save slots
+
+// Save slots shown by mbox_slots, the thumbnails point to the index
+static struct sd_slot_index * slot_index = NULL;
+static lv_img_dsc_t slot_thumb[SD_SLOT_NUM];
+static uint8_t slot_btn[SD_SLOT_NUM];   // Slot of each button of list_slots
+static uint8_t slot_btn_num = 0;
+static bool slot_saving = false;        // The slots are listed to save, otherwise to load
+
 static const char *TAG = "GUI_frontend";
 
 /**********************
@@ -204,24 +228,19 @@ void GUI_frontend(void){
     battery_label = lv_label_create(battery_bar, NULL);
     lv_obj_align_origo(battery_label, NULL, LV_ALIGN_CENTER, 7, 2);
     lv_obj_set_style_local_text_font(battery_label, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_12 );
-    
-    //To show the battery level before the first message arrives to the queue
-    uint8_t battery_aux = battery_get_percentage();
-    char *battery_level = malloc(4); 
-    sprintf(battery_level,"%i",battery_aux);
-    lv_label_set_text(battery_label, battery_level);
-    lv_bar_set_value(battery_bar, battery_aux, NULL);
-    free(battery_level);
 
     // This task checks every minute if a new battery message is on the queue
     lv_task_t * task = lv_task_create(battery_status_task, 1000, LV_TASK_PRIO_LOW, NULL);
 
+    // This task gets the results of the SD card accesses done by the storage worker
+    lv_task_create(storage_task, 20, LV_TASK_PRIO_MID, NULL);
+
     /* SD card connected icon */
     SD_label = lv_label_create(notification_cont, NULL);
     lv_label_set_text(SD_label, LV_SYMBOL_SD_CARD);
     lv_obj_align_origo(SD_label, NULL, LV_ALIGN_IN_LEFT_MID, 25, 0);
-    // Check if is connected
-    if(!sd_mounted()) lv_obj_set_hidden(SD_label,true); 
+    // It's shown by GUI_frontend_start if the SD card is mounted
+    lv_obj_set_hidden(SD_label,true);
 
     //Wi-Fi Status Icon
     WIFI_label = lv_label_create(notification_cont, NULL);
@@ -267,6 +286,28 @@ void GUI_frontend(void){
 
 }
 
+// The menu is built in parallel with the SD card and battery initialization, their status is set here
+void GUI_frontend_start(void){
+    if(sd_mounted()) lv_obj_set_hidden(SD_label,false);
+
+    //To show the battery level before the first message arrives to the queue
+    uint8_t battery_aux = battery_get_percentage();
+    char *battery_level = malloc(4); 
+    sprintf(battery_level,"%i",battery_aux);
+    lv_label_set_text(battery_label, battery_level);
+    lv_bar_set_value(battery_bar, battery_aux, NULL);
+    free(battery_level);
+
+    // The menu button was pushed on a resumed game, so the GUI starts like if the game was launched from it
+    if(game_resumed) on_game_menu();
+}
+
+void GUI_frontend_resume_game(uint8_t console, const char * game_name){
+    emulator_selected = console;
+    strncpy(game_running, game_name, sizeof(game_running) - 1);
+    game_resumed = true;
+}
+
 
 /**********************
  *   STATIC FUNCTIONS
@@ -328,6 +369,9 @@ static void on_game_menu(){
     list_btn = lv_list_add_btn(list_on_game, LV_SYMBOL_SAVE, "Save Game");
     lv_obj_set_event_cb(list_btn, list_game_menu_cb);
 
+    list_btn = lv_list_add_btn(list_on_game, LV_SYMBOL_UPLOAD, "Load Game");
+    lv_obj_set_event_cb(list_btn, list_game_menu_cb);
+
     list_btn = lv_list_add_btn(list_on_game, LV_SYMBOL_VOLUME_MAX, "Volume");
     lv_obj_set_event_cb(list_btn, list_game_menu_cb);
 
@@ -392,6 +436,8 @@ static void game_list_cb(lv_obj_t * parent, lv_event_t e){
 
     // Get the list of available games for each console and show a header with the icon of the console
     if(e == LV_EVENT_CLICKED){
+        // Wait for the list which is already loading
+        if(library_request != 0) return;
 
         container_header_game_icon = lv_cont_create(lv_layer_top(), NULL);
         lv_obj_align(container_header_game_icon, NULL, LV_ALIGN_IN_TOP_LEFT, 0, 0);
@@ -477,55 +523,23 @@ static void game_list_cb(lv_obj_t * parent, lv_event_t e){
             ESP_LOGI(TAG,"Selected Sega Game Gear");
         }
 
-        // Get the game list of each console.
-        char *game_list[100];
-        uint8_t games_num = sd_game_list(game_list, emulator_selected);
-
-        ESP_LOGI(TAG,"Found %i games",games_num);
-
-        // Print the list of games or show a message is any game is available
-        if(games_num>0){
-            list_game_emulator = lv_list_create(lv_layer_top(), NULL);
-            lv_obj_set_size(list_game_emulator, 210, 200);
-            lv_obj_align(list_game_emulator, NULL, LV_ALIGN_CENTER, 0, 23);
-            //lv_obj_set_event_cb(list_game_emulator, emulator_list_event);
-            lv_page_glue_obj(list_game_emulator,true);
-            // Add a button for each game
-            for(int i=0;i<games_num;i++){
-                lv_obj_t * game_btn = lv_list_add_btn(list_game_emulator, NULL, game_list[i]);
-                lv_group_add_obj(group_interact, game_btn);
-                lv_obj_set_event_cb(game_btn, game_menu_cb);
-                free(game_list[i]);
-            }
-            lv_group_add_obj(group_interact, list_game_emulator);
-
-            lv_group_focus_obj(list_game_emulator);
-        }
-        else{
-            lv_obj_del(container_header_game_icon);
-
-            lv_obj_t * mbox = lv_msgbox_create(lv_layer_top(), NULL);
-            lv_msgbox_set_text(mbox, "Oops! No games available.");
-            lv_obj_set_event_cb(mbox, msgbox_no_game_cb);
-            lv_group_add_obj(group_interact, mbox);
-            lv_group_focus_obj(mbox);
-            lv_group_focus_freeze(group_interact, true);
-
-            lv_obj_t * nogame_image = lv_img_create(mbox, NULL);
-            lv_img_set_src(nogame_image, &nogame_icon);
-            lv_obj_align(nogame_image, mbox, LV_ALIGN_CENTER, 0, 0);
+        // The library is loaded by the storage worker, game_list_show is called once it's ready
+        struct sd_request request = { .type = SD_REQ_LIBRARY, .console = emulator_selected };
+        library_request = sd_worker_request(&request);
 
-            //static const char * btns[] = {"Ok", "", ""};
-            //lv_msgbox_add_btns(mbox, btns);
-            lv_obj_align(mbox, NULL, LV_ALIGN_CENTER, 0, 0);
+        label_loading = lv_label_create(lv_layer_top(), NULL);
+        lv_label_set_text(label_loading, "Loading...");
+        lv_obj_align(label_loading, NULL, LV_ALIGN_CENTER, 0, 23);
 
-            lv_obj_set_style_local_bg_opa(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_70);
-            lv_obj_set_style_local_bg_color(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_GRAY);
-            lv_obj_set_click(lv_layer_top(), true);
-        }
-        
+        if(library_request == 0) game_list_show(NULL);
     }
     else if(e == LV_EVENT_CANCEL ){
+        if(library_request != 0){
+            // The game list is still loading, drop it
+            library_request = 0;
+            lv_obj_del(label_loading);
+            lv_obj_del(container_header_game_icon);
+        }
         sub_menu = false;
         lv_group_focus_obj(btn_emulator_lib);
         lv_obj_del(list_emulators_main);
@@ -585,6 +599,55 @@ static void emulators_list_cb(lv_obj_t * parent, lv_event_t e){
     }
 }
 
+static void game_list_show(struct sd_game_library * library){
+    lv_obj_del(label_loading);
+
+    uint32_t games_num = 0;
+    sd_game_library_close(&game_library);
+    if(library != NULL){
+        game_library = *library;
+        games_num = game_library.count;
+    }
+
+    ESP_LOGI(TAG,"Found %i games",games_num);
+
+    // Print the list of games or show a message is any game is available
+    if(games_num>0){
+        // Only the visible rows get a button, they are relabeled while scrolling
+        list_game_emulator = GUI_vlist_create(lv_layer_top(), 210, 200, games_num,
+                                              game_library_text, &game_library, game_menu_cb);
+        lv_obj_align(list_game_emulator, NULL, LV_ALIGN_CENTER, 0, 23);
+        //lv_obj_set_event_cb(list_game_emulator, emulator_list_event);
+        lv_page_glue_obj(list_game_emulator,true);
+        lv_group_add_obj(group_interact, list_game_emulator);
+
+        lv_group_focus_obj(list_game_emulator);
+    }
+    else{
+        sd_game_library_close(&game_library);
+        lv_obj_del(container_header_game_icon);
+
+        lv_obj_t * mbox = lv_msgbox_create(lv_layer_top(), NULL);
+        lv_msgbox_set_text(mbox, "Oops! No games available.");
+        lv_obj_set_event_cb(mbox, msgbox_no_game_cb);
+        lv_group_add_obj(group_interact, mbox);
+        lv_group_focus_obj(mbox);
+        lv_group_focus_freeze(group_interact, true);
+
+        lv_obj_t * nogame_image = lv_img_create(mbox, NULL);
+        lv_img_set_src(nogame_image, &nogame_icon);
+        lv_obj_align(nogame_image, mbox, LV_ALIGN_CENTER, 0, 0);
+
+        //static const char * btns[] = {"Ok", "", ""};
+        //lv_msgbox_add_btns(mbox, btns);
+        lv_obj_align(mbox, NULL, LV_ALIGN_CENTER, 0, 0);
+
+        lv_obj_set_style_local_bg_opa(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_70);
+        lv_obj_set_style_local_bg_color(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_GRAY);
+        lv_obj_set_click(lv_layer_top(), true);
+    }
+}
+
 static void game_menu_cb(lv_obj_t * parent, lv_event_t e){
     if(e == LV_EVENT_CLICKED) {
        
@@ -604,13 +667,10 @@ static void game_menu_cb(lv_obj_t * parent, lv_event_t e){
         btn_game_new = lv_list_add_btn(list_game_options, LV_SYMBOL_HOME, "New Game");
         lv_obj_set_event_cb(btn_game_new, game_execute_cb);
 
-        if(sd_sav_exist((char *)lv_list_get_btn_text(parent),emulator_selected)){
-            btn_game_resume = lv_list_add_btn(list_game_options, LV_SYMBOL_SAVE, "Resume Game");
-            lv_obj_set_event_cb(btn_game_resume, game_execute_cb);
-
-            btn_game_delete = lv_list_add_btn(list_game_options, LV_SYMBOL_CLOSE, "Delete Save Data");
-            lv_obj_set_event_cb(btn_game_delete, game_execute_cb);
-        }
+        // The save options are added by game_options_add_save once the worker checked the save file
+        struct sd_request request = { .type = SD_REQ_SAV_EXIST, .console = emulator_selected };
+        strncpy(request.name, lv_list_get_btn_text(parent), sizeof(request.name) - 1);
+        sav_request = sd_worker_request(&request);
         
 
         lv_group_add_obj(group_interact, list_game_options);
@@ -625,11 +685,24 @@ static void game_menu_cb(lv_obj_t * parent, lv_event_t e){
         // Delete the list of games and the header icon
         lv_obj_del(container_header_game_icon);
         lv_obj_del(list_game_emulator);
+        sd_game_library_close(&game_library);
         lv_obj_set_hidden(list_emulators_main,false);
         lv_group_focus_obj(list_emulators_main);
     }
 }
 
+static void game_options_add_save(){
+    btn_game_resume = lv_list_add_btn(list_game_options, LV_SYMBOL_SAVE, "Resume Game");
+    lv_obj_set_event_cb(btn_game_resume, game_execute_cb);
+
+    btn_game_delete = lv_list_add_btn(list_game_options, LV_SYMBOL_CLOSE, "Delete Save Data");
+    lv_obj_set_event_cb(btn_game_delete, game_execute_cb);
+}
+
+static const char * game_library_text(void * source, uint32_t index){
+    return sd_game_library_name(source, index);
+}
+
 static void game_execute_cb(lv_obj_t * parent, lv_event_t e){
     if(e == LV_EVENT_CLICKED) {
         struct SYSTEM_MODE emulator;
@@ -642,6 +715,7 @@ static void game_execute_cb(lv_obj_t * parent, lv_event_t e){
             emulator.status = 1;
             emulator.console = emulator_selected;
             strcpy(emulator.game_name, (char *)lv_msgbox_get_text(mbox_game_options));
+            strcpy(game_running, emulator.game_name);
 
             if( xQueueSend( modeQueue,&emulator, ( TickType_t ) 10) != pdPASS ){
                 ESP_LOGE(TAG, "Error sending game execution queue");
@@ -658,6 +732,7 @@ static void game_execute_cb(lv_obj_t * parent, lv_event_t e){
             emulator.status = 1;
             emulator.console = emulator_selected;
             strcpy(emulator.game_name, (char *)lv_msgbox_get_text(mbox_game_options));
+            strcpy(game_running, emulator.game_name);
 
             if( xQueueSend( modeQueue,&emulator, ( TickType_t ) 10) != pdPASS ){
                 ESP_LOGE(TAG, "Error sending game execution queue");
@@ -666,7 +741,9 @@ static void game_execute_cb(lv_obj_t * parent, lv_event_t e){
 
         }
         else if(strcmp(lv_list_get_btn_text(parent),"Delete Save Data")==0){
-            sd_sav_remove((char *)lv_msgbox_get_text(mbox_game_options), emulator_selected);
+            struct sd_request request = { .type = SD_REQ_SAV_REMOVE, .console = emulator_selected };
+            strncpy(request.name, lv_msgbox_get_text(mbox_game_options), sizeof(request.name) - 1);
+            sd_worker_request(&request);
             //Update the list of options
             lv_obj_del(btn_game_delete);
             lv_obj_del(btn_game_resume);
@@ -681,6 +758,7 @@ static void game_execute_cb(lv_obj_t * parent, lv_event_t e){
         lv_obj_set_hidden(list_emulators_main,false);
         lv_obj_set_hidden(list_game_emulator,false);
 
+        sav_request = 0;
         lv_obj_del(mbox_game_options);
     }
 }
@@ -724,14 +802,10 @@ static void list_game_menu_cb(lv_obj_t * parent, lv_event_t e){
 
         }
         else if(strcmp(lv_list_get_btn_text(parent),"Save Game")==0){
-
-            emulator.mode = MODE_SAVE_GAME;
-            emulator.console = emulator_selected;
-
-            if( xQueueSend( modeQueue,&emulator, ( TickType_t ) 10) != pdPASS ){
-                ESP_LOGE(TAG,"modeQueue send error");
-            }
-
+            slot_menu(true);
+        }
+        else if(strcmp(lv_list_get_btn_text(parent),"Load Game")==0){
+            slot_menu(false);
         }
         else if(strcmp(lv_list_get_btn_text(parent),"Volume")==0){
             
@@ -806,58 +880,175 @@ static void list_game_menu_cb(lv_obj_t * parent, lv_event_t e){
 }
 
 
-/* External app call-back functions */
+/* Save slots functions */
 
-static void external_app_cb(lv_obj_t * parent, lv_event_t e){
+static void slot_menu(bool save){
+    // Only one slot menu at a time, the first one may still be waiting for the index
+    if(slot_request != 0 || mbox_slots != NULL) return;
+
+    slot_saving = save;
+
+    mbox_slots = lv_msgbox_create(lv_layer_top(), NULL);
+    lv_msgbox_set_text(mbox_slots, save ? "Save Game" : "Load Game");
+    lv_obj_align(mbox_slots, NULL, LV_ALIGN_CENTER, 0, 0);
+
+    list_slots = lv_list_create(mbox_slots, NULL);
+    lv_obj_set_size(list_slots, 200, 170);
+
+    // The slots are listed once the worker read the index of the game
+    struct sd_request request = { .type = SD_REQ_SLOT_INDEX, .console = emulator_selected };
+    strncpy(request.name, game_running, sizeof(request.name) - 1);
+    slot_request = sd_worker_request(&request);
+    if(slot_request == 0) slot_list_show(NULL);
+}
+
+static void slot_list_show(struct sd_slot_index * index){
+    slot_index = index;
+    slot_btn_num = 0;
+
+    for(uint8_t i = 0; i < SD_SLOT_NUM; i++){
+        bool used = index != NULL && index->slot[i].used;
+        if(!used && !slot_saving) continue;
+
+        char text[48];
+        int len = (i == 0) ? snprintf(text, sizeof(text), "Quick save") : snprintf(text, sizeof(text), "Slot %d", i);
+
+        const void * img = LV_SYMBOL_SAVE;
+        if(used){
+            struct sd_slot * slot = &index->slot[i];
+            time_t timestamp = slot->timestamp;
+            struct tm date;
+
+            // Without a clock set, the saves are only numbered
+            if(timestamp > 1577836800 && localtime_r(&timestamp, &date) != NULL) strftime(text + len, sizeof(text) - len, "\n%d/%m/%y %H:%M", &date);
+            else snprintf(text + len, sizeof(text) - len, "\nSave %u", slot->serial);
+
+            slot_thumb[i].header.always_zero = 0;
+            slot_thumb[i].header.w = SD_SLOT_THUMB_SIZE;
+            slot_thumb[i].header.h = SD_SLOT_THUMB_SIZE;
+            slot_thumb[i].header.cf = LV_IMG_CF_TRUE_COLOR;
+            slot_thumb[i].data_size = sizeof(slot->thumb);
+            slot_thumb[i].data = (const uint8_t *)slot->thumb;
+            img = &slot_thumb[i];
+        }
+        else snprintf(text + len, sizeof(text) - len, "\nEmpty");
+
+        lv_obj_t * btn = lv_list_add_btn(list_slots, img, text);
+        lv_obj_set_event_cb(btn, slot_execute_cb);
+        slot_btn[slot_btn_num++] = i;
+    }
 
+    if(slot_btn_num == 0){
+        lv_obj_t * btn = lv_list_add_btn(list_slots, LV_SYMBOL_CLOSE, "No save data");
+        lv_obj_set_event_cb(btn, slot_execute_cb);
+    }
+
+    lv_group_add_obj(group_interact, list_slots);
+    lv_group_focus_obj(list_slots);
+}
+
+static void slot_execute_cb(lv_obj_t * parent, lv_event_t e){
     if(e == LV_EVENT_CLICKED){
+        int32_t btn = lv_list_get_btn_index(list_slots, parent);
 
-        char *app_list[100];
-        uint8_t app_num = sd_app_list(app_list,false);
-
-        ESP_LOGI(TAG,"Found %i applications",app_num);
-
-        if(app_num > 0){
-            //Create a list of applications
-            sub_menu = true;
-            list_external_app = lv_list_create(lv_layer_top(), NULL);
-            lv_obj_set_size(list_external_app, 210, 200);
-            lv_obj_align(list_external_app, NULL, LV_ALIGN_CENTER, 0, 10);
-
-             lv_page_glue_obj(list_external_app,true);
-            // Add a button for each game
-            for(int i=0;i<app_num;i++){
-                lv_obj_t * app_btn = lv_list_add_btn(list_external_app, NULL, app_list[i]);
-                lv_group_add_obj(group_interact, app_btn);
-                lv_obj_set_event_cb(app_btn, app_execute_cb);
-                free(app_list[i]);
+        if(btn >= 0 && btn < slot_btn_num){
+            struct SYSTEM_MODE emulator;
+            emulator.mode = slot_saving ? MODE_SAVE_GAME : MODE_LOAD_GAME;
+            emulator.console = emulator_selected;
+            emulator.slot = slot_btn[btn];
+
+            if( xQueueSend( modeQueue,&emulator, ( TickType_t ) 10) != pdPASS ){
+                ESP_LOGE(TAG,"modeQueue send error");
             }
-            lv_group_add_obj(group_interact, list_external_app);
 
-            lv_group_focus_obj(list_external_app);
+            // Back to the game once the state is restored
+            if(!slot_saving){
+                emulator.mode = MODE_GAME;
+                emulator.status = 0;
 
+                if( xQueueSend( modeQueue,&emulator, ( TickType_t ) 10) != pdPASS ){
+                    ESP_LOGE(TAG,"modeQueue send error");
+                }
+            }
         }
-        else{
-            //TODO: Repair where it focus this message once is close
-            //Show a message
-            lv_obj_t * mbox = lv_msgbox_create(lv_layer_top(), NULL);
-            lv_msgbox_set_text(mbox, "No apps available.");
-            lv_obj_set_event_cb(mbox, msgbox_no_game_cb);
-            lv_group_add_obj(group_interact, mbox);
-            lv_group_focus_obj(mbox);
-            lv_group_focus_freeze(group_interact, true);
-
-            lv_obj_t * nogame_image = lv_img_create(mbox, NULL);
-            lv_img_set_src(nogame_image, &nogame_icon);
-            lv_obj_align(nogame_image, mbox, LV_ALIGN_CENTER, 0, 0);
 
-            lv_obj_set_style_local_bg_opa(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_70);
-            lv_obj_set_style_local_bg_color(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_GRAY);
-            lv_obj_set_click(lv_layer_top(), true);
+        slot_menu_close();
+    }
+    else if(e == LV_EVENT_CANCEL){
+        slot_menu_close();
+    }
+}
 
-            lv_group_focus_obj(btn_ext_app);
+static void slot_menu_close(){
+    slot_request = 0;
+    lv_obj_del(mbox_slots);
+    mbox_slots = NULL;
+
+    for(uint8_t i = 0; i < SD_SLOT_NUM; i++) lv_img_cache_invalidate_src(&slot_thumb[i]);
+    free(slot_index);
+    slot_index = NULL;
+
+    lv_group_focus_obj(list_on_game);
+}
+
+
+/* External app call-back functions */
+
+static void external_app_cb(lv_obj_t * parent, lv_event_t e){
+
+    if(e == LV_EVENT_CLICKED){
+
+        // The list is shown by external_app_show once the worker read the apps folder
+        if(app_request != 0) return;
+        struct sd_request request = { .type = SD_REQ_APP_LIST, .update = false };
+        app_request = sd_worker_request(&request);
+    }
+}
+
+static void external_app_show(char ** app_list, uint8_t app_num){
+    ESP_LOGI(TAG,"Found %i applications",app_num);
+
+    if(app_num > 0){
+        //Create a list of applications
+        sub_menu = true;
+        list_external_app = lv_list_create(lv_layer_top(), NULL);
+        lv_obj_set_size(list_external_app, 210, 200);
+        lv_obj_align(list_external_app, NULL, LV_ALIGN_CENTER, 0, 10);
+
+         lv_page_glue_obj(list_external_app,true);
+        // Add a button for each game
+        for(int i=0;i<app_num;i++){
+            lv_obj_t * app_btn = lv_list_add_btn(list_external_app, NULL, app_list[i]);
+            lv_group_add_obj(group_interact, app_btn);
+            lv_obj_set_event_cb(app_btn, app_execute_cb);
+            free(app_list[i]);
         }
+        lv_group_add_obj(group_interact, list_external_app);
+
+        lv_group_focus_obj(list_external_app);
+
+    }
+    else{
+        //TODO: Repair where it focus this message once is close
+        //Show a message
+        lv_obj_t * mbox = lv_msgbox_create(lv_layer_top(), NULL);
+        lv_msgbox_set_text(mbox, "No apps available.");
+        lv_obj_set_event_cb(mbox, msgbox_no_game_cb);
+        lv_group_add_obj(group_interact, mbox);
+        lv_group_focus_obj(mbox);
+        lv_group_focus_freeze(group_interact, true);
+
+        lv_obj_t * nogame_image = lv_img_create(mbox, NULL);
+        lv_img_set_src(nogame_image, &nogame_icon);
+        lv_obj_align(nogame_image, mbox, LV_ALIGN_CENTER, 0, 0);
+
+        lv_obj_set_style_local_bg_opa(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_70);
+        lv_obj_set_style_local_bg_color(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_GRAY);
+        lv_obj_set_click(lv_layer_top(), true);
+
+        lv_group_focus_obj(btn_ext_app);
     }
+    free(app_list);
 }
 
 static void app_execute_cb(lv_obj_t * parent, lv_event_t e){
@@ -937,6 +1128,8 @@ static void configuration_cb(lv_obj_t * parent, lv_event_t e){
         lv_obj_set_event_cb(list_btn, config_option_cb);
         list_btn = lv_list_add_btn(list_config, LV_SYMBOL_SD_CARD, "SD card Status");
         lv_obj_set_event_cb(list_btn, config_option_cb);
+        list_btn = lv_list_add_btn(list_config, LV_SYMBOL_LIST, "Boot timeline");
+        lv_obj_set_event_cb(list_btn, config_option_cb);
 
         lv_group_add_obj(group_interact, list_config);
         lv_group_focus_obj(list_config);
@@ -972,51 +1165,10 @@ static void config_option_cb(lv_obj_t * parent, lv_event_t e){
         }
         else if(strcmp(lv_list_get_btn_text(parent),"Update firmware")==0){
 
-                // Get the game list of each console.
-            char fw_update_name[30][100];
-            uint8_t fw_update_num = sd_app_list(fw_update_name,true);
-
-            ESP_LOGI(TAG,"Found %i updates",fw_update_num);
-
-            // Print the list of games or show a message is any game is available
-            if(fw_update_num>0){
-                list_fw_update = lv_list_create(lv_layer_top(), NULL);
-                lv_obj_set_size(list_fw_update, 210, 210);
-                lv_obj_align(list_fw_update, NULL, LV_ALIGN_CENTER, 0, 23);
-                //lv_obj_set_event_cb(list_game_emulator, emulator_list_event);
-                lv_page_glue_obj(list_fw_update,true);
-                // Add a button for each game
-                for(int i=0;i<fw_update_num;i++){
-                    lv_obj_t * update_btn = lv_list_add_btn(list_fw_update, NULL, fw_update_name[i]);
-                    lv_group_add_obj(group_interact, update_btn);
-                    lv_obj_set_event_cb(update_btn, fw_update_cb);
-                }
-                lv_group_add_obj(group_interact, list_fw_update);
-
-                lv_group_focus_obj(list_fw_update);
-            }
-            else{
-            /* lv_obj_del(container_header_game_icon);
-
-                lv_obj_t * mbox = lv_msgbox_create(lv_layer_top(), NULL);
-                lv_msgbox_set_text(mbox, "Oops! Any game available.");
-                lv_obj_set_event_cb(mbox, msgbox_no_game_cb);
-                lv_group_add_obj(group_interact, mbox);
-                lv_group_focus_obj(mbox);
-                lv_group_focus_freeze(group_interact, true);
-
-                lv_obj_t * nogame_image = lv_img_create(mbox, NULL);
-                lv_img_set_src(nogame_image, &nogame_icon);
-                lv_obj_align(nogame_image, mbox, LV_ALIGN_CENTER, 0, 0);
-
-                static const char * btns[] = {"Ok", "", ""};
-                lv_msgbox_add_btns(mbox, btns);
-                lv_obj_align(mbox, NULL, LV_ALIGN_CENTER, 0, 0);
-
-                lv_obj_set_style_local_bg_opa(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_70);
-                lv_obj_set_style_local_bg_color(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_GRAY);
-                lv_obj_set_click(lv_layer_top(), true);*/
-            }
+            // The list is shown by fw_update_show once the worker read the SD card root
+            if(fw_update_request != 0) return;
+            struct sd_request request = { .type = SD_REQ_APP_LIST, .update = true };
+            fw_update_request = sd_worker_request(&request);
         }
         else if(strcmp(lv_list_get_btn_text(parent),"Brightness")==0){
             mbox_brightness = lv_msgbox_create(lv_layer_top(), NULL);
@@ -1149,6 +1301,32 @@ static void config_option_cb(lv_obj_t * parent, lv_event_t e){
             lv_group_focus_obj(mbox_SD);
             
         }
+        else if(strcmp(lv_list_get_btn_text(parent),"Boot timeline")==0){
+            lv_obj_t * mbox_boot = lv_msgbox_create(lv_layer_top(), NULL);
+            lv_msgbox_set_text(mbox_boot, "Boot timeline");
+            lv_obj_align(mbox_boot, NULL, LV_ALIGN_CENTER, 0, -50);
+
+            // Start and end of each stage, in ms since the power on
+            struct BOOT_STAGE timeline[BOOT_STAGE_MAX];
+            uint8_t stage_num = system_boot_timeline(timeline);
+
+            char spec_text[BOOT_STAGE_MAX*40];
+            size_t len = 0;
+            spec_text[0] = '\0';
+            for(uint8_t i = 0; i < stage_num; i++){
+                len += snprintf(spec_text + len, sizeof(spec_text) - len, "%s\u2022 %s: %u-%u ms", i ? "\n" : "",\
+                timeline[i].name, timeline[i].start, timeline[i].end);
+                if(len >= sizeof(spec_text)) break;
+            }
+
+            lv_obj_t * label_timeline = lv_label_create(mbox_boot, NULL);
+            lv_obj_set_style_local_text_font(label_timeline, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_12);
+            lv_label_set_text(label_timeline,spec_text);
+
+            lv_obj_set_event_cb(mbox_boot, mbox_config_cb);
+            lv_group_add_obj(group_interact, mbox_boot);
+            lv_group_focus_obj(mbox_boot);
+        }
     }
     else if(e == LV_EVENT_CANCEL){
         sub_menu = false;
@@ -1158,6 +1336,52 @@ static void config_option_cb(lv_obj_t * parent, lv_event_t e){
 
 }
 
+static void fw_update_show(char ** app_list, uint8_t app_num){
+    ESP_LOGI(TAG,"Found %i updates",app_num);
+
+    // Print the list of games or show a message is any game is available
+    if(app_num>0){
+        list_fw_update = lv_list_create(lv_layer_top(), NULL);
+        lv_obj_set_size(list_fw_update, 210, 210);
+        lv_obj_align(list_fw_update, NULL, LV_ALIGN_CENTER, 0, 23);
+        //lv_obj_set_event_cb(list_game_emulator, emulator_list_event);
+        lv_page_glue_obj(list_fw_update,true);
+        // Add a button for each game
+        for(int i=0;i<app_num;i++){
+            lv_obj_t * update_btn = lv_list_add_btn(list_fw_update, NULL, app_list[i]);
+            free(app_list[i]);
+            lv_group_add_obj(group_interact, update_btn);
+            lv_obj_set_event_cb(update_btn, fw_update_cb);
+        }
+        lv_group_add_obj(group_interact, list_fw_update);
+
+        lv_group_focus_obj(list_fw_update);
+    }
+    else{
+    /* lv_obj_del(container_header_game_icon);
+
+        lv_obj_t * mbox = lv_msgbox_create(lv_layer_top(), NULL);
+        lv_msgbox_set_text(mbox, "Oops! Any game available.");
+        lv_obj_set_event_cb(mbox, msgbox_no_game_cb);
+        lv_group_add_obj(group_interact, mbox);
+        lv_group_focus_obj(mbox);
+        lv_group_focus_freeze(group_interact, true);
+
+        lv_obj_t * nogame_image = lv_img_create(mbox, NULL);
+        lv_img_set_src(nogame_image, &nogame_icon);
+        lv_obj_align(nogame_image, mbox, LV_ALIGN_CENTER, 0, 0);
+
+        static const char * btns[] = {"Ok", "", ""};
+        lv_msgbox_add_btns(mbox, btns);
+        lv_obj_align(mbox, NULL, LV_ALIGN_CENTER, 0, 0);
+
+        lv_obj_set_style_local_bg_opa(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_70);
+        lv_obj_set_style_local_bg_color(lv_layer_top(), LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_GRAY);
+        lv_obj_set_click(lv_layer_top(), true);*/
+    }
+    free(app_list);
+}
+
 static void fw_update_cb(lv_obj_t * parent, lv_event_t e){
 
     if(e == LV_EVENT_CLICKED){
@@ -1234,6 +1458,49 @@ void async_battery_alert(bool game_mode){
  *   TASKS FUNCTIONS
  **********************/
 
+static void storage_task(lv_task_t * task){
+    // Results of the requests sent to the storage worker. The ones which aren't pending anymore
+    // were cancelled by the user, so only their memory is released.
+    struct sd_response response;
+
+    while(sd_worker_response(&response)){
+        if(response.type == SD_REQ_LIBRARY){
+            if(response.id == library_request){
+                library_request = 0;
+                game_list_show(&response.library);
+            }
+            else sd_game_library_close(&response.library);
+        }
+        else if(response.type == SD_REQ_SAV_EXIST){
+            if(response.id == sav_request){
+                sav_request = 0;
+                if(response.sav_exist) game_options_add_save();
+            }
+        }
+        else if(response.type == SD_REQ_APP_LIST){
+            if(response.id == app_request){
+                app_request = 0;
+                external_app_show(response.app_list, response.app_num);
+            }
+            else if(response.id == fw_update_request){
+                fw_update_request = 0;
+                fw_update_show(response.app_list, response.app_num);
+            }
+            else{
+                for(int i=0;i<response.app_num;i++) free(response.app_list[i]);
+                free(response.app_list);
+            }
+        }
+        else if(response.type == SD_REQ_SLOT_INDEX){
+            if(response.id == slot_request){
+                slot_request = 0;
+                slot_list_show(response.data);
+            }
+            else free(response.data);
+        }
+    }
+}
+
 static void battery_status_task(lv_task_t * task){
     // This task check every minute if the battery level has change. If it receive a message from the 
     // queue, it change the text value and the size of the battery bar.
@@ -1,2 +1,4 @@
 void GUI_frontend(void);
+void GUI_frontend_start(void);
+void GUI_frontend_resume_game(uint8_t console, const char * game_name);
 void async_battery_alert();
\ No newline at end of file
@@ -0,0 +1,186 @@
+/*********************
+ *      LIBRARIES
+ *********************/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+#include "lvgl.h"
+
+#include "GUI_icons.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ICON_CACHE_SIZE     (128*1024)  // Bytes of decoded icons kept on the SPIRAM
+#define ICON_HEADER_SIZE    8           // See icons/icon_rle.py
+
+typedef struct {
+    const lv_img_dsc_t * src;
+    uint8_t * data;
+    uint32_t size;
+    uint32_t last_use;
+    uint16_t open;      // Opened by LVGL, it can't be released
+} icon_cache_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t icon_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
+static lv_res_t icon_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static void icon_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static icon_cache_entry_t * icon_cache_get(const lv_img_dsc_t * src);
+static icon_cache_entry_t * icon_cache_reserve(uint32_t size);
+static void icon_decode(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size, uint8_t px_size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static icon_cache_entry_t icon_cache[GUI_ICONS_MAX];
+static uint32_t icon_cache_used = 0;
+static uint32_t icon_cache_tick = 0;
+
+static const char *TAG = "GUI_icons";
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+void GUI_icons_init(void){
+    lv_img_decoder_t * decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, icon_info);
+    lv_img_decoder_set_open_cb(decoder, icon_open);
+    lv_img_decoder_set_close_cb(decoder, icon_close);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_res_t icon_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header){
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return LV_RES_INV;
+
+    const lv_img_dsc_t * img = src;
+    if(img->header.cf != LV_IMG_CF_USER_ENCODED_0 || img->data_size < ICON_HEADER_SIZE) return LV_RES_INV;
+
+    // LVGL draws the decoded pixels, so it gets their real format
+    header->w = img->header.w;
+    header->h = img->header.h;
+    header->cf = img->data[0];
+
+    return LV_RES_OK;
+}
+
+static lv_res_t icon_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc){
+    icon_cache_entry_t * entry = icon_cache_get(dsc->src);
+    if(entry == NULL) return LV_RES_INV;
+
+    entry->open++;
+    entry->last_use = ++icon_cache_tick;
+
+    // The whole image is given, so LVGL doesn't need a read line callback
+    dsc->img_data = entry->data;
+    dsc->user_data = entry;
+
+    return LV_RES_OK;
+}
+
+static void icon_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc){
+    icon_cache_entry_t * entry = dsc->user_data;
+    if(entry != NULL && entry->open > 0) entry->open--;
+}
+
+// Get the decoded icon, decoding it only if it isn't on the cache yet
+static icon_cache_entry_t * icon_cache_get(const lv_img_dsc_t * src){
+    for(int i = 0; i < GUI_ICONS_MAX; i++){
+        if(icon_cache[i].src == src) return &icon_cache[i];
+    }
+
+    const uint8_t * in = src->data;
+    uint8_t px_size = in[1];
+    uint32_t size;
+    memcpy(&size, in + 4, sizeof(size));
+
+    icon_cache_entry_t * free_entry = icon_cache_reserve(size);
+    if(free_entry == NULL){
+        ESP_LOGE(TAG, "Icon cache full");
+        return NULL;
+    }
+
+    uint8_t * data = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if(data == NULL) data = malloc(size);
+    if(data == NULL) return NULL;
+
+    icon_decode(in + ICON_HEADER_SIZE, src->data_size - ICON_HEADER_SIZE, data, size, px_size);
+
+    free_entry->src = src;
+    free_entry->data = data;
+    free_entry->size = size;
+    free_entry->open = 0;
+    icon_cache_used += size;
+
+    return free_entry;
+}
+
+// Release the least recently used icons until there is a free entry and room for size bytes
+static icon_cache_entry_t * icon_cache_reserve(uint32_t size){
+    icon_cache_entry_t * free_entry = NULL;
+
+    for(int i = 0; i < GUI_ICONS_MAX; i++){
+        if(icon_cache[i].src == NULL){
+            free_entry = &icon_cache[i];
+            break;
+        }
+    }
+
+    while(free_entry == NULL || icon_cache_used + size > ICON_CACHE_SIZE){
+        icon_cache_entry_t * lru = NULL;
+
+        for(int i = 0; i < GUI_ICONS_MAX; i++){
+            if(icon_cache[i].src == NULL || icon_cache[i].open > 0) continue;
+            if(lru == NULL || icon_cache[i].last_use < lru->last_use) lru = &icon_cache[i];
+        }
+        if(lru == NULL) return NULL;
+
+        free(lru->data);
+        icon_cache_used -= lru->size;
+        memset(lru, 0, sizeof(*lru));
+        if(free_entry == NULL) free_entry = lru;
+    }
+
+    return free_entry;
+}
+
+static void icon_decode(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size, uint8_t px_size){
+    const uint8_t * in_end = in + in_size;
+    uint8_t * out_end = out + out_size;
+
+    while(in < in_end && out < out_end){
+        uint8_t ctrl = *in++;
+        uint32_t count = (ctrl & 0x7f) + 1;
+
+        if(ctrl & 0x80){
+            // Run of the same pixel
+            if(in + px_size > in_end) break;
+            while(count-- && out + px_size <= out_end){
+                memcpy(out, in, px_size);
+                out += px_size;
+            }
+            in += px_size;
+        }
+        else{
+            // Literal pixels
+            uint32_t bytes = count * px_size;
+            if(in + bytes > in_end || out + bytes > out_end) break;
+            memcpy(out, in, bytes);
+            in += bytes;
+            out += bytes;
+        }
+    }
+
+    // A broken stream leaves the rest of the icon transparent instead of garbage
+    if(out < out_end) memset(out, 0, out_end - out);
+}
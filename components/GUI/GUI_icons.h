@@ -0,0 +1,27 @@
+#pragma once
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define GUI_ICONS_MAX   16  // Different icons kept decoded at the same time
+
+/*********************
+ *      FUNCTIONS
+ *********************/
+
+/*
+ * Function:  GUI_icons_init
+ * --------------------
+ *
+ * Register the LVGL image decoder of the RLE compressed icons generated by icons/icon_rle.py.
+ * Each icon is decoded the first time it's drawn and kept on a SPIRAM cache, so switching
+ * between menus doesn't decode it again.
+ *
+ * Returns: Nothing.
+ *
+ */
+void GUI_icons_init(void);
@@ -0,0 +1,141 @@
+/*********************
+ *      LIBRARIES
+ *********************/
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#include "GUI_vlist.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+// Extended data of the list, the lv_list data has to stay the first member.
+typedef struct {
+    lv_list_ext_t list;
+    uint32_t count;     // Number of rows
+    uint32_t first;     // Row shown by the first button
+    uint16_t rows;      // Number of buttons
+    GUI_vlist_text_cb_t text_cb;
+    void * source;
+} GUI_vlist_ext_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t vlist_signal(lv_obj_t * list, lv_signal_t sign, void * param);
+static void vlist_refresh(lv_obj_t * list);
+static void vlist_select(lv_obj_t * list, uint32_t index);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_signal_cb_t ancestor_signal;
+
+/**********************
+*   GLOBAL FUNCTIONS
+**********************/
+
+lv_obj_t * GUI_vlist_create(lv_obj_t * parent, lv_coord_t width, lv_coord_t height, uint32_t count,
+                            GUI_vlist_text_cb_t text_cb, void * source, lv_event_cb_t event_cb){
+    lv_obj_t * list = lv_list_create(parent, NULL);
+    lv_obj_set_size(list, width, height);
+
+    GUI_vlist_ext_t * ext = lv_obj_allocate_ext_attr(list, sizeof(GUI_vlist_ext_t));
+    LV_ASSERT_MEM(ext);
+    if(ext == NULL) return list;
+
+    ext->count = count;
+    ext->first = 0;
+    ext->rows = 0;
+    ext->text_cb = text_cb;
+    ext->source = source;
+
+    if(ancestor_signal == NULL) ancestor_signal = lv_obj_get_signal_cb(list);
+    lv_obj_set_signal_cb(list, vlist_signal);
+
+    // Add buttons until the visible area of the list is full
+    lv_coord_t visible = lv_obj_get_height_fit(list);
+    while(ext->rows < count && ext->rows < UINT16_MAX){
+        lv_obj_t * btn = lv_list_add_btn(list, NULL, text_cb(source, ext->rows));
+        if(ext->rows > 0 && lv_obj_get_y(btn) + lv_obj_get_height(btn) > visible){
+            lv_obj_del(btn);
+            break;
+        }
+        lv_obj_set_event_cb(btn, event_cb);
+        ext->rows++;
+    }
+
+    return list;
+}
+
+uint32_t GUI_vlist_get_selected(const lv_obj_t * list){
+    GUI_vlist_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_obj_t * btn = lv_list_get_btn_selected(list);
+    if(btn == NULL) return ext->first;
+
+    return ext->first + lv_list_get_btn_index(list, btn);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_res_t vlist_signal(lv_obj_t * list, lv_signal_t sign, void * param){
+    if(sign == LV_SIGNAL_CONTROL){
+        GUI_vlist_ext_t * ext = lv_obj_get_ext_attr(list);
+        lv_obj_t * btn = lv_list_get_btn_selected(list);
+        char c = *((char *)param);
+
+        // Without a selected button the list selects the first one
+        if(btn != NULL && ext->rows > 0){
+            uint32_t selected = ext->first + lv_list_get_btn_index(list, btn);
+            uint32_t target;
+
+            if(c == LV_KEY_DOWN) target = selected + 1;
+            else if(c == LV_KEY_UP) target = selected > 0 ? selected - 1 : 0;
+            else if(c == LV_KEY_RIGHT) target = selected + ext->rows;
+            else if(c == LV_KEY_LEFT) target = selected > ext->rows ? selected - ext->rows : 0;
+            else return ancestor_signal(list, sign, param);
+
+            if(target >= ext->count) target = ext->count - 1;
+            vlist_select(list, target);
+            return LV_RES_OK;
+        }
+    }
+
+    return ancestor_signal(list, sign, param);
+}
+
+// Relabel the buttons with the rows of the current window
+static void vlist_refresh(lv_obj_t * list){
+    GUI_vlist_ext_t * ext = lv_obj_get_ext_attr(list);
+    uint32_t index = ext->first;
+
+    lv_obj_t * btn = lv_list_get_next_btn(list, NULL);
+    while(btn != NULL){
+        lv_label_set_text(lv_list_get_btn_label(btn), ext->text_cb(ext->source, index++));
+        btn = lv_list_get_next_btn(list, btn);
+    }
+}
+
+static void vlist_select(lv_obj_t * list, uint32_t index){
+    GUI_vlist_ext_t * ext = lv_obj_get_ext_attr(list);
+
+    // Move the window only when the row isn't already shown
+    uint32_t first = ext->first;
+    if(index < first) first = index;
+    else if(index >= first + ext->rows) first = index - ext->rows + 1;
+
+    if(first != ext->first){
+        ext->first = first;
+        vlist_refresh(list);
+    }
+
+    lv_obj_t * btn = lv_list_get_next_btn(list, NULL);
+    for(uint32_t i = first; i < index && btn != NULL; i++){
+        btn = lv_list_get_next_btn(list, btn);
+    }
+    if(btn != NULL) lv_list_focus_btn(list, btn);
+}
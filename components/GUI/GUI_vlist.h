@@ -0,0 +1,54 @@
+#pragma once
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+
+#include "lvgl.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+// Gives the text of a row, the returned string is copied by the list.
+typedef const char * (*GUI_vlist_text_cb_t)(void * source, uint32_t index);
+
+/*********************
+ *      FUNCTIONS
+ *********************/
+
+/*
+ * Function:  GUI_vlist_create
+ * --------------------
+ *
+ * Create a list that only holds the rows that fit on its area as buttons. When the
+ * selection moves past the first or last visible row the buttons are relabeled with
+ * the next rows instead of creating new ones, so the cost doesn't depend on the number
+ * of rows. Up/Down move one row, Left/Right move one page.
+ *
+ * Arguments:
+ *  -parent: Parent of the list.
+ *  -width: Width of the list.
+ *  -height: Height of the list.
+ *  -count: Number of rows.
+ *  -text_cb: Data source callback giving the text of each row.
+ *  -source: Data passed to text_cb.
+ *  -event_cb: Event callback set to every row button.
+ *
+ * Returns: The list object.
+ *
+ */
+lv_obj_t * GUI_vlist_create(lv_obj_t * parent, lv_coord_t width, lv_coord_t height, uint32_t count,
+                            GUI_vlist_text_cb_t text_cb, void * source, lv_event_cb_t event_cb);
+
+/*
+ * Function:  GUI_vlist_get_selected
+ * --------------------
+ *
+ * Arguments:
+ *  -list: List created with GUI_vlist_create.
+ *
+ * Returns: Index of the selected row.
+ *
+ */
+uint32_t GUI_vlist_get_selected(const lv_obj_t * list);
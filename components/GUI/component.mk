@@ -15,4 +15,16 @@ COMPONENT_SRCDIRS := LVGL/ \
 	LVGL/src/lv_font \
 	.
 
-COMPONENT_ADD_INCLUDEDIRS := $(COMPONENT_SRCDIRS) .
\ No newline at end of file
+COMPONENT_ADD_INCLUDEDIRS := $(COMPONENT_SRCDIRS) .
+# The icons are RLE compressed at build time (icons/icon_rle.py) and decoded by GUI_icons.c
+GUI_ICONS := emulators_icon gameboycolor_icon gameboy_icon nes_icon snes_icon sega_icon \
+	nogame_icon GG_icon ext_application_icon settings_icon
+GUI_ICONS_SRC := $(addprefix $(COMPONENT_PATH)/icons/,$(addsuffix .h,$(GUI_ICONS)))
+
+CFLAGS += -I$(COMPONENT_BUILD_DIR)
+COMPONENT_EXTRA_CLEAN := icons_rle.h
+
+GUI_frontend.o: icons_rle.h
+
+icons_rle.h: $(COMPONENT_PATH)/icons/icon_rle.py $(GUI_ICONS_SRC)
+	$(PYTHON) $(COMPONENT_PATH)/icons/icon_rle.py $@ $(GUI_ICONS_SRC)
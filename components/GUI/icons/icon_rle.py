@@ -0,0 +1,124 @@
+#!/usr/bin/env python
+#
+# Build step of the GUI component: converts the icons exported by the LVGL image
+# converter (C arrays with every color format) into RLE compressed image descriptors.
+# Only the RGB565 swapped format used by the display is kept.
+#
+# Compressed data layout, decoded by GUI_icons.c:
+#   -u8 cf: LVGL color format of the decoded pixels.
+#   -u8 px_size: Bytes per pixel.
+#   -u16 reserved.
+#   -u32 raw_size: Bytes of the decoded image (little endian).
+#   -Packets: a control byte c followed by pixels. If c & 0x80, the next pixel is
+#    repeated (c & 0x7f) + 1 times, otherwise c + 1 pixels are copied as they are.
+#
+# Usage: icon_rle.py output.h icon.h [icon.h ...]
+
+import re
+import struct
+import sys
+
+BLOCK = 'LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0'
+MAX_RUN = 128
+
+# LVGL color formats (lv_img_buf.h)
+CF_SIZE = {
+    'LV_IMG_CF_TRUE_COLOR': (4, 2),
+    'LV_IMG_CF_TRUE_COLOR_ALPHA': (5, 3),
+    'LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED': (6, 2),
+}
+
+
+def parse_icon(path):
+    text = open(path).read()
+
+    name = re.search(r'const\s+lv_img_dsc_t\s+(\w+)\s*=', text).group(1)
+    width = int(re.search(r'\.header\.w\s*=\s*(\d+)', text).group(1))
+    height = int(re.search(r'\.header\.h\s*=\s*(\d+)', text).group(1))
+    cf_name = re.search(r'\.header\.cf\s*=\s*(\w+)', text).group(1)
+
+    start = text.index(BLOCK)
+    start = text.index('\n', start) + 1
+    end = text.index('#endif', start)
+    pixels = bytes(int(b, 16) for b in re.findall(r'0x([0-9a-fA-F]{2})', text[start:end]))
+
+    cf, px_size = CF_SIZE[cf_name]
+    if len(pixels) != width * height * px_size:
+        sys.exit('%s: %d bytes, expected %d' % (path, len(pixels), width * height * px_size))
+
+    return name, width, height, cf, px_size, pixels
+
+
+def rle_encode(pixels, px_size):
+    px = [pixels[i:i + px_size] for i in range(0, len(pixels), px_size)]
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(p)
+
+    i = 0
+    while i < len(px):
+        run = 1
+        while i + run < len(px) and run < MAX_RUN and px[i + run] == px[i]:
+            run += 1
+        # A run of 2 costs the same than 2 literal pixels, keep it as literal
+        if run > 2:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.extend(px[i])
+            i += run
+        else:
+            literal.append(px[i])
+            i += 1
+    flush_literal()
+
+    return bytes(out)
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit('Usage: icon_rle.py output.h icon.h [icon.h ...]')
+
+    lines = [
+        '/* Generated by icons/icon_rle.py, don\'t edit */',
+        '#include "lvgl.h"',
+        '',
+    ]
+    raw_total = 0
+    rle_total = 0
+
+    for path in sys.argv[2:]:
+        name, width, height, cf, px_size, pixels = parse_icon(path)
+        data = struct.pack('<BBHI', cf, px_size, 0, len(pixels)) + rle_encode(pixels, px_size)
+        raw_total += len(pixels)
+        rle_total += len(data)
+
+        lines.append('static const uint8_t %s_rle[%d] = {' % (name, len(data)))
+        for i in range(0, len(data), 16):
+            lines.append('  ' + ', '.join('0x%02x' % b for b in data[i:i + 16]) + ',')
+        lines.append('};')
+        lines.append('')
+        lines.append('const lv_img_dsc_t %s = {' % name)
+        lines.append('  .header.always_zero = 0,')
+        lines.append('  .header.w = %d,' % width)
+        lines.append('  .header.h = %d,' % height)
+        lines.append('  .data_size = %d,' % len(data))
+        lines.append('  .header.cf = LV_IMG_CF_USER_ENCODED_0,')
+        lines.append('  .data = %s_rle,' % name)
+        lines.append('};')
+        lines.append('')
+
+    lines.append('/* %d bytes of pixels compressed to %d bytes */' % (raw_total, rle_total))
+
+    with open(sys.argv[1], 'w') as out:
+        out.write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -3,17 +3,15 @@
  *********************/
 
 #include <math.h>
-#include "unicode.h"
-#include "font_render.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include "glyph_atlas.h"
 #include "display_HAL.h"
 #include "system_configuration.h"
 #include "sin_table.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
-extern const uint8_t ttf_start[] asm("_binary_Ubuntu_R_ttf_start");
-extern const uint8_t ttf_end[] asm("_binary_Ubuntu_R_ttf_end");
-
 /*********************
  *      DEFINES
  *********************/
@@ -27,14 +25,6 @@ extern const uint8_t ttf_end[] asm("_binary_Ubuntu_R_ttf_end");
 #define ST7789_DISPLAY_WIDTH 240
 #define ST7789_DISPLAY_HEIGHT 240
 
-/*********************
- *   STATIC VARIABLES
- *********************/
-
-static font_render_t font_render;
-static font_render_t font_render2;
-static font_face_t font_face;
-
 /*********************
  *   VARIABLES
  *********************/
@@ -67,20 +57,21 @@ typedef struct animation_step {
 *  STATIC PROTOTYPES
 **********************/
 static void randomize_dither_table();
-static void render_text(const char *text, font_render_t *render, uint16_t *buffer, int src_x, int src_y, int y, uint8_t color_r, uint8_t color_g, uint8_t color_b);
-static void draw_gray2_bitmap(uint8_t *src_buf, uint16_t *target_buf, uint8_t r, uint8_t g, uint8_t b, int x, int y, int src_w, int src_h, int target_w, int target_h);
+static void render_text(const char *text, uint16_t *buffer, int src_x, int src_y, int y, uint8_t color_r, uint8_t color_g, uint8_t color_b);
+static void draw_gray2_bitmap(const uint8_t *src_buf, uint16_t *target_buf, uint8_t r, uint8_t g, uint8_t b, int x, int y, int src_w, int src_h, int target_w, int target_h);
 static inline void __attribute__((always_inline)) color_to_rgb(uint16_t color, uint8_t *r, uint8_t *g, uint8_t *b) ;
 static inline uint16_t __attribute__((always_inline)) rgb_to_color_dither(uint8_t r, uint8_t g, uint8_t b, uint16_t x, uint16_t y);
 static inline uint8_t __attribute__((always_inline)) fast_sin(int value);
 static uint16_t rgb_to_color(uint8_t r, uint8_t g, uint8_t b);
 static void plasma_animation(uint16_t * buffer, uint16_t y, draw_event_param_t *param);
+static const glyph_atlas_entry_t *glyph_atlas_find(uint32_t utf_code);
 
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
 
 void boot_screen_free(){
-	font_face_destroy(&font_face);
+	// The glyphs are pre-rasterized on flash (glyph_atlas.h), there is nothing to release
 }
 
 void boot_screen_task(void *arg){
@@ -89,8 +80,6 @@ void boot_screen_task(void *arg){
 	uint16_t * buffer = display_HAL_get_buffer();
 
 	while(1){
-		ESP_ERROR_CHECK(font_face_init(&font_face, ttf_start, ttf_end - ttf_start - 1));
-
 		const draw_element_t complex_text_demo_layers[] = {
 			{plasma_animation, NULL},
 			{NULL, NULL},
@@ -172,7 +161,6 @@ void boot_screen_task(void *arg){
 
 			animation_step++;
 		}
-		font_face_destroy(&font_face);
 	}
 }
 
@@ -182,25 +170,8 @@ void boot_screen_task(void *arg){
 
 static void plasma_animation(uint16_t * buffer, uint16_t y, draw_event_param_t *param){
 
+	// Nothing to prepare, the text glyphs are already rasterized
 	if (y >= DRAW_EVENT_CONTROL) {
-		if (y == DRAW_EVENT_START) {
-			ESP_ERROR_CHECK(font_render_init(&font_render2, &font_face, 30, 48));
-		}
-		else if (y == DRAW_EVENT_END) {
-			font_render_destroy(&font_render2);
-		}
-		else if (y == DRAW_EVENT_FRAME_START) {
-			if (param->frame > 1200 - 240) {
-				uint32_t glyph = 0x21 + ((param->frame >> 5) % 0x5d);
-				ESP_ERROR_CHECK(font_render_init(&font_render, &font_face, (fast_sin(param->frame << 2) >> 1) + 14, 1));
-				font_render_glyph(&font_render, glyph);
-			}
-		}
-		else if (y == DRAW_EVENT_FRAME_END) {
-			if (param->frame > 1200 - 240) {
-				font_render_destroy(&font_render);
-			}
-		}
 		return;
 	}
 
@@ -253,10 +224,10 @@ static void plasma_animation(uint16_t * buffer, uint16_t y, draw_event_param_t *
 	}
 
 	if(frame >= 0 && frame<= 100){
-		render_text("micro", &font_render2, buffer, 50, 100, y, 255, 255, 255);
+		render_text("micro", buffer, 50, 100, y, 255, 255, 255);
 	}
 	if(frame >= 0 && frame<= 100){
-		render_text("BYTE", &font_render2, buffer, 130, 100, y, 255, 255, 255);
+		render_text("BYTE", buffer, 130, 100, y, 255, 255, 255);
 	}
 }
 
@@ -268,22 +239,33 @@ static void randomize_dither_table(){
 	}
 }
 
-static void render_text(const char *text, font_render_t *render, uint16_t *buffer, int src_x, int src_y, int y, uint8_t color_r, uint8_t color_g, uint8_t color_b){
+static const glyph_atlas_entry_t *glyph_atlas_find(uint32_t utf_code){
+	for (size_t i = 0; i < GLYPH_ATLAS_SIZE; ++i){
+		if (glyph_atlas[i].utf_code == utf_code){
+			return &glyph_atlas[i];
+		}
+	}
+	return NULL;
+}
+
+static void render_text(const char *text, uint16_t *buffer, int src_x, int src_y, int y, uint8_t color_r, uint8_t color_g, uint8_t color_b){
 
-	if(src_y - y >= ST7789_BUFFER_SIZE || src_y + (int)render->max_pixel_height - y < 0){
+	if(src_y - y >= ST7789_BUFFER_SIZE || src_y + GLYPH_ATLAS_MAX_PIXEL_HEIGHT - y < 0){
 		return;
 	}
 
 	while(*text){
-		uint32_t glyph;
-		text += u8_decode(&glyph, text);
-		font_render_glyph(render, glyph);
-		draw_gray2_bitmap(render->bitmap, buffer, color_r, color_g, color_b, src_x + render->bitmap_left, render->max_pixel_height - render->origin - render->bitmap_top + src_y - y, render->bitmap_width, render->bitmap_height, 240, ST7789_BUFFER_SIZE);
-		src_x += render->advance;
+		// The atlas only has the characters of the boot text, see tools/glyph_atlas.c
+		const glyph_atlas_entry_t *glyph = glyph_atlas_find((uint8_t)*text++);
+		if (glyph == NULL){
+			continue;
+		}
+		draw_gray2_bitmap(glyph_atlas_bitmap + glyph->offset, buffer, color_r, color_g, color_b, src_x + glyph->bitmap_left, GLYPH_ATLAS_MAX_PIXEL_HEIGHT - GLYPH_ATLAS_ORIGIN - glyph->bitmap_top + src_y - y, glyph->bitmap_width, glyph->bitmap_height, 240, ST7789_BUFFER_SIZE);
+		src_x += glyph->advance;
 	}
 }
 
-static void draw_gray2_bitmap(uint8_t *src_buf, uint16_t *target_buf, uint8_t r, uint8_t g, uint8_t b, int x, int y, int src_w, int src_h, int target_w, int target_h) {
+static void draw_gray2_bitmap(const uint8_t *src_buf, uint16_t *target_buf, uint8_t r, uint8_t g, uint8_t b, int x, int y, int src_w, int src_h, int target_w, int target_h) {
 	if (x >= target_w || y >= target_h || x + src_w <= 0 || y + src_h <= 0){
 		return;
 	}
@@ -2,7 +2,7 @@
  * Function:  boot_screen_task 
  * --------------------
  * 
- * This task performs the font render process and the creation of the plasma animation at the bottom 
+ * This task draws the pre-rasterized boot text (glyph_atlas.h) over the plasma animation at the bottom 
  * of the animation. Once is finish the partial photogram, it sends to the display HAL.
  * 
  * Returns: Nothing
@@ -15,7 +15,7 @@ void boot_screen_task(void *arg);
  * --------------------
  * 
  * When the boot is finished and the boot screen task is eliminated, call this function to relesase
- * the resources reserved by the font converter engine.
+ * the resources of the boot screen. The glyphs are kept on flash, so nowadays there is nothing to free.
  * 
  * Returns: Nothing
  * 
@@ -1,4 +1,3 @@
 COMPONENT_ADD_INCLUDEDIRS := .
 COMPONENT_SRCDIRS := .
-COMPONENT_EMBED_FILES += Ubuntu-R.ttf
 CFLAGS +=  -DIS_LITTLE_ENDIAN
\ No newline at end of file
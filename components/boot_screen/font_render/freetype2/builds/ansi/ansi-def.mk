@@ -1,74 +0,0 @@
-#
-# FreeType 2 configuration rules for a `normal' ANSI system
-#
-
-
-# Copyright 1996-2000, 2003, 2006 by
-# David Turner, Robert Wilhelm, and Werner Lemberg.
-#
-# This file is part of the FreeType project, and may only be used, modified,
-# and distributed under the terms of the FreeType project license,
-# LICENSE.TXT.  By continuing to use, modify, or distribute this file you
-# indicate that you have read the license and understand and accept it
-# fully.
-
-
-DELETE    := rm -f
-CAT       := cat
-SEP       := /
-BUILD_DIR := $(TOP_DIR)/builds/ansi
-PLATFORM  := ansi
-
-
-# The directory where all library files are placed.
-#
-# By default, this is the same as $(OBJ_DIR); however, this can be changed
-# to suit particular needs.
-#
-LIB_DIR := $(OBJ_DIR)
-
-
-# The name of the final library file.  Note that the DOS-specific Makefile
-# uses a shorter (8.3) name.
-#
-LIBRARY := lib$(PROJECT)
-
-
-# Path inclusion flag.  Some compilers use a different flag than `-I' to
-# specify an additional include path.  Examples are `/i=' or `-J'.
-#
-I := -I
-
-
-# C flag used to define a macro before the compilation of a given source
-# object.  Usually it is `-D' like in `-DDEBUG'.
-#
-D := -D
-
-
-# The link flag used to specify a given library file on link.  Note that
-# this is only used to compile the demo programs, not the library itself.
-#
-L := -l
-
-
-# Target flag.
-#
-T := -o$(space)
-
-
-# C flags
-#
-#   These should concern: debug output, optimization & warnings.
-#
-#   Use the ANSIFLAGS variable to define the compiler flags used to enfore
-#   ANSI compliance.
-#
-CFLAGS ?= -c
-
-# ANSIFLAGS: Put there the flags used to make your compiler ANSI-compliant.
-#
-ANSIFLAGS :=
-
-
-# EOF
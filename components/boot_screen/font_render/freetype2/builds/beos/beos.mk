@@ -1,19 +0,0 @@
-#
-# FreeType 2 configuration rules for a BeOS system
-#
-
-# Copyright 1996-2000, 2002, 2005 by
-# David Turner, Robert Wilhelm, and Werner Lemberg.
-#
-# This file is part of the FreeType project, and may only be used, modified,
-# and distributed under the terms of the FreeType project license,
-# LICENSE.TXT.  By continuing to use, modify, or distribute this file you
-# indicate that you have read the license and understand and accept it
-# fully.
-
-include $(TOP_DIR)/builds/beos/beos-def.mk
-include $(TOP_DIR)/builds/compiler/ansi-cc.mk
-include $(TOP_DIR)/builds/link_std.mk
-
-
-# EOF
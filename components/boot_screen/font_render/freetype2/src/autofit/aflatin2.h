@@ -1,39 +0,0 @@
-/***************************************************************************/
-/*                                                                         */
-/*  aflatin2.h                                                             */
-/*                                                                         */
-/*    Auto-fitter hinting routines for latin script (specification).       */
-/*                                                                         */
-/*  Copyright 2003-2007, 2012 by                                           */
-/*  David Turner, Robert Wilhelm, and Werner Lemberg.                      */
-/*                                                                         */
-/*  This file is part of the FreeType project, and may only be used,       */
-/*  modified, and distributed under the terms of the FreeType project      */
-/*  license, LICENSE.TXT.  By continuing to use, modify, or distribute     */
-/*  this file you indicate that you have read the license and              */
-/*  understand and accept it fully.                                        */
-/*                                                                         */
-/***************************************************************************/
-
-
-#ifndef __AFLATIN2_H__
-#define __AFLATIN2_H__
-
-#include "afhints.h"
-
-
-FT_BEGIN_HEADER
-
-
-  /* the latin-specific script class */
-
-  AF_DECLARE_SCRIPT_CLASS( af_latin2_script_class )
-
-/* */
-
-FT_END_HEADER
-
-#endif /* __AFLATIN_H__ */
-
-
-/* END */
@@ -1,46 +0,0 @@
-/***************************************************************************/
-/*                                                                         */
-/*  gxvalid.c                                                              */
-/*                                                                         */
-/*    FreeType validator for TrueTypeGX/AAT tables (body only).            */
-/*                                                                         */
-/*  Copyright 2005 by suzuki toshiya, Masatake YAMATO, Red Hat K.K.,       */
-/*  David Turner, Robert Wilhelm, and Werner Lemberg.                      */
-/*                                                                         */
-/*  This file is part of the FreeType project, and may only be used,       */
-/*  modified, and distributed under the terms of the FreeType project      */
-/*  license, LICENSE.TXT.  By continuing to use, modify, or distribute     */
-/*  this file you indicate that you have read the license and              */
-/*  understand and accept it fully.                                        */
-/*                                                                         */
-/***************************************************************************/
-
-#define FT_MAKE_OPTION_SINGLE_OBJECT
-
-#include <ft2build.h>
-
-#include "gxvfeat.c"
-#include "gxvcommn.c"
-#include "gxvbsln.c"
-#include "gxvtrak.c"
-#include "gxvjust.c"
-#include "gxvmort.c"
-#include "gxvmort0.c"
-#include "gxvmort1.c"
-#include "gxvmort2.c"
-#include "gxvmort4.c"
-#include "gxvmort5.c"
-#include "gxvmorx.c"
-#include "gxvmorx0.c"
-#include "gxvmorx1.c"
-#include "gxvmorx2.c"
-#include "gxvmorx4.c"
-#include "gxvmorx5.c"
-#include "gxvkern.c"
-#include "gxvopbd.c"
-#include "gxvprop.c"
-#include "gxvlcar.c"
-#include "gxvmod.c"
-
-
-/* END */
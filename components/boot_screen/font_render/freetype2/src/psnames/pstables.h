@@ -1,4170 +0,0 @@
-/***************************************************************************/
-/*                                                                         */
-/*  pstables.h                                                             */
-/*                                                                         */
-/*    PostScript glyph names.                                              */
-/*                                                                         */
-/*  Copyright 2005, 2008, 2011 by                                          */
-/*  David Turner, Robert Wilhelm, and Werner Lemberg.                      */
-/*                                                                         */
-/*  This file is part of the FreeType project, and may only be used,       */
-/*  modified, and distributed under the terms of the FreeType project      */
-/*  license, LICENSE.TXT.  By continuing to use, modify, or distribute     */
-/*  this file you indicate that you have read the license and              */
-/*  understand and accept it fully.                                        */
-/*                                                                         */
-/***************************************************************************/
-
-
-  /* This file has been generated automatically -- do not edit! */
-
-
-  static const char  ft_standard_glyph_names[3696] =
-  {
-    '.','n','u','l','l', 0,
-    'n','o','n','m','a','r','k','i','n','g','r','e','t','u','r','n', 0,
-    'n','o','t','e','q','u','a','l', 0,
-    'i','n','f','i','n','i','t','y', 0,
-    'l','e','s','s','e','q','u','a','l', 0,
-    'g','r','e','a','t','e','r','e','q','u','a','l', 0,
-    'p','a','r','t','i','a','l','d','i','f','f', 0,
-    's','u','m','m','a','t','i','o','n', 0,
-    'p','r','o','d','u','c','t', 0,
-    'p','i', 0,
-    'i','n','t','e','g','r','a','l', 0,
-    'O','m','e','g','a', 0,
-    'r','a','d','i','c','a','l', 0,
-    'a','p','p','r','o','x','e','q','u','a','l', 0,
-    'D','e','l','t','a', 0,
-    'n','o','n','b','r','e','a','k','i','n','g','s','p','a','c','e', 0,
-    'l','o','z','e','n','g','e', 0,
-    'a','p','p','l','e', 0,
-    'f','r','a','n','c', 0,
-    'G','b','r','e','v','e', 0,
-    'g','b','r','e','v','e', 0,
-    'I','d','o','t','a','c','c','e','n','t', 0,
-    'S','c','e','d','i','l','l','a', 0,
-    's','c','e','d','i','l','l','a', 0,
-    'C','a','c','u','t','e', 0,
-    'c','a','c','u','t','e', 0,
-    'C','c','a','r','o','n', 0,
-    'c','c','a','r','o','n', 0,
-    'd','c','r','o','a','t', 0,
-    '.','n','o','t','d','e','f', 0,
-    's','p','a','c','e', 0,
-    'e','x','c','l','a','m', 0,
-    'q','u','o','t','e','d','b','l', 0,
-    'n','u','m','b','e','r','s','i','g','n', 0,
-    'd','o','l','l','a','r', 0,
-    'p','e','r','c','e','n','t', 0,
-    'a','m','p','e','r','s','a','n','d', 0,
-    'q','u','o','t','e','r','i','g','h','t', 0,
-    'p','a','r','e','n','l','e','f','t', 0,
-    'p','a','r','e','n','r','i','g','h','t', 0,
-    'a','s','t','e','r','i','s','k', 0,
-    'p','l','u','s', 0,
-    'c','o','m','m','a', 0,
-    'h','y','p','h','e','n', 0,
-    'p','e','r','i','o','d', 0,
-    's','l','a','s','h', 0,
-    'z','e','r','o', 0,
-    'o','n','e', 0,
-    't','w','o', 0,
-    't','h','r','e','e', 0,
-    'f','o','u','r', 0,
-    'f','i','v','e', 0,
-    's','i','x', 0,
-    's','e','v','e','n', 0,
-    'e','i','g','h','t', 0,
-    'n','i','n','e', 0,
-    'c','o','l','o','n', 0,
-    's','e','m','i','c','o','l','o','n', 0,
-    'l','e','s','s', 0,
-    'e','q','u','a','l', 0,
-    'g','r','e','a','t','e','r', 0,
-    'q','u','e','s','t','i','o','n', 0,
-    'a','t', 0,
-    'A', 0,
-    'B', 0,
-    'C', 0,
-    'D', 0,
-    'E', 0,
-    'F', 0,
-    'G', 0,
-    'H', 0,
-    'I', 0,
-    'J', 0,
-    'K', 0,
-    'L', 0,
-    'M', 0,
-    'N', 0,
-    'O', 0,
-    'P', 0,
-    'Q', 0,
-    'R', 0,
-    'S', 0,
-    'T', 0,
-    'U', 0,
-    'V', 0,
-    'W', 0,
-    'X', 0,
-    'Y', 0,
-    'Z', 0,
-    'b','r','a','c','k','e','t','l','e','f','t', 0,
-    'b','a','c','k','s','l','a','s','h', 0,
-    'b','r','a','c','k','e','t','r','i','g','h','t', 0,
-    'a','s','c','i','i','c','i','r','c','u','m', 0,
-    'u','n','d','e','r','s','c','o','r','e', 0,
-    'q','u','o','t','e','l','e','f','t', 0,
-    'a', 0,
-    'b', 0,
-    'c', 0,
-    'd', 0,
-    'e', 0,
-    'f', 0,
-    'g', 0,
-    'h', 0,
-    'i', 0,
-    'j', 0,
-    'k', 0,
-    'l', 0,
-    'm', 0,
-    'n', 0,
-    'o', 0,
-    'p', 0,
-    'q', 0,
-    'r', 0,
-    's', 0,
-    't', 0,
-    'u', 0,
-    'v', 0,
-    'w', 0,
-    'x', 0,
-    'y', 0,
-    'z', 0,
-    'b','r','a','c','e','l','e','f','t', 0,
-    'b','a','r', 0,
-    'b','r','a','c','e','r','i','g','h','t', 0,
-    'a','s','c','i','i','t','i','l','d','e', 0,
-    'e','x','c','l','a','m','d','o','w','n', 0,
-    'c','e','n','t', 0,
-    's','t','e','r','l','i','n','g', 0,
-    'f','r','a','c','t','i','o','n', 0,
-    'y','e','n', 0,
-    'f','l','o','r','i','n', 0,
-    's','e','c','t','i','o','n', 0,
-    'c','u','r','r','e','n','c','y', 0,
-    'q','u','o','t','e','s','i','n','g','l','e', 0,
-    'q','u','o','t','e','d','b','l','l','e','f','t', 0,
-    'g','u','i','l','l','e','m','o','t','l','e','f','t', 0,
-    'g','u','i','l','s','i','n','g','l','l','e','f','t', 0,
-    'g','u','i','l','s','i','n','g','l','r','i','g','h','t', 0,
-    'f','i', 0,
-    'f','l', 0,
-    'e','n','d','a','s','h', 0,
-    'd','a','g','g','e','r', 0,
-    'd','a','g','g','e','r','d','b','l', 0,
-    'p','e','r','i','o','d','c','e','n','t','e','r','e','d', 0,
-    'p','a','r','a','g','r','a','p','h', 0,
-    'b','u','l','l','e','t', 0,
-    'q','u','o','t','e','s','i','n','g','l','b','a','s','e', 0,
-    'q','u','o','t','e','d','b','l','b','a','s','e', 0,
-    'q','u','o','t','e','d','b','l','r','i','g','h','t', 0,
-    'g','u','i','l','l','e','m','o','t','r','i','g','h','t', 0,
-    'e','l','l','i','p','s','i','s', 0,
-    'p','e','r','t','h','o','u','s','a','n','d', 0,
-    'q','u','e','s','t','i','o','n','d','o','w','n', 0,
-    'g','r','a','v','e', 0,
-    'a','c','u','t','e', 0,
-    'c','i','r','c','u','m','f','l','e','x', 0,
-    't','i','l','d','e', 0,
-    'm','a','c','r','o','n', 0,
-    'b','r','e','v','e', 0,
-    'd','o','t','a','c','c','e','n','t', 0,
-    'd','i','e','r','e','s','i','s', 0,
-    'r','i','n','g', 0,
-    'c','e','d','i','l','l','a', 0,
-    'h','u','n','g','a','r','u','m','l','a','u','t', 0,
-    'o','g','o','n','e','k', 0,
-    'c','a','r','o','n', 0,
-    'e','m','d','a','s','h', 0,
-    'A','E', 0,
-    'o','r','d','f','e','m','i','n','i','n','e', 0,
-    'L','s','l','a','s','h', 0,
-    'O','s','l','a','s','h', 0,
-    'O','E', 0,
-    'o','r','d','m','a','s','c','u','l','i','n','e', 0,
-    'a','e', 0,
-    'd','o','t','l','e','s','s','i', 0,
-    'l','s','l','a','s','h', 0,
-    'o','s','l','a','s','h', 0,
-    'o','e', 0,
-    'g','e','r','m','a','n','d','b','l','s', 0,
-    'o','n','e','s','u','p','e','r','i','o','r', 0,
-    'l','o','g','i','c','a','l','n','o','t', 0,
-    'm','u', 0,
-    't','r','a','d','e','m','a','r','k', 0,
-    'E','t','h', 0,
-    'o','n','e','h','a','l','f', 0,
-    'p','l','u','s','m','i','n','u','s', 0,
-    'T','h','o','r','n', 0,
-    'o','n','e','q','u','a','r','t','e','r', 0,
-    'd','i','v','i','d','e', 0,
-    'b','r','o','k','e','n','b','a','r', 0,
-    'd','e','g','r','e','e', 0,
-    't','h','o','r','n', 0,
-    't','h','r','e','e','q','u','a','r','t','e','r','s', 0,
-    't','w','o','s','u','p','e','r','i','o','r', 0,
-    'r','e','g','i','s','t','e','r','e','d', 0,
-    'm','i','n','u','s', 0,
-    'e','t','h', 0,
-    'm','u','l','t','i','p','l','y', 0,
-    't','h','r','e','e','s','u','p','e','r','i','o','r', 0,
-    'c','o','p','y','r','i','g','h','t', 0,
-    'A','a','c','u','t','e', 0,
-    'A','c','i','r','c','u','m','f','l','e','x', 0,
-    'A','d','i','e','r','e','s','i','s', 0,
-    'A','g','r','a','v','e', 0,
-    'A','r','i','n','g', 0,
-    'A','t','i','l','d','e', 0,
-    'C','c','e','d','i','l','l','a', 0,
-    'E','a','c','u','t','e', 0,
-    'E','c','i','r','c','u','m','f','l','e','x', 0,
-    'E','d','i','e','r','e','s','i','s', 0,
-    'E','g','r','a','v','e', 0,
-    'I','a','c','u','t','e', 0,
-    'I','c','i','r','c','u','m','f','l','e','x', 0,
-    'I','d','i','e','r','e','s','i','s', 0,
-    'I','g','r','a','v','e', 0,
-    'N','t','i','l','d','e', 0,
-    'O','a','c','u','t','e', 0,
-    'O','c','i','r','c','u','m','f','l','e','x', 0,
-    'O','d','i','e','r','e','s','i','s', 0,
-    'O','g','r','a','v','e', 0,
-    'O','t','i','l','d','e', 0,
-    'S','c','a','r','o','n', 0,
-    'U','a','c','u','t','e', 0,
-    'U','c','i','r','c','u','m','f','l','e','x', 0,
-    'U','d','i','e','r','e','s','i','s', 0,
-    'U','g','r','a','v','e', 0,
-    'Y','a','c','u','t','e', 0,
-    'Y','d','i','e','r','e','s','i','s', 0,
-    'Z','c','a','r','o','n', 0,
-    'a','a','c','u','t','e', 0,
-    'a','c','i','r','c','u','m','f','l','e','x', 0,
-    'a','d','i','e','r','e','s','i','s', 0,
-    'a','g','r','a','v','e', 0,
-    'a','r','i','n','g', 0,
-    'a','t','i','l','d','e', 0,
-    'c','c','e','d','i','l','l','a', 0,
-    'e','a','c','u','t','e', 0,
-    'e','c','i','r','c','u','m','f','l','e','x', 0,
-    'e','d','i','e','r','e','s','i','s', 0,
-    'e','g','r','a','v','e', 0,
-    'i','a','c','u','t','e', 0,
-    'i','c','i','r','c','u','m','f','l','e','x', 0,
-    'i','d','i','e','r','e','s','i','s', 0,
-    'i','g','r','a','v','e', 0,
-    'n','t','i','l','d','e', 0,
-    'o','a','c','u','t','e', 0,
-    'o','c','i','r','c','u','m','f','l','e','x', 0,
-    'o','d','i','e','r','e','s','i','s', 0,
-    'o','g','r','a','v','e', 0,
-    'o','t','i','l','d','e', 0,
-    's','c','a','r','o','n', 0,
-    'u','a','c','u','t','e', 0,
-    'u','c','i','r','c','u','m','f','l','e','x', 0,
-    'u','d','i','e','r','e','s','i','s', 0,
-    'u','g','r','a','v','e', 0,
-    'y','a','c','u','t','e', 0,
-    'y','d','i','e','r','e','s','i','s', 0,
-    'z','c','a','r','o','n', 0,
-    'e','x','c','l','a','m','s','m','a','l','l', 0,
-    'H','u','n','g','a','r','u','m','l','a','u','t','s','m','a','l','l', 0,
-    'd','o','l','l','a','r','o','l','d','s','t','y','l','e', 0,
-    'd','o','l','l','a','r','s','u','p','e','r','i','o','r', 0,
-    'a','m','p','e','r','s','a','n','d','s','m','a','l','l', 0,
-    'A','c','u','t','e','s','m','a','l','l', 0,
-    'p','a','r','e','n','l','e','f','t','s','u','p','e','r','i','o','r', 0,
-    'p','a','r','e','n','r','i','g','h','t','s','u','p','e','r','i','o','r', 0,
-    't','w','o','d','o','t','e','n','l','e','a','d','e','r', 0,
-    'o','n','e','d','o','t','e','n','l','e','a','d','e','r', 0,
-    'z','e','r','o','o','l','d','s','t','y','l','e', 0,
-    'o','n','e','o','l','d','s','t','y','l','e', 0,
-    't','w','o','o','l','d','s','t','y','l','e', 0,
-    't','h','r','e','e','o','l','d','s','t','y','l','e', 0,
-    'f','o','u','r','o','l','d','s','t','y','l','e', 0,
-    'f','i','v','e','o','l','d','s','t','y','l','e', 0,
-    's','i','x','o','l','d','s','t','y','l','e', 0,
-    's','e','v','e','n','o','l','d','s','t','y','l','e', 0,
-    'e','i','g','h','t','o','l','d','s','t','y','l','e', 0,
-    'n','i','n','e','o','l','d','s','t','y','l','e', 0,
-    'c','o','m','m','a','s','u','p','e','r','i','o','r', 0,
-    't','h','r','e','e','q','u','a','r','t','e','r','s','e','m','d','a','s','h', 0,
-    'p','e','r','i','o','d','s','u','p','e','r','i','o','r', 0,
-    'q','u','e','s','t','i','o','n','s','m','a','l','l', 0,
-    'a','s','u','p','e','r','i','o','r', 0,
-    'b','s','u','p','e','r','i','o','r', 0,
-    'c','e','n','t','s','u','p','e','r','i','o','r', 0,
-    'd','s','u','p','e','r','i','o','r', 0,
-    'e','s','u','p','e','r','i','o','r', 0,
-    'i','s','u','p','e','r','i','o','r', 0,
-    'l','s','u','p','e','r','i','o','r', 0,
-    'm','s','u','p','e','r','i','o','r', 0,
-    'n','s','u','p','e','r','i','o','r', 0,
-    'o','s','u','p','e','r','i','o','r', 0,
-    'r','s','u','p','e','r','i','o','r', 0,
-    's','s','u','p','e','r','i','o','r', 0,
-    't','s','u','p','e','r','i','o','r', 0,
-    'f','f', 0,
-    'f','f','i', 0,
-    'f','f','l', 0,
-    'p','a','r','e','n','l','e','f','t','i','n','f','e','r','i','o','r', 0,
-    'p','a','r','e','n','r','i','g','h','t','i','n','f','e','r','i','o','r', 0,
-    'C','i','r','c','u','m','f','l','e','x','s','m','a','l','l', 0,
-    'h','y','p','h','e','n','s','u','p','e','r','i','o','r', 0,
-    'G','r','a','v','e','s','m','a','l','l', 0,
-    'A','s','m','a','l','l', 0,
-    'B','s','m','a','l','l', 0,
-    'C','s','m','a','l','l', 0,
-    'D','s','m','a','l','l', 0,
-    'E','s','m','a','l','l', 0,
-    'F','s','m','a','l','l', 0,
-    'G','s','m','a','l','l', 0,
-    'H','s','m','a','l','l', 0,
-    'I','s','m','a','l','l', 0,
-    'J','s','m','a','l','l', 0,
-    'K','s','m','a','l','l', 0,
-    'L','s','m','a','l','l', 0,
-    'M','s','m','a','l','l', 0,
-    'N','s','m','a','l','l', 0,
-    'O','s','m','a','l','l', 0,
-    'P','s','m','a','l','l', 0,
-    'Q','s','m','a','l','l', 0,
-    'R','s','m','a','l','l', 0,
-    'S','s','m','a','l','l', 0,
-    'T','s','m','a','l','l', 0,
-    'U','s','m','a','l','l', 0,
-    'V','s','m','a','l','l', 0,
-    'W','s','m','a','l','l', 0,
-    'X','s','m','a','l','l', 0,
-    'Y','s','m','a','l','l', 0,
-    'Z','s','m','a','l','l', 0,
-    'c','o','l','o','n','m','o','n','e','t','a','r','y', 0,
-    'o','n','e','f','i','t','t','e','d', 0,
-    'r','u','p','i','a','h', 0,
-    'T','i','l','d','e','s','m','a','l','l', 0,
-    'e','x','c','l','a','m','d','o','w','n','s','m','a','l','l', 0,
-    'c','e','n','t','o','l','d','s','t','y','l','e', 0,
-    'L','s','l','a','s','h','s','m','a','l','l', 0,
-    'S','c','a','r','o','n','s','m','a','l','l', 0,
-    'Z','c','a','r','o','n','s','m','a','l','l', 0,
-    'D','i','e','r','e','s','i','s','s','m','a','l','l', 0,
-    'B','r','e','v','e','s','m','a','l','l', 0,
-    'C','a','r','o','n','s','m','a','l','l', 0,
-    'D','o','t','a','c','c','e','n','t','s','m','a','l','l', 0,
-    'M','a','c','r','o','n','s','m','a','l','l', 0,
-    'f','i','g','u','r','e','d','a','s','h', 0,
-    'h','y','p','h','e','n','i','n','f','e','r','i','o','r', 0,
-    'O','g','o','n','e','k','s','m','a','l','l', 0,
-    'R','i','n','g','s','m','a','l','l', 0,
-    'C','e','d','i','l','l','a','s','m','a','l','l', 0,
-    'q','u','e','s','t','i','o','n','d','o','w','n','s','m','a','l','l', 0,
-    'o','n','e','e','i','g','h','t','h', 0,
-    't','h','r','e','e','e','i','g','h','t','h','s', 0,
-    'f','i','v','e','e','i','g','h','t','h','s', 0,
-    's','e','v','e','n','e','i','g','h','t','h','s', 0,
-    'o','n','e','t','h','i','r','d', 0,
-    't','w','o','t','h','i','r','d','s', 0,
-    'z','e','r','o','s','u','p','e','r','i','o','r', 0,
-    'f','o','u','r','s','u','p','e','r','i','o','r', 0,
-    'f','i','v','e','s','u','p','e','r','i','o','r', 0,
-    's','i','x','s','u','p','e','r','i','o','r', 0,
-    's','e','v','e','n','s','u','p','e','r','i','o','r', 0,
-    'e','i','g','h','t','s','u','p','e','r','i','o','r', 0,
-    'n','i','n','e','s','u','p','e','r','i','o','r', 0,
-    'z','e','r','o','i','n','f','e','r','i','o','r', 0,
-    'o','n','e','i','n','f','e','r','i','o','r', 0,
-    't','w','o','i','n','f','e','r','i','o','r', 0,
-    't','h','r','e','e','i','n','f','e','r','i','o','r', 0,
-    'f','o','u','r','i','n','f','e','r','i','o','r', 0,
-    'f','i','v','e','i','n','f','e','r','i','o','r', 0,
-    's','i','x','i','n','f','e','r','i','o','r', 0,
-    's','e','v','e','n','i','n','f','e','r','i','o','r', 0,
-    'e','i','g','h','t','i','n','f','e','r','i','o','r', 0,
-    'n','i','n','e','i','n','f','e','r','i','o','r', 0,
-    'c','e','n','t','i','n','f','e','r','i','o','r', 0,
-    'd','o','l','l','a','r','i','n','f','e','r','i','o','r', 0,
-    'p','e','r','i','o','d','i','n','f','e','r','i','o','r', 0,
-    'c','o','m','m','a','i','n','f','e','r','i','o','r', 0,
-    'A','g','r','a','v','e','s','m','a','l','l', 0,
-    'A','a','c','u','t','e','s','m','a','l','l', 0,
-    'A','c','i','r','c','u','m','f','l','e','x','s','m','a','l','l', 0,
-    'A','t','i','l','d','e','s','m','a','l','l', 0,
-    'A','d','i','e','r','e','s','i','s','s','m','a','l','l', 0,
-    'A','r','i','n','g','s','m','a','l','l', 0,
-    'A','E','s','m','a','l','l', 0,
-    'C','c','e','d','i','l','l','a','s','m','a','l','l', 0,
-    'E','g','r','a','v','e','s','m','a','l','l', 0,
-    'E','a','c','u','t','e','s','m','a','l','l', 0,
-    'E','c','i','r','c','u','m','f','l','e','x','s','m','a','l','l', 0,
-    'E','d','i','e','r','e','s','i','s','s','m','a','l','l', 0,
-    'I','g','r','a','v','e','s','m','a','l','l', 0,
-    'I','a','c','u','t','e','s','m','a','l','l', 0,
-    'I','c','i','r','c','u','m','f','l','e','x','s','m','a','l','l', 0,
-    'I','d','i','e','r','e','s','i','s','s','m','a','l','l', 0,
-    'E','t','h','s','m','a','l','l', 0,
-    'N','t','i','l','d','e','s','m','a','l','l', 0,
-    'O','g','r','a','v','e','s','m','a','l','l', 0,
-    'O','a','c','u','t','e','s','m','a','l','l', 0,
-    'O','c','i','r','c','u','m','f','l','e','x','s','m','a','l','l', 0,
-    'O','t','i','l','d','e','s','m','a','l','l', 0,
-    'O','d','i','e','r','e','s','i','s','s','m','a','l','l', 0,
-    'O','E','s','m','a','l','l', 0,
-    'O','s','l','a','s','h','s','m','a','l','l', 0,
-    'U','g','r','a','v','e','s','m','a','l','l', 0,
-    'U','a','c','u','t','e','s','m','a','l','l', 0,
-    'U','c','i','r','c','u','m','f','l','e','x','s','m','a','l','l', 0,
-    'U','d','i','e','r','e','s','i','s','s','m','a','l','l', 0,
-    'Y','a','c','u','t','e','s','m','a','l','l', 0,
-    'T','h','o','r','n','s','m','a','l','l', 0,
-    'Y','d','i','e','r','e','s','i','s','s','m','a','l','l', 0,
-    '0','0','1','.','0','0','0', 0,
-    '0','0','1','.','0','0','1', 0,
-    '0','0','1','.','0','0','2', 0,
-    '0','0','1','.','0','0','3', 0,
-    'B','l','a','c','k', 0,
-    'B','o','l','d', 0,
-    'B','o','o','k', 0,
-    'L','i','g','h','t', 0,
-    'M','e','d','i','u','m', 0,
-    'R','e','g','u','l','a','r', 0,
-    'R','o','m','a','n', 0,
-    'S','e','m','i','b','o','l','d', 0,
-  };
-
-
-#define FT_NUM_MAC_NAMES  258
-
-  /* Values are offsets into the `ft_standard_glyph_names' table */
-
-  static const short  ft_mac_names[FT_NUM_MAC_NAMES] =
-  {
-     253,   0,   6, 261, 267, 274, 283, 294, 301, 309, 758, 330, 340, 351,
-     360, 365, 371, 378, 385, 391, 396, 400, 404, 410, 415, 420, 424, 430,
-     436, 441, 447, 457, 462, 468, 476, 485, 488, 490, 492, 494, 496, 498,
-     500, 502, 504, 506, 508, 510, 512, 514, 516, 518, 520, 522, 524, 526,
-     528, 530, 532, 534, 536, 538, 540, 552, 562, 575, 587, 979, 608, 610,
-     612, 614, 616, 618, 620, 622, 624, 626, 628, 630, 632, 634, 636, 638,
-     640, 642, 644, 646, 648, 650, 652, 654, 656, 658, 660, 670, 674, 685,
-    1375,1392,1405,1414,1486,1512,1562,1603,1632,1610,1622,1645,1639,1652,
-    1661,1690,1668,1680,1697,1726,1704,1716,1733,1740,1769,1747,1759,1776,
-    1790,1819,1797,1809, 839,1263, 707, 712, 741, 881, 871,1160,1302,1346,
-    1197, 985,1031,  23,1086,1108,  32,1219,  41,  51, 730,1194,  64,  76,
-      86,  94,  97,1089,1118, 106,1131,1150, 966, 696,1183, 112, 734, 120,
-     132, 783, 930, 945, 138,1385,1398,1529,1115,1157, 832,1079, 770, 916,
-     598, 319,1246, 155,1833,1586, 721, 749, 797, 811, 826, 829, 846, 856,
-     888, 903, 954,1363,1421,1356,1433,1443,1450,1457,1469,1479,1493,1500,
-     163,1522,1543,1550,1572,1134, 991,1002,1008,1015,1021,1040,1045,1053,
-    1066,1073,1101,1143,1536,1783,1596,1843,1253,1207,1319,1579,1826,1229,
-    1270,1313,1323,1171,1290,1332,1211,1235,1276, 169, 175, 182, 189, 200,
-     209, 218, 225, 232, 239, 246
-  };
-
-
-#define FT_NUM_SID_NAMES  391
-
-  /* Values are offsets into the `ft_standard_glyph_names' table */
-
-  static const short  ft_sid_names[FT_NUM_SID_NAMES] =
-  {
-     253, 261, 267, 274, 283, 294, 301, 309, 319, 330, 340, 351, 360, 365,
-     371, 378, 385, 391, 396, 400, 404, 410, 415, 420, 424, 430, 436, 441,
-     447, 457, 462, 468, 476, 485, 488, 490, 492, 494, 496, 498, 500, 502,
-     504, 506, 508, 510, 512, 514, 516, 518, 520, 522, 524, 526, 528, 530,
-     532, 534, 536, 538, 540, 552, 562, 575, 587, 598, 608, 610, 612, 614,
-     616, 618, 620, 622, 624, 626, 628, 630, 632, 634, 636, 638, 640, 642,
-     644, 646, 648, 650, 652, 654, 656, 658, 660, 670, 674, 685, 696, 707,
-     712, 721, 730, 734, 741, 749, 758, 770, 783, 797, 811, 826, 829, 832,
-     839, 846, 856, 871, 881, 888, 903, 916, 930, 945, 954, 966, 979, 985,
-     991,1002,1008,1015,1021,1031,1040,1045,1053,1066,1073,1079,1086,1089,
-    1101,1108,1115,1118,1131,1134,1143,1150,1157,1160,1171,1183,1194,1197,
-    1207,1211,1219,1229,1235,1246,1253,1263,1270,1276,1290,1302,1313,1319,
-    1323,1332,1346,1356,1363,1375,1385,1392,1398,1405,1414,1421,1433,1443,
-    1450,1457,1469,1479,1486,1493,1500,1512,1522,1529,1536,1543,1550,1562,
-    1572,1579,1586,1596,1603,1610,1622,1632,1639,1645,1652,1661,1668,1680,
-    1690,1697,1704,1716,1726,1733,1740,1747,1759,1769,1776,1783,1790,1797,
-    1809,1819,1826,1833,1843,1850,1862,1880,1895,1910,1925,1936,1954,1973,
-    1988,2003,2016,2028,2040,2054,2067,2080,2092,2106,2120,2133,2147,2167,
-    2182,2196,2206,2216,2229,2239,2249,2259,2269,2279,2289,2299,2309,2319,
-    2329,2332,2336,2340,2358,2377,2393,2408,2419,2426,2433,2440,2447,2454,
-    2461,2468,2475,2482,2489,2496,2503,2510,2517,2524,2531,2538,2545,2552,
-    2559,2566,2573,2580,2587,2594,2601,2615,2625,2632,2643,2659,2672,2684,
-    2696,2708,2722,2733,2744,2759,2771,2782,2797,2809,2819,2832,2850,2860,
-    2873,2885,2898,2907,2917,2930,2943,2956,2968,2982,2996,3009,3022,3034,
-    3046,3060,3073,3086,3098,3112,3126,3139,3152,3167,3182,3196,3208,3220,
-    3237,3249,3264,3275,3283,3297,3309,3321,3338,3353,3365,3377,3394,3409,
-    3418,3430,3442,3454,3471,3483,3498,3506,3518,3530,3542,3559,3574,3586,
-    3597,3612,3620,3628,3636,3644,3650,3655,3660,3666,3673,3681,3687
-  };
-
-
-  /* the following are indices into the SID name table */
-  static const unsigned short  t1_standard_encoding[256] =
-  {
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16,
-     17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
-     33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
-     49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
-     65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
-     81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0, 96, 97, 98, 99,100,101,102,103,104,105,106,107,108,109,110,
-      0,111,112,113,114,  0,115,116,117,118,119,120,121,122,  0,123,
-      0,124,125,126,127,128,129,130,131,  0,132,133,  0,134,135,136,
-    137,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,138,  0,139,  0,  0,  0,  0,140,141,142,143,  0,  0,  0,  0,
-      0,144,  0,  0,  0,145,  0,  0,146,147,148,149,  0,  0,  0,  0
-  };
-
-
-  /* the following are indices into the SID name table */
-  static const unsigned short  t1_expert_encoding[256] =
-  {
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      1,229,230,  0,231,232,233,234,235,236,237,238, 13, 14, 15, 99,
-    239,240,241,242,243,244,245,246,247,248, 27, 28,249,250,251,252,
-      0,253,254,255,256,257,  0,  0,  0,258,  0,  0,259,260,261,262,
-      0,  0,263,264,265,  0,266,109,110,267,268,269,  0,270,271,272,
-    273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,
-    289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,304,305,306,  0,  0,307,308,309,310,311,  0,312,  0,  0,313,
-      0,  0,314,315,  0,  0,316,317,318,  0,  0,  0,158,155,163,319,
-    320,321,322,323,324,325,  0,  0,326,150,164,169,327,328,329,330,
-    331,332,333,334,335,336,337,338,339,340,341,342,343,344,345,346,
-    347,348,349,350,351,352,353,354,355,356,357,358,359,360,361,362,
-    363,364,365,366,367,368,369,370,371,372,373,374,375,376,377,378
-  };
-
-
-  /*
-   *  This table is a compressed version of the Adobe Glyph List (AGL),
-   *  optimized for efficient searching.  It has been generated by the
-   *  `glnames.py' python script located in the `src/tools' directory.
-   *
-   *  The lookup function to get the Unicode value for a given string
-   *  is defined below the table.
-   */
-
-#ifdef FT_CONFIG_OPTION_ADOBE_GLYPH_LIST
-
-  static const unsigned char  ft_adobe_glyph_list[55997L] =
-  {
-      0, 52,  0,106,  2,167,  3, 63,  4,220,  6,125,  9,143, 10, 23,
-     11,137, 12,199, 14,246, 15, 87, 16,233, 17,219, 18,104, 19, 88,
-     22,110, 23, 32, 23, 71, 24, 77, 27,156, 29, 73, 31,247, 32,107,
-     32,222, 33, 55, 34,154, 35,218, 58, 10, 64,122, 72,188, 80,109,
-     88,104, 93, 61, 98,168,106, 91,114,111,115,237,122,180,127,255,
-    135,164,143,132,149,213,158,108,161,115,168,175,183,147,197,199,
-    202, 25,204,166,208,209,209, 81,215, 26, 65,143,  0, 65,  0,140,
-      0,175,  0,193,  1, 15,  1,147,  1,233,  1,251,  2,  7,  2, 40,
-      2, 57,  2, 82,  2, 91,  2,128,  2,136,  2,154, 69,131,  0,198,
-      0,150,  0,158,  0,167,225,227,245,244,101,128,  1,252,237,225,
-    227,242,239,110,128,  1,226,243,237,225,236,108,128,247,230,225,
-    227,245,244,101,129,  0,193,  0,185,243,237,225,236,108,128,247,
-    225,226,242,229,246,101,134,  1,  2,  0,213,  0,221,  0,232,  0,
-    243,  0,251,  1,  7,225,227,245,244,101,128, 30,174,227,249,242,
-    233,236,236,233, 99,128,  4,208,228,239,244,226,229,236,239,119,
-    128, 30,182,231,242,225,246,101,128, 30,176,232,239,239,235,225,
-    226,239,246,101,128, 30,178,244,233,236,228,101,128, 30,180, 99,
-      4,  1, 25,  1, 32,  1,121,  1,137,225,242,239,110,128,  1,205,
-    233,242, 99,  2,  1, 40,  1, 45,236,101,128, 36,182,245,237,230,
-    236,229,120,134,  0,194,  1, 66,  1, 74,  1, 85,  1, 93,  1,105,
-      1,113,225,227,245,244,101,128, 30,164,228,239,244,226,229,236,
-    239,119,128, 30,172,231,242,225,246,101,128, 30,166,232,239,239,
-    235,225,226,239,246,101,128, 30,168,243,237,225,236,108,128,247,
-    226,244,233,236,228,101,128, 30,170,245,244,101,129,246,201,  1,
-    129,243,237,225,236,108,128,247,180,249,242,233,236,236,233, 99,
-    128,  4, 16,100,  3,  1,155,  1,165,  1,209,226,236,231,242,225,
-    246,101,128,  2,  0,233,229,242,229,243,233,115,131,  0,196,  1,
-    181,  1,192,  1,201,227,249,242,233,236,236,233, 99,128,  4,210,
-    237,225,227,242,239,110,128,  1,222,243,237,225,236,108,128,247,
-    228,239,116,  2,  1,216,  1,224,226,229,236,239,119,128, 30,160,
-    237,225,227,242,239,110,128,  1,224,231,242,225,246,101,129,  0,
-    192,  1,243,243,237,225,236,108,128,247,224,232,239,239,235,225,
-    226,239,246,101,128, 30,162,105,  2,  2, 13,  2, 25,229,227,249,
-    242,233,236,236,233, 99,128,  4,212,238,246,229,242,244,229,228,
-    226,242,229,246,101,128,  2,  2,236,240,232, 97,129,  3,145,  2,
-     49,244,239,238,239,115,128,  3,134,109,  2,  2, 63,  2, 71,225,
-    227,242,239,110,128,  1,  0,239,238,239,243,240,225,227,101,128,
-    255, 33,239,231,239,238,229,107,128,  1,  4,242,233,238,103,131,
-      0,197,  2,104,  2,112,  2,120,225,227,245,244,101,128,  1,250,
-    226,229,236,239,119,128, 30,  0,243,237,225,236,108,128,247,229,
-    243,237,225,236,108,128,247, 97,244,233,236,228,101,129,  0,195,
-      2,146,243,237,225,236,108,128,247,227,249,226,225,242,237,229,
-    238,233,225,110,128,  5, 49, 66,137,  0, 66,  2,189,  2,198,  2,
-    223,  3,  3,  3, 10,  3, 22,  3, 34,  3, 46,  3, 54,227,233,242,
-    227,236,101,128, 36,183,228,239,116,  2,  2,206,  2,215,225,227,
-    227,229,238,116,128, 30,  2,226,229,236,239,119,128, 30,  4,101,
-      3,  2,231,  2,242,  2,254,227,249,242,233,236,236,233, 99,128,
-      4, 17,238,225,242,237,229,238,233,225,110,128,  5, 50,244, 97,
-    128,  3,146,232,239,239,107,128,  1,129,236,233,238,229,226,229,
-    236,239,119,128, 30,  6,237,239,238,239,243,240,225,227,101,128,
-    255, 34,242,229,246,229,243,237,225,236,108,128,246,244,243,237,
-    225,236,108,128,247, 98,244,239,240,226,225,114,128,  1,130, 67,
-    137,  0, 67,  3, 85,  3,127,  3,193,  3,210,  3,224,  4,171,  4,
-    188,  4,200,  4,212, 97,  3,  3, 93,  3,104,  3,111,225,242,237,
-    229,238,233,225,110,128,  5, 62,227,245,244,101,128,  1,  6,242,
-    239,110,129,246,202,  3,119,243,237,225,236,108,128,246,245, 99,
-      3,  3,135,  3,142,  3,171,225,242,239,110,128,  1, 12,229,228,
-    233,236,236, 97,130,  0,199,  3,155,  3,163,225,227,245,244,101,
-    128, 30,  8,243,237,225,236,108,128,247,231,233,242, 99,  2,  3,
-    179,  3,184,236,101,128, 36,184,245,237,230,236,229,120,128,  1,
-      8,228,239,116,129,  1, 10,  3,201,225,227,227,229,238,116,128,
-      1, 10,229,228,233,236,236,225,243,237,225,236,108,128,247,184,
-    104,  4,  3,234,  3,246,  4,161,  4,165,225,225,242,237,229,238,
-    233,225,110,128,  5, 73,101,  6,  4,  4,  4, 24,  4, 35,  4,103,
-      4,115,  4,136,225,226,235,232,225,243,233,225,238,227,249,242,
-    233,236,236,233, 99,128,  4,188,227,249,242,233,236,236,233, 99,
-    128,  4, 39,100,  2,  4, 41,  4, 85,229,243,227,229,238,228,229,
-    114,  2,  4, 54,  4, 74,225,226,235,232,225,243,233,225,238,227,
-    249,242,233,236,236,233, 99,128,  4,190,227,249,242,233,236,236,
-    233, 99,128,  4,182,233,229,242,229,243,233,243,227,249,242,233,
-    236,236,233, 99,128,  4,244,232,225,242,237,229,238,233,225,110,
-    128,  5, 67,235,232,225,235,225,243,243,233,225,238,227,249,242,
-    233,236,236,233, 99,128,  4,203,246,229,242,244,233,227,225,236,
-    243,244,242,239,235,229,227,249,242,233,236,236,233, 99,128,  4,
-    184,105,128,  3,167,239,239,107,128,  1,135,233,242,227,245,237,
-    230,236,229,248,243,237,225,236,108,128,246,246,237,239,238,239,
-    243,240,225,227,101,128,255, 35,239,225,242,237,229,238,233,225,
-    110,128,  5, 81,243,237,225,236,108,128,247, 99, 68,142,  0, 68,
-      4,252,  5, 10,  5, 36,  5, 96,  5,121,  5,166,  5,173,  5,231,
-      5,244,  6,  0,  6, 12,  6, 28,  6, 48,  6, 57, 90,129,  1,241,
-      5,  2,227,225,242,239,110,128,  1,196, 97,  2,  5, 16,  5, 27,
-    225,242,237,229,238,233,225,110,128,  5, 52,230,242,233,227,225,
-    110,128,  1,137, 99,  4,  5, 46,  5, 53,  5, 62,  5, 89,225,242,
-    239,110,128,  1, 14,229,228,233,236,236, 97,128, 30, 16,233,242,
-     99,  2,  5, 70,  5, 75,236,101,128, 36,185,245,237,230,236,229,
-    248,226,229,236,239,119,128, 30, 18,242,239,225,116,128,  1, 16,
-    228,239,116,  2,  5,104,  5,113,225,227,227,229,238,116,128, 30,
-     10,226,229,236,239,119,128, 30, 12,101,  3,  5,129,  5,140,  5,
-    150,227,249,242,233,236,236,233, 99,128,  4, 20,233,227,239,240,
-    244,233, 99,128,  3,238,236,244, 97,129, 34,  6,  5,158,231,242,
-    229,229,107,128,  3,148,232,239,239,107,128,  1,138,105,  2,  5,
-    179,  5,218,229,242,229,243,233,115,131,246,203,  5,194,  5,202,
-      5,210,193,227,245,244,101,128,246,204,199,242,225,246,101,128,
-    246,205,243,237,225,236,108,128,247,168,231,225,237,237,225,231,
-    242,229,229,107,128,  3,220,234,229,227,249,242,233,236,236,233,
-     99,128,  4,  2,236,233,238,229,226,229,236,239,119,128, 30, 14,
-    237,239,238,239,243,240,225,227,101,128,255, 36,239,244,225,227,
-    227,229,238,244,243,237,225,236,108,128,246,247,115,  2,  6, 34,
-      6, 41,236,225,243,104,128,  1, 16,237,225,236,108,128,247,100,
-    244,239,240,226,225,114,128,  1,139,122,131,  1,242,  6, 67,  6,
-     75,  6,112,227,225,242,239,110,128,  1,197,101,  2,  6, 81,  6,
-    101,225,226,235,232,225,243,233,225,238,227,249,242,233,236,236,
-    233, 99,128,  4,224,227,249,242,233,236,236,233, 99,128,  4,  5,
-    232,229,227,249,242,233,236,236,233, 99,128,  4, 15, 69,146,  0,
-     69,  6,165,  6,183,  6,191,  7, 89,  7,153,  7,165,  7,183,  7,
-    211,  8,  7,  8, 36,  8, 94,  8,169,  8,189,  8,208,  8,248,  9,
-     44,  9,109,  9,115,225,227,245,244,101,129,  0,201,  6,175,243,
-    237,225,236,108,128,247,233,226,242,229,246,101,128,  1, 20, 99,
-      5,  6,203,  6,210,  6,224,  6,236,  7, 79,225,242,239,110,128,
-      1, 26,229,228,233,236,236,225,226,242,229,246,101,128, 30, 28,
-    232,225,242,237,229,238,233,225,110,128,  5, 53,233,242, 99,  2,
-      6,244,  6,249,236,101,128, 36,186,245,237,230,236,229,120,135,
-      0,202,  7, 16,  7, 24,  7, 32,  7, 43,  7, 51,  7, 63,  7, 71,
-    225,227,245,244,101,128, 30,190,226,229,236,239,119,128, 30, 24,
-    228,239,244,226,229,236,239,119,128, 30,198,231,242,225,246,101,
-    128, 30,192,232,239,239,235,225,226,239,246,101,128, 30,194,243,
-    237,225,236,108,128,247,234,244,233,236,228,101,128, 30,196,249,
-    242,233,236,236,233, 99,128,  4,  4,100,  3,  7, 97,  7,107,  7,
-    127,226,236,231,242,225,246,101,128,  2,  4,233,229,242,229,243,
-    233,115,129,  0,203,  7,119,243,237,225,236,108,128,247,235,239,
-    116,130,  1, 22,  7,136,  7,145,225,227,227,229,238,116,128,  1,
-     22,226,229,236,239,119,128, 30,184,230,227,249,242,233,236,236,
-    233, 99,128,  4, 36,231,242,225,246,101,129,  0,200,  7,175,243,
-    237,225,236,108,128,247,232,104,  2,  7,189,  7,200,225,242,237,
-    229,238,233,225,110,128,  5, 55,239,239,235,225,226,239,246,101,
-    128, 30,186,105,  3,  7,219,  7,230,  7,245,231,232,244,242,239,
-    237,225,110,128, 33,103,238,246,229,242,244,229,228,226,242,229,
-    246,101,128,  2,  6,239,244,233,230,233,229,228,227,249,242,233,
-    236,236,233, 99,128,  4,100,108,  2,  8, 13,  8, 24,227,249,242,
-    233,236,236,233, 99,128,  4, 27,229,246,229,238,242,239,237,225,
-    110,128, 33,106,109,  3,  8, 44,  8, 72,  8, 83,225,227,242,239,
-    110,130,  1, 18,  8, 56,  8, 64,225,227,245,244,101,128, 30, 22,
-    231,242,225,246,101,128, 30, 20,227,249,242,233,236,236,233, 99,
-    128,  4, 28,239,238,239,243,240,225,227,101,128,255, 37,110,  4,
-      8,104,  8,115,  8,135,  8,154,227,249,242,233,236,236,233, 99,
-    128,  4, 29,228,229,243,227,229,238,228,229,242,227,249,242,233,
-    236,236,233, 99,128,  4,162,103,129,  1, 74,  8,141,232,229,227,
-    249,242,233,236,236,233, 99,128,  4,164,232,239,239,235,227,249,
-    242,233,236,236,233, 99,128,  4,199,111,  2,  8,175,  8,183,231,
-    239,238,229,107,128,  1, 24,240,229,110,128,  1,144,240,243,233,
-    236,239,110,129,  3,149,  8,200,244,239,238,239,115,128,  3,136,
-    114,  2,  8,214,  8,225,227,249,242,233,236,236,233, 99,128,  4,
-     32,229,246,229,242,243,229,100,129,  1,142,  8,237,227,249,242,
-    233,236,236,233, 99,128,  4, 45,115,  4,  9,  2,  9, 13,  9, 33,
-      9, 37,227,249,242,233,236,236,233, 99,128,  4, 33,228,229,243,
-    227,229,238,228,229,242,227,249,242,233,236,236,233, 99,128,  4,
-    170,104,128,  1,169,237,225,236,108,128,247,101,116,  3,  9, 52,
-      9, 78,  9, 92, 97,130,  3,151,  9, 60,  9, 70,242,237,229,238,
-    233,225,110,128,  5, 56,244,239,238,239,115,128,  3,137,104,129,
-      0,208,  9, 84,243,237,225,236,108,128,247,240,233,236,228,101,
-    129, 30,188,  9,101,226,229,236,239,119,128, 30, 26,245,242,111,
-    128, 32,172,250,104,130,  1,183,  9,124,  9,132,227,225,242,239,
-    110,128,  1,238,242,229,246,229,242,243,229,100,128,  1,184, 70,
-    136,  0, 70,  9,163,  9,172,  9,184,  9,212,  9,219,  9,248, 10,
-      4, 10, 15,227,233,242,227,236,101,128, 36,187,228,239,244,225,
-    227,227,229,238,116,128, 30, 30,101,  2,  9,190,  9,202,232,225,
-    242,237,229,238,233,225,110,128,  5, 86,233,227,239,240,244,233,
-     99,128,  3,228,232,239,239,107,128,  1,145,105,  2,  9,225,  9,
-    238,244,225,227,249,242,233,236,236,233, 99,128,  4,114,246,229,
-    242,239,237,225,110,128, 33,100,237,239,238,239,243,240,225,227,
-    101,128,255, 38,239,245,242,242,239,237,225,110,128, 33, 99,243,
-    237,225,236,108,128,247,102, 71,140,  0, 71, 10, 51, 10, 61, 10,
-    107, 10,115, 10,176, 10,193, 10,205, 11, 39, 11, 52, 11, 65, 11,
-     90, 11,107,194,243,241,245,225,242,101,128, 51,135, 97,  3, 10,
-     69, 10, 76, 10, 94,227,245,244,101,128,  1,244,237,237, 97,129,
-      3,147, 10, 84,225,230,242,233,227,225,110,128,  1,148,238,231,
-    233,225,227,239,240,244,233, 99,128,  3,234,226,242,229,246,101,
-    128,  1, 30, 99,  4, 10,125, 10,132, 10,141, 10,163,225,242,239,
-    110,128,  1,230,229,228,233,236,236, 97,128,  1, 34,233,242, 99,
-      2, 10,149, 10,154,236,101,128, 36,188,245,237,230,236,229,120,
-    128,  1, 28,239,237,237,225,225,227,227,229,238,116,128,  1, 34,
-    228,239,116,129,  1, 32, 10,184,225,227,227,229,238,116,128,  1,
-     32,229,227,249,242,233,236,236,233, 99,128,  4, 19,104,  3, 10,
-    213, 10,226, 11, 33,225,228,225,242,237,229,238,233,225,110,128,
-      5, 66,101,  3, 10,234, 10,255, 11, 16,237,233,228,228,236,229,
-    232,239,239,235,227,249,242,233,236,236,233, 99,128,  4,148,243,
-    244,242,239,235,229,227,249,242,233,236,236,233, 99,128,  4,146,
-    245,240,244,245,242,238,227,249,242,233,236,236,233, 99,128,  4,
-    144,239,239,107,128,  1,147,233,237,225,242,237,229,238,233,225,
-    110,128,  5, 51,234,229,227,249,242,233,236,236,233, 99,128,  4,
-      3,109,  2, 11, 71, 11, 79,225,227,242,239,110,128, 30, 32,239,
-    238,239,243,240,225,227,101,128,255, 39,242,225,246,101,129,246,
-    206, 11, 99,243,237,225,236,108,128,247, 96,115,  2, 11,113, 11,
-    129,237,225,236,108,129,247,103, 11,122,232,239,239,107,128,  2,
-    155,244,242,239,235,101,128,  1,228, 72,140,  0, 72, 11,165, 11,
-    190, 11,198, 11,208, 12, 17, 12, 40, 12, 77, 12,117, 12,129, 12,
-    157, 12,165, 12,189,177,184, 53,  3, 11,175, 11,180, 11,185,179,
-     51,128, 37,207,180, 51,128, 37,170,181, 49,128, 37,171,178,178,
-    176,183, 51,128, 37,161,208,243,241,245,225,242,101,128, 51,203,
-     97,  3, 11,216, 11,236, 12,  0,225,226,235,232,225,243,233,225,
-    238,227,249,242,233,236,236,233, 99,128,  4,168,228,229,243,227,
-    229,238,228,229,242,227,249,242,233,236,236,233, 99,128,  4,178,
-    242,228,243,233,231,238,227,249,242,233,236,236,233, 99,128,  4,
-     42, 98,  2, 12, 23, 12, 28,225,114,128,  1, 38,242,229,246,229,
-    226,229,236,239,119,128, 30, 42, 99,  2, 12, 46, 12, 55,229,228,
-    233,236,236, 97,128, 30, 40,233,242, 99,  2, 12, 63, 12, 68,236,
-    101,128, 36,189,245,237,230,236,229,120,128,  1, 36,100,  2, 12,
-     83, 12, 93,233,229,242,229,243,233,115,128, 30, 38,239,116,  2,
-     12,100, 12,109,225,227,227,229,238,116,128, 30, 34,226,229,236,
-    239,119,128, 30, 36,237,239,238,239,243,240,225,227,101,128,255,
-     40,111,  2, 12,135, 12,146,225,242,237,229,238,233,225,110,128,
-      5, 64,242,233,227,239,240,244,233, 99,128,  3,232,243,237,225,
-    236,108,128,247,104,245,238,231,225,242,245,237,236,225,245,116,
-    129,246,207, 12,181,243,237,225,236,108,128,246,248,250,243,241,
-    245,225,242,101,128, 51,144, 73,146,  0, 73, 12,239, 12,251, 12,
-    255, 13, 11, 13, 29, 13, 37, 13, 94, 13,181, 13,214, 13,224, 13,
-    242, 13,254, 14, 48, 14, 86, 14, 99, 14,166, 14,187, 14,205,193,
-    227,249,242,233,236,236,233, 99,128,  4, 47, 74,128,  1, 50,213,
-    227,249,242,233,236,236,233, 99,128,  4, 46,225,227,245,244,101,
-    129,  0,205, 13, 21,243,237,225,236,108,128,247,237,226,242,229,
-    246,101,128,  1, 44, 99,  3, 13, 45, 13, 52, 13, 84,225,242,239,
-    110,128,  1,207,233,242, 99,  2, 13, 60, 13, 65,236,101,128, 36,
-    190,245,237,230,236,229,120,129,  0,206, 13, 76,243,237,225,236,
-    108,128,247,238,249,242,233,236,236,233, 99,128,  4,  6,100,  3,
-     13,102, 13,112, 13,155,226,236,231,242,225,246,101,128,  2,  8,
-    233,229,242,229,243,233,115,131,  0,207, 13,128, 13,136, 13,147,
-    225,227,245,244,101,128, 30, 46,227,249,242,233,236,236,233, 99,
-    128,  4,228,243,237,225,236,108,128,247,239,239,116,130,  1, 48,
-     13,164, 13,173,225,227,227,229,238,116,128,  1, 48,226,229,236,
-    239,119,128, 30,202,101,  2, 13,187, 13,203,226,242,229,246,229,
-    227,249,242,233,236,236,233, 99,128,  4,214,227,249,242,233,236,
-    236,233, 99,128,  4, 21,230,242,225,235,244,245,114,128, 33, 17,
-    231,242,225,246,101,129,  0,204, 13,234,243,237,225,236,108,128,
-    247,236,232,239,239,235,225,226,239,246,101,128, 30,200,105,  3,
-     14,  6, 14, 17, 14, 32,227,249,242,233,236,236,233, 99,128,  4,
-     24,238,246,229,242,244,229,228,226,242,229,246,101,128,  2, 10,
-    243,232,239,242,244,227,249,242,233,236,236,233, 99,128,  4, 25,
-    109,  2, 14, 54, 14, 75,225,227,242,239,110,129,  1, 42, 14, 64,
-    227,249,242,233,236,236,233, 99,128,  4,226,239,238,239,243,240,
-    225,227,101,128,255, 41,238,233,225,242,237,229,238,233,225,110,
-    128,  5, 59,111,  3, 14,107, 14,118, 14,126,227,249,242,233,236,
-    236,233, 99,128,  4,  1,231,239,238,229,107,128,  1, 46,244, 97,
-    131,  3,153, 14,137, 14,147, 14,158,225,230,242,233,227,225,110,
-    128,  1,150,228,233,229,242,229,243,233,115,128,  3,170,244,239,
-    238,239,115,128,  3,138,115,  2, 14,172, 14,179,237,225,236,108,
-    128,247,105,244,242,239,235,101,128,  1,151,244,233,236,228,101,
-    129,  1, 40, 14,197,226,229,236,239,119,128, 30, 44,250,232,233,
-    244,243, 97,  2, 14,216, 14,227,227,249,242,233,236,236,233, 99,
-    128,  4,116,228,226,236,231,242,225,246,229,227,249,242,233,236,
-    236,233, 99,128,  4,118, 74,134,  0, 74, 15,  6, 15, 18, 15, 41,
-     15, 53, 15, 67, 15, 79,225,225,242,237,229,238,233,225,110,128,
-      5, 65,227,233,242, 99,  2, 15, 27, 15, 32,236,101,128, 36,191,
-    245,237,230,236,229,120,128,  1, 52,229,227,249,242,233,236,236,
-    233, 99,128,  4,  8,232,229,232,225,242,237,229,238,233,225,110,
-    128,  5, 75,237,239,238,239,243,240,225,227,101,128,255, 42,243,
-    237,225,236,108,128,247,106, 75,140,  0, 75, 15,115, 15,125, 15,
-    135, 16, 18, 16, 65, 16, 76, 16,106, 16,143, 16,156, 16,168, 16,
-    180, 16,208,194,243,241,245,225,242,101,128, 51,133,203,243,241,
-    245,225,242,101,128, 51,205, 97,  7, 15,151, 15,169, 15,191, 15,
-    211, 15,226, 15,232, 15,249,226,225,243,232,235,233,242,227,249,
-    242,233,236,236,233, 99,128,  4,160, 99,  2, 15,175, 15,181,245,
-    244,101,128, 30, 48,249,242,233,236,236,233, 99,128,  4, 26,228,
-    229,243,227,229,238,228,229,242,227,249,242,233,236,236,233, 99,
-    128,  4,154,232,239,239,235,227,249,242,233,236,236,233, 99,128,
-      4,195,240,240, 97,128,  3,154,243,244,242,239,235,229,227,249,
-    242,233,236,236,233, 99,128,  4,158,246,229,242,244,233,227,225,
-    236,243,244,242,239,235,229,227,249,242,233,236,236,233, 99,128,
-      4,156, 99,  4, 16, 28, 16, 35, 16, 44, 16, 52,225,242,239,110,
-    128,  1,232,229,228,233,236,236, 97,128,  1, 54,233,242,227,236,
-    101,128, 36,192,239,237,237,225,225,227,227,229,238,116,128,  1,
-     54,228,239,244,226,229,236,239,119,128, 30, 50,101,  2, 16, 82,
-     16, 94,232,225,242,237,229,238,233,225,110,128,  5, 84,238,225,
-    242,237,229,238,233,225,110,128,  5, 63,104,  3, 16,114, 16,126,
-     16,137,225,227,249,242,233,236,236,233, 99,128,  4, 37,229,233,
-    227,239,240,244,233, 99,128,  3,230,239,239,107,128,  1,152,234,
-    229,227,249,242,233,236,236,233, 99,128,  4, 12,236,233,238,229,
-    226,229,236,239,119,128, 30, 52,237,239,238,239,243,240,225,227,
-    101,128,255, 43,239,240,240, 97,  2, 16,189, 16,200,227,249,242,
-    233,236,236,233, 99,128,  4,128,231,242,229,229,107,128,  3,222,
-    115,  2, 16,214, 16,226,233,227,249,242,233,236,236,233, 99,128,
-      4,110,237,225,236,108,128,247,107, 76,138,  0, 76, 17,  1, 17,
-      5, 17,  9, 17, 29, 17, 95, 17,133, 17,147, 17,165, 17,177, 17,
-    189, 74,128,  1,199, 76,128,246,191, 97,  2, 17, 15, 17, 22,227,
-    245,244,101,128,  1, 57,237,226,228, 97,128,  3,155, 99,  4, 17,
-     39, 17, 46, 17, 55, 17, 82,225,242,239,110,128,  1, 61,229,228,
-    233,236,236, 97,128,  1, 59,233,242, 99,  2, 17, 63, 17, 68,236,
-    101,128, 36,193,245,237,230,236,229,248,226,229,236,239,119,128,
-     30, 60,239,237,237,225,225,227,227,229,238,116,128,  1, 59,228,
-    239,116,130,  1, 63, 17,105, 17,114,225,227,227,229,238,116,128,
-      1, 63,226,229,236,239,119,129, 30, 54, 17,124,237,225,227,242,
-    239,110,128, 30, 56,233,247,238,225,242,237,229,238,233,225,110,
-    128,  5, 60,106,129,  1,200, 17,153,229,227,249,242,233,236,236,
-    233, 99,128,  4,  9,236,233,238,229,226,229,236,239,119,128, 30,
-     58,237,239,238,239,243,240,225,227,101,128,255, 44,115,  2, 17,
-    195, 17,212,236,225,243,104,129,  1, 65, 17,204,243,237,225,236,
-    108,128,246,249,237,225,236,108,128,247,108, 77,137,  0, 77, 17,
-    241, 17,251, 18, 24, 18, 33, 18, 58, 18, 71, 18, 83, 18, 91, 18,
-    100,194,243,241,245,225,242,101,128, 51,134,225, 99,  2, 18,  2,
-     18, 18,242,239,110,129,246,208, 18, 10,243,237,225,236,108,128,
-    247,175,245,244,101,128, 30, 62,227,233,242,227,236,101,128, 36,
-    194,228,239,116,  2, 18, 41, 18, 50,225,227,227,229,238,116,128,
-     30, 64,226,229,236,239,119,128, 30, 66,229,238,225,242,237,229,
-    238,233,225,110,128,  5, 68,237,239,238,239,243,240,225,227,101,
-    128,255, 45,243,237,225,236,108,128,247,109,244,245,242,238,229,
-    100,128,  1,156,117,128,  3,156, 78,141,  0, 78, 18,134, 18,138,
-     18,146, 18,212, 18,237, 18,248, 19,  3, 19, 21, 19, 33, 19, 45,
-     19, 58, 19, 66, 19, 84, 74,128,  1,202,225,227,245,244,101,128,
-      1, 67, 99,  4, 18,156, 18,163, 18,172, 18,199,225,242,239,110,
-    128,  1, 71,229,228,233,236,236, 97,128,  1, 69,233,242, 99,  2,
-     18,180, 18,185,236,101,128, 36,195,245,237,230,236,229,248,226,
-    229,236,239,119,128, 30, 74,239,237,237,225,225,227,227,229,238,
-    116,128,  1, 69,228,239,116,  2, 18,220, 18,229,225,227,227,229,
-    238,116,128, 30, 68,226,229,236,239,119,128, 30, 70,232,239,239,
-    235,236,229,230,116,128,  1,157,233,238,229,242,239,237,225,110,
-    128, 33,104,106,129,  1,203, 19,  9,229,227,249,242,233,236,236,
-    233, 99,128,  4, 10,236,233,238,229,226,229,236,239,119,128, 30,
-     72,237,239,238,239,243,240,225,227,101,128,255, 46,239,247,225,
-    242,237,229,238,233,225,110,128,  5, 70,243,237,225,236,108,128,
-    247,110,244,233,236,228,101,129,  0,209, 19, 76,243,237,225,236,
-    108,128,247,241,117,128,  3,157, 79,141,  0, 79, 19,118, 19,132,
-     19,150, 19,203, 20, 78, 20,152, 20,187, 21, 48, 21, 69, 21,213,
-     21,223, 21,254, 22, 53, 69,129,  1, 82, 19,124,243,237,225,236,
-    108,128,246,250,225,227,245,244,101,129,  0,211, 19,142,243,237,
-    225,236,108,128,247,243, 98,  2, 19,156, 19,196,225,242,242,229,
-    100,  2, 19,166, 19,177,227,249,242,233,236,236,233, 99,128,  4,
-    232,228,233,229,242,229,243,233,243,227,249,242,233,236,236,233,
-     99,128,  4,234,242,229,246,101,128,  1, 78, 99,  4, 19,213, 19,
-    220, 19,235, 20, 68,225,242,239,110,128,  1,209,229,238,244,229,
-    242,229,228,244,233,236,228,101,128,  1,159,233,242, 99,  2, 19,
-    243, 19,248,236,101,128, 36,196,245,237,230,236,229,120,134,  0,
-    212, 20, 13, 20, 21, 20, 32, 20, 40, 20, 52, 20, 60,225,227,245,
-    244,101,128, 30,208,228,239,244,226,229,236,239,119,128, 30,216,
-    231,242,225,246,101,128, 30,210,232,239,239,235,225,226,239,246,
-    101,128, 30,212,243,237,225,236,108,128,247,244,244,233,236,228,
-    101,128, 30,214,249,242,233,236,236,233, 99,128,  4, 30,100,  3,
-     20, 86, 20,109, 20,142,226,108,  2, 20, 93, 20,101,225,227,245,
-    244,101,128,  1, 80,231,242,225,246,101,128,  2, 12,233,229,242,
-    229,243,233,115,130,  0,214, 20,123, 20,134,227,249,242,233,236,
-    236,233, 99,128,  4,230,243,237,225,236,108,128,247,246,239,244,
-    226,229,236,239,119,128, 30,204,103,  2, 20,158, 20,170,239,238,
-    229,235,243,237,225,236,108,128,246,251,242,225,246,101,129,  0,
-    210, 20,179,243,237,225,236,108,128,247,242,104,  4, 20,197, 20,
-    208, 20,212, 21, 34,225,242,237,229,238,233,225,110,128,  5, 85,
-    109,128, 33, 38,111,  2, 20,218, 20,228,239,235,225,226,239,246,
-    101,128, 30,206,242,110,133,  1,160, 20,243, 20,251, 21,  6, 21,
-     14, 21, 26,225,227,245,244,101,128, 30,218,228,239,244,226,229,
-    236,239,119,128, 30,226,231,242,225,246,101,128, 30,220,232,239,
-    239,235,225,226,239,246,101,128, 30,222,244,233,236,228,101,128,
-     30,224,245,238,231,225,242,245,237,236,225,245,116,128,  1, 80,
-    105,129,  1,162, 21, 54,238,246,229,242,244,229,228,226,242,229,
-    246,101,128,  2, 14,109,  4, 21, 79, 21,107, 21,184, 21,202,225,
-    227,242,239,110,130,  1, 76, 21, 91, 21, 99,225,227,245,244,101,
-    128, 30, 82,231,242,225,246,101,128, 30, 80,229,231, 97,132, 33,
-     38, 21,121, 21,132, 21,140, 21,156,227,249,242,233,236,236,233,
-     99,128,  4, 96,231,242,229,229,107,128,  3,169,242,239,245,238,
-    228,227,249,242,233,236,236,233, 99,128,  4,122,116,  2, 21,162,
-     21,177,233,244,236,239,227,249,242,233,236,236,233, 99,128,  4,
-    124,239,238,239,115,128,  3,143,233,227,242,239,110,129,  3,159,
-     21,194,244,239,238,239,115,128,  3,140,239,238,239,243,240,225,
-    227,101,128,255, 47,238,229,242,239,237,225,110,128, 33, 96,111,
-      2, 21,229, 21,248,231,239,238,229,107,129,  1,234, 21,239,237,
-    225,227,242,239,110,128,  1,236,240,229,110,128,  1,134,115,  3,
-     22,  6, 22, 33, 22, 40,236,225,243,104,130,  0,216, 22, 17, 22,
-     25,225,227,245,244,101,128,  1,254,243,237,225,236,108,128,247,
-    248,237,225,236,108,128,247,111,244,242,239,235,229,225,227,245,
-    244,101,128,  1,254,116,  2, 22, 59, 22, 70,227,249,242,233,236,
-    236,233, 99,128,  4,126,233,236,228,101,131,  0,213, 22, 83, 22,
-     91, 22,102,225,227,245,244,101,128, 30, 76,228,233,229,242,229,
-    243,233,115,128, 30, 78,243,237,225,236,108,128,247,245, 80,136,
-      0, 80, 22,130, 22,138, 22,147, 22,159, 22,211, 22,227, 22,246,
-     23,  2,225,227,245,244,101,128, 30, 84,227,233,242,227,236,101,
-    128, 36,197,228,239,244,225,227,227,229,238,116,128, 30, 86,101,
-      3, 22,167, 22,178, 22,190,227,249,242,233,236,236,233, 99,128,
-      4, 31,232,225,242,237,229,238,233,225,110,128,  5, 74,237,233,
-    228,228,236,229,232,239,239,235,227,249,242,233,236,236,233, 99,
-    128,  4,166,104,  2, 22,217, 22,221,105,128,  3,166,239,239,107,
-    128,  1,164,105,129,  3,160, 22,233,247,242,225,242,237,229,238,
-    233,225,110,128,  5, 83,237,239,238,239,243,240,225,227,101,128,
-    255, 48,115,  2, 23,  8, 23, 25,105,129,  3,168, 23, 14,227,249,
-    242,233,236,236,233, 99,128,  4,112,237,225,236,108,128,247,112,
-     81,131,  0, 81, 23, 42, 23, 51, 23, 63,227,233,242,227,236,101,
-    128, 36,198,237,239,238,239,243,240,225,227,101,128,255, 49,243,
-    237,225,236,108,128,247,113, 82,138,  0, 82, 23, 95, 23,119, 23,
-    166, 23,217, 23,230, 23,240, 23,245, 24, 19, 24, 31, 24, 43, 97,
-      2, 23,101, 23,112,225,242,237,229,238,233,225,110,128,  5, 76,
-    227,245,244,101,128,  1, 84, 99,  4, 23,129, 23,136, 23,145, 23,
-    153,225,242,239,110,128,  1, 88,229,228,233,236,236, 97,128,  1,
-     86,233,242,227,236,101,128, 36,199,239,237,237,225,225,227,227,
-    229,238,116,128,  1, 86,100,  2, 23,172, 23,182,226,236,231,242,
-    225,246,101,128,  2, 16,239,116,  2, 23,189, 23,198,225,227,227,
-    229,238,116,128, 30, 88,226,229,236,239,119,129, 30, 90, 23,208,
-    237,225,227,242,239,110,128, 30, 92,229,232,225,242,237,229,238,
-    233,225,110,128,  5, 80,230,242,225,235,244,245,114,128, 33, 28,
-    232,111,128,  3,161,233,110,  2, 23,252, 24,  5,231,243,237,225,
-    236,108,128,246,252,246,229,242,244,229,228,226,242,229,246,101,
-    128,  2, 18,236,233,238,229,226,229,236,239,119,128, 30, 94,237,
-    239,238,239,243,240,225,227,101,128,255, 50,243,237,225,236,108,
-    129,247,114, 24, 53,233,238,246,229,242,244,229,100,129,  2,129,
-     24, 66,243,245,240,229,242,233,239,114,128,  2,182, 83,139,  0,
-     83, 24,103, 26, 17, 26, 55, 26,182, 26,221, 26,250, 27, 84, 27,
-    105, 27,117, 27,135, 27,143, 70,  6, 24,117, 24,209, 24,241, 25,
-     77, 25,119, 25,221, 48,  9, 24,137, 24,145, 24,153, 24,161, 24,
-    169, 24,177, 24,185, 24,193, 24,201,177,176,176,176, 48,128, 37,
-     12,178,176,176,176, 48,128, 37, 20,179,176,176,176, 48,128, 37,
-     16,180,176,176,176, 48,128, 37, 24,181,176,176,176, 48,128, 37,
-     60,182,176,176,176, 48,128, 37, 44,183,176,176,176, 48,128, 37,
-     52,184,176,176,176, 48,128, 37, 28,185,176,176,176, 48,128, 37,
-     36, 49,  3, 24,217, 24,225, 24,233,176,176,176,176, 48,128, 37,
-      0,177,176,176,176, 48,128, 37,  2,185,176,176,176, 48,128, 37,
-     97, 50,  9, 25,  5, 25, 13, 25, 21, 25, 29, 25, 37, 25, 45, 25,
-     53, 25, 61, 25, 69,176,176,176,176, 48,128, 37, 98,177,176,176,
-    176, 48,128, 37, 86,178,176,176,176, 48,128, 37, 85,179,176,176,
-    176, 48,128, 37, 99,180,176,176,176, 48,128, 37, 81,181,176,176,
-    176, 48,128, 37, 87,182,176,176,176, 48,128, 37, 93,183,176,176,
-    176, 48,128, 37, 92,184,176,176,176, 48,128, 37, 91, 51,  4, 25,
-     87, 25, 95, 25,103, 25,111,182,176,176,176, 48,128, 37, 94,183,
-    176,176,176, 48,128, 37, 95,184,176,176,176, 48,128, 37, 90,185,
-    176,176,176, 48,128, 37, 84, 52, 10, 25,141, 25,149, 25,157, 25,
-    165, 25,173, 25,181, 25,189, 25,197, 25,205, 25,213,176,176,176,
-    176, 48,128, 37,105,177,176,176,176, 48,128, 37,102,178,176,176,
-    176, 48,128, 37, 96,179,176,176,176, 48,128, 37, 80,180,176,176,
-    176, 48,128, 37,108,181,176,176,176, 48,128, 37,103,182,176,176,
-    176, 48,128, 37,104,183,176,176,176, 48,128, 37,100,184,176,176,
-    176, 48,128, 37,101,185,176,176,176, 48,128, 37, 89, 53,  5, 25,
-    233, 25,241, 25,249, 26,  1, 26,  9,176,176,176,176, 48,128, 37,
-     88,177,176,176,176, 48,128, 37, 82,178,176,176,176, 48,128, 37,
-     83,179,176,176,176, 48,128, 37,107,180,176,176,176, 48,128, 37,
-    106, 97,  2, 26, 23, 26, 44,227,245,244,101,129,  1, 90, 26, 32,
-    228,239,244,225,227,227,229,238,116,128, 30,100,237,240,233,231,
-    242,229,229,107,128,  3,224, 99,  5, 26, 67, 26, 98, 26,107, 26,
-    147, 26,169,225,242,239,110,130,  1, 96, 26, 78, 26, 90,228,239,
-    244,225,227,227,229,238,116,128, 30,102,243,237,225,236,108,128,
-    246,253,229,228,233,236,236, 97,128,  1, 94,232,247, 97,130,  1,
-    143, 26,117, 26,128,227,249,242,233,236,236,233, 99,128,  4,216,
-    228,233,229,242,229,243,233,243,227,249,242,233,236,236,233, 99,
-    128,  4,218,233,242, 99,  2, 26,155, 26,160,236,101,128, 36,200,
-    245,237,230,236,229,120,128,  1, 92,239,237,237,225,225,227,227,
-    229,238,116,128,  2, 24,228,239,116,  2, 26,190, 26,199,225,227,
-    227,229,238,116,128, 30, 96,226,229,236,239,119,129, 30, 98, 26,
-    209,228,239,244,225,227,227,229,238,116,128, 30,104,101,  2, 26,
-    227, 26,239,232,225,242,237,229,238,233,225,110,128,  5, 77,246,
-    229,238,242,239,237,225,110,128, 33,102,104,  5, 27,  6, 27, 34,
-     27, 48, 27, 59, 27, 72, 97,  2, 27, 12, 27, 23,225,242,237,229,
-    238,233,225,110,128,  5, 71,227,249,242,233,236,236,233, 99,128,
-      4, 40,227,232,225,227,249,242,233,236,236,233, 99,128,  4, 41,
-    229,233,227,239,240,244,233, 99,128,  3,226,232,225,227,249,242,
-    233,236,236,233, 99,128,  4,186,233,237,225,227,239,240,244,233,
-     99,128,  3,236,105,  2, 27, 90, 27, 96,231,237, 97,128,  3,163,
-    248,242,239,237,225,110,128, 33,101,237,239,238,239,243,240,225,
-    227,101,128,255, 51,239,230,244,243,233,231,238,227,249,242,233,
-    236,236,233, 99,128,  4, 44,243,237,225,236,108,128,247,115,244,
-    233,231,237,225,231,242,229,229,107,128,  3,218, 84,141,  0, 84,
-     27,186, 27,191, 27,197, 28,  7, 28, 32, 28, 96, 28,147, 28,177,
-     28,189, 28,201, 28,246, 29,  6, 29, 46,225,117,128,  3,164,226,
-    225,114,128,  1,102, 99,  4, 27,207, 27,214, 27,223, 27,250,225,
-    242,239,110,128,  1,100,229,228,233,236,236, 97,128,  1, 98,233,
-    242, 99,  2, 27,231, 27,236,236,101,128, 36,201,245,237,230,236,
-    229,248,226,229,236,239,119,128, 30,112,239,237,237,225,225,227,
-    227,229,238,116,128,  1, 98,228,239,116,  2, 28, 15, 28, 24,225,
-    227,227,229,238,116,128, 30,106,226,229,236,239,119,128, 30,108,
-    101,  4, 28, 42, 28, 53, 28, 73, 28, 82,227,249,242,233,236,236,
-    233, 99,128,  4, 34,228,229,243,227,229,238,228,229,242,227,249,
-    242,233,236,236,233, 99,128,  4,172,238,242,239,237,225,110,128,
-     33,105,244,243,229,227,249,242,233,236,236,233, 99,128,  4,180,
-    104,  3, 28,104, 28,110, 28,136,229,244, 97,128,  3,152,111,  2,
-     28,116, 28,121,239,107,128,  1,172,242,110,129,  0,222, 28,128,
-    243,237,225,236,108,128,247,254,242,229,229,242,239,237,225,110,
-    128, 33, 98,105,  2, 28,153, 28,164,236,228,229,243,237,225,236,
-    108,128,246,254,247,238,225,242,237,229,238,233,225,110,128,  5,
-     79,236,233,238,229,226,229,236,239,119,128, 30,110,237,239,238,
-    239,243,240,225,227,101,128,255, 52,111,  2, 28,207, 28,218,225,
-    242,237,229,238,233,225,110,128,  5, 57,238,101,  3, 28,227, 28,
-    234, 28,240,230,233,246,101,128,  1,188,243,233,120,128,  1,132,
-    244,247,111,128,  1,167,242,229,244,242,239,230,236,229,248,232,
-    239,239,107,128,  1,174,115,  3, 29, 14, 29, 26, 29, 39,229,227,
-    249,242,233,236,236,233, 99,128,  4, 38,232,229,227,249,242,233,
-    236,236,233, 99,128,  4, 11,237,225,236,108,128,247,116,119,  2,
-     29, 52, 29, 64,229,236,246,229,242,239,237,225,110,128, 33,107,
-    239,242,239,237,225,110,128, 33, 97, 85,142,  0, 85, 29,105, 29,
-    123, 29,131, 29,198, 30, 69, 30, 87, 30,198, 30,214, 30,226, 31,
-     21, 31, 30, 31,142, 31,149, 31,219,225,227,245,244,101,129,  0,
-    218, 29,115,243,237,225,236,108,128,247,250,226,242,229,246,101,
-    128,  1,108, 99,  3, 29,139, 29,146, 29,188,225,242,239,110,128,
-      1,211,233,242, 99,  2, 29,154, 29,159,236,101,128, 36,202,245,
-    237,230,236,229,120,130,  0,219, 29,172, 29,180,226,229,236,239,
-    119,128, 30,118,243,237,225,236,108,128,247,251,249,242,233,236,
-    236,233, 99,128,  4, 35,100,  3, 29,206, 29,229, 30, 59,226,108,
-      2, 29,213, 29,221,225,227,245,244,101,128,  1,112,231,242,225,
-    246,101,128,  2, 20,233,229,242,229,243,233,115,134,  0,220, 29,
-    251, 30,  3, 30, 11, 30, 34, 30, 42, 30, 51,225,227,245,244,101,
-    128,  1,215,226,229,236,239,119,128, 30,114, 99,  2, 30, 17, 30,
-     24,225,242,239,110,128,  1,217,249,242,233,236,236,233, 99,128,
-      4,240,231,242,225,246,101,128,  1,219,237,225,227,242,239,110,
-    128,  1,213,243,237,225,236,108,128,247,252,239,244,226,229,236,
-    239,119,128, 30,228,231,242,225,246,101,129,  0,217, 30, 79,243,
-    237,225,236,108,128,247,249,104,  2, 30, 93, 30,171,111,  2, 30,
-     99, 30,109,239,235,225,226,239,246,101,128, 30,230,242,110,133,
-      1,175, 30,124, 30,132, 30,143, 30,151, 30,163,225,227,245,244,
-    101,128, 30,232,228,239,244,226,229,236,239,119,128, 30,240,231,
-    242,225,246,101,128, 30,234,232,239,239,235,225,226,239,246,101,
-    128, 30,236,244,233,236,228,101,128, 30,238,245,238,231,225,242,
-    245,237,236,225,245,116,129,  1,112, 30,187,227,249,242,233,236,
-    236,233, 99,128,  4,242,233,238,246,229,242,244,229,228,226,242,
-    229,246,101,128,  2, 22,235,227,249,242,233,236,236,233, 99,128,
-      4,120,109,  2, 30,232, 31, 10,225,227,242,239,110,130,  1,106,
-     30,244, 30,255,227,249,242,233,236,236,233, 99,128,  4,238,228,
-    233,229,242,229,243,233,115,128, 30,122,239,238,239,243,240,225,
-    227,101,128,255, 53,239,231,239,238,229,107,128,  1,114,240,243,
-    233,236,239,110,133,  3,165, 31, 49, 31, 53, 31, 90, 31,121, 31,
-    134, 49,128,  3,210, 97,  2, 31, 59, 31, 81,227,245,244,229,232,
-    239,239,235,243,249,237,226,239,236,231,242,229,229,107,128,  3,
-    211,230,242,233,227,225,110,128,  1,177,228,233,229,242,229,243,
-    233,115,129,  3,171, 31,103,232,239,239,235,243,249,237,226,239,
-    236,231,242,229,229,107,128,  3,212,232,239,239,235,243,249,237,
-    226,239,108,128,  3,210,244,239,238,239,115,128,  3,142,242,233,
-    238,103,128,  1,110,115,  3, 31,157, 31,172, 31,179,232,239,242,
-    244,227,249,242,233,236,236,233, 99,128,  4, 14,237,225,236,108,
-    128,247,117,244,242,225,233,231,232,116,  2, 31,191, 31,202,227,
-    249,242,233,236,236,233, 99,128,  4,174,243,244,242,239,235,229,
-    227,249,242,233,236,236,233, 99,128,  4,176,244,233,236,228,101,
-    130,  1,104, 31,231, 31,239,225,227,245,244,101,128, 30,120,226,
-    229,236,239,119,128, 30,116, 86,136,  0, 86, 32, 11, 32, 20, 32,
-     31, 32, 60, 32, 67, 32, 79, 32, 91, 32, 99,227,233,242,227,236,
-    101,128, 36,203,228,239,244,226,229,236,239,119,128, 30,126,101,
-      2, 32, 37, 32, 48,227,249,242,233,236,236,233, 99,128,  4, 18,
-    247,225,242,237,229,238,233,225,110,128,  5, 78,232,239,239,107,
-    128,  1,178,237,239,238,239,243,240,225,227,101,128,255, 54,239,
-    225,242,237,229,238,233,225,110,128,  5, 72,243,237,225,236,108,
-    128,247,118,244,233,236,228,101,128, 30,124, 87,134,  0, 87, 32,
-    123, 32,131, 32,154, 32,194, 32,202, 32,214,225,227,245,244,101,
-    128, 30,130,227,233,242, 99,  2, 32,140, 32,145,236,101,128, 36,
-    204,245,237,230,236,229,120,128,  1,116,100,  2, 32,160, 32,170,
-    233,229,242,229,243,233,115,128, 30,132,239,116,  2, 32,177, 32,
-    186,225,227,227,229,238,116,128, 30,134,226,229,236,239,119,128,
-     30,136,231,242,225,246,101,128, 30,128,237,239,238,239,243,240,
-    225,227,101,128,255, 55,243,237,225,236,108,128,247,119, 88,134,
-      0, 88, 32,238, 32,247, 33, 18, 33, 31, 33, 35, 33, 47,227,233,
-    242,227,236,101,128, 36,205,100,  2, 32,253, 33,  7,233,229,242,
-    229,243,233,115,128, 30,140,239,244,225,227,227,229,238,116,128,
-     30,138,229,232,225,242,237,229,238,233,225,110,128,  5, 61,105,
-    128,  3,158,237,239,238,239,243,240,225,227,101,128,255, 56,243,
-    237,225,236,108,128,247,120, 89,139,  0, 89, 33, 81, 33,116, 33,
-    139, 33,189, 33,228, 33,236, 33,253, 34, 40, 34, 52, 34, 60, 34,
-     68, 97,  2, 33, 87, 33,104,227,245,244,101,129,  0,221, 33, 96,
-    243,237,225,236,108,128,247,253,244,227,249,242,233,236,236,233,
-     99,128,  4, 98,227,233,242, 99,  2, 33,125, 33,130,236,101,128,
-     36,206,245,237,230,236,229,120,128,  1,118,100,  2, 33,145, 33,
-    165,233,229,242,229,243,233,115,129,  1,120, 33,157,243,237,225,
-    236,108,128,247,255,239,116,  2, 33,172, 33,181,225,227,227,229,
-    238,116,128, 30,142,226,229,236,239,119,128, 30,244,229,114,  2,
-     33,196, 33,208,233,227,249,242,233,236,236,233, 99,128,  4, 43,
-    245,228,233,229,242,229,243,233,243,227,249,242,233,236,236,233,
-     99,128,  4,248,231,242,225,246,101,128, 30,242,232,239,239,107,
-    129,  1,179, 33,245,225,226,239,246,101,128, 30,246,105,  3, 34,
-      5, 34, 16, 34, 27,225,242,237,229,238,233,225,110,128,  5, 69,
-    227,249,242,233,236,236,233, 99,128,  4,  7,247,238,225,242,237,
-    229,238,233,225,110,128,  5, 82,237,239,238,239,243,240,225,227,
-    101,128,255, 57,243,237,225,236,108,128,247,121,244,233,236,228,
-    101,128, 30,248,245,115,  2, 34, 75, 34,113,226,233,103,  2, 34,
-     83, 34, 94,227,249,242,233,236,236,233, 99,128,  4,106,233,239,
-    244,233,230,233,229,228,227,249,242,233,236,236,233, 99,128,  4,
-    108,236,233,244,244,236,101,  2, 34,124, 34,135,227,249,242,233,
-    236,236,233, 99,128,  4,102,233,239,244,233,230,233,229,228,227,
-    249,242,233,236,236,233, 99,128,  4,104, 90,136,  0, 90, 34,174,
-     34,198, 34,243, 35, 14, 35, 81, 35,173, 35,185, 35,197, 97,  2,
-     34,180, 34,191,225,242,237,229,238,233,225,110,128,  5, 54,227,
-    245,244,101,128,  1,121, 99,  2, 34,204, 34,221,225,242,239,110,
-    129,  1,125, 34,213,243,237,225,236,108,128,246,255,233,242, 99,
-      2, 34,229, 34,234,236,101,128, 36,207,245,237,230,236,229,120,
-    128, 30,144,228,239,116,130,  1,123, 34,253, 35,  6,225,227,227,
-    229,238,116,128,  1,123,226,229,236,239,119,128, 30,146,101,  3,
-     35, 22, 35, 33, 35, 76,227,249,242,233,236,236,233, 99,128,  4,
-     23,100,  2, 35, 39, 35, 58,229,243,227,229,238,228,229,242,227,
-    249,242,233,236,236,233, 99,128,  4,152,233,229,242,229,243,233,
-    243,227,249,242,233,236,236,233, 99,128,  4,222,244, 97,128,  3,
-    150,232,101,  4, 35, 92, 35,103, 35,119, 35,130,225,242,237,229,
-    238,233,225,110,128,  5, 58,226,242,229,246,229,227,249,242,233,
-    236,236,233, 99,128,  4,193,227,249,242,233,236,236,233, 99,128,
-      4, 22,100,  2, 35,136, 35,155,229,243,227,229,238,228,229,242,
-    227,249,242,233,236,236,233, 99,128,  4,150,233,229,242,229,243,
-    233,243,227,249,242,233,236,236,233, 99,128,  4,220,236,233,238,
-    229,226,229,236,239,119,128, 30,148,237,239,238,239,243,240,225,
-    227,101,128,255, 58,115,  2, 35,203, 35,210,237,225,236,108,128,
-    247,122,244,242,239,235,101,128,  1,181, 97,158,  0, 97, 36, 26,
-     38,154, 39,  4, 39, 68, 39,132, 39,196, 40,  4, 40, 68, 40,126,
-     40,190, 41, 70, 41,217, 42,137, 42,237, 43, 17, 49,192, 49,229,
-     50,  0, 50,225, 51,  7, 52, 96, 52,168, 53,123, 53,132, 54,  5,
-     56, 13, 57,  3, 57, 50, 57,201, 57,215, 49,138, 39,  1, 36, 50,
-     36,114, 36,154, 36,218, 37, 26, 37, 90, 37,154, 37,218, 38, 26,
-     38, 90, 48,138, 39, 33, 36, 74, 36, 78, 36, 82, 36, 86, 36, 90,
-     36, 94, 36, 98, 36,102, 36,106, 36,110, 48,128, 39, 94, 49,128,
-     39, 97, 50,128, 39, 98, 51,128, 39, 99, 52,128, 39,100, 53,128,
-     39, 16, 54,128, 39,101, 55,128, 39,102, 56,128, 39,103, 57,128,
-     38, 96, 49,134, 38, 27, 36,130, 36,134, 36,138, 36,142, 36,146,
-     36,150, 48,128, 38,101, 49,128, 38,102, 50,128, 38, 99, 55,128,
-     39,  9, 56,128, 39,  8, 57,128, 39,  7, 50,138, 38, 30, 36,178,
-     36,182, 36,186, 36,190, 36,194, 36,198, 36,202, 36,206, 36,210,
-     36,214, 48,128, 36, 96, 49,128, 36, 97, 50,128, 36, 98, 51,128,
-     36, 99, 52,128, 36,100, 53,128, 36,101, 54,128, 36,102, 55,128,
-     36,103, 56,128, 36,104, 57,128, 36,105, 51,138, 39, 12, 36,242,
-     36,246, 36,250, 36,254, 37,  2, 37,  6, 37, 10, 37, 14, 37, 18,
-     37, 22, 48,128, 39,118, 49,128, 39,119, 50,128, 39,120, 51,128,
-     39,121, 52,128, 39,122, 53,128, 39,123, 54,128, 39,124, 55,128,
-     39,125, 56,128, 39,126, 57,128, 39,127, 52,138, 39, 13, 37, 50,
-     37, 54, 37, 58, 37, 62, 37, 66, 37, 70, 37, 74, 37, 78, 37, 82,
-     37, 86, 48,128, 39,128, 49,128, 39,129, 50,128, 39,130, 51,128,
-     39,131, 52,128, 39,132, 53,128, 39,133, 54,128, 39,134, 55,128,
-     39,135, 56,128, 39,136, 57,128, 39,137, 53,138, 39, 14, 37,114,
-     37,118, 37,122, 37,126, 37,130, 37,134, 37,138, 37,142, 37,146,
-     37,150, 48,128, 39,138, 49,128, 39,139, 50,128, 39,140, 51,128,
-     39,141, 52,128, 39,142, 53,128, 39,143, 54,128, 39,144, 55,128,
-     39,145, 56,128, 39,146, 57,128, 39,147, 54,138, 39, 15, 37,178,
-     37,182, 37,186, 37,190, 37,194, 37,198, 37,202, 37,206, 37,210,
-     37,214, 48,128, 39,148, 49,128, 33,146, 50,128, 39,163, 51,128,
-     33,148, 52,128, 33,149, 53,128, 39,153, 54,128, 39,155, 55,128,
-     39,156, 56,128, 39,157, 57,128, 39,158, 55,138, 39, 17, 37,242,
-     37,246, 37,250, 37,254, 38,  2, 38,  6, 38, 10, 38, 14, 38, 18,
-     38, 22, 48,128, 39,159, 49,128, 39,160, 50,128, 39,161, 51,128,
-     39,162, 52,128, 39,164, 53,128, 39,165, 54,128, 39,166, 55,128,
-     39,167, 56,128, 39,168, 57,128, 39,169, 56,138, 39, 18, 38, 50,
-     38, 54, 38, 58, 38, 62, 38, 66, 38, 70, 38, 74, 38, 78, 38, 82,
-     38, 86, 48,128, 39,171, 49,128, 39,173, 50,128, 39,175, 51,128,
-     39,178, 52,128, 39,179, 53,128, 39,181, 54,128, 39,184, 55,128,
-     39,186, 56,128, 39,187, 57,128, 39,188, 57,138, 39, 19, 38,114,
-     38,118, 38,122, 38,126, 38,130, 38,134, 38,138, 38,142, 38,146,
-     38,150, 48,128, 39,189, 49,128, 39,190, 50,128, 39,154, 51,128,
-     39,170, 52,128, 39,182, 53,128, 39,185, 54,128, 39,152, 55,128,
-     39,180, 56,128, 39,183, 57,128, 39,172, 50,138, 39,  2, 38,178,
-     38,224, 38,228, 38,232, 38,236, 38,240, 38,244, 38,248, 38,252,
-     39,  0, 48,135, 39, 20, 38,196, 38,200, 38,204, 38,208, 38,212,
-     38,216, 38,220, 48,128, 39,174, 49,128, 39,177, 50,128, 39,  3,
-     51,128, 39, 80, 52,128, 39, 82, 53,128, 39,110, 54,128, 39,112,
-     49,128, 39, 21, 50,128, 39, 22, 51,128, 39, 23, 52,128, 39, 24,
-     53,128, 39, 25, 54,128, 39, 26, 55,128, 39, 27, 56,128, 39, 28,
-     57,128, 39, 34, 51,138, 39,  4, 39, 28, 39, 32, 39, 36, 39, 40,
-     39, 44, 39, 48, 39, 52, 39, 56, 39, 60, 39, 64, 48,128, 39, 35,
-     49,128, 39, 36, 50,128, 39, 37, 51,128, 39, 38, 52,128, 39, 39,
-     53,128, 38,  5, 54,128, 39, 41, 55,128, 39, 42, 56,128, 39, 43,
-     57,128, 39, 44, 52,138, 38, 14, 39, 92, 39, 96, 39,100, 39,104,
-     39,108, 39,112, 39,116, 39,120, 39,124, 39,128, 48,128, 39, 45,
-     49,128, 39, 46, 50,128, 39, 47, 51,128, 39, 48, 52,128, 39, 49,
-     53,128, 39, 50, 54,128, 39, 51, 55,128, 39, 52, 56,128, 39, 53,
-     57,128, 39, 54, 53,138, 39,  6, 39,156, 39,160, 39,164, 39,168,
-     39,172, 39,176, 39,180, 39,184, 39,188, 39,192, 48,128, 39, 55,
-     49,128, 39, 56, 50,128, 39, 57, 51,128, 39, 58, 52,128, 39, 59,
-     53,128, 39, 60, 54,128, 39, 61, 55,128, 39, 62, 56,128, 39, 63,
-     57,128, 39, 64, 54,138, 39, 29, 39,220, 39,224, 39,228, 39,232,
-     39,236, 39,240, 39,244, 39,248, 39,252, 40,  0, 48,128, 39, 65,
-     49,128, 39, 66, 50,128, 39, 67, 51,128, 39, 68, 52,128, 39, 69,
-     53,128, 39, 70, 54,128, 39, 71, 55,128, 39, 72, 56,128, 39, 73,
-     57,128, 39, 74, 55,138, 39, 30, 40, 28, 40, 32, 40, 36, 40, 40,
-     40, 44, 40, 48, 40, 52, 40, 56, 40, 60, 40, 64, 48,128, 39, 75,
-     49,128, 37,207, 50,128, 39, 77, 51,128, 37,160, 52,128, 39, 79,
-     53,128, 39, 81, 54,128, 37,178, 55,128, 37,188, 56,128, 37,198,
-     57,128, 39, 86, 56,137, 39, 31, 40, 90, 40, 94, 40, 98, 40,102,
-     40,106, 40,110, 40,114, 40,118, 40,122, 49,128, 37,215, 50,128,
-     39, 88, 51,128, 39, 89, 52,128, 39, 90, 53,128, 39,111, 54,128,
-     39,113, 55,128, 39,114, 56,128, 39,115, 57,128, 39,104, 57,138,
-     39, 32, 40,150, 40,154, 40,158, 40,162, 40,166, 40,170, 40,174,
-     40,178, 40,182, 40,186, 48,128, 39,105, 49,128, 39,108, 50,128,
-     39,109, 51,128, 39,106, 52,128, 39,107, 53,128, 39,116, 54,128,
-     39,117, 55,128, 39, 91, 56,128, 39, 92, 57,128, 39, 93, 97,  7,
-     40,206, 40,216, 40,223, 40,230, 40,255, 41, 15, 41, 26,226,229,
-    238,231,225,236,105,128,  9,134,227,245,244,101,128,  0,225,228,
-    229,246, 97,128,  9,  6,231,117,  2, 40,237, 40,246,234,225,242,
-    225,244,105,128, 10,134,242,237,245,235,232,105,128, 10,  6,237,
-    225,244,242,225,231,245,242,237,245,235,232,105,128, 10, 62,242,
-    245,243,241,245,225,242,101,128, 51,  3,246,239,247,229,236,243,
-    233,231,110,  3, 41, 42, 41, 52, 41, 59,226,229,238,231,225,236,
-    105,128,  9,190,228,229,246, 97,128,  9, 62,231,245,234,225,242,
-    225,244,105,128, 10,190, 98,  4, 41, 80, 41,121, 41,130, 41,140,
-    226,242,229,246,233,225,244,233,239,110,  2, 41, 95, 41,110,237,
-    225,242,235,225,242,237,229,238,233,225,110,128,  5, 95,243,233,
-    231,238,228,229,246, 97,128,  9,112,229,238,231,225,236,105,128,
-      9,133,239,240,239,237,239,230,111,128, 49, 26,242,229,246,101,
-    134,  1,  3, 41,159, 41,167, 41,178, 41,189, 41,197, 41,209,225,
-    227,245,244,101,128, 30,175,227,249,242,233,236,236,233, 99,128,
-      4,209,228,239,244,226,229,236,239,119,128, 30,183,231,242,225,
-    246,101,128, 30,177,232,239,239,235,225,226,239,246,101,128, 30,
-    179,244,233,236,228,101,128, 30,181, 99,  4, 41,227, 41,234, 42,
-     57, 42,127,225,242,239,110,128,  1,206,233,242, 99,  2, 41,242,
-     41,247,236,101,128, 36,208,245,237,230,236,229,120,133,  0,226,
-     42, 10, 42, 18, 42, 29, 42, 37, 42, 49,225,227,245,244,101,128,
-     30,165,228,239,244,226,229,236,239,119,128, 30,173,231,242,225,
-    246,101,128, 30,167,232,239,239,235,225,226,239,246,101,128, 30,
-    169,244,233,236,228,101,128, 30,171,245,244,101,133,  0,180, 42,
-     73, 42, 84, 42,101, 42,108, 42,117,226,229,236,239,247,227,237,
-     98,128,  3, 23, 99,  2, 42, 90, 42, 95,237, 98,128,  3,  1,239,
-    237, 98,128,  3,  1,228,229,246, 97,128,  9, 84,236,239,247,237,
-    239,100,128,  2,207,244,239,238,229,227,237, 98,128,  3, 65,249,
-    242,233,236,236,233, 99,128,  4, 48,100,  5, 42,149, 42,159, 42,
-    173, 42,179, 42,213,226,236,231,242,225,246,101,128,  2,  1,228,
-    225,235,231,245,242,237,245,235,232,105,128, 10,113,229,246, 97,
-    128,  9,  5,233,229,242,229,243,233,115,130,  0,228, 42,193, 42,
-    204,227,249,242,233,236,236,233, 99,128,  4,211,237,225,227,242,
-    239,110,128,  1,223,239,116,  2, 42,220, 42,228,226,229,236,239,
-    119,128, 30,161,237,225,227,242,239,110,128,  1,225,101,131,  0,
-    230, 42,247, 42,255, 43,  8,225,227,245,244,101,128,  1,253,235,
-    239,242,229,225,110,128, 49, 80,237,225,227,242,239,110,128,  1,
-    227,230,233,105,  6, 43, 33, 43, 53, 45,246, 45,252, 46, 11, 49,
-    111, 48,  2, 43, 39, 43, 46,176,178,176, 56,128, 32, 21,184,185,
-    180, 49,128, 32,164,177, 48,  3, 43, 62, 45, 86, 45,221, 48,  9,
-     43, 82, 43,102, 43,164, 43,226, 44, 32, 44, 94, 44,156, 44,218,
-     45, 24, 49,  3, 43, 90, 43, 94, 43, 98, 55,128,  4, 16, 56,128,
-      4, 17, 57,128,  4, 18, 50, 10, 43,124, 43,128, 43,132, 43,136,
-     43,140, 43,144, 43,148, 43,152, 43,156, 43,160, 48,128,  4, 19,
-     49,128,  4, 20, 50,128,  4, 21, 51,128,  4,  1, 52,128,  4, 22,
-     53,128,  4, 23, 54,128,  4, 24, 55,128,  4, 25, 56,128,  4, 26,
-     57,128,  4, 27, 51, 10, 43,186, 43,190, 43,194, 43,198, 43,202,
-     43,206, 43,210, 43,214, 43,218, 43,222, 48,128,  4, 28, 49,128,
-      4, 29, 50,128,  4, 30, 51,128,  4, 31, 52,128,  4, 32, 53,128,
-      4, 33, 54,128,  4, 34, 55,128,  4, 35, 56,128,  4, 36, 57,128,
-      4, 37, 52, 10, 43,248, 43,252, 44,  0, 44,  4, 44,  8, 44, 12,
-     44, 16, 44, 20, 44, 24, 44, 28, 48,128,  4, 38, 49,128,  4, 39,
-     50,128,  4, 40, 51,128,  4, 41, 52,128,  4, 42, 53,128,  4, 43,
-     54,128,  4, 44, 55,128,  4, 45, 56,128,  4, 46, 57,128,  4, 47,
-     53, 10, 44, 54, 44, 58, 44, 62, 44, 66, 44, 70, 44, 74, 44, 78,
-     44, 82, 44, 86, 44, 90, 48,128,  4,144, 49,128,  4,  2, 50,128,
-      4,  3, 51,128,  4,  4, 52,128,  4,  5, 53,128,  4,  6, 54,128,
-      4,  7, 55,128,  4,  8, 56,128,  4,  9, 57,128,  4, 10, 54, 10,
-     44,116, 44,120, 44,124, 44,128, 44,132, 44,136, 44,140, 44,144,
-     44,148, 44,152, 48,128,  4, 11, 49,128,  4, 12, 50,128,  4, 14,
-     51,128,246,196, 52,128,246,197, 53,128,  4, 48, 54,128,  4, 49,
-     55,128,  4, 50, 56,128,  4, 51, 57,128,  4, 52, 55, 10, 44,178,
-     44,182, 44,186, 44,190, 44,194, 44,198, 44,202, 44,206, 44,210,
-     44,214, 48,128,  4, 53, 49,128,  4, 81, 50,128,  4, 54, 51,128,
-      4, 55, 52,128,  4, 56, 53,128,  4, 57, 54,128,  4, 58, 55,128,
-      4, 59, 56,128,  4, 60, 57,128,  4, 61, 56, 10, 44,240, 44,244,
-     44,248, 44,252, 45,  0, 45,  4, 45,  8, 45, 12, 45, 16, 45, 20,
-     48,128,  4, 62, 49,128,  4, 63, 50,128,  4, 64, 51,128,  4, 65,
-     52,128,  4, 66, 53,128,  4, 67, 54,128,  4, 68, 55,128,  4, 69,
-     56,128,  4, 70, 57,128,  4, 71, 57, 10, 45, 46, 45, 50, 45, 54,
-     45, 58, 45, 62, 45, 66, 45, 70, 45, 74, 45, 78, 45, 82, 48,128,
-      4, 72, 49,128,  4, 73, 50,128,  4, 74, 51,128,  4, 75, 52,128,
-      4, 76, 53,128,  4, 77, 54,128,  4, 78, 55,128,  4, 79, 56,128,
-      4,145, 57,128,  4, 82, 49,  4, 45, 96, 45,158, 45,163, 45,189,
-     48, 10, 45,118, 45,122, 45,126, 45,130, 45,134, 45,138, 45,142,
-     45,146, 45,150, 45,154, 48,128,  4, 83, 49,128,  4, 84, 50,128,
-      4, 85, 51,128,  4, 86, 52,128,  4, 87, 53,128,  4, 88, 54,128,
-      4, 89, 55,128,  4, 90, 56,128,  4, 91, 57,128,  4, 92,177, 48,
-    128,  4, 94, 52,  4, 45,173, 45,177, 45,181, 45,185, 53,128,  4,
-     15, 54,128,  4, 98, 55,128,  4,114, 56,128,  4,116, 57,  5, 45,
-    201, 45,205, 45,209, 45,213, 45,217, 50,128,246,198, 51,128,  4,
-     95, 52,128,  4, 99, 53,128,  4,115, 54,128,  4,117, 56,  2, 45,
-    227, 45,241, 51,  2, 45,233, 45,237, 49,128,246,199, 50,128,246,
-    200,180, 54,128,  4,217,178,185, 57,128, 32, 14,179, 48,  2, 46,
-      3, 46,  7, 48,128, 32, 15, 49,128, 32, 13,181, 55,  7, 46, 28,
-     46, 98, 47,163, 47,240, 48,197, 49, 34, 49,105, 51,  2, 46, 34,
-     46, 48, 56,  2, 46, 40, 46, 44, 49,128,  6,106, 56,128,  6, 12,
-     57,  8, 46, 66, 46, 70, 46, 74, 46, 78, 46, 82, 46, 86, 46, 90,
-     46, 94, 50,128,  6, 96, 51,128,  6, 97, 52,128,  6, 98, 53,128,
-      6, 99, 54,128,  6,100, 55,128,  6,101, 56,128,  6,102, 57,128,
-      6,103, 52,  7, 46,114, 46,146, 46,208, 47, 14, 47, 46, 47,102,
-     47,158, 48,  5, 46,126, 46,130, 46,134, 46,138, 46,142, 48,128,
-      6,104, 49,128,  6,105, 51,128,  6, 27, 55,128,  6, 31, 57,128,
-      6, 33, 49, 10, 46,168, 46,172, 46,176, 46,180, 46,184, 46,188,
-     46,192, 46,196, 46,200, 46,204, 48,128,  6, 34, 49,128,  6, 35,
-     50,128,  6, 36, 51,128,  6, 37, 52,128,  6, 38, 53,128,  6, 39,
-     54,128,  6, 40, 55,128,  6, 41, 56,128,  6, 42, 57,128,  6, 43,
-     50, 10, 46,230, 46,234, 46,238, 46,242, 46,246, 46,250, 46,254,
-     47,  2, 47,  6, 47, 10, 48,128,  6, 44, 49,128,  6, 45, 50,128,
-      6, 46, 51,128,  6, 47, 52,128,  6, 48, 53,128,  6, 49, 54,128,
-      6, 50, 55,128,  6, 51, 56,128,  6, 52, 57,128,  6, 53, 51,  5,
-     47, 26, 47, 30, 47, 34, 47, 38, 47, 42, 48,128,  6, 54, 49,128,
-      6, 55, 50,128,  6, 56, 51,128,  6, 57, 52,128,  6, 58, 52,  9,
-     47, 66, 47, 70, 47, 74, 47, 78, 47, 82, 47, 86, 47, 90, 47, 94,
-     47, 98, 48,128,  6, 64, 49,128,  6, 65, 50,128,  6, 66, 51,128,
-      6, 67, 52,128,  6, 68, 53,128,  6, 69, 54,128,  6, 70, 56,128,
-      6, 72, 57,128,  6, 73, 53,  9, 47,122, 47,126, 47,130, 47,134,
-     47,138, 47,142, 47,146, 47,150, 47,154, 48,128,  6, 74, 49,128,
-      6, 75, 50,128,  6, 76, 51,128,  6, 77, 52,128,  6, 78, 53,128,
-      6, 79, 54,128,  6, 80, 55,128,  6, 81, 56,128,  6, 82,183, 48,
-    128,  6, 71, 53,  3, 47,171, 47,203, 47,235, 48,  5, 47,183, 47,
-    187, 47,191, 47,195, 47,199, 53,128,  6,164, 54,128,  6,126, 55,
-    128,  6,134, 56,128,  6,152, 57,128,  6,175, 49,  5, 47,215, 47,
-    219, 47,223, 47,227, 47,231, 49,128,  6,121, 50,128,  6,136, 51,
-    128,  6,145, 52,128,  6,186, 57,128,  6,210,179, 52,128,  6,213,
-     54,  7, 48,  0, 48,  5, 48, 10, 48, 15, 48, 53, 48,115, 48,177,
-    179, 54,128, 32,170,180, 53,128,  5,190,181, 56,128,  5,195, 54,
-      6, 48, 29, 48, 33, 48, 37, 48, 41, 48, 45, 48, 49, 52,128,  5,
-    208, 53,128,  5,209, 54,128,  5,210, 55,128,  5,211, 56,128,  5,
-    212, 57,128,  5,213, 55, 10, 48, 75, 48, 79, 48, 83, 48, 87, 48,
-     91, 48, 95, 48, 99, 48,103, 48,107, 48,111, 48,128,  5,214, 49,
-    128,  5,215, 50,128,  5,216, 51,128,  5,217, 52,128,  5,218, 53,
-    128,  5,219, 54,128,  5,220, 55,128,  5,221, 56,128,  5,222, 57,
-    128,  5,223, 56, 10, 48,137, 48,141, 48,145, 48,149, 48,153, 48,
-    157, 48,161, 48,165, 48,169, 48,173, 48,128,  5,224, 49,128,  5,
-    225, 50,128,  5,226, 51,128,  5,227, 52,128,  5,228, 53,128,  5,
-    229, 54,128,  5,230, 55,128,  5,231, 56,128,  5,232, 57,128,  5,
-    233, 57,  3, 48,185, 48,189, 48,193, 48,128,  5,234, 52,128,251,
-     42, 53,128,251, 43, 55,  4, 48,207, 48,221, 48,241, 48,246, 48,
-      2, 48,213, 48,217, 48,128,251, 75, 53,128,251, 31, 49,  3, 48,
-    229, 48,233, 48,237, 54,128,  5,240, 55,128,  5,241, 56,128,  5,
-    242,178, 51,128,251, 53, 57,  7, 49,  6, 49, 10, 49, 14, 49, 18,
-     49, 22, 49, 26, 49, 30, 51,128,  5,180, 52,128,  5,181, 53,128,
-      5,182, 54,128,  5,187, 55,128,  5,184, 56,128,  5,183, 57,128,
-      5,176, 56,  3, 49, 42, 49, 86, 49, 91, 48,  7, 49, 58, 49, 62,
-     49, 66, 49, 70, 49, 74, 49, 78, 49, 82, 48,128,  5,178, 49,128,
-      5,177, 50,128,  5,179, 51,128,  5,194, 52,128,  5,193, 54,128,
-      5,185, 55,128,  5,188,179, 57,128,  5,189, 52,  2, 49, 97, 49,
-    101, 49,128,  5,191, 50,128,  5,192,185,178, 57,128,  2,188, 54,
-      3, 49,119, 49,178, 49,185, 49,  4, 49,129, 49,145, 49,151, 49,
-    172, 50,  2, 49,135, 49,140,180, 56,128, 33,  5,184, 57,128, 33,
-     19,179,181, 50,128, 33, 22,181, 55,  3, 49,160, 49,164, 49,168,
-     51,128, 32, 44, 52,128, 32, 45, 53,128, 32, 46,182,182, 52,128,
-     32, 12,179,177,182, 55,128,  6,109,180,185,179, 55,128,  2,189,
-    103,  2, 49,198, 49,205,242,225,246,101,128,  0,224,117,  2, 49,
-    211, 49,220,234,225,242,225,244,105,128, 10,133,242,237,245,235,
-    232,105,128, 10,  5,104,  2, 49,235, 49,245,233,242,225,231,225,
-    238, 97,128, 48, 66,239,239,235,225,226,239,246,101,128, 30,163,
-    105,  7, 50, 16, 50, 41, 50, 48, 50, 60, 50, 85, 50,101, 50,181,
-     98,  2, 50, 22, 50, 31,229,238,231,225,236,105,128,  9,144,239,
-    240,239,237,239,230,111,128, 49, 30,228,229,246, 97,128,  9, 16,
-    229,227,249,242,233,236,236,233, 99,128,  4,213,231,117,  2, 50,
-     67, 50, 76,234,225,242,225,244,105,128, 10,144,242,237,245,235,
-    232,105,128, 10, 16,237,225,244,242,225,231,245,242,237,245,235,
-    232,105,128, 10, 72,110,  5, 50,113, 50,122, 50,136, 50,152, 50,
-    167,225,242,225,226,233, 99,128,  6, 57,230,233,238,225,236,225,
-    242,225,226,233, 99,128,254,202,233,238,233,244,233,225,236,225,
-    242,225,226,233, 99,128,254,203,237,229,228,233,225,236,225,242,
-    225,226,233, 99,128,254,204,246,229,242,244,229,228,226,242,229,
-    246,101,128,  2,  3,246,239,247,229,236,243,233,231,110,  3, 50,
-    197, 50,207, 50,214,226,229,238,231,225,236,105,128,  9,200,228,
-    229,246, 97,128,  9, 72,231,245,234,225,242,225,244,105,128, 10,
-    200,107,  2, 50,231, 50,255,225,244,225,235,225,238, 97,129, 48,
-    162, 50,243,232,225,236,230,247,233,228,244,104,128,255,113,239,
-    242,229,225,110,128, 49, 79,108,  3, 51, 15, 52, 71, 52, 80,101,
-      2, 51, 21, 52, 66,102,136,  5,208, 51, 41, 51, 50, 51, 65, 51,
-     79, 51,168, 51,182, 52, 37, 52, 51,225,242,225,226,233, 99,128,
-      6, 39,228,225,231,229,243,232,232,229,226,242,229,119,128,251,
-     48,230,233,238,225,236,225,242,225,226,233, 99,128,254,142,104,
-      2, 51, 85, 51,160,225,237,250, 97,  2, 51, 94, 51,127,225,226,
-    239,246,101,  2, 51,104, 51,113,225,242,225,226,233, 99,128,  6,
-     35,230,233,238,225,236,225,242,225,226,233, 99,128,254,132,226,
-    229,236,239,119,  2, 51,137, 51,146,225,242,225,226,233, 99,128,
-      6, 37,230,233,238,225,236,225,242,225,226,233, 99,128,254,136,
-    229,226,242,229,119,128,  5,208,236,225,237,229,228,232,229,226,
-    242,229,119,128,251, 79,237, 97,  2, 51,189, 51,225,228,228,225,
-    225,226,239,246,101,  2, 51,202, 51,211,225,242,225,226,233, 99,
-    128,  6, 34,230,233,238,225,236,225,242,225,226,233, 99,128,254,
-    130,235,243,245,242, 97,  4, 51,239, 51,248, 52,  6, 52, 22,225,
-    242,225,226,233, 99,128,  6, 73,230,233,238,225,236,225,242,225,
-    226,233, 99,128,254,240,233,238,233,244,233,225,236,225,242,225,
-    226,233, 99,128,254,243,237,229,228,233,225,236,225,242,225,226,
-    233, 99,128,254,244,240,225,244,225,232,232,229,226,242,229,119,
-    128,251, 46,241,225,237,225,244,243,232,229,226,242,229,119,128,
-    251, 47,240,104,128, 33, 53,236,229,241,245,225,108,128, 34, 76,
-    240,232, 97,129,  3,177, 52, 88,244,239,238,239,115,128,  3,172,
-    109,  4, 52,106, 52,114, 52,125, 52,159,225,227,242,239,110,128,
-      1,  1,239,238,239,243,240,225,227,101,128,255, 65,240,229,242,
-    243,225,238,100,130,  0, 38, 52,139, 52,151,237,239,238,239,243,
-    240,225,227,101,128,255,  6,243,237,225,236,108,128,247, 38,243,
-    241,245,225,242,101,128, 51,194,110,  4, 52,178, 52,189, 53, 55,
-     53, 65,226,239,240,239,237,239,230,111,128, 49, 34,103,  4, 52,
-    199, 52,210, 52,224, 53, 47,226,239,240,239,237,239,230,111,128,
-     49, 36,235,232,225,238,235,232,245,244,232,225,105,128, 14, 90,
-    236,101,131, 34, 32, 52,235, 53, 32, 53, 39,226,242,225,227,235,
-    229,116,  2, 52,247, 53, 11,236,229,230,116,129, 48,  8, 53,  0,
-    246,229,242,244,233,227,225,108,128,254, 63,242,233,231,232,116,
-    129, 48,  9, 53, 21,246,229,242,244,233,227,225,108,128,254, 64,
-    236,229,230,116,128, 35, 41,242,233,231,232,116,128, 35, 42,243,
-    244,242,239,109,128, 33, 43,239,244,229,236,229,233, 97,128,  3,
-    135,117,  2, 53, 71, 53, 83,228,225,244,244,225,228,229,246, 97,
-    128,  9, 82,243,246,225,242, 97,  3, 53, 95, 53,105, 53,112,226,
-    229,238,231,225,236,105,128,  9,130,228,229,246, 97,128,  9,  2,
-    231,245,234,225,242,225,244,105,128, 10,130,239,231,239,238,229,
-    107,128,  1,  5,112,  3, 53,140, 53,164, 53,194, 97,  2, 53,146,
-     53,158,225,244,239,243,241,245,225,242,101,128, 51,  0,242,229,
-    110,128, 36,156,239,243,244,242,239,240,232,101,  2, 53,177, 53,
-    188,225,242,237,229,238,233,225,110,128,  5, 90,237,239,100,128,
-      2,188,112,  2, 53,200, 53,205,236,101,128,248,255,242,111,  2,
-     53,212, 53,220,225,227,232,229,115,128, 34, 80,120,  2, 53,226,
-     53,246,229,241,245,225,108,129, 34, 72, 53,236,239,242,233,237,
-    225,231,101,128, 34, 82,233,237,225,244,229,236,249,229,241,245,
-    225,108,128, 34, 69,114,  4, 54, 15, 54, 42, 54, 46, 54, 91,225,
-    229, 97,  2, 54, 23, 54, 33,229,235,239,242,229,225,110,128, 49,
-    142,235,239,242,229,225,110,128, 49,141, 99,128, 35, 18,105,  2,
-     54, 52, 54, 66,231,232,244,232,225,236,230,242,233,238,103,128,
-     30,154,238,103,130,  0,229, 54, 75, 54, 83,225,227,245,244,101,
-    128,  1,251,226,229,236,239,119,128, 30,  1,242,239,119,  8, 54,
-    111, 54,118, 54,247, 55, 57, 55,107, 55,162, 55,185, 56,  4,226,
-    239,244,104,128, 33,148,100,  3, 54,126, 54,165, 54,212,225,243,
-    104,  4, 54,138, 54,145, 54,152, 54,160,228,239,247,110,128, 33,
-    227,236,229,230,116,128, 33,224,242,233,231,232,116,128, 33,226,
-    245,112,128, 33,225,226,108,  5, 54,178, 54,185, 54,192, 54,199,
-     54,207,226,239,244,104,128, 33,212,228,239,247,110,128, 33,211,
-    236,229,230,116,128, 33,208,242,233,231,232,116,128, 33,210,245,
-    112,128, 33,209,239,247,110,131, 33,147, 54,224, 54,231, 54,239,
-    236,229,230,116,128, 33,153,242,233,231,232,116,128, 33,152,247,
-    232,233,244,101,128, 33,233,104,  2, 54,253, 55, 48,229,225,100,
-      4, 55,  9, 55, 19, 55, 29, 55, 40,228,239,247,238,237,239,100,
-    128,  2,197,236,229,230,244,237,239,100,128,  2,194,242,233,231,
-    232,244,237,239,100,128,  2,195,245,240,237,239,100,128,  2,196,
-    239,242,233,250,229,120,128,248,231,236,229,230,116,131, 33,144,
-     55, 70, 55, 87, 55, 99,228,226,108,129, 33,208, 55, 78,243,244,
-    242,239,235,101,128, 33,205,239,246,229,242,242,233,231,232,116,
-    128, 33,198,247,232,233,244,101,128, 33,230,242,233,231,232,116,
-    132, 33,146, 55,123, 55,135, 55,143, 55,154,228,226,236,243,244,
-    242,239,235,101,128, 33,207,232,229,225,246,121,128, 39,158,239,
-    246,229,242,236,229,230,116,128, 33,196,247,232,233,244,101,128,
-     33,232,244,225, 98,  2, 55,170, 55,177,236,229,230,116,128, 33,
-    228,242,233,231,232,116,128, 33,229,245,112,132, 33,145, 55,198,
-     55,226, 55,244, 55,252,100,  2, 55,204, 55,216,110,129, 33,149,
-     55,210,226,243,101,128, 33,168,239,247,238,226,225,243,101,128,
-     33,168,236,229,230,116,129, 33,150, 55,235,239,230,228,239,247,
-    110,128, 33,197,242,233,231,232,116,128, 33,151,247,232,233,244,
-    101,128, 33,231,246,229,242,244,229,120,128,248,230,115,  5, 56,
-     25, 56,101, 56,146, 56,229, 56,239, 99,  2, 56, 31, 56, 83,233,
-    105,  2, 56, 38, 56, 61,227,233,242,227,245,109,129,  0, 94, 56,
-     49,237,239,238,239,243,240,225,227,101,128,255, 62,244,233,236,
-    228,101,129,  0,126, 56, 71,237,239,238,239,243,240,225,227,101,
-    128,255, 94,242,233,240,116,129,  2, 81, 56, 92,244,245,242,238,
-    229,100,128,  2, 82,237,225,236,108,  2, 56,110, 56,121,232,233,
-    242,225,231,225,238, 97,128, 48, 65,235,225,244,225,235,225,238,
-     97,129, 48,161, 56,134,232,225,236,230,247,233,228,244,104,128,
-    255,103,244,229,242,233,115,  2, 56,156, 56,225,107,131,  0, 42,
-     56,166, 56,194, 56,217, 97,  2, 56,172, 56,186,236,244,239,238,
-    229,225,242,225,226,233, 99,128,  6,109,242,225,226,233, 99,128,
-      6,109,109,  2, 56,200, 56,206,225,244,104,128, 34, 23,239,238,
-    239,243,240,225,227,101,128,255, 10,243,237,225,236,108,128,254,
-     97,109,128, 32, 66,245,240,229,242,233,239,114,128,246,233,249,
-    237,240,244,239,244,233,227,225,236,236,249,229,241,245,225,108,
-    128, 34, 67,116,132,  0, 64, 57, 15, 57, 22, 57, 34, 57, 42,233,
-    236,228,101,128,  0,227,237,239,238,239,243,240,225,227,101,128,
-    255, 32,243,237,225,236,108,128,254,107,245,242,238,229,100,128,
-      2, 80,117,  6, 57, 64, 57, 89, 57, 96, 57,121, 57,141, 57,157,
-     98,  2, 57, 70, 57, 79,229,238,231,225,236,105,128,  9,148,239,
-    240,239,237,239,230,111,128, 49, 32,228,229,246, 97,128,  9, 20,
-    231,117,  2, 57,103, 57,112,234,225,242,225,244,105,128, 10,148,
-    242,237,245,235,232,105,128, 10, 20,236,229,238,231,244,232,237,
-    225,242,235,226,229,238,231,225,236,105,128,  9,215,237,225,244,
-    242,225,231,245,242,237,245,235,232,105,128, 10, 76,246,239,247,
-    229,236,243,233,231,110,  3, 57,173, 57,183, 57,190,226,229,238,
-    231,225,236,105,128,  9,204,228,229,246, 97,128,  9, 76,231,245,
-    234,225,242,225,244,105,128, 10,204,246,225,231,242,225,232,225,
-    228,229,246, 97,128,  9, 61,121,  2, 57,221, 57,233,226,225,242,
-    237,229,238,233,225,110,128,  5, 97,233,110,130,  5,226, 57,242,
-     58,  1,225,236,244,239,238,229,232,229,226,242,229,119,128,251,
-     32,232,229,226,242,229,119,128,  5,226, 98,144,  0, 98, 58, 46,
-     58,181, 58,192, 58,201, 58,226, 60, 11, 60, 73, 60,146, 62, 72,
-     62, 84, 62,127, 62,135, 62,145, 64, 15, 64, 39, 64, 48, 97,  7,
-     58, 62, 58, 72, 58, 96, 58,103, 58,128, 58,152, 58,163,226,229,
-    238,231,225,236,105,128,  9,172,227,235,243,236,225,243,104,129,
-      0, 92, 58, 84,237,239,238,239,243,240,225,227,101,128,255, 60,
-    228,229,246, 97,128,  9, 44,231,117,  2, 58,110, 58,119,234,225,
-    242,225,244,105,128, 10,172,242,237,245,235,232,105,128, 10, 44,
-    104,  2, 58,134, 58,144,233,242,225,231,225,238, 97,128, 48,112,
-    244,244,232,225,105,128, 14, 63,235,225,244,225,235,225,238, 97,
-    128, 48,208,114,129,  0,124, 58,169,237,239,238,239,243,240,225,
-    227,101,128,255, 92,226,239,240,239,237,239,230,111,128, 49,  5,
-    227,233,242,227,236,101,128, 36,209,228,239,116,  2, 58,209, 58,
-    218,225,227,227,229,238,116,128, 30,  3,226,229,236,239,119,128,
-     30,  5,101,  6, 58,240, 59,  5, 59, 28, 59,170, 59,181, 59,193,
-    225,237,229,228,243,233,248,244,229,229,238,244,232,238,239,244,
-    229,115,128, 38,108, 99,  2, 59, 11, 59, 18,225,245,243,101,128,
-     34, 53,249,242,233,236,236,233, 99,128,  4, 49,104,  5, 59, 40,
-     59, 49, 59, 63, 59, 93, 59,152,225,242,225,226,233, 99,128,  6,
-     40,230,233,238,225,236,225,242,225,226,233, 99,128,254,144,105,
-      2, 59, 69, 59, 84,238,233,244,233,225,236,225,242,225,226,233,
-     99,128,254,145,242,225,231,225,238, 97,128, 48,121,237,101,  2,
-     59,100, 59,113,228,233,225,236,225,242,225,226,233, 99,128,254,
-    146,229,237,105,  2, 59,121, 59,136,238,233,244,233,225,236,225,
-    242,225,226,233, 99,128,252,159,243,239,236,225,244,229,228,225,
-    242,225,226,233, 99,128,252,  8,238,239,239,238,230,233,238,225,
-    236,225,242,225,226,233, 99,128,252,109,235,225,244,225,235,225,
-    238, 97,128, 48,217,238,225,242,237,229,238,233,225,110,128,  5,
-     98,116,132,  5,209, 59,205, 59,225, 59,245, 59,254, 97,129,  3,
-    178, 59,211,243,249,237,226,239,236,231,242,229,229,107,128,  3,
-    208,228,225,231,229,243,104,129,251, 49, 59,236,232,229,226,242,
-    229,119,128,251, 49,232,229,226,242,229,119,128,  5,209,242,225,
-    230,229,232,229,226,242,229,119,128,251, 76,104,  2, 60, 17, 60,
-     67, 97,  3, 60, 25, 60, 35, 60, 42,226,229,238,231,225,236,105,
-    128,  9,173,228,229,246, 97,128,  9, 45,231,117,  2, 60, 49, 60,
-     58,234,225,242,225,244,105,128, 10,173,242,237,245,235,232,105,
-    128, 10, 45,239,239,107,128,  2, 83,105,  5, 60, 85, 60, 96, 60,
-    107, 60,121, 60,135,232,233,242,225,231,225,238, 97,128, 48,115,
-    235,225,244,225,235,225,238, 97,128, 48,211,236,225,226,233,225,
-    236,227,236,233,227,107,128,  2,152,238,228,233,231,245,242,237,
-    245,235,232,105,128, 10,  2,242,245,243,241,245,225,242,101,128,
-     51, 49,108,  3, 60,154, 62, 55, 62, 66, 97,  2, 60,160, 62, 50,
-    227,107,  6, 60,175, 60,184, 60,221, 61,114, 61,169, 61,221,227,
-    233,242,227,236,101,128, 37,207,100,  2, 60,190, 60,199,233,225,
-    237,239,238,100,128, 37,198,239,247,238,240,239,233,238,244,233,
-    238,231,244,242,233,225,238,231,236,101,128, 37,188,108,  2, 60,
-    227, 61, 74,101,  2, 60,233, 61, 13,230,244,240,239,233,238,244,
-    233,238,103,  2, 60,248, 61,  2,240,239,233,238,244,229,114,128,
-     37,196,244,242,233,225,238,231,236,101,128, 37,192,238,244,233,
-    227,245,236,225,242,226,242,225,227,235,229,116,  2, 61, 33, 61,
-     53,236,229,230,116,129, 48, 16, 61, 42,246,229,242,244,233,227,
-    225,108,128,254, 59,242,233,231,232,116,129, 48, 17, 61, 63,246,
-    229,242,244,233,227,225,108,128,254, 60,239,247,229,114,  2, 61,
-     83, 61, 98,236,229,230,244,244,242,233,225,238,231,236,101,128,
-     37,227,242,233,231,232,244,244,242,233,225,238,231,236,101,128,
-     37,226,114,  2, 61,120, 61,131,229,227,244,225,238,231,236,101,
-    128, 37,172,233,231,232,244,240,239,233,238,244,233,238,103,  2,
-     61,148, 61,158,240,239,233,238,244,229,114,128, 37,186,244,242,
-    233,225,238,231,236,101,128, 37,182,115,  3, 61,177, 61,207, 61,
-    215,109,  2, 61,183, 61,195,225,236,236,243,241,245,225,242,101,
-    128, 37,170,233,236,233,238,231,230,225,227,101,128, 38, 59,241,
-    245,225,242,101,128, 37,160,244,225,114,128, 38,  5,245,240,112,
-      2, 61,229, 62, 11,229,114,  2, 61,236, 61,251,236,229,230,244,
-    244,242,233,225,238,231,236,101,128, 37,228,242,233,231,232,244,
-    244,242,233,225,238,231,236,101,128, 37,229,239,233,238,244,233,
-    238,103,  2, 62, 23, 62, 39,243,237,225,236,236,244,242,233,225,
-    238,231,236,101,128, 37,180,244,242,233,225,238,231,236,101,128,
-     37,178,238,107,128, 36, 35,233,238,229,226,229,236,239,119,128,
-     30,  7,239,227,107,128, 37,136,237,239,238,239,243,240,225,227,
-    101,128,255, 66,111,  3, 62, 92, 62,105, 62,116,226,225,233,237,
-    225,233,244,232,225,105,128, 14, 26,232,233,242,225,231,225,238,
-     97,128, 48,124,235,225,244,225,235,225,238, 97,128, 48,220,240,
-    225,242,229,110,128, 36,157,241,243,241,245,225,242,101,128, 51,
-    195,114,  4, 62,155, 63,149, 63,222, 64,  5,225, 99,  2, 62,162,
-     63, 56,101,  3, 62,170, 62,175, 62,243,229,120,128,248,244,236,
-    229,230,116,133,  0,123, 62,192, 62,197, 62,219, 62,227, 62,232,
-    226,116,128,248,243,109,  2, 62,203, 62,208,233,100,128,248,242,
-    239,238,239,243,240,225,227,101,128,255, 91,243,237,225,236,108,
-    128,254, 91,244,112,128,248,241,246,229,242,244,233,227,225,108,
-    128,254, 55,242,233,231,232,116,133,  0,125, 63,  5, 63, 10, 63,
-     32, 63, 40, 63, 45,226,116,128,248,254,109,  2, 63, 16, 63, 21,
-    233,100,128,248,253,239,238,239,243,240,225,227,101,128,255, 93,
-    243,237,225,236,108,128,254, 92,244,112,128,248,252,246,229,242,
-    244,233,227,225,108,128,254, 56,235,229,116,  2, 63, 64, 63,106,
-    236,229,230,116,132,  0, 91, 63, 79, 63, 84, 63, 89, 63,101,226,
-    116,128,248,240,229,120,128,248,239,237,239,238,239,243,240,225,
-    227,101,128,255, 59,244,112,128,248,238,242,233,231,232,116,132,
-      0, 93, 63,122, 63,127, 63,132, 63,144,226,116,128,248,251,229,
-    120,128,248,250,237,239,238,239,243,240,225,227,101,128,255, 61,
-    244,112,128,248,249,229,246,101,131,  2,216, 63,161, 63,172, 63,
-    178,226,229,236,239,247,227,237, 98,128,  3, 46,227,237, 98,128,
-      3,  6,233,238,246,229,242,244,229,100,  3, 63,193, 63,204, 63,
-    210,226,229,236,239,247,227,237, 98,128,  3, 47,227,237, 98,128,
-      3, 17,228,239,245,226,236,229,227,237, 98,128,  3, 97,233,228,
-    231,101,  2, 63,231, 63,242,226,229,236,239,247,227,237, 98,128,
-      3, 42,233,238,246,229,242,244,229,228,226,229,236,239,247,227,
-    237, 98,128,  3, 58,239,235,229,238,226,225,114,128,  0,166,115,
-      2, 64, 21, 64, 29,244,242,239,235,101,128,  1,128,245,240,229,
-    242,233,239,114,128,246,234,244,239,240,226,225,114,128,  1,131,
-    117,  3, 64, 56, 64, 67, 64, 78,232,233,242,225,231,225,238, 97,
-    128, 48,118,235,225,244,225,235,225,238, 97,128, 48,214,236,108,
-      2, 64, 85, 64,115,229,116,130, 32, 34, 64, 94, 64,104,233,238,
-    246,229,242,243,101,128, 37,216,239,240,229,242,225,244,239,114,
-    128, 34, 25,243,229,249,101,128, 37,206, 99,143,  0, 99, 64,156,
-     65,105, 65,116, 65,180, 65,211, 66, 48, 67,215, 68,199, 69, 43,
-     69, 92, 72, 84, 72, 92, 72,102, 72,114, 72,147, 97,  9, 64,176,
-     64,187, 64,197, 64,204, 64,211, 64,236, 64,246, 65, 42, 65, 51,
-    225,242,237,229,238,233,225,110,128,  5,110,226,229,238,231,225,
-    236,105,128,  9,154,227,245,244,101,128,  1,  7,228,229,246, 97,
-    128,  9, 26,231,117,  2, 64,218, 64,227,234,225,242,225,244,105,
-    128, 10,154,242,237,245,235,232,105,128, 10, 26,236,243,241,245,
-    225,242,101,128, 51,136,238,228,242,225,226,233,238,228,117,  4,
-     65,  8, 65, 18, 65, 24, 65, 31,226,229,238,231,225,236,105,128,
-      9,129,227,237, 98,128,  3, 16,228,229,246, 97,128,  9,  1,231,
-    245,234,225,242,225,244,105,128, 10,129,240,243,236,239,227,107,
-    128, 33,234,114,  3, 65, 59, 65, 65, 65, 91,229,239,102,128, 33,
-      5,239,110,130,  2,199, 65, 74, 65, 85,226,229,236,239,247,227,
-    237, 98,128,  3, 44,227,237, 98,128,  3, 12,242,233,225,231,229,
-    242,229,244,245,242,110,128, 33,181,226,239,240,239,237,239,230,
-    111,128, 49, 24, 99,  4, 65,126, 65,133, 65,152, 65,174,225,242,
-    239,110,128,  1, 13,229,228,233,236,236, 97,129,  0,231, 65,144,
-    225,227,245,244,101,128, 30,  9,233,242, 99,  2, 65,160, 65,165,
-    236,101,128, 36,210,245,237,230,236,229,120,128,  1,  9,245,242,
-    108,128,  2, 85,100,  2, 65,186, 65,202,239,116,129,  1, 11, 65,
-    193,225,227,227,229,238,116,128,  1, 11,243,241,245,225,242,101,
-    128, 51,197,101,  2, 65,217, 65,233,228,233,236,236, 97,129,  0,
-    184, 65,227,227,237, 98,128,  3, 39,238,116,132,  0,162, 65,246,
-     66, 14, 66, 26, 66, 37,105,  2, 65,252, 66,  4,231,242,225,228,
-    101,128, 33,  3,238,230,229,242,233,239,114,128,246,223,237,239,
-    238,239,243,240,225,227,101,128,255,224,239,236,228,243,244,249,
-    236,101,128,247,162,243,245,240,229,242,233,239,114,128,246,224,
-    104,  5, 66, 60, 66,123, 66,134, 67, 62, 67,154, 97,  4, 66, 70,
-     66, 81, 66, 91, 66, 98,225,242,237,229,238,233,225,110,128,  5,
-    121,226,229,238,231,225,236,105,128,  9,155,228,229,246, 97,128,
-      9, 27,231,117,  2, 66,105, 66,114,234,225,242,225,244,105,128,
-     10,155,242,237,245,235,232,105,128, 10, 27,226,239,240,239,237,
-    239,230,111,128, 49, 20,101,  6, 66,148, 66,168, 66,192, 67,  4,
-     67, 16, 67, 37,225,226,235,232,225,243,233,225,238,227,249,242,
-    233,236,236,233, 99,128,  4,189, 99,  2, 66,174, 66,182,235,237,
-    225,242,107,128, 39, 19,249,242,233,236,236,233, 99,128,  4, 71,
-    100,  2, 66,198, 66,242,229,243,227,229,238,228,229,114,  2, 66,
-    211, 66,231,225,226,235,232,225,243,233,225,238,227,249,242,233,
-    236,236,233, 99,128,  4,191,227,249,242,233,236,236,233, 99,128,
-      4,183,233,229,242,229,243,233,243,227,249,242,233,236,236,233,
-     99,128,  4,245,232,225,242,237,229,238,233,225,110,128,  5,115,
-    235,232,225,235,225,243,243,233,225,238,227,249,242,233,236,236,
-    233, 99,128,  4,204,246,229,242,244,233,227,225,236,243,244,242,
-    239,235,229,227,249,242,233,236,236,233, 99,128,  4,185,105,129,
-      3,199, 67, 68,229,245,227,104,  4, 67, 81, 67,116, 67,131, 67,
-    140, 97,  2, 67, 87, 67,102,227,233,242,227,236,229,235,239,242,
-    229,225,110,128, 50,119,240,225,242,229,238,235,239,242,229,225,
-    110,128, 50, 23,227,233,242,227,236,229,235,239,242,229,225,110,
-    128, 50,105,235,239,242,229,225,110,128, 49, 74,240,225,242,229,
-    238,235,239,242,229,225,110,128, 50,  9,111,  2, 67,160, 67,210,
-    227,104,  3, 67,169, 67,191, 67,201,225,110,  2, 67,176, 67,184,
-    231,244,232,225,105,128, 14, 10,244,232,225,105,128, 14,  8,233,
-    238,231,244,232,225,105,128, 14,  9,239,229,244,232,225,105,128,
-     14, 12,239,107,128,  1,136,105,  2, 67,221, 68, 67,229,245, 99,
-      5, 67,235, 68, 14, 68, 29, 68, 38, 68, 52, 97,  2, 67,241, 68,
-      0,227,233,242,227,236,229,235,239,242,229,225,110,128, 50,118,
-    240,225,242,229,238,235,239,242,229,225,110,128, 50, 22,227,233,
-    242,227,236,229,235,239,242,229,225,110,128, 50,104,235,239,242,
-    229,225,110,128, 49, 72,240,225,242,229,238,235,239,242,229,225,
-    110,128, 50,  8,245,240,225,242,229,238,235,239,242,229,225,110,
-    128, 50, 28,242, 99,  2, 68, 74, 68,169,236,101,132, 37,203, 68,
-     87, 68, 98, 68,103, 68,127,237,245,236,244,233,240,236,121,128,
-     34,151,239,116,128, 34,153,112,  2, 68,109, 68,115,236,245,115,
-    128, 34,149,239,243,244,225,236,237,225,242,107,128, 48, 54,247,
-    233,244,104,  2, 68,136, 68,152,236,229,230,244,232,225,236,230,
-    226,236,225,227,107,128, 37,208,242,233,231,232,244,232,225,236,
-    230,226,236,225,227,107,128, 37,209,245,237,230,236,229,120,130,
-      2,198, 68,182, 68,193,226,229,236,239,247,227,237, 98,128,  3,
-     45,227,237, 98,128,  3,  2,108,  3, 68,207, 68,213, 69, 11,229,
-    225,114,128, 35, 39,233,227,107,  4, 68,225, 68,236, 68,245, 68,
-    255,225,236,246,229,239,236,225,114,128,  1,194,228,229,238,244,
-    225,108,128,  1,192,236,225,244,229,242,225,108,128,  1,193,242,
-    229,244,242,239,230,236,229,120,128,  1,195,245, 98,129, 38, 99,
-     69, 18,243,245,233,116,  2, 69, 27, 69, 35,226,236,225,227,107,
-    128, 38, 99,247,232,233,244,101,128, 38,103,109,  3, 69, 51, 69,
-     65, 69, 76,227,245,226,229,228,243,241,245,225,242,101,128, 51,
-    164,239,238,239,243,240,225,227,101,128,255, 67,243,241,245,225,
-    242,229,228,243,241,245,225,242,101,128, 51,160,111,  8, 69,110,
-     69,121, 69,208, 70,150, 71,179, 71,210, 72, 61, 72, 70,225,242,
-    237,229,238,233,225,110,128,  5,129,236,239,110,131,  0, 58, 69,
-    133, 69,158, 69,177,237,239,110,  2, 69,141, 69,149,229,244,225,
-    242,121,128, 32,161,239,243,240,225,227,101,128,255, 26,115,  2,
-     69,164, 69,170,233,231,110,128, 32,161,237,225,236,108,128,254,
-     85,244,242,233,225,238,231,245,236,225,114,  2, 69,192, 69,202,
-    232,225,236,230,237,239,100,128,  2,209,237,239,100,128,  2,208,
-    109,  2, 69,214, 70,143,237, 97,134,  0, 44, 69,231, 70, 39, 70,
-     50, 70, 62, 70, 92, 70,115, 97,  3, 69,239, 70,  9, 70, 17,226,
-    239,246,101,  2, 69,248, 69,254,227,237, 98,128,  3, 19,242,233,
-    231,232,244,227,237, 98,128,  3, 21,227,227,229,238,116,128,246,
-    195,114,  2, 70, 23, 70, 30,225,226,233, 99,128,  6, 12,237,229,
-    238,233,225,110,128,  5, 93,233,238,230,229,242,233,239,114,128,
-    246,225,237,239,238,239,243,240,225,227,101,128,255, 12,242,229,
-    246,229,242,243,229,100,  2, 70, 75, 70, 86,225,226,239,246,229,
-    227,237, 98,128,  3, 20,237,239,100,128,  2,189,115,  2, 70, 98,
-     70,105,237,225,236,108,128,254, 80,245,240,229,242,233,239,114,
-    128,246,226,244,245,242,238,229,100,  2, 70,126, 70,137,225,226,
-    239,246,229,227,237, 98,128,  3, 18,237,239,100,128,  2,187,240,
-    225,243,115,128, 38, 60,110,  2, 70,156, 70,165,231,242,245,229,
-    238,116,128, 34, 69,116,  2, 70,171, 70,185,239,245,242,233,238,
-    244,229,231,242,225,108,128, 34, 46,242,239,108,142, 35,  3, 70,
-    219, 70,225, 70,240, 70,255, 71, 43, 71, 88, 71,102, 71,107, 71,
-    112, 71,117, 71,123, 71,128, 71,169, 71,174,193,195, 75,128,  0,
-      6, 66,  2, 70,231, 70,236,197, 76,128,  0,  7, 83,128,  0,  8,
-     67,  2, 70,246, 70,251,193, 78,128,  0, 24, 82,128,  0, 13, 68,
-      3, 71,  7, 71, 33, 71, 38, 67,  4, 71, 17, 71, 21, 71, 25, 71,
-     29, 49,128,  0, 17, 50,128,  0, 18, 51,128,  0, 19, 52,128,  0,
-     20,197, 76,128,  0,127,204, 69,128,  0, 16, 69,  5, 71, 55, 71,
-     59, 71, 64, 71, 69, 71, 74, 77,128,  0, 25,206, 81,128,  0,  5,
-    207, 84,128,  0,  4,211, 67,128,  0, 27, 84,  2, 71, 80, 71, 84,
-     66,128,  0, 23, 88,128,  0,  3, 70,  2, 71, 94, 71, 98, 70,128,
-      0, 12, 83,128,  0, 28,199, 83,128,  0, 29,200, 84,128,  0,  9,
-    204, 70,128,  0, 10,206,193, 75,128,  0, 21,210, 83,128,  0, 30,
-     83,  5, 71,140, 71,144, 71,154, 71,159, 71,164, 73,128,  0, 15,
-     79,129,  0, 14, 71,150, 84,128,  0,  2,212, 88,128,  0,  1,213,
-     66,128,  0, 26,217, 78,128,  0, 22,213, 83,128,  0, 31,214, 84,
-    128,  0, 11,240,249,242,233,231,232,116,129,  0,169, 71,191,115,
-      2, 71,197, 71,203,225,238,115,128,248,233,229,242,233,102,128,
-    246,217,114,  2, 71,216, 72, 44,238,229,242,226,242,225,227,235,
-    229,116,  2, 71,231, 72,  9,236,229,230,116,130, 48, 12, 71,242,
-     71,254,232,225,236,230,247,233,228,244,104,128,255, 98,246,229,
-    242,244,233,227,225,108,128,254, 65,242,233,231,232,116,130, 48,
-     13, 72, 21, 72, 33,232,225,236,230,247,233,228,244,104,128,255,
-     99,246,229,242,244,233,227,225,108,128,254, 66,240,239,242,225,
-    244,233,239,238,243,241,245,225,242,101,128, 51,127,243,241,245,
-    225,242,101,128, 51,199,246,229,242,235,231,243,241,245,225,242,
-    101,128, 51,198,240,225,242,229,110,128, 36,158,242,245,250,229,
-    233,242,111,128, 32,162,243,244,242,229,244,227,232,229,100,128,
-      2,151,245,114,  2, 72,121, 72,139,236,121,  2, 72,128, 72,134,
-    225,238,100,128, 34,207,239,114,128, 34,206,242,229,238,227,121,
-    128,  0,164,249,114,  4, 72,158, 72,166, 72,173, 72,181,194,242,
-    229,246,101,128,246,209,198,236,229,120,128,246,210,226,242,229,
-    246,101,128,246,212,230,236,229,120,128,246,213,100,146,  0,100,
-     72,228, 74,110, 75,134, 75,194, 76,114, 77, 68, 77,130, 78, 59,
-     78, 72, 78, 81, 78,107, 78,132, 78,141, 79,208, 79,216, 79,227,
-     79,247, 80, 19, 97, 11, 72,252, 73,  7, 73, 17, 73, 89, 73,152,
-     73,163, 73,174, 73,243, 74, 49, 74, 55, 74, 85,225,242,237,229,
-    238,233,225,110,128,  5,100,226,229,238,231,225,236,105,128,  9,
-    166,100,  5, 73, 29, 73, 38, 73, 44, 73, 58, 73, 74,225,242,225,
-    226,233, 99,128,  6, 54,229,246, 97,128,  9, 38,230,233,238,225,
-    236,225,242,225,226,233, 99,128,254,190,233,238,233,244,233,225,
-    236,225,242,225,226,233, 99,128,254,191,237,229,228,233,225,236,
-    225,242,225,226,233, 99,128,254,192,103,  3, 73, 97, 73,114, 73,
-    128,229,243,104,129,  5,188, 73,105,232,229,226,242,229,119,128,
-      5,188,231,229,114,129, 32, 32, 73,122,228,226,108,128, 32, 33,
-    117,  2, 73,134, 73,143,234,225,242,225,244,105,128, 10,166,242,
-    237,245,235,232,105,128, 10, 38,232,233,242,225,231,225,238, 97,
-    128, 48, 96,235,225,244,225,235,225,238, 97,128, 48,192,108,  3,
-     73,182, 73,191, 73,229,225,242,225,226,233, 99,128,  6, 47,229,
-    116,130,  5,211, 73,200, 73,220,228,225,231,229,243,104,129,251,
-     51, 73,211,232,229,226,242,229,119,128,251, 51,232,229,226,242,
-    229,119,128,  5,211,230,233,238,225,236,225,242,225,226,233, 99,
-    128,254,170,237,237, 97,  3, 73,253, 74,  6, 74, 18,225,242,225,
-    226,233, 99,128,  6, 79,236,239,247,225,242,225,226,233, 99,128,
-      6, 79,244,225,238, 97,  2, 74, 27, 74, 41,236,244,239,238,229,
-    225,242,225,226,233, 99,128,  6, 76,242,225,226,233, 99,128,  6,
-     76,238,228, 97,128,  9,100,242,231, 97,  2, 74, 63, 74, 72,232,
-    229,226,242,229,119,128,  5,167,236,229,230,244,232,229,226,242,
-    229,119,128,  5,167,243,233,225,240,238,229,245,237,225,244,225,
-    227,249,242,233,236,236,233,227,227,237, 98,128,  4,133, 98,  3,
-     74,118, 75,115, 75,125,108,  9, 74,138, 74,146, 75,  3, 75, 11,
-     75, 27, 75, 38, 75, 56, 75, 70, 75, 81,199,242,225,246,101,128,
-    246,211, 97,  2, 74,152, 74,209,238,231,236,229,226,242,225,227,
-    235,229,116,  2, 74,168, 74,188,236,229,230,116,129, 48, 10, 74,
-    177,246,229,242,244,233,227,225,108,128,254, 61,242,233,231,232,
-    116,129, 48, 11, 74,198,246,229,242,244,233,227,225,108,128,254,
-     62,114,  2, 74,215, 74,236,227,232,233,238,246,229,242,244,229,
-    228,226,229,236,239,247,227,237, 98,128,  3, 43,242,239,119,  2,
-     74,244, 74,251,236,229,230,116,128, 33,212,242,233,231,232,116,
-    128, 33,210,228,225,238,228, 97,128,  9,101,231,242,225,246,101,
-    129,246,214, 75, 21,227,237, 98,128,  3, 15,233,238,244,229,231,
-    242,225,108,128, 34, 44,236,239,247,236,233,238,101,129, 32, 23,
-     75, 50,227,237, 98,128,  3, 51,239,246,229,242,236,233,238,229,
-    227,237, 98,128,  3, 63,240,242,233,237,229,237,239,100,128,  2,
-    186,246,229,242,244,233,227,225,108,  2, 75, 94, 75,100,226,225,
-    114,128, 32, 22,236,233,238,229,225,226,239,246,229,227,237, 98,
-    128,  3, 14,239,240,239,237,239,230,111,128, 49,  9,243,241,245,
-    225,242,101,128, 51,200, 99,  4, 75,144, 75,151, 75,160, 75,187,
-    225,242,239,110,128,  1, 15,229,228,233,236,236, 97,128, 30, 17,
-    233,242, 99,  2, 75,168, 75,173,236,101,128, 36,211,245,237,230,
-    236,229,248,226,229,236,239,119,128, 30, 19,242,239,225,116,128,
-      1, 17,100,  4, 75,204, 76, 29, 76, 39, 76, 90, 97,  4, 75,214,
-     75,224, 75,231, 76,  0,226,229,238,231,225,236,105,128,  9,161,
-    228,229,246, 97,128,  9, 33,231,117,  2, 75,238, 75,247,234,225,
-    242,225,244,105,128, 10,161,242,237,245,235,232,105,128, 10, 33,
-    108,  2, 76,  6, 76, 15,225,242,225,226,233, 99,128,  6,136,230,
-    233,238,225,236,225,242,225,226,233, 99,128,251,137,228,232,225,
-    228,229,246, 97,128,  9, 92,232, 97,  3, 76, 48, 76, 58, 76, 65,
-    226,229,238,231,225,236,105,128,  9,162,228,229,246, 97,128,  9,
-     34,231,117,  2, 76, 72, 76, 81,234,225,242,225,244,105,128, 10,
-    162,242,237,245,235,232,105,128, 10, 34,239,116,  2, 76, 97, 76,
-    106,225,227,227,229,238,116,128, 30, 11,226,229,236,239,119,128,
-     30, 13,101,  8, 76,132, 76,185, 76,192, 76,217, 76,227, 76,238,
-     77, 27, 77, 63, 99,  2, 76,138, 76,175,233,237,225,236,243,229,
-    240,225,242,225,244,239,114,  2, 76,156, 76,165,225,242,225,226,
-    233, 99,128,  6,107,240,229,242,243,233,225,110,128,  6,107,249,
-    242,233,236,236,233, 99,128,  4, 52,231,242,229,101,128,  0,176,
-    232,105,  2, 76,199, 76,208,232,229,226,242,229,119,128,  5,173,
-    242,225,231,225,238, 97,128, 48,103,233,227,239,240,244,233, 99,
-    128,  3,239,235,225,244,225,235,225,238, 97,128, 48,199,108,  2,
-     76,244, 77, 11,229,244,101,  2, 76,252, 77,  3,236,229,230,116,
-    128, 35, 43,242,233,231,232,116,128, 35, 38,244, 97,129,  3,180,
-     77, 18,244,245,242,238,229,100,128,  1,141,238,239,237,233,238,
-    225,244,239,242,237,233,238,245,243,239,238,229,238,245,237,229,
-    242,225,244,239,242,226,229,238,231,225,236,105,128,  9,248,250,
-    104,128,  2,164,104,  2, 77, 74, 77,124, 97,  3, 77, 82, 77, 92,
-     77, 99,226,229,238,231,225,236,105,128,  9,167,228,229,246, 97,
-    128,  9, 39,231,117,  2, 77,106, 77,115,234,225,242,225,244,105,
-    128, 10,167,242,237,245,235,232,105,128, 10, 39,239,239,107,128,
-      2, 87,105,  6, 77,144, 77,193, 77,253, 78,  8, 78, 19, 78, 29,
-     97,  2, 77,150, 77,172,236,249,244,233,235,225,244,239,238,239,
-    115,129,  3,133, 77,166,227,237, 98,128,  3, 68,237,239,238,100,
-    129, 38,102, 77,181,243,245,233,244,247,232,233,244,101,128, 38,
-     98,229,242,229,243,233,115,133,  0,168, 77,212, 77,220, 77,231,
-     77,237, 77,245,225,227,245,244,101,128,246,215,226,229,236,239,
-    247,227,237, 98,128,  3, 36,227,237, 98,128,  3,  8,231,242,225,
-    246,101,128,246,216,244,239,238,239,115,128,  3,133,232,233,242,
-    225,231,225,238, 97,128, 48, 98,235,225,244,225,235,225,238, 97,
-    128, 48,194,244,244,239,237,225,242,107,128, 48,  3,246,105,  2,
-     78, 36, 78, 47,228,101,129,  0,247, 78, 43,115,128, 34, 35,243,
-    233,239,238,243,236,225,243,104,128, 34, 21,234,229,227,249,242,
-    233,236,236,233, 99,128,  4, 82,235,243,232,225,228,101,128, 37,
-    147,108,  2, 78, 87, 78, 98,233,238,229,226,229,236,239,119,128,
-     30, 15,243,241,245,225,242,101,128, 51,151,109,  2, 78,113, 78,
-    121,225,227,242,239,110,128,  1, 17,239,238,239,243,240,225,227,
-    101,128,255, 68,238,226,236,239,227,107,128, 37,132,111, 10, 78,
-    163, 78,175, 78,185, 78,196, 78,207, 79, 23, 79, 28, 79, 39, 79,
-    154, 79,180,227,232,225,228,225,244,232,225,105,128, 14, 14,228,
-    229,235,244,232,225,105,128, 14, 20,232,233,242,225,231,225,238,
-     97,128, 48,105,235,225,244,225,235,225,238, 97,128, 48,201,236,
-    236,225,114,132,  0, 36, 78,222, 78,233, 78,245, 79,  0,233,238,
-    230,229,242,233,239,114,128,246,227,237,239,238,239,243,240,225,
-    227,101,128,255,  4,239,236,228,243,244,249,236,101,128,247, 36,
-    115,  2, 79,  6, 79, 13,237,225,236,108,128,254,105,245,240,229,
-    242,233,239,114,128,246,228,238,103,128, 32,171,242,245,243,241,
-    245,225,242,101,128, 51, 38,116,  6, 79, 53, 79, 70, 79, 92, 79,
-    103, 79,135, 79,142,225,227,227,229,238,116,129,  2,217, 79, 64,
-    227,237, 98,128,  3,  7,226,229,236,239,247, 99,  2, 79, 81, 79,
-     86,237, 98,128,  3, 35,239,237, 98,128,  3, 35,235,225,244,225,
-    235,225,238, 97,128, 48,251,236,229,243,115,  2, 79,112, 79,116,
-    105,128,  1, 49,106,129,246,190, 79,122,243,244,242,239,235,229,
-    232,239,239,107,128,  2,132,237,225,244,104,128, 34,197,244,229,
-    228,227,233,242,227,236,101,128, 37,204,245,226,236,229,249,239,
-    228,240,225,244,225,104,129,251, 31, 79,171,232,229,226,242,229,
-    119,128,251, 31,247,238,244,225,227,107,  2, 79,191, 79,202,226,
-    229,236,239,247,227,237, 98,128,  3, 30,237,239,100,128,  2,213,
-    240,225,242,229,110,128, 36,159,243,245,240,229,242,233,239,114,
-    128,246,235,116,  2, 79,233, 79,239,225,233,108,128,  2, 86,239,
-    240,226,225,114,128,  1,140,117,  2, 79,253, 80,  8,232,233,242,
-    225,231,225,238, 97,128, 48,101,235,225,244,225,235,225,238, 97,
-    128, 48,197,122,132,  1,243, 80, 31, 80, 40, 80, 59, 80, 96,225,
-    236,244,239,238,101,128,  2,163, 99,  2, 80, 46, 80, 53,225,242,
-    239,110,128,  1,198,245,242,108,128,  2,165,101,  2, 80, 65, 80,
-     85,225,226,235,232,225,243,233,225,238,227,249,242,233,236,236,
-    233, 99,128,  4,225,227,249,242,233,236,236,233, 99,128,  4, 85,
-    232,229,227,249,242,233,236,236,233, 99,128,  4, 95,101,151,  0,
-    101, 80,159, 80,178, 80,212, 81,186, 81,248, 82, 25, 82, 37, 82,
-     60, 82,113, 83,225, 84, 27, 84,129, 84,245, 85,124, 85,199, 85,
-    230, 86, 36, 86, 89, 87, 24, 87,157, 87,177, 87,221, 88, 56, 97,
-      2, 80,165, 80,172,227,245,244,101,128,  0,233,242,244,104,128,
-     38, 65, 98,  3, 80,186, 80,195, 80,205,229,238,231,225,236,105,
-    128,  9,143,239,240,239,237,239,230,111,128, 49, 28,242,229,246,
-    101,128,  1, 21, 99,  5, 80,224, 81, 41, 81, 55, 81, 87, 81,176,
-     97,  2, 80,230, 81, 35,238,228,242, 97,  3, 80,241, 80,248, 81,
-      3,228,229,246, 97,128,  9, 13,231,245,234,225,242,225,244,105,
-    128, 10,141,246,239,247,229,236,243,233,231,110,  2, 81, 17, 81,
-     24,228,229,246, 97,128,  9, 69,231,245,234,225,242,225,244,105,
-    128, 10,197,242,239,110,128,  1, 27,229,228,233,236,236,225,226,
-    242,229,246,101,128, 30, 29,104,  2, 81, 61, 81, 72,225,242,237,
-    229,238,233,225,110,128,  5,101,249,233,247,238,225,242,237,229,
-    238,233,225,110,128,  5,135,233,242, 99,  2, 81, 95, 81,100,236,
-    101,128, 36,212,245,237,230,236,229,120,134,  0,234, 81,121, 81,
-    129, 81,137, 81,148, 81,156, 81,168,225,227,245,244,101,128, 30,
-    191,226,229,236,239,119,128, 30, 25,228,239,244,226,229,236,239,
-    119,128, 30,199,231,242,225,246,101,128, 30,193,232,239,239,235,
-    225,226,239,246,101,128, 30,195,244,233,236,228,101,128, 30,197,
-    249,242,233,236,236,233, 99,128,  4, 84,100,  4, 81,196, 81,206,
-     81,212, 81,222,226,236,231,242,225,246,101,128,  2,  5,229,246,
-     97,128,  9, 15,233,229,242,229,243,233,115,128,  0,235,239,116,
-    130,  1, 23, 81,231, 81,240,225,227,227,229,238,116,128,  1, 23,
-    226,229,236,239,119,128, 30,185,101,  2, 81,254, 82,  9,231,245,
-    242,237,245,235,232,105,128, 10, 15,237,225,244,242,225,231,245,
-    242,237,245,235,232,105,128, 10, 71,230,227,249,242,233,236,236,
-    233, 99,128,  4, 68,103,  2, 82, 43, 82, 50,242,225,246,101,128,
-      0,232,245,234,225,242,225,244,105,128, 10,143,104,  4, 82, 70,
-     82, 81, 82, 92, 82,102,225,242,237,229,238,233,225,110,128,  5,
-    103,226,239,240,239,237,239,230,111,128, 49, 29,233,242,225,231,
-    225,238, 97,128, 48, 72,239,239,235,225,226,239,246,101,128, 30,
-    187,105,  4, 82,123, 82,134, 83,192, 83,207,226,239,240,239,237,
-    239,230,111,128, 49, 31,231,232,116,142,  0, 56, 82,168, 82,177,
-     82,187, 82,217, 82,224, 83,  6, 83, 31, 83, 76, 83,110, 83,122,
-     83,133, 83,166, 83,174, 83,185,225,242,225,226,233, 99,128,  6,
-    104,226,229,238,231,225,236,105,128,  9,238,227,233,242,227,236,
-    101,129, 36,103, 82,198,233,238,246,229,242,243,229,243,225,238,
-    243,243,229,242,233,102,128, 39,145,228,229,246, 97,128,  9,110,
-    229,229,110,  2, 82,232, 82,241,227,233,242,227,236,101,128, 36,
-    113,112,  2, 82,247, 82,254,225,242,229,110,128, 36,133,229,242,
-    233,239,100,128, 36,153,231,117,  2, 83, 13, 83, 22,234,225,242,
-    225,244,105,128, 10,238,242,237,245,235,232,105,128, 10,110,104,
-      2, 83, 37, 83, 63, 97,  2, 83, 43, 83, 54,227,235,225,242,225,
-    226,233, 99,128,  6,104,238,231,250,232,239,117,128, 48, 40,238,
-    239,244,229,226,229,225,237,229,100,128, 38,107,105,  2, 83, 82,
-     83,100,228,229,239,231,242,225,240,232,233,227,240,225,242,229,
-    110,128, 50, 39,238,230,229,242,233,239,114,128, 32,136,237,239,
-    238,239,243,240,225,227,101,128,255, 24,239,236,228,243,244,249,
-    236,101,128,247, 56,112,  2, 83,139, 83,146,225,242,229,110,128,
-     36,123,229,114,  2, 83,153, 83,159,233,239,100,128, 36,143,243,
-    233,225,110,128,  6,248,242,239,237,225,110,128, 33,119,243,245,
-    240,229,242,233,239,114,128, 32,120,244,232,225,105,128, 14, 88,
-    238,246,229,242,244,229,228,226,242,229,246,101,128,  2,  7,239,
-    244,233,230,233,229,228,227,249,242,233,236,236,233, 99,128,  4,
-    101,107,  2, 83,231, 83,255,225,244,225,235,225,238, 97,129, 48,
-    168, 83,243,232,225,236,230,247,233,228,244,104,128,255,116,111,
-      2, 84,  5, 84, 20,238,235,225,242,231,245,242,237,245,235,232,
-    105,128, 10,116,242,229,225,110,128, 49, 84,108,  3, 84, 35, 84,
-     46, 84,107,227,249,242,233,236,236,233, 99,128,  4, 59,101,  2,
-     84, 52, 84, 59,237,229,238,116,128, 34,  8,246,229,110,  3, 84,
-     69, 84, 78, 84, 99,227,233,242,227,236,101,128, 36,106,112,  2,
-     84, 84, 84, 91,225,242,229,110,128, 36,126,229,242,233,239,100,
-    128, 36,146,242,239,237,225,110,128, 33,122,236,233,240,243,233,
-    115,129, 32, 38, 84,118,246,229,242,244,233,227,225,108,128, 34,
-    238,109,  5, 84,141, 84,169, 84,180, 84,200, 84,211,225,227,242,
-    239,110,130,  1, 19, 84,153, 84,161,225,227,245,244,101,128, 30,
-     23,231,242,225,246,101,128, 30, 21,227,249,242,233,236,236,233,
-     99,128,  4, 60,228,225,243,104,129, 32, 20, 84,189,246,229,242,
-    244,233,227,225,108,128,254, 49,239,238,239,243,240,225,227,101,
-    128,255, 69,112,  2, 84,217, 84,237,232,225,243,233,243,237,225,
-    242,235,225,242,237,229,238,233,225,110,128,  5, 91,244,249,243,
-    229,116,128, 34,  5,110,  6, 85,  3, 85, 14, 85, 25, 85, 69, 85,
-    101, 85,116,226,239,240,239,237,239,230,111,128, 49, 35,227,249,
-    242,233,236,236,233, 99,128,  4, 61,100,  2, 85, 31, 85, 50,225,
-    243,104,129, 32, 19, 85, 39,246,229,242,244,233,227,225,108,128,
-    254, 50,229,243,227,229,238,228,229,242,227,249,242,233,236,236,
-    233, 99,128,  4,163,103,130,  1, 75, 85, 77, 85, 88,226,239,240,
-    239,237,239,230,111,128, 49, 37,232,229,227,249,242,233,236,236,
-    233, 99,128,  4,165,232,239,239,235,227,249,242,233,236,236,233,
-     99,128,  4,200,243,240,225,227,101,128, 32,  2,111,  3, 85,132,
-     85,140, 85,149,231,239,238,229,107,128,  1, 25,235,239,242,229,
-    225,110,128, 49, 83,240,229,110,130,  2, 91, 85,159, 85,168,227,
-    236,239,243,229,100,128,  2,154,242,229,246,229,242,243,229,100,
-    130,  2, 92, 85,183, 85,192,227,236,239,243,229,100,128,  2, 94,
-    232,239,239,107,128,  2, 93,112,  2, 85,205, 85,212,225,242,229,
-    110,128, 36,160,243,233,236,239,110,129,  3,181, 85,222,244,239,
-    238,239,115,128,  3,173,241,117,  2, 85,237, 86, 25,225,108,130,
-      0, 61, 85,246, 86,  2,237,239,238,239,243,240,225,227,101,128,
-    255, 29,115,  2, 86,  8, 86, 15,237,225,236,108,128,254,102,245,
-    240,229,242,233,239,114,128, 32,124,233,246,225,236,229,238,227,
-    101,128, 34, 97,114,  3, 86, 44, 86, 55, 86, 66,226,239,240,239,
-    237,239,230,111,128, 49, 38,227,249,242,233,236,236,233, 99,128,
-      4, 64,229,246,229,242,243,229,100,129,  2, 88, 86, 78,227,249,
-    242,233,236,236,233, 99,128,  4, 77,115,  6, 86,103, 86,114, 86,
-    134, 86,215, 87,  4, 87, 14,227,249,242,233,236,236,233, 99,128,
-      4, 65,228,229,243,227,229,238,228,229,242,227,249,242,233,236,
-    236,233, 99,128,  4,171,104,132,  2,131, 86,146, 86,153, 86,184,
-     86,199,227,245,242,108,128,  2,134,239,242,116,  2, 86,161, 86,
-    168,228,229,246, 97,128,  9, 14,246,239,247,229,236,243,233,231,
-    238,228,229,246, 97,128,  9, 70,242,229,246,229,242,243,229,228,
-    236,239,239,112,128,  1,170,243,241,245,225,244,242,229,246,229,
-    242,243,229,100,128,  2,133,237,225,236,108,  2, 86,224, 86,235,
-    232,233,242,225,231,225,238, 97,128, 48, 71,235,225,244,225,235,
-    225,238, 97,129, 48,167, 86,248,232,225,236,230,247,233,228,244,
-    104,128,255,106,244,233,237,225,244,229,100,128, 33, 46,245,240,
-    229,242,233,239,114,128,246,236,116,  5, 87, 36, 87, 62, 87, 66,
-     87, 83, 87,149, 97,130,  3,183, 87, 44, 87, 54,242,237,229,238,
-    233,225,110,128,  5,104,244,239,238,239,115,128,  3,174,104,128,
-      0,240,233,236,228,101,129, 30,189, 87, 75,226,229,236,239,119,
-    128, 30, 27,238,225,232,244, 97,  3, 87, 95, 87,127, 87,136,230,
-    239,245,235,104,  2, 87,105, 87,114,232,229,226,242,229,119,128,
-      5,145,236,229,230,244,232,229,226,242,229,119,128,  5,145,232,
-    229,226,242,229,119,128,  5,145,236,229,230,244,232,229,226,242,
-    229,119,128,  5,145,245,242,238,229,100,128,  1,221,117,  2, 87,
-    163, 87,172,235,239,242,229,225,110,128, 49, 97,242,111,128, 32,
-    172,246,239,247,229,236,243,233,231,110,  3, 87,193, 87,203, 87,
-    210,226,229,238,231,225,236,105,128,  9,199,228,229,246, 97,128,
-      9, 71,231,245,234,225,242,225,244,105,128, 10,199,120,  2, 87,
-    227, 88, 44,227,236,225,109,132,  0, 33, 87,242, 87,253, 88, 24,
-     88, 36,225,242,237,229,238,233,225,110,128,  5, 92,100,  2, 88,
-      3, 88,  8,226,108,128, 32, 60,239,247,110,129,  0,161, 88, 16,
-    243,237,225,236,108,128,247,161,237,239,238,239,243,240,225,227,
-    101,128,255,  1,243,237,225,236,108,128,247, 33,233,243,244,229,
-    238,244,233,225,108,128, 34,  3,250,104,131,  2,146, 88, 67, 88,
-     86, 88, 97, 99,  2, 88, 73, 88, 80,225,242,239,110,128,  1,239,
-    245,242,108,128,  2,147,242,229,246,229,242,243,229,100,128,  1,
-    185,244,225,233,108,128,  1,186,102,140,  0,102, 88,132, 88,214,
-     88,225, 88,234, 88,246, 89, 93, 89,109, 91,117, 91,130, 91,156,
-     93, 33, 93, 41, 97,  4, 88,142, 88,149, 88,160, 88,171,228,229,
-    246, 97,128,  9, 94,231,245,242,237,245,235,232,105,128, 10, 94,
-    232,242,229,238,232,229,233,116,128, 33,  9,244,232, 97,  3, 88,
-    181, 88,190, 88,202,225,242,225,226,233, 99,128,  6, 78,236,239,
-    247,225,242,225,226,233, 99,128,  6, 78,244,225,238,225,242,225,
-    226,233, 99,128,  6, 75,226,239,240,239,237,239,230,111,128, 49,
-      8,227,233,242,227,236,101,128, 36,213,228,239,244,225,227,227,
-    229,238,116,128, 30, 31,101,  3, 88,254, 89, 76, 89, 86,104,  4,
-     89,  8, 89, 31, 89, 45, 89, 61,225,114,  2, 89, 15, 89, 22,225,
-    226,233, 99,128,  6, 65,237,229,238,233,225,110,128,  5,134,230,
-    233,238,225,236,225,242,225,226,233, 99,128,254,210,233,238,233,
-    244,233,225,236,225,242,225,226,233, 99,128,254,211,237,229,228,
-    233,225,236,225,242,225,226,233, 99,128,254,212,233,227,239,240,
-    244,233, 99,128,  3,229,237,225,236,101,128, 38, 64,102,130,251,
-      0, 89,101, 89,105,105,128,251,  3,108,128,251,  4,105,136,251,
-      1, 89,129, 89,169, 89,180, 89,202, 90, 68, 90, 85, 90, 93, 90,
-    106,230,244,229,229,110,  2, 89,139, 89,148,227,233,242,227,236,
-    101,128, 36,110,112,  2, 89,154, 89,161,225,242,229,110,128, 36,
-    130,229,242,233,239,100,128, 36,150,231,245,242,229,228,225,243,
-    104,128, 32, 18,236,236,229,100,  2, 89,189, 89,195,226,239,120,
-    128, 37,160,242,229,227,116,128, 37,172,238,225,108,  5, 89,216,
-     89,255, 90, 16, 90, 33, 90, 49,235,225,102,130,  5,218, 89,226,
-     89,246,228,225,231,229,243,104,129,251, 58, 89,237,232,229,226,
-    242,229,119,128,251, 58,232,229,226,242,229,119,128,  5,218,237,
-    229,109,129,  5,221, 90,  7,232,229,226,242,229,119,128,  5,221,
-    238,245,110,129,  5,223, 90, 24,232,229,226,242,229,119,128,  5,
-    223,240,101,129,  5,227, 90, 40,232,229,226,242,229,119,128,  5,
-    227,244,243,225,228,105,129,  5,229, 90, 59,232,229,226,242,229,
-    119,128,  5,229,242,243,244,244,239,238,229,227,232,233,238,229,
-    243,101,128,  2,201,243,232,229,249,101,128, 37,201,244,225,227,
-    249,242,233,236,236,233, 99,128,  4,115,246,101,142,  0, 53, 90,
-    139, 90,148, 90,158, 90,188, 90,195, 90,205, 90,230, 91,  1, 91,
-     35, 91, 47, 91, 58, 91, 91, 91, 99, 91,110,225,242,225,226,233,
-     99,128,  6,101,226,229,238,231,225,236,105,128,  9,235,227,233,
-    242,227,236,101,129, 36,100, 90,169,233,238,246,229,242,243,229,
-    243,225,238,243,243,229,242,233,102,128, 39,142,228,229,246, 97,
-    128,  9,107,229,233,231,232,244,232,115,128, 33, 93,231,117,  2,
-     90,212, 90,221,234,225,242,225,244,105,128, 10,235,242,237,245,
-    235,232,105,128, 10,107,232, 97,  2, 90,237, 90,248,227,235,225,
-    242,225,226,233, 99,128,  6,101,238,231,250,232,239,117,128, 48,
-     37,105,  2, 91,  7, 91, 25,228,229,239,231,242,225,240,232,233,
-    227,240,225,242,229,110,128, 50, 36,238,230,229,242,233,239,114,
-    128, 32,133,237,239,238,239,243,240,225,227,101,128,255, 21,239,
-    236,228,243,244,249,236,101,128,247, 53,112,  2, 91, 64, 91, 71,
-    225,242,229,110,128, 36,120,229,114,  2, 91, 78, 91, 84,233,239,
-    100,128, 36,140,243,233,225,110,128,  6,245,242,239,237,225,110,
-    128, 33,116,243,245,240,229,242,233,239,114,128, 32,117,244,232,
-    225,105,128, 14, 85,108,129,251,  2, 91,123,239,242,233,110,128,
-      1,146,109,  2, 91,136, 91,147,239,238,239,243,240,225,227,101,
-    128,255, 70,243,241,245,225,242,101,128, 51,153,111,  4, 91,166,
-     91,188, 91,200, 91,207,230, 97,  2, 91,173, 91,181,238,244,232,
-    225,105,128, 14, 31,244,232,225,105,128, 14, 29,238,231,237,225,
-    238,244,232,225,105,128, 14, 79,242,225,236,108,128, 34,  0,245,
-    114,142,  0, 52, 91,240, 91,249, 92,  3, 92, 33, 92, 40, 92, 65,
-     92, 92, 92,126, 92,138, 92,157, 92,168, 92,201, 92,209, 92,220,
-    225,242,225,226,233, 99,128,  6,100,226,229,238,231,225,236,105,
-    128,  9,234,227,233,242,227,236,101,129, 36, 99, 92, 14,233,238,
-    246,229,242,243,229,243,225,238,243,243,229,242,233,102,128, 39,
-    141,228,229,246, 97,128,  9,106,231,117,  2, 92, 47, 92, 56,234,
-    225,242,225,244,105,128, 10,234,242,237,245,235,232,105,128, 10,
-    106,232, 97,  2, 92, 72, 92, 83,227,235,225,242,225,226,233, 99,
-    128,  6,100,238,231,250,232,239,117,128, 48, 36,105,  2, 92, 98,
-     92,116,228,229,239,231,242,225,240,232,233,227,240,225,242,229,
-    110,128, 50, 35,238,230,229,242,233,239,114,128, 32,132,237,239,
-    238,239,243,240,225,227,101,128,255, 20,238,245,237,229,242,225,
-    244,239,242,226,229,238,231,225,236,105,128,  9,247,239,236,228,
-    243,244,249,236,101,128,247, 52,112,  2, 92,174, 92,181,225,242,
-    229,110,128, 36,119,229,114,  2, 92,188, 92,194,233,239,100,128,
-     36,139,243,233,225,110,128,  6,244,242,239,237,225,110,128, 33,
-    115,243,245,240,229,242,233,239,114,128, 32,116,116,  2, 92,226,
-     93,  8,229,229,110,  2, 92,234, 92,243,227,233,242,227,236,101,
-    128, 36,109,112,  2, 92,249, 93,  0,225,242,229,110,128, 36,129,
-    229,242,233,239,100,128, 36,149,104,  2, 93, 14, 93, 19,225,105,
-    128, 14, 84,244,239,238,229,227,232,233,238,229,243,101,128,  2,
-    203,240,225,242,229,110,128, 36,161,242, 97,  2, 93, 48, 93, 56,
-    227,244,233,239,110,128, 32, 68,238, 99,128, 32,163,103,144,  0,
-    103, 93, 97, 94, 43, 94, 66, 94,127, 94,144, 95, 65, 96, 58, 96,
-    143, 96,156, 97, 14, 97, 39, 97, 67, 97, 89, 98, 34, 98, 56, 98,
-    158, 97,  9, 93,117, 93,127, 93,134, 93,141, 93,205, 93,230, 93,
-    241, 93,252, 94, 30,226,229,238,231,225,236,105,128,  9,151,227,
-    245,244,101,128,  1,245,228,229,246, 97,128,  9, 23,102,  4, 93,
-    151, 93,160, 93,174, 93,190,225,242,225,226,233, 99,128,  6,175,
-    230,233,238,225,236,225,242,225,226,233, 99,128,251,147,233,238,
-    233,244,233,225,236,225,242,225,226,233, 99,128,251,148,237,229,
-    228,233,225,236,225,242,225,226,233, 99,128,251,149,231,117,  2,
-     93,212, 93,221,234,225,242,225,244,105,128, 10,151,242,237,245,
-    235,232,105,128, 10, 23,232,233,242,225,231,225,238, 97,128, 48,
-     76,235,225,244,225,235,225,238, 97,128, 48,172,237,237, 97,130,
-      3,179, 94,  6, 94, 19,236,225,244,233,238,243,237,225,236,108,
-    128,  2, 99,243,245,240,229,242,233,239,114,128,  2,224,238,231,
-    233,225,227,239,240,244,233, 99,128,  3,235, 98,  2, 94, 49, 94,
-     59,239,240,239,237,239,230,111,128, 49, 13,242,229,246,101,128,
-      1, 31, 99,  4, 94, 76, 94, 83, 94, 92, 94,114,225,242,239,110,
-    128,  1,231,229,228,233,236,236, 97,128,  1, 35,233,242, 99,  2,
-     94,100, 94,105,236,101,128, 36,214,245,237,230,236,229,120,128,
-      1, 29,239,237,237,225,225,227,227,229,238,116,128,  1, 35,228,
-    239,116,129,  1, 33, 94,135,225,227,227,229,238,116,128,  1, 33,
-    101,  6, 94,158, 94,169, 94,180, 94,191, 94,210, 95, 56,227,249,
-    242,233,236,236,233, 99,128,  4, 51,232,233,242,225,231,225,238,
-     97,128, 48, 82,235,225,244,225,235,225,238, 97,128, 48,178,239,
-    237,229,244,242,233,227,225,236,236,249,229,241,245,225,108,128,
-     34, 81,114,  3, 94,218, 95, 11, 95, 21,229,243,104,  3, 94,228,
-     94,243, 94,252,225,227,227,229,238,244,232,229,226,242,229,119,
-    128,  5,156,232,229,226,242,229,119,128,  5,243,237,245,241,228,
-    225,237,232,229,226,242,229,119,128,  5,157,237,225,238,228,226,
-    236,115,128,  0,223,243,232,225,249,233,109,  2, 95, 32, 95, 47,
-    225,227,227,229,238,244,232,229,226,242,229,119,128,  5,158,232,
-    229,226,242,229,119,128,  5,244,244,225,237,225,242,107,128, 48,
-     19,104,  5, 95, 77, 95,210, 96, 17, 96, 42, 96, 48, 97,  4, 95,
-     87, 95, 97, 95,120, 95,145,226,229,238,231,225,236,105,128,  9,
-    152,100,  2, 95,103, 95,114,225,242,237,229,238,233,225,110,128,
-      5,114,229,246, 97,128,  9, 24,231,117,  2, 95,127, 95,136,234,
-    225,242,225,244,105,128, 10,152,242,237,245,235,232,105,128, 10,
-     24,233,110,  4, 95,156, 95,165, 95,179, 95,195,225,242,225,226,
-    233, 99,128,  6, 58,230,233,238,225,236,225,242,225,226,233, 99,
-    128,254,206,233,238,233,244,233,225,236,225,242,225,226,233, 99,
-    128,254,207,237,229,228,233,225,236,225,242,225,226,233, 99,128,
-    254,208,101,  3, 95,218, 95,239, 96,  0,237,233,228,228,236,229,
-    232,239,239,235,227,249,242,233,236,236,233, 99,128,  4,149,243,
-    244,242,239,235,229,227,249,242,233,236,236,233, 99,128,  4,147,
-    245,240,244,245,242,238,227,249,242,233,236,236,233, 99,128,  4,
-    145,232, 97,  2, 96, 24, 96, 31,228,229,246, 97,128,  9, 90,231,
-    245,242,237,245,235,232,105,128, 10, 90,239,239,107,128,  2, 96,
-    250,243,241,245,225,242,101,128, 51,147,105,  3, 96, 66, 96, 77,
-     96, 88,232,233,242,225,231,225,238, 97,128, 48, 78,235,225,244,
-    225,235,225,238, 97,128, 48,174,109,  2, 96, 94, 96,105,225,242,
-    237,229,238,233,225,110,128,  5, 99,229,108,130,  5,210, 96,114,
-     96,134,228,225,231,229,243,104,129,251, 50, 96,125,232,229,226,
-    242,229,119,128,251, 50,232,229,226,242,229,119,128,  5,210,234,
-    229,227,249,242,233,236,236,233, 99,128,  4, 83,236,239,244,244,
-    225,108,  2, 96,167, 96,184,233,238,246,229,242,244,229,228,243,
-    244,242,239,235,101,128,  1,190,243,244,239,112,132,  2,148, 96,
-    199, 96,210, 96,216, 96,248,233,238,246,229,242,244,229,100,128,
-      2,150,237,239,100,128,  2,192,242,229,246,229,242,243,229,100,
-    130,  2,149, 96,231, 96,237,237,239,100,128,  2,193,243,245,240,
-    229,242,233,239,114,128,  2,228,243,244,242,239,235,101,129,  2,
-    161, 97,  3,242,229,246,229,242,243,229,100,128,  2,162,109,  2,
-     97, 20, 97, 28,225,227,242,239,110,128, 30, 33,239,238,239,243,
-    240,225,227,101,128,255, 71,111,  2, 97, 45, 97, 56,232,233,242,
-    225,231,225,238, 97,128, 48, 84,235,225,244,225,235,225,238, 97,
-    128, 48,180,240, 97,  2, 97, 74, 97, 80,242,229,110,128, 36,162,
-    243,241,245,225,242,101,128, 51,172,114,  2, 97, 95, 97,192, 97,
-      2, 97,101, 97,109,228,233,229,238,116,128, 34,  7,246,101,134,
-      0, 96, 97,126, 97,137, 97,154, 97,161, 97,170, 97,182,226,229,
-    236,239,247,227,237, 98,128,  3, 22, 99,  2, 97,143, 97,148,237,
-     98,128,  3,  0,239,237, 98,128,  3,  0,228,229,246, 97,128,  9,
-     83,236,239,247,237,239,100,128,  2,206,237,239,238,239,243,240,
-    225,227,101,128,255, 64,244,239,238,229,227,237, 98,128,  3, 64,
-    229,225,244,229,114,132,  0, 62, 97,208, 97,227, 97,239, 98, 26,
-    229,241,245,225,108,129, 34,101, 97,218,239,242,236,229,243,115,
-    128, 34,219,237,239,238,239,243,240,225,227,101,128,255, 30,111,
-      2, 97,245, 98, 15,114,  2, 97,251, 98,  8,229,241,245,233,246,
-    225,236,229,238,116,128, 34,115,236,229,243,115,128, 34,119,246,
-    229,242,229,241,245,225,108,128, 34,103,243,237,225,236,108,128,
-    254,101,115,  2, 98, 40, 98, 48,227,242,233,240,116,128,  2, 97,
-    244,242,239,235,101,128,  1,229,117,  4, 98, 66, 98, 77, 98,134,
-     98,145,232,233,242,225,231,225,238, 97,128, 48, 80,233,108,  2,
-     98, 84, 98,109,236,229,237,239,116,  2, 98, 94, 98,101,236,229,
-    230,116,128,  0,171,242,233,231,232,116,128,  0,187,243,233,238,
-    231,108,  2, 98,119, 98,126,236,229,230,116,128, 32, 57,242,233,
-    231,232,116,128, 32, 58,235,225,244,225,235,225,238, 97,128, 48,
-    176,242,225,237,245,243,241,245,225,242,101,128, 51, 24,249,243,
-    241,245,225,242,101,128, 51,201,104,144,  0,104, 98,204,101, 90,
-    101,125,101,162,101,202,103, 90,103,110,104, 75,104, 87,104, 99,
-    105,167,105,175,105,186,105,195,106, 19,106, 23, 97, 13, 98,232,
-     99, 15, 99, 25, 99, 55, 99, 80, 99,158, 99,170, 99,195, 99,210,
-     99,239, 99,252,100, 54,100, 63, 97,  2, 98,238, 99,  1,226,235,
-    232,225,243,233,225,238,227,249,242,233,236,236,233, 99,128,  4,
-    169,236,244,239,238,229,225,242,225,226,233, 99,128,  6,193,226,
-    229,238,231,225,236,105,128,  9,185,228,101,  2, 99, 32, 99, 50,
-    243,227,229,238,228,229,242,227,249,242,233,236,236,233, 99,128,
-      4,179,246, 97,128,  9, 57,231,117,  2, 99, 62, 99, 71,234,225,
-    242,225,244,105,128, 10,185,242,237,245,235,232,105,128, 10, 57,
-    104,  4, 99, 90, 99, 99, 99,113, 99,143,225,242,225,226,233, 99,
-    128,  6, 45,230,233,238,225,236,225,242,225,226,233, 99,128,254,
-    162,105,  2, 99,119, 99,134,238,233,244,233,225,236,225,242,225,
-    226,233, 99,128,254,163,242,225,231,225,238, 97,128, 48,111,237,
-    229,228,233,225,236,225,242,225,226,233, 99,128,254,164,233,244,
-    245,243,241,245,225,242,101,128, 51, 42,235,225,244,225,235,225,
-    238, 97,129, 48,207, 99,183,232,225,236,230,247,233,228,244,104,
-    128,255,138,236,225,238,244,231,245,242,237,245,235,232,105,128,
-     10, 77,237,250, 97,  2, 99,218, 99,227,225,242,225,226,233, 99,
-    128,  6, 33,236,239,247,225,242,225,226,233, 99,128,  6, 33,238,
-    231,245,236,230,233,236,236,229,114,128, 49,100,114,  2,100,  2,
-    100, 18,228,243,233,231,238,227,249,242,233,236,236,233, 99,128,
-      4, 74,240,239,239,110,  2,100, 27,100, 40,236,229,230,244,226,
-    225,242,226,245,112,128, 33,188,242,233,231,232,244,226,225,242,
-    226,245,112,128, 33,192,243,241,245,225,242,101,128, 51,202,244,
-    225,102,  3,100, 73,100,165,101,  0,240,225,244,225,104,134,  5,
-    178,100, 93,100, 98,100,112,100,121,100,136,100,152,177, 54,128,
-      5,178, 50,  2,100,104,100,108, 51,128,  5,178,102,128,  5,178,
-    232,229,226,242,229,119,128,  5,178,238,225,242,242,239,247,232,
-    229,226,242,229,119,128,  5,178,241,245,225,242,244,229,242,232,
-    229,226,242,229,119,128,  5,178,247,233,228,229,232,229,226,242,
-    229,119,128,  5,178,241,225,237,225,244,115,135,  5,179,100,188,
-    100,193,100,198,100,203,100,212,100,227,100,243,177, 98,128,  5,
-    179,178, 56,128,  5,179,179, 52,128,  5,179,232,229,226,242,229,
-    119,128,  5,179,238,225,242,242,239,247,232,229,226,242,229,119,
-    128,  5,179,241,245,225,242,244,229,242,232,229,226,242,229,119,
-    128,  5,179,247,233,228,229,232,229,226,242,229,119,128,  5,179,
-    243,229,231,239,108,135,  5,177,101, 22,101, 27,101, 32,101, 37,
-    101, 46,101, 61,101, 77,177, 55,128,  5,177,178, 52,128,  5,177,
-    179, 48,128,  5,177,232,229,226,242,229,119,128,  5,177,238,225,
-    242,242,239,247,232,229,226,242,229,119,128,  5,177,241,245,225,
-    242,244,229,242,232,229,226,242,229,119,128,  5,177,247,233,228,
-    229,232,229,226,242,229,119,128,  5,177, 98,  3,101, 98,101,103,
-    101,113,225,114,128,  1, 39,239,240,239,237,239,230,111,128, 49,
-     15,242,229,246,229,226,229,236,239,119,128, 30, 43, 99,  2,101,
-    131,101,140,229,228,233,236,236, 97,128, 30, 41,233,242, 99,  2,
-    101,148,101,153,236,101,128, 36,215,245,237,230,236,229,120,128,
-      1, 37,100,  2,101,168,101,178,233,229,242,229,243,233,115,128,
-     30, 39,239,116,  2,101,185,101,194,225,227,227,229,238,116,128,
-     30, 35,226,229,236,239,119,128, 30, 37,101,136,  5,212,101,222,
-    101,255,102, 19,102,248,103,  8,103, 53,103, 62,103, 75,225,242,
-    116,129, 38,101,101,230,243,245,233,116,  2,101,239,101,247,226,
-    236,225,227,107,128, 38,101,247,232,233,244,101,128, 38, 97,228,
-    225,231,229,243,104,129,251, 52,102, 10,232,229,226,242,229,119,
-    128,251, 52,104,  6,102, 33,102, 61,102, 69,102,119,102,165,102,
-    214, 97,  2,102, 39,102, 53,236,244,239,238,229,225,242,225,226,
-    233, 99,128,  6,193,242,225,226,233, 99,128,  6, 71,229,226,242,
-    229,119,128,  5,212,230,233,238,225,236, 97,  2,102, 80,102,111,
-    236,116,  2,102, 87,102, 99,239,238,229,225,242,225,226,233, 99,
-    128,251,167,244,247,239,225,242,225,226,233, 99,128,254,234,242,
-    225,226,233, 99,128,254,234,232,225,237,250,225,225,226,239,246,
-    101,  2,102,134,102,148,230,233,238,225,236,225,242,225,226,233,
-     99,128,251,165,233,243,239,236,225,244,229,228,225,242,225,226,
-    233, 99,128,251,164,105,  2,102,171,102,205,238,233,244,233,225,
-    236, 97,  2,102,183,102,197,236,244,239,238,229,225,242,225,226,
-    233, 99,128,251,168,242,225,226,233, 99,128,254,235,242,225,231,
-    225,238, 97,128, 48,120,237,229,228,233,225,236, 97,  2,102,226,
-    102,240,236,244,239,238,229,225,242,225,226,233, 99,128,251,169,
-    242,225,226,233, 99,128,254,236,233,243,229,233,229,242,225,243,
-    241,245,225,242,101,128, 51,123,107,  2,103, 14,103, 38,225,244,
-    225,235,225,238, 97,129, 48,216,103, 26,232,225,236,230,247,233,
-    228,244,104,128,255,141,245,244,225,225,242,245,243,241,245,225,
-    242,101,128, 51, 54,238,231,232,239,239,107,128,  2,103,242,245,
-    244,245,243,241,245,225,242,101,128, 51, 57,116,129,  5,215,103,
-     81,232,229,226,242,229,119,128,  5,215,232,239,239,107,129,  2,
-    102,103, 99,243,245,240,229,242,233,239,114,128,  2,177,105,  4,
-    103,120,103,205,103,216,103,241,229,245,104,  4,103,132,103,167,
-    103,182,103,191, 97,  2,103,138,103,153,227,233,242,227,236,229,
-    235,239,242,229,225,110,128, 50,123,240,225,242,229,238,235,239,
-    242,229,225,110,128, 50, 27,227,233,242,227,236,229,235,239,242,
-    229,225,110,128, 50,109,235,239,242,229,225,110,128, 49, 78,240,
-    225,242,229,238,235,239,242,229,225,110,128, 50, 13,232,233,242,
-    225,231,225,238, 97,128, 48,114,235,225,244,225,235,225,238, 97,
-    129, 48,210,103,229,232,225,236,230,247,233,228,244,104,128,255,
-    139,242,233,113,134,  5,180,104,  3,104,  8,104, 22,104, 31,104,
-     46,104, 62,177, 52,128,  5,180, 50,  2,104, 14,104, 18, 49,128,
-      5,180,100,128,  5,180,232,229,226,242,229,119,128,  5,180,238,
-    225,242,242,239,247,232,229,226,242,229,119,128,  5,180,241,245,
-    225,242,244,229,242,232,229,226,242,229,119,128,  5,180,247,233,
-    228,229,232,229,226,242,229,119,128,  5,180,236,233,238,229,226,
-    229,236,239,119,128, 30,150,237,239,238,239,243,240,225,227,101,
-    128,255, 72,111,  9,104,119,104,130,104,154,104,179,105, 11,105,
-     24,105,110,105,150,105,161,225,242,237,229,238,233,225,110,128,
-      5,112,232,105,  2,104,137,104,145,240,244,232,225,105,128, 14,
-     43,242,225,231,225,238, 97,128, 48,123,235,225,244,225,235,225,
-    238, 97,129, 48,219,104,167,232,225,236,230,247,233,228,244,104,
-    128,255,142,236,225,109,135,  5,185,104,199,104,204,104,209,104,
-    214,104,223,104,238,104,254,177, 57,128,  5,185,178, 54,128,  5,
-    185,179, 50,128,  5,185,232,229,226,242,229,119,128,  5,185,238,
-    225,242,242,239,247,232,229,226,242,229,119,128,  5,185,241,245,
-    225,242,244,229,242,232,229,226,242,229,119,128,  5,185,247,233,
-    228,229,232,229,226,242,229,119,128,  5,185,238,239,235,232,245,
-    235,244,232,225,105,128, 14, 46,111,  2,105, 30,105,100,107,  4,
-    105, 40,105, 52,105, 58,105, 80,225,226,239,246,229,227,239,237,
-     98,128,  3,  9,227,237, 98,128,  3,  9,240,225,236,225,244,225,
-    236,233,250,229,228,226,229,236,239,247,227,237, 98,128,  3, 33,
-    242,229,244,242,239,230,236,229,248,226,229,236,239,247,227,237,
-     98,128,  3, 34,238,243,241,245,225,242,101,128, 51, 66,114,  2,
-    105,116,105,143,105,  2,105,122,105,131,227,239,240,244,233, 99,
-    128,  3,233,250,239,238,244,225,236,226,225,114,128, 32, 21,238,
-    227,237, 98,128,  3, 27,244,243,240,242,233,238,231,115,128, 38,
-    104,245,243,101,128, 35,  2,240,225,242,229,110,128, 36,163,243,
-    245,240,229,242,233,239,114,128,  2,176,244,245,242,238,229,100,
-    128,  2,101,117,  4,105,205,105,216,105,229,105,254,232,233,242,
-    225,231,225,238, 97,128, 48,117,233,233,244,239,243,241,245,225,
-    242,101,128, 51, 51,235,225,244,225,235,225,238, 97,129, 48,213,
-    105,242,232,225,236,230,247,233,228,244,104,128,255,140,238,231,
-    225,242,245,237,236,225,245,116,129,  2,221,106, 13,227,237, 98,
-    128,  3, 11,118,128,  1,149,249,240,232,229,110,132,  0, 45,106,
-     39,106, 50,106, 62,106, 85,233,238,230,229,242,233,239,114,128,
-    246,229,237,239,238,239,243,240,225,227,101,128,255, 13,115,  2,
-    106, 68,106, 75,237,225,236,108,128,254, 99,245,240,229,242,233,
-    239,114,128,246,230,244,247,111,128, 32, 16,105,149,  0,105,106,
-    137,106,160,106,194,106,241,110,123,110,243,111, 24,111, 51,111,
-    213,111,217,111,255,112, 21,112,105,113, 14,113, 89,113, 97,113,
-    110,113,197,113,254,114, 26,114, 70,225, 99,  2,106,144,106,150,
-    245,244,101,128,  0,237,249,242,233,236,236,233, 99,128,  4, 79,
-     98,  3,106,168,106,177,106,187,229,238,231,225,236,105,128,  9,
-    135,239,240,239,237,239,230,111,128, 49, 39,242,229,246,101,128,
-      1, 45, 99,  3,106,202,106,209,106,231,225,242,239,110,128,  1,
-    208,233,242, 99,  2,106,217,106,222,236,101,128, 36,216,245,237,
-    230,236,229,120,128,  0,238,249,242,233,236,236,233, 99,128,  4,
-     86,100,  4,106,251,107,  5,110, 80,110,113,226,236,231,242,225,
-    246,101,128,  2,  9,101,  2,107, 11,110, 75,239,231,242,225,240,
-    104,  7,107, 32,107, 46,107, 59,109,244,110, 19,110, 32,110, 44,
-    229,225,242,244,232,227,233,242,227,236,101,128, 50,143,230,233,
-    242,229,227,233,242,227,236,101,128, 50,139,233, 99, 14,107, 90,
-    107,106,107,205,108,  3,108, 69,108, 98,108,114,108,171,108,220,
-    108,232,109,  3,109, 70,109,208,109,237,225,236,236,233,225,238,
-    227,229,240,225,242,229,110,128, 50, 63, 99,  4,107,116,107,127,
-    107,141,107,148,225,236,236,240,225,242,229,110,128, 50, 58,229,
-    238,244,242,229,227,233,242,227,236,101,128, 50,165,236,239,243,
-    101,128, 48,  6,111,  3,107,156,107,171,107,191,237,237, 97,129,
-     48,  1,107,164,236,229,230,116,128,255,100,238,231,242,225,244,
-    245,236,225,244,233,239,238,240,225,242,229,110,128, 50, 55,242,
-    242,229,227,244,227,233,242,227,236,101,128, 50,163,101,  3,107,
-    213,107,225,107,242,225,242,244,232,240,225,242,229,110,128, 50,
-     47,238,244,229,242,240,242,233,243,229,240,225,242,229,110,128,
-     50, 61,248,227,229,236,236,229,238,244,227,233,242,227,236,101,
-    128, 50,157,102,  2,108,  9,108, 24,229,243,244,233,246,225,236,
-    240,225,242,229,110,128, 50, 64,105,  2,108, 30,108, 59,238,225,
-    238,227,233,225,108,  2,108, 42,108, 51,227,233,242,227,236,101,
-    128, 50,150,240,225,242,229,110,128, 50, 54,242,229,240,225,242,
-    229,110,128, 50, 43,104,  2,108, 75,108, 86,225,246,229,240,225,
-    242,229,110,128, 50, 50,233,231,232,227,233,242,227,236,101,128,
-     50,164,233,244,229,242,225,244,233,239,238,237,225,242,107,128,
-     48,  5,108,  3,108,122,108,148,108,160,225,226,239,114,  2,108,
-    131,108,140,227,233,242,227,236,101,128, 50,152,240,225,242,229,
-    110,128, 50, 56,229,230,244,227,233,242,227,236,101,128, 50,167,
-    239,247,227,233,242,227,236,101,128, 50,166,109,  2,108,177,108,
-    209,101,  2,108,183,108,198,228,233,227,233,238,229,227,233,242,
-    227,236,101,128, 50,169,244,225,236,240,225,242,229,110,128, 50,
-     46,239,239,238,240,225,242,229,110,128, 50, 42,238,225,237,229,
-    240,225,242,229,110,128, 50, 52,112,  2,108,238,108,246,229,242,
-    233,239,100,128, 48,  2,242,233,238,244,227,233,242,227,236,101,
-    128, 50,158,114,  2,109,  9,109, 57,101,  3,109, 17,109, 28,109,
-     43,225,227,232,240,225,242,229,110,128, 50, 67,240,242,229,243,
-    229,238,244,240,225,242,229,110,128, 50, 57,243,239,245,242,227,
-    229,240,225,242,229,110,128, 50, 62,233,231,232,244,227,233,242,
-    227,236,101,128, 50,168,115,  5,109, 82,109,111,109,125,109,150,
-    109,178,101,  2,109, 88,109,101,227,242,229,244,227,233,242,227,
-    236,101,128, 50,153,236,230,240,225,242,229,110,128, 50, 66,239,
-    227,233,229,244,249,240,225,242,229,110,128, 50, 51,112,  2,109,
-    131,109,137,225,227,101,128, 48,  0,229,227,233,225,236,240,225,
-    242,229,110,128, 50, 53,116,  2,109,156,109,167,239,227,235,240,
-    225,242,229,110,128, 50, 49,245,228,249,240,225,242,229,110,128,
-     50, 59,117,  2,109,184,109,193,238,240,225,242,229,110,128, 50,
-     48,240,229,242,246,233,243,229,240,225,242,229,110,128, 50, 60,
-    119,  2,109,214,109,226,225,244,229,242,240,225,242,229,110,128,
-     50, 44,239,239,228,240,225,242,229,110,128, 50, 45,250,229,242,
-    111,128, 48,  7,109,  2,109,250,110,  7,229,244,225,236,227,233,
-    242,227,236,101,128, 50,142,239,239,238,227,233,242,227,236,101,
-    128, 50,138,238,225,237,229,227,233,242,227,236,101,128, 50,148,
-    243,245,238,227,233,242,227,236,101,128, 50,144,119,  2,110, 50,
-    110, 63,225,244,229,242,227,233,242,227,236,101,128, 50,140,239,
-    239,228,227,233,242,227,236,101,128, 50,141,246, 97,128,  9,  7,
-    233,229,242,229,243,233,115,130,  0,239,110, 94,110,102,225,227,
-    245,244,101,128, 30, 47,227,249,242,233,236,236,233, 99,128,  4,
-    229,239,244,226,229,236,239,119,128, 30,203,101,  3,110,131,110,
-    147,110,158,226,242,229,246,229,227,249,242,233,236,236,233, 99,
-    128,  4,215,227,249,242,233,236,236,233, 99,128,  4, 53,245,238,
-    103,  4,110,170,110,205,110,220,110,229, 97,  2,110,176,110,191,
-    227,233,242,227,236,229,235,239,242,229,225,110,128, 50,117,240,
-    225,242,229,238,235,239,242,229,225,110,128, 50, 21,227,233,242,
-    227,236,229,235,239,242,229,225,110,128, 50,103,235,239,242,229,
-    225,110,128, 49, 71,240,225,242,229,238,235,239,242,229,225,110,
-    128, 50,  7,103,  2,110,249,111,  0,242,225,246,101,128,  0,236,
-    117,  2,111,  6,111, 15,234,225,242,225,244,105,128, 10,135,242,
-    237,245,235,232,105,128, 10,  7,104,  2,111, 30,111, 40,233,242,
-    225,231,225,238, 97,128, 48, 68,239,239,235,225,226,239,246,101,
-    128, 30,201,105,  8,111, 69,111, 79,111, 90,111, 97,111,122,111,
-    138,111,153,111,169,226,229,238,231,225,236,105,128,  9,136,227,
-    249,242,233,236,236,233, 99,128,  4, 56,228,229,246, 97,128,  9,
-      8,231,117,  2,111,104,111,113,234,225,242,225,244,105,128, 10,
-    136,242,237,245,235,232,105,128, 10,  8,237,225,244,242,225,231,
-    245,242,237,245,235,232,105,128, 10, 64,238,246,229,242,244,229,
-    228,226,242,229,246,101,128,  2, 11,243,232,239,242,244,227,249,
-    242,233,236,236,233, 99,128,  4, 57,246,239,247,229,236,243,233,
-    231,110,  3,111,185,111,195,111,202,226,229,238,231,225,236,105,
-    128,  9,192,228,229,246, 97,128,  9, 64,231,245,234,225,242,225,
-    244,105,128, 10,192,106,128,  1, 51,107,  2,111,223,111,247,225,
-    244,225,235,225,238, 97,129, 48,164,111,235,232,225,236,230,247,
-    233,228,244,104,128,255,114,239,242,229,225,110,128, 49, 99,108,
-      2,112,  5,112, 10,228,101,128,  2,220,245,249,232,229,226,242,
-    229,119,128,  5,172,109,  2,112, 27,112, 94, 97,  3,112, 35,112,
-     55,112, 80,227,242,239,110,129,  1, 43,112, 44,227,249,242,233,
-    236,236,233, 99,128,  4,227,231,229,239,242,225,240,240,242,239,
-    248,233,237,225,244,229,236,249,229,241,245,225,108,128, 34, 83,
-    244,242,225,231,245,242,237,245,235,232,105,128, 10, 63,239,238,
-    239,243,240,225,227,101,128,255, 73,110,  5,112,117,112,127,112,
-    136,112,148,112,232,227,242,229,237,229,238,116,128, 34,  6,230,
-    233,238,233,244,121,128, 34, 30,233,225,242,237,229,238,233,225,
-    110,128,  5,107,116,  2,112,154,112,222,101,  2,112,160,112,211,
-    231,242,225,108,131, 34, 43,112,173,112,191,112,196, 98,  2,112,
-    179,112,187,239,244,244,239,109,128, 35, 33,116,128, 35, 33,229,
-    120,128,248,245,116,  2,112,202,112,207,239,112,128, 35, 32,112,
-    128, 35, 32,242,243,229,227,244,233,239,110,128, 34, 41,233,243,
-    241,245,225,242,101,128, 51,  5,118,  3,112,240,112,249,113,  2,
-    226,245,236,236,229,116,128, 37,216,227,233,242,227,236,101,128,
-     37,217,243,237,233,236,229,230,225,227,101,128, 38, 59,111,  3,
-    113, 22,113, 33,113, 41,227,249,242,233,236,236,233, 99,128,  4,
-     81,231,239,238,229,107,128,  1, 47,244, 97,131,  3,185,113, 52,
-    113, 73,113, 81,228,233,229,242,229,243,233,115,129,  3,202,113,
-     65,244,239,238,239,115,128,  3,144,236,225,244,233,110,128,  2,
-    105,244,239,238,239,115,128,  3,175,240,225,242,229,110,128, 36,
-    164,242,233,231,245,242,237,245,235,232,105,128, 10,114,115,  4,
-    113,120,113,165,113,179,113,187,237,225,236,108,  2,113,129,113,
-    140,232,233,242,225,231,225,238, 97,128, 48, 67,235,225,244,225,
-    235,225,238, 97,129, 48,163,113,153,232,225,236,230,247,233,228,
-    244,104,128,255,104,243,232,225,242,226,229,238,231,225,236,105,
-    128,  9,250,244,242,239,235,101,128,  2,104,245,240,229,242,233,
-    239,114,128,246,237,116,  2,113,203,113,237,229,242,225,244,233,
-    239,110,  2,113,215,113,226,232,233,242,225,231,225,238, 97,128,
-     48,157,235,225,244,225,235,225,238, 97,128, 48,253,233,236,228,
-    101,129,  1, 41,113,246,226,229,236,239,119,128, 30, 45,117,  2,
-    114,  4,114, 15,226,239,240,239,237,239,230,111,128, 49, 41,227,
-    249,242,233,236,236,233, 99,128,  4, 78,246,239,247,229,236,243,
-    233,231,110,  3,114, 42,114, 52,114, 59,226,229,238,231,225,236,
-    105,128,  9,191,228,229,246, 97,128,  9, 63,231,245,234,225,242,
-    225,244,105,128, 10,191,250,232,233,244,243, 97,  2,114, 81,114,
-     92,227,249,242,233,236,236,233, 99,128,  4,117,228,226,236,231,
-    242,225,246,229,227,249,242,233,236,236,233, 99,128,  4,119,106,
-    138,  0,106,114,135,114,198,114,209,115,  3,115, 19,115,132,115,
-    201,115,206,115,218,115,226, 97,  4,114,145,114,156,114,166,114,
-    173,225,242,237,229,238,233,225,110,128,  5,113,226,229,238,231,
-    225,236,105,128,  9,156,228,229,246, 97,128,  9, 28,231,117,  2,
-    114,180,114,189,234,225,242,225,244,105,128, 10,156,242,237,245,
-    235,232,105,128, 10, 28,226,239,240,239,237,239,230,111,128, 49,
-     16, 99,  3,114,217,114,224,114,246,225,242,239,110,128,  1,240,
-    233,242, 99,  2,114,232,114,237,236,101,128, 36,217,245,237,230,
-    236,229,120,128,  1, 53,242,239,243,243,229,228,244,225,233,108,
-    128,  2,157,228,239,244,236,229,243,243,243,244,242,239,235,101,
-    128,  2, 95,101,  3,115, 27,115, 38,115,103,227,249,242,233,236,
-    236,233, 99,128,  4, 88,229,109,  4,115, 49,115, 58,115, 72,115,
-     88,225,242,225,226,233, 99,128,  6, 44,230,233,238,225,236,225,
-    242,225,226,233, 99,128,254,158,233,238,233,244,233,225,236,225,
-    242,225,226,233, 99,128,254,159,237,229,228,233,225,236,225,242,
-    225,226,233, 99,128,254,160,104,  2,115,109,115,118,225,242,225,
-    226,233, 99,128,  6,152,230,233,238,225,236,225,242,225,226,233,
-     99,128,251,139,104,  2,115,138,115,188, 97,  3,115,146,115,156,
-    115,163,226,229,238,231,225,236,105,128,  9,157,228,229,246, 97,
-    128,  9, 29,231,117,  2,115,170,115,179,234,225,242,225,244,105,
-    128, 10,157,242,237,245,235,232,105,128, 10, 29,229,232,225,242,
-    237,229,238,233,225,110,128,  5,123,233,115,128, 48,  4,237,239,
-    238,239,243,240,225,227,101,128,255, 74,240,225,242,229,110,128,
-     36,165,243,245,240,229,242,233,239,114,128,  2,178,107,146,  0,
-    107,116, 21,118,110,118,121,118,183,118,194,119, 28,119, 42,120,
-    150,121, 90,121,103,121,129,121,178,122, 60,122, 82,122, 95,122,
-    118,122,160,122,170, 97, 12,116, 47,116, 79,116,101,116,131,116,
-    245,117, 14,117, 44,117, 69,117,175,117,189,118, 56,118, 85, 98,
-      2,116, 53,116, 70,225,243,232,235,233,242,227,249,242,233,236,
-    236,233, 99,128,  4,161,229,238,231,225,236,105,128,  9,149, 99,
-      2,116, 85,116, 91,245,244,101,128, 30, 49,249,242,233,236,236,
-    233, 99,128,  4, 58,228,101,  2,116,108,116,126,243,227,229,238,
-    228,229,242,227,249,242,233,236,236,233, 99,128,  4,155,246, 97,
-    128,  9, 21,102,135,  5,219,116,149,116,158,116,178,116,192,116,
-    201,116,217,116,232,225,242,225,226,233, 99,128,  6, 67,228,225,
-    231,229,243,104,129,251, 59,116,169,232,229,226,242,229,119,128,
-    251, 59,230,233,238,225,236,225,242,225,226,233, 99,128,254,218,
-    232,229,226,242,229,119,128,  5,219,233,238,233,244,233,225,236,
-    225,242,225,226,233, 99,128,254,219,237,229,228,233,225,236,225,
-    242,225,226,233, 99,128,254,220,242,225,230,229,232,229,226,242,
-    229,119,128,251, 77,231,117,  2,116,252,117,  5,234,225,242,225,
-    244,105,128, 10,149,242,237,245,235,232,105,128, 10, 21,104,  2,
-    117, 20,117, 30,233,242,225,231,225,238, 97,128, 48, 75,239,239,
-    235,227,249,242,233,236,236,233, 99,128,  4,196,235,225,244,225,
-    235,225,238, 97,129, 48,171,117, 57,232,225,236,230,247,233,228,
-    244,104,128,255,118,112,  2,117, 75,117, 96,240, 97,129,  3,186,
-    117, 82,243,249,237,226,239,236,231,242,229,229,107,128,  3,240,
-    249,229,239,245,110,  3,117,108,117,122,117,156,237,233,229,245,
-    237,235,239,242,229,225,110,128, 49,113,112,  2,117,128,117,143,
-    232,233,229,245,240,232,235,239,242,229,225,110,128, 49,132,233,
-    229,245,240,235,239,242,229,225,110,128, 49,120,243,243,225,238,
-    231,240,233,229,245,240,235,239,242,229,225,110,128, 49,121,242,
-    239,242,233,233,243,241,245,225,242,101,128, 51, 13,115,  5,117,
-    201,117,245,118,  4,118, 12,118, 40,232,233,228,225,225,245,244,
-    111,  2,117,214,117,223,225,242,225,226,233, 99,128,  6, 64,238,
-    239,243,233,228,229,226,229,225,242,233,238,231,225,242,225,226,
-    233, 99,128,  6, 64,237,225,236,236,235,225,244,225,235,225,238,
-     97,128, 48,245,241,245,225,242,101,128, 51,132,242, 97,  2,118,
-     19,118, 28,225,242,225,226,233, 99,128,  6, 80,244,225,238,225,
-    242,225,226,233, 99,128,  6, 77,244,242,239,235,229,227,249,242,
-    233,236,236,233, 99,128,  4,159,244,225,232,233,242,225,240,242,
-    239,236,239,238,231,237,225,242,235,232,225,236,230,247,233,228,
-    244,104,128,255,112,246,229,242,244,233,227,225,236,243,244,242,
-    239,235,229,227,249,242,233,236,236,233, 99,128,  4,157,226,239,
-    240,239,237,239,230,111,128, 49, 14, 99,  4,118,131,118,153,118,
-    162,118,170, 97,  2,118,137,118,147,236,243,241,245,225,242,101,
-    128, 51,137,242,239,110,128,  1,233,229,228,233,236,236, 97,128,
-      1, 55,233,242,227,236,101,128, 36,218,239,237,237,225,225,227,
-    227,229,238,116,128,  1, 55,228,239,244,226,229,236,239,119,128,
-     30, 51,101,  4,118,204,118,231,119,  0,119, 12,104,  2,118,210,
-    118,221,225,242,237,229,238,233,225,110,128,  5,132,233,242,225,
-    231,225,238, 97,128, 48, 81,235,225,244,225,235,225,238, 97,129,
-     48,177,118,244,232,225,236,230,247,233,228,244,104,128,255,121,
-    238,225,242,237,229,238,233,225,110,128,  5,111,243,237,225,236,
-    236,235,225,244,225,235,225,238, 97,128, 48,246,231,242,229,229,
-    238,236,225,238,228,233, 99,128,  1, 56,104,  6,119, 56,119,185,
-    119,196,119,221,120, 52,120,140, 97,  5,119, 68,119, 78,119, 89,
-    119, 96,119,121,226,229,238,231,225,236,105,128,  9,150,227,249,
-    242,233,236,236,233, 99,128,  4, 69,228,229,246, 97,128,  9, 22,
-    231,117,  2,119,103,119,112,234,225,242,225,244,105,128, 10,150,
-    242,237,245,235,232,105,128, 10, 22,104,  4,119,131,119,140,119,
-    154,119,170,225,242,225,226,233, 99,128,  6, 46,230,233,238,225,
-    236,225,242,225,226,233, 99,128,254,166,233,238,233,244,233,225,
-    236,225,242,225,226,233, 99,128,254,167,237,229,228,233,225,236,
-    225,242,225,226,233, 99,128,254,168,229,233,227,239,240,244,233,
-     99,128,  3,231,232, 97,  2,119,203,119,210,228,229,246, 97,128,
-      9, 89,231,245,242,237,245,235,232,105,128, 10, 89,233,229,245,
-    235,104,  4,119,235,120, 14,120, 29,120, 38, 97,  2,119,241,120,
-      0,227,233,242,227,236,229,235,239,242,229,225,110,128, 50,120,
-    240,225,242,229,238,235,239,242,229,225,110,128, 50, 24,227,233,
-    242,227,236,229,235,239,242,229,225,110,128, 50,106,235,239,242,
-    229,225,110,128, 49, 75,240,225,242,229,238,235,239,242,229,225,
-    110,128, 50, 10,111,  4,120, 62,120,111,120,121,120,126,235,104,
-      4,120, 73,120, 82,120, 91,120,101,225,233,244,232,225,105,128,
-     14,  2,239,238,244,232,225,105,128, 14,  5,245,225,244,244,232,
-    225,105,128, 14,  3,247,225,233,244,232,225,105,128, 14,  4,237,
-    245,244,244,232,225,105,128, 14, 91,239,107,128,  1,153,242,225,
-    235,232,225,238,231,244,232,225,105,128, 14,  6,250,243,241,245,
-    225,242,101,128, 51,145,105,  4,120,160,120,171,120,196,120,245,
-    232,233,242,225,231,225,238, 97,128, 48, 77,235,225,244,225,235,
-    225,238, 97,129, 48,173,120,184,232,225,236,230,247,233,228,244,
-    104,128,255,119,242,111,  3,120,205,120,220,120,236,231,245,242,
-    225,237,245,243,241,245,225,242,101,128, 51, 21,237,229,229,244,
-    239,242,245,243,241,245,225,242,101,128, 51, 22,243,241,245,225,
-    242,101,128, 51, 20,249,229,239,107,  5,121,  4,121, 39,121, 54,
-    121, 63,121, 77, 97,  2,121, 10,121, 25,227,233,242,227,236,229,
-    235,239,242,229,225,110,128, 50,110,240,225,242,229,238,235,239,
-    242,229,225,110,128, 50, 14,227,233,242,227,236,229,235,239,242,
-    229,225,110,128, 50, 96,235,239,242,229,225,110,128, 49, 49,240,
-    225,242,229,238,235,239,242,229,225,110,128, 50,  0,243,233,239,
-    243,235,239,242,229,225,110,128, 49, 51,234,229,227,249,242,233,
-    236,236,233, 99,128,  4, 92,108,  2,121,109,121,120,233,238,229,
-    226,229,236,239,119,128, 30, 53,243,241,245,225,242,101,128, 51,
-    152,109,  3,121,137,121,151,121,162,227,245,226,229,228,243,241,
-    245,225,242,101,128, 51,166,239,238,239,243,240,225,227,101,128,
-    255, 75,243,241,245,225,242,229,228,243,241,245,225,242,101,128,
-     51,162,111,  5,121,190,121,216,121,254,122, 10,122, 24,104,  2,
-    121,196,121,206,233,242,225,231,225,238, 97,128, 48, 83,237,243,
-    241,245,225,242,101,128, 51,192,235, 97,  2,121,223,121,231,233,
-    244,232,225,105,128, 14,  1,244,225,235,225,238, 97,129, 48,179,
-    121,242,232,225,236,230,247,233,228,244,104,128,255,122,239,240,
-    239,243,241,245,225,242,101,128, 51, 30,240,240,225,227,249,242,
-    233,236,236,233, 99,128,  4,129,114,  2,122, 30,122, 50,229,225,
-    238,243,244,225,238,228,225,242,228,243,249,237,226,239,108,128,
-     50,127,239,238,233,243,227,237, 98,128,  3, 67,240, 97,  2,122,
-     67,122, 73,242,229,110,128, 36,166,243,241,245,225,242,101,128,
-     51,170,243,233,227,249,242,233,236,236,233, 99,128,  4,111,116,
-      2,122,101,122,110,243,241,245,225,242,101,128, 51,207,245,242,
-    238,229,100,128,  2,158,117,  2,122,124,122,135,232,233,242,225,
-    231,225,238, 97,128, 48, 79,235,225,244,225,235,225,238, 97,129,
-     48,175,122,148,232,225,236,230,247,233,228,244,104,128,255,120,
-    246,243,241,245,225,242,101,128, 51,184,247,243,241,245,225,242,
-    101,128, 51,190,108,146,  0,108,122,220,124,247,125, 20,125, 86,
-    125,124,126, 20,126, 29,126, 45,126, 69,126, 87,126,205,126,246,
-    127,125,127,133,127,166,127,175,127,183,127,245, 97,  7,122,236,
-    122,246,122,253,123,  4,123, 29,123, 45,124,235,226,229,238,231,
-    225,236,105,128,  9,178,227,245,244,101,128,  1, 58,228,229,246,
-     97,128,  9, 50,231,117,  2,123, 11,123, 20,234,225,242,225,244,
-    105,128, 10,178,242,237,245,235,232,105,128, 10, 50,235,235,232,
-    225,238,231,249,225,239,244,232,225,105,128, 14, 69,109, 10,123,
-     67,124,  6,124, 23,124, 61,124, 75,124, 94,124,110,124,130,124,
-    150,124,173, 97,  2,123, 73,123,254,236,229,102,  4,123, 85,123,
-     99,123,191,123,208,230,233,238,225,236,225,242,225,226,233, 99,
-    128,254,252,232,225,237,250, 97,  2,123,109,123,150,225,226,239,
-    246,101,  2,123,119,123,133,230,233,238,225,236,225,242,225,226,
-    233, 99,128,254,248,233,243,239,236,225,244,229,228,225,242,225,
-    226,233, 99,128,254,247,226,229,236,239,119,  2,123,160,123,174,
-    230,233,238,225,236,225,242,225,226,233, 99,128,254,250,233,243,
-    239,236,225,244,229,228,225,242,225,226,233, 99,128,254,249,233,
-    243,239,236,225,244,229,228,225,242,225,226,233, 99,128,254,251,
-    237,225,228,228,225,225,226,239,246,101,  2,123,223,123,237,230,
-    233,238,225,236,225,242,225,226,233, 99,128,254,246,233,243,239,
-    236,225,244,229,228,225,242,225,226,233, 99,128,254,245,242,225,
-    226,233, 99,128,  6, 68,226,228, 97,129,  3,187,124, 14,243,244,
-    242,239,235,101,128,  1,155,229,100,130,  5,220,124, 32,124, 52,
-    228,225,231,229,243,104,129,251, 60,124, 43,232,229,226,242,229,
-    119,128,251, 60,232,229,226,242,229,119,128,  5,220,230,233,238,
-    225,236,225,242,225,226,233, 99,128,254,222,232,225,232,233,238,
-    233,244,233,225,236,225,242,225,226,233, 99,128,252,202,233,238,
-    233,244,233,225,236,225,242,225,226,233, 99,128,254,223,234,229,
-    229,237,233,238,233,244,233,225,236,225,242,225,226,233, 99,128,
-    252,201,235,232,225,232,233,238,233,244,233,225,236,225,242,225,
-    226,233, 99,128,252,203,236,225,237,232,229,232,233,243,239,236,
-    225,244,229,228,225,242,225,226,233, 99,128,253,242,237,101,  2,
-    124,180,124,193,228,233,225,236,225,242,225,226,233, 99,128,254,
-    224,229,109,  2,124,200,124,219,232,225,232,233,238,233,244,233,
-    225,236,225,242,225,226,233, 99,128,253,136,233,238,233,244,233,
-    225,236,225,242,225,226,233, 99,128,252,204,242,231,229,227,233,
-    242,227,236,101,128, 37,239, 98,  3,124,255,125,  4,125, 10,225,
-    114,128,  1,154,229,236,116,128,  2,108,239,240,239,237,239,230,
-    111,128, 49, 12, 99,  4,125, 30,125, 37,125, 46,125, 73,225,242,
-    239,110,128,  1, 62,229,228,233,236,236, 97,128,  1, 60,233,242,
-     99,  2,125, 54,125, 59,236,101,128, 36,219,245,237,230,236,229,
-    248,226,229,236,239,119,128, 30, 61,239,237,237,225,225,227,227,
-    229,238,116,128,  1, 60,228,239,116,130,  1, 64,125, 96,125,105,
-    225,227,227,229,238,116,128,  1, 64,226,229,236,239,119,129, 30,
-     55,125,115,237,225,227,242,239,110,128, 30, 57,101,  3,125,132,
-    125,170,126, 15,230,116,  2,125,139,125,155,225,238,231,236,229,
-    225,226,239,246,229,227,237, 98,128,  3, 26,244,225,227,235,226,
-    229,236,239,247,227,237, 98,128,  3, 24,243,115,132,  0, 60,125,
-    183,125,205,125,217,126,  7,229,241,245,225,108,129, 34,100,125,
-    193,239,242,231,242,229,225,244,229,114,128, 34,218,237,239,238,
-    239,243,240,225,227,101,128,255, 28,111,  2,125,223,125,252,114,
-      2,125,229,125,242,229,241,245,233,246,225,236,229,238,116,128,
-     34,114,231,242,229,225,244,229,114,128, 34,118,246,229,242,229,
-    241,245,225,108,128, 34,102,243,237,225,236,108,128,254,100,250,
-    104,128,  2,110,230,226,236,239,227,107,128, 37,140,232,239,239,
-    235,242,229,244,242,239,230,236,229,120,128,  2,109,105,  2,126,
-     51,126, 56,242, 97,128, 32,164,247,238,225,242,237,229,238,233,
-    225,110,128,  5,108,106,129,  1,201,126, 75,229,227,249,242,233,
-    236,236,233, 99,128,  4, 89,108,132,246,192,126, 99,126,123,126,
-    134,126,143, 97,  2,126,105,126,112,228,229,246, 97,128,  9, 51,
-    231,245,234,225,242,225,244,105,128, 10,179,233,238,229,226,229,
-    236,239,119,128, 30, 59,236,225,228,229,246, 97,128,  9, 52,246,
-    239,227,225,236,233, 99,  3,126,157,126,167,126,174,226,229,238,
-    231,225,236,105,128,  9,225,228,229,246, 97,128,  9, 97,246,239,
-    247,229,236,243,233,231,110,  2,126,188,126,198,226,229,238,231,
-    225,236,105,128,  9,227,228,229,246, 97,128,  9, 99,109,  3,126,
-    213,126,226,126,237,233,228,228,236,229,244,233,236,228,101,128,
-      2,107,239,238,239,243,240,225,227,101,128,255, 76,243,241,245,
-    225,242,101,128, 51,208,111,  6,127,  4,127, 16,127, 58,127, 69,
-    127, 75,127,117,227,232,245,236,225,244,232,225,105,128, 14, 44,
-    231,233,227,225,108,  3,127, 28,127, 34,127, 53,225,238,100,128,
-     34, 39,238,239,116,129,  0,172,127, 42,242,229,246,229,242,243,
-    229,100,128, 35, 16,239,114,128, 34, 40,236,233,238,231,244,232,
-    225,105,128, 14, 37,238,231,115,128,  1,127,247,236,233,238,101,
-      2,127, 85,127,108, 99,  2,127, 91,127,103,229,238,244,229,242,
-    236,233,238,101,128,254, 78,237, 98,128,  3, 50,228,225,243,232,
-    229,100,128,254, 77,250,229,238,231,101,128, 37,202,240,225,242,
-    229,110,128, 36,167,115,  3,127,141,127,148,127,156,236,225,243,
-    104,128,  1, 66,241,245,225,242,101,128, 33, 19,245,240,229,242,
-    233,239,114,128,246,238,244,243,232,225,228,101,128, 37,145,245,
-    244,232,225,105,128, 14, 38,246,239,227,225,236,233, 99,  3,127,
-    197,127,207,127,214,226,229,238,231,225,236,105,128,  9,140,228,
-    229,246, 97,128,  9, 12,246,239,247,229,236,243,233,231,110,  2,
-    127,228,127,238,226,229,238,231,225,236,105,128,  9,226,228,229,
-    246, 97,128,  9, 98,248,243,241,245,225,242,101,128, 51,211,109,
-    144,  0,109,128, 35,130,144,130,169,130,196,130,221,132, 18,132,
-     40,133, 95,133,125,133,174,134, 25,134, 47,134, 72,134, 81,135,
-    108,135,136, 97, 12,128, 61,128, 71,128,135,128,142,128,167,128,
-    215,130, 51,130, 76,130, 81,130, 95,130,107,130,112,226,229,238,
-    231,225,236,105,128,  9,174, 99,  2,128, 77,128,129,242,239,110,
-    132,  0,175,128, 91,128,102,128,108,128,117,226,229,236,239,247,
-    227,237, 98,128,  3, 49,227,237, 98,128,  3,  4,236,239,247,237,
-    239,100,128,  2,205,237,239,238,239,243,240,225,227,101,128,255,
-    227,245,244,101,128, 30, 63,228,229,246, 97,128,  9, 46,231,117,
-      2,128,149,128,158,234,225,242,225,244,105,128, 10,174,242,237,
-    245,235,232,105,128, 10, 46,104,  2,128,173,128,205,225,240,225,
-    235,104,  2,128,183,128,192,232,229,226,242,229,119,128,  5,164,
-    236,229,230,244,232,229,226,242,229,119,128,  5,164,233,242,225,
-    231,225,238, 97,128, 48,126,105,  5,128,227,129, 40,129,103,129,
-    133,130, 39,227,232,225,244,244,225,247, 97,  3,128,242,129, 17,
-    129, 24,236,239,119,  2,128,250,129,  5,236,229,230,244,244,232,
-    225,105,128,248,149,242,233,231,232,244,244,232,225,105,128,248,
-    148,244,232,225,105,128, 14, 75,245,240,240,229,242,236,229,230,
-    244,244,232,225,105,128,248,147,229,107,  3,129, 49,129, 80,129,
-     87,236,239,119,  2,129, 57,129, 68,236,229,230,244,244,232,225,
-    105,128,248,140,242,233,231,232,244,244,232,225,105,128,248,139,
-    244,232,225,105,128, 14, 72,245,240,240,229,242,236,229,230,244,
-    244,232,225,105,128,248,138,232,225,238,225,235,225,116,  2,129,
-    115,129,126,236,229,230,244,244,232,225,105,128,248,132,244,232,
-    225,105,128, 14, 49,116,  3,129,141,129,169,129,232,225,233,235,
-    232,117,  2,129,151,129,162,236,229,230,244,244,232,225,105,128,
-    248,137,244,232,225,105,128, 14, 71,232,111,  3,129,178,129,209,
-    129,216,236,239,119,  2,129,186,129,197,236,229,230,244,244,232,
-    225,105,128,248,143,242,233,231,232,244,244,232,225,105,128,248,
-    142,244,232,225,105,128, 14, 73,245,240,240,229,242,236,229,230,
-    244,244,232,225,105,128,248,141,242,105,  3,129,241,130, 16,130,
-     23,236,239,119,  2,129,249,130,  4,236,229,230,244,244,232,225,
-    105,128,248,146,242,233,231,232,244,244,232,225,105,128,248,145,
-    244,232,225,105,128, 14, 74,245,240,240,229,242,236,229,230,244,
-    244,232,225,105,128,248,144,249,225,237,239,235,244,232,225,105,
-    128, 14, 70,235,225,244,225,235,225,238, 97,129, 48,222,130, 64,
-    232,225,236,230,247,233,228,244,104,128,255,143,236,101,128, 38,
-     66,238,243,249,239,238,243,241,245,225,242,101,128, 51, 71,241,
-    225,230,232,229,226,242,229,119,128,  5,190,242,115,128, 38, 66,
-    115,  2,130,118,130,136,239,242,225,227,233,242,227,236,229,232,
-    229,226,242,229,119,128,  5,175,241,245,225,242,101,128, 51,131,
-     98,  2,130,150,130,160,239,240,239,237,239,230,111,128, 49,  7,
-    243,241,245,225,242,101,128, 51,212, 99,  2,130,175,130,183,233,
-    242,227,236,101,128, 36,220,245,226,229,228,243,241,245,225,242,
-    101,128, 51,165,228,239,116,  2,130,204,130,213,225,227,227,229,
-    238,116,128, 30, 65,226,229,236,239,119,128, 30, 67,101,  7,130,
-    237,131,108,131,119,131,134,131,159,131,196,131,208,101,  2,130,
-    243,131, 95,109,  4,130,253,131,  6,131, 20,131, 36,225,242,225,
-    226,233, 99,128,  6, 69,230,233,238,225,236,225,242,225,226,233,
-     99,128,254,226,233,238,233,244,233,225,236,225,242,225,226,233,
-     99,128,254,227,237,101,  2,131, 43,131, 56,228,233,225,236,225,
-    242,225,226,233, 99,128,254,228,229,237,105,  2,131, 64,131, 79,
-    238,233,244,233,225,236,225,242,225,226,233, 99,128,252,209,243,
-    239,236,225,244,229,228,225,242,225,226,233, 99,128,252, 72,244,
-    239,242,245,243,241,245,225,242,101,128, 51, 77,232,233,242,225,
-    231,225,238, 97,128, 48,129,233,250,233,229,242,225,243,241,245,
-    225,242,101,128, 51,126,235,225,244,225,235,225,238, 97,129, 48,
-    225,131,147,232,225,236,230,247,233,228,244,104,128,255,146,109,
-    130,  5,222,131,167,131,187,228,225,231,229,243,104,129,251, 62,
-    131,178,232,229,226,242,229,119,128,251, 62,232,229,226,242,229,
-    119,128,  5,222,238,225,242,237,229,238,233,225,110,128,  5,116,
-    242,235,232, 97,  3,131,219,131,228,132,  5,232,229,226,242,229,
-    119,128,  5,165,235,229,230,245,236, 97,  2,131,239,131,248,232,
-    229,226,242,229,119,128,  5,166,236,229,230,244,232,229,226,242,
-    229,119,128,  5,166,236,229,230,244,232,229,226,242,229,119,128,
-      5,165,104,  2,132, 24,132, 30,239,239,107,128,  2,113,250,243,
-    241,245,225,242,101,128, 51,146,105,  6,132, 54,132, 91,132,228,
-    132,239,133,  8,133, 65,228,100,  2,132, 61,132, 86,236,229,228,
-    239,244,235,225,244,225,235,225,238,225,232,225,236,230,247,233,
-    228,244,104,128,255,101,239,116,128,  0,183,229,245,109,  5,132,
-    105,132,140,132,155,132,164,132,215, 97,  2,132,111,132,126,227,
-    233,242,227,236,229,235,239,242,229,225,110,128, 50,114,240,225,
-    242,229,238,235,239,242,229,225,110,128, 50, 18,227,233,242,227,
-    236,229,235,239,242,229,225,110,128, 50,100,235,239,242,229,225,
-    110,128, 49, 65,112,  2,132,170,132,202, 97,  2,132,176,132,190,
-    238,243,233,239,243,235,239,242,229,225,110,128, 49,112,242,229,
-    238,235,239,242,229,225,110,128, 50,  4,233,229,245,240,235,239,
-    242,229,225,110,128, 49,110,243,233,239,243,235,239,242,229,225,
-    110,128, 49,111,232,233,242,225,231,225,238, 97,128, 48,127,235,
-    225,244,225,235,225,238, 97,129, 48,223,132,252,232,225,236,230,
-    247,233,228,244,104,128,255,144,238,117,  2,133, 15,133, 60,115,
-    132, 34, 18,133, 27,133, 38,133, 47,133, 53,226,229,236,239,247,
-    227,237, 98,128,  3, 32,227,233,242,227,236,101,128, 34,150,237,
-    239,100,128,  2,215,240,236,245,115,128, 34, 19,244,101,128, 32,
-     50,242,105,  2,133, 72,133, 86,226,225,225,242,245,243,241,245,
-    225,242,101,128, 51, 74,243,241,245,225,242,101,128, 51, 73,108,
-      2,133,101,133,116,239,238,231,236,229,231,244,245,242,238,229,
-    100,128,  2,112,243,241,245,225,242,101,128, 51,150,109,  3,133,
-    133,133,147,133,158,227,245,226,229,228,243,241,245,225,242,101,
-    128, 51,163,239,238,239,243,240,225,227,101,128,255, 77,243,241,
-    245,225,242,229,228,243,241,245,225,242,101,128, 51,159,111,  5,
-    133,186,133,212,133,237,133,247,134,  0,104,  2,133,192,133,202,
-    233,242,225,231,225,238, 97,128, 48,130,237,243,241,245,225,242,
-    101,128, 51,193,235,225,244,225,235,225,238, 97,129, 48,226,133,
-    225,232,225,236,230,247,233,228,244,104,128,255,147,236,243,241,
-    245,225,242,101,128, 51,214,237,225,244,232,225,105,128, 14, 33,
-    246,229,242,243,243,241,245,225,242,101,129, 51,167,134, 15,228,
-    243,241,245,225,242,101,128, 51,168,240, 97,  2,134, 32,134, 38,
-    242,229,110,128, 36,168,243,241,245,225,242,101,128, 51,171,115,
-      2,134, 53,134, 62,243,241,245,225,242,101,128, 51,179,245,240,
-    229,242,233,239,114,128,246,239,244,245,242,238,229,100,128,  2,
-    111,117,141,  0,181,134,111,134,115,134,125,134,149,134,159,134,
-    181,134,192,134,217,134,240,134,250,135, 24,135, 88,135, 98, 49,
-    128,  0,181,225,243,241,245,225,242,101,128, 51,130,227,104,  2,
-    134,132,134,142,231,242,229,225,244,229,114,128, 34,107,236,229,
-    243,115,128, 34,106,230,243,241,245,225,242,101,128, 51,140,103,
-      2,134,165,134,172,242,229,229,107,128,  3,188,243,241,245,225,
-    242,101,128, 51,141,232,233,242,225,231,225,238, 97,128, 48,128,
-    235,225,244,225,235,225,238, 97,129, 48,224,134,205,232,225,236,
-    230,247,233,228,244,104,128,255,145,108,  2,134,223,134,232,243,
-    241,245,225,242,101,128, 51,149,244,233,240,236,121,128,  0,215,
-    237,243,241,245,225,242,101,128, 51,155,238,225,104,  2,135,  2,
-    135, 11,232,229,226,242,229,119,128,  5,163,236,229,230,244,232,
-    229,226,242,229,119,128,  5,163,115,  2,135, 30,135, 79,233, 99,
-      3,135, 39,135, 56,135, 67,225,236,238,239,244,101,129, 38,106,
-    135, 50,228,226,108,128, 38,107,230,236,225,244,243,233,231,110,
-    128, 38,109,243,232,225,242,240,243,233,231,110,128, 38,111,243,
-    241,245,225,242,101,128, 51,178,246,243,241,245,225,242,101,128,
-     51,182,247,243,241,245,225,242,101,128, 51,188,118,  2,135,114,
-    135,127,237,229,231,225,243,241,245,225,242,101,128, 51,185,243,
-    241,245,225,242,101,128, 51,183,119,  2,135,142,135,155,237,229,
-    231,225,243,241,245,225,242,101,128, 51,191,243,241,245,225,242,
-    101,128, 51,189,110,150,  0,110,135,212,136, 90,136,114,136,180,
-    136,205,137,  7,137, 17,137, 84,137,127,139,161,139,179,139,204,
-    139,235,140,  5,140, 70,142, 52,142, 60,142, 85,142, 93,143, 61,
-    143, 71,143, 81, 97,  8,135,230,135,250,136,  1,136,  8,136, 33,
-    136, 44,136, 69,136, 81, 98,  2,135,236,135,245,229,238,231,225,
-    236,105,128,  9,168,236, 97,128, 34,  7,227,245,244,101,128,  1,
-     68,228,229,246, 97,128,  9, 40,231,117,  2,136, 15,136, 24,234,
-    225,242,225,244,105,128, 10,168,242,237,245,235,232,105,128, 10,
-     40,232,233,242,225,231,225,238, 97,128, 48,106,235,225,244,225,
-    235,225,238, 97,129, 48,202,136, 57,232,225,236,230,247,233,228,
-    244,104,128,255,133,240,239,243,244,242,239,240,232,101,128,  1,
-     73,243,241,245,225,242,101,128, 51,129, 98,  2,136, 96,136,106,
-    239,240,239,237,239,230,111,128, 49, 11,243,240,225,227,101,128,
-      0,160, 99,  4,136,124,136,131,136,140,136,167,225,242,239,110,
-    128,  1, 72,229,228,233,236,236, 97,128,  1, 70,233,242, 99,  2,
-    136,148,136,153,236,101,128, 36,221,245,237,230,236,229,248,226,
-    229,236,239,119,128, 30, 75,239,237,237,225,225,227,227,229,238,
-    116,128,  1, 70,228,239,116,  2,136,188,136,197,225,227,227,229,
-    238,116,128, 30, 69,226,229,236,239,119,128, 30, 71,101,  3,136,
-    213,136,224,136,249,232,233,242,225,231,225,238, 97,128, 48,109,
-    235,225,244,225,235,225,238, 97,129, 48,205,136,237,232,225,236,
-    230,247,233,228,244,104,128,255,136,247,243,232,229,241,229,236,
-    243,233,231,110,128, 32,170,230,243,241,245,225,242,101,128, 51,
-    139,103,  2,137, 23,137, 73, 97,  3,137, 31,137, 41,137, 48,226,
-    229,238,231,225,236,105,128,  9,153,228,229,246, 97,128,  9, 25,
-    231,117,  2,137, 55,137, 64,234,225,242,225,244,105,128, 10,153,
-    242,237,245,235,232,105,128, 10, 25,239,238,231,245,244,232,225,
-    105,128, 14,  7,104,  2,137, 90,137,100,233,242,225,231,225,238,
-     97,128, 48,147,239,239,107,  2,137,108,137,115,236,229,230,116,
-    128,  2,114,242,229,244,242,239,230,236,229,120,128,  2,115,105,
-      4,137,137,138, 50,138, 61,138,119,229,245,110,  7,137,155,137,
-    190,137,222,137,236,137,245,138, 22,138, 35, 97,  2,137,161,137,
-    176,227,233,242,227,236,229,235,239,242,229,225,110,128, 50,111,
-    240,225,242,229,238,235,239,242,229,225,110,128, 50, 15,227,105,
-      2,137,197,137,209,229,245,227,235,239,242,229,225,110,128, 49,
-     53,242,227,236,229,235,239,242,229,225,110,128, 50, 97,232,233,
-    229,245,232,235,239,242,229,225,110,128, 49, 54,235,239,242,229,
-    225,110,128, 49, 52,240, 97,  2,137,252,138, 10,238,243,233,239,
-    243,235,239,242,229,225,110,128, 49,104,242,229,238,235,239,242,
-    229,225,110,128, 50,  1,243,233,239,243,235,239,242,229,225,110,
-    128, 49,103,244,233,235,229,245,244,235,239,242,229,225,110,128,
-     49,102,232,233,242,225,231,225,238, 97,128, 48,107,107,  2,138,
-     67,138, 91,225,244,225,235,225,238, 97,129, 48,203,138, 79,232,
-    225,236,230,247,233,228,244,104,128,255,134,232,225,232,233,116,
-      2,138,101,138,112,236,229,230,244,244,232,225,105,128,248,153,
-    244,232,225,105,128, 14, 77,238,101,141,  0, 57,138,150,138,159,
-    138,169,138,199,138,206,138,231,139,  2,139, 36,139, 48,139, 59,
-    139, 92,139,100,139,111,225,242,225,226,233, 99,128,  6,105,226,
-    229,238,231,225,236,105,128,  9,239,227,233,242,227,236,101,129,
-     36,104,138,180,233,238,246,229,242,243,229,243,225,238,243,243,
-    229,242,233,102,128, 39,146,228,229,246, 97,128,  9,111,231,117,
-      2,138,213,138,222,234,225,242,225,244,105,128, 10,239,242,237,
-    245,235,232,105,128, 10,111,232, 97,  2,138,238,138,249,227,235,
-    225,242,225,226,233, 99,128,  6,105,238,231,250,232,239,117,128,
-     48, 41,105,  2,139,  8,139, 26,228,229,239,231,242,225,240,232,
-    233,227,240,225,242,229,110,128, 50, 40,238,230,229,242,233,239,
-    114,128, 32,137,237,239,238,239,243,240,225,227,101,128,255, 25,
-    239,236,228,243,244,249,236,101,128,247, 57,112,  2,139, 65,139,
-     72,225,242,229,110,128, 36,124,229,114,  2,139, 79,139, 85,233,
-    239,100,128, 36,144,243,233,225,110,128,  6,249,242,239,237,225,
-    110,128, 33,120,243,245,240,229,242,233,239,114,128, 32,121,116,
-      2,139,117,139,155,229,229,110,  2,139,125,139,134,227,233,242,
-    227,236,101,128, 36,114,112,  2,139,140,139,147,225,242,229,110,
-    128, 36,134,229,242,233,239,100,128, 36,154,232,225,105,128, 14,
-     89,106,129,  1,204,139,167,229,227,249,242,233,236,236,233, 99,
-    128,  4, 90,235,225,244,225,235,225,238, 97,129, 48,243,139,192,
-    232,225,236,230,247,233,228,244,104,128,255,157,108,  2,139,210,
-    139,224,229,231,242,233,231,232,244,236,239,238,103,128,  1,158,
-    233,238,229,226,229,236,239,119,128, 30, 73,109,  2,139,241,139,
-    252,239,238,239,243,240,225,227,101,128,255, 78,243,241,245,225,
-    242,101,128, 51,154,110,  2,140, 11,140, 61, 97,  3,140, 19,140,
-     29,140, 36,226,229,238,231,225,236,105,128,  9,163,228,229,246,
-     97,128,  9, 35,231,117,  2,140, 43,140, 52,234,225,242,225,244,
-    105,128, 10,163,242,237,245,235,232,105,128, 10, 35,238,225,228,
-    229,246, 97,128,  9, 41,111,  6,140, 84,140, 95,140,120,140,161,
-    141,113,142, 40,232,233,242,225,231,225,238, 97,128, 48,110,235,
-    225,244,225,235,225,238, 97,129, 48,206,140,108,232,225,236,230,
-    247,233,228,244,104,128,255,137,110,  3,140,128,140,144,140,153,
-    226,242,229,225,235,233,238,231,243,240,225,227,101,128,  0,160,
-    229,238,244,232,225,105,128, 14, 19,245,244,232,225,105,128, 14,
-     25,239,110,  7,140,178,140,187,140,201,140,235,140,251,141, 36,
-    141, 95,225,242,225,226,233, 99,128,  6, 70,230,233,238,225,236,
-    225,242,225,226,233, 99,128,254,230,231,232,245,238,238, 97,  2,
-    140,212,140,221,225,242,225,226,233, 99,128,  6,186,230,233,238,
-    225,236,225,242,225,226,233, 99,128,251,159,233,238,233,244,233,
-    225,236,225,242,225,226,233, 99,128,254,231,234,229,229,237,105,
-      2,141,  5,141, 20,238,233,244,233,225,236,225,242,225,226,233,
-     99,128,252,210,243,239,236,225,244,229,228,225,242,225,226,233,
-     99,128,252, 75,237,101,  2,141, 43,141, 56,228,233,225,236,225,
-    242,225,226,233, 99,128,254,232,229,237,105,  2,141, 64,141, 79,
-    238,233,244,233,225,236,225,242,225,226,233, 99,128,252,213,243,
-    239,236,225,244,229,228,225,242,225,226,233, 99,128,252, 78,238,
-    239,239,238,230,233,238,225,236,225,242,225,226,233, 99,128,252,
-    141,116,  7,141,129,141,140,141,169,141,204,141,216,141,236,142,
-      6,227,239,238,244,225,233,238,115,128, 34, 12,101,  2,141,146,
-    141,162,236,229,237,229,238,116,129, 34,  9,141,157,239,102,128,
-     34,  9,241,245,225,108,128, 34, 96,231,242,229,225,244,229,114,
-    129, 34,111,141,181,238,239,114,  2,141,189,141,197,229,241,245,
-    225,108,128, 34,113,236,229,243,115,128, 34,121,233,228,229,238,
-    244,233,227,225,108,128, 34, 98,236,229,243,115,129, 34,110,141,
-    225,238,239,242,229,241,245,225,108,128, 34,112,112,  2,141,242,
-    141,252,225,242,225,236,236,229,108,128, 34, 38,242,229,227,229,
-    228,229,115,128, 34,128,243,117,  3,142, 15,142, 22,142, 31,226,
-    243,229,116,128, 34,132,227,227,229,229,228,115,128, 34,129,240,
-    229,242,243,229,116,128, 34,133,247,225,242,237,229,238,233,225,
-    110,128,  5,118,240,225,242,229,110,128, 36,169,115,  2,142, 66,
-    142, 75,243,241,245,225,242,101,128, 51,177,245,240,229,242,233,
-    239,114,128, 32,127,244,233,236,228,101,128,  0,241,117,132,  3,
-    189,142,105,142,116,142,197,143, 24,232,233,242,225,231,225,238,
-     97,128, 48,108,107,  2,142,122,142,146,225,244,225,235,225,238,
-     97,129, 48,204,142,134,232,225,236,230,247,233,228,244,104,128,
-    255,135,244, 97,  3,142,155,142,165,142,172,226,229,238,231,225,
-    236,105,128,  9,188,228,229,246, 97,128,  9, 60,231,117,  2,142,
-    179,142,188,234,225,242,225,244,105,128, 10,188,242,237,245,235,
-    232,105,128, 10, 60,109,  2,142,203,142,237,226,229,242,243,233,
-    231,110,130,  0, 35,142,217,142,229,237,239,238,239,243,240,225,
-    227,101,128,255,  3,243,237,225,236,108,128,254, 95,229,114,  2,
-    142,244,143, 20,225,236,243,233,231,110,  2,142,255,143,  7,231,
-    242,229,229,107,128,  3,116,236,239,247,229,242,231,242,229,229,
-    107,128,  3,117,111,128, 33, 22,110,130,  5,224,143, 32,143, 52,
-    228,225,231,229,243,104,129,251, 64,143, 43,232,229,226,242,229,
-    119,128,251, 64,232,229,226,242,229,119,128,  5,224,246,243,241,
-    245,225,242,101,128, 51,181,247,243,241,245,225,242,101,128, 51,
-    187,249, 97,  3,143, 90,143,100,143,107,226,229,238,231,225,236,
-    105,128,  9,158,228,229,246, 97,128,  9, 30,231,117,  2,143,114,
-    143,123,234,225,242,225,244,105,128, 10,158,242,237,245,235,232,
-    105,128, 10, 30,111,147,  0,111,143,174,143,196,144, 18,144,188,
-    145,  4,145, 19,145, 59,145,182,145,203,145,241,145,252,146,174,
-    148,  8,148, 72,148,105,148,151,149, 24,149, 71,149, 83, 97,  2,
-    143,180,143,187,227,245,244,101,128,  0,243,238,231,244,232,225,
-    105,128, 14, 45, 98,  4,143,206,143,248,144,  1,144, 11,225,242,
-    242,229,100,130,  2,117,143,218,143,229,227,249,242,233,236,236,
-    233, 99,128,  4,233,228,233,229,242,229,243,233,243,227,249,242,
-    233,236,236,233, 99,128,  4,235,229,238,231,225,236,105,128,  9,
-    147,239,240,239,237,239,230,111,128, 49, 27,242,229,246,101,128,
-      1, 79, 99,  3,144, 26,144, 99,144,178, 97,  2,144, 32,144, 93,
-    238,228,242, 97,  3,144, 43,144, 50,144, 61,228,229,246, 97,128,
-      9, 17,231,245,234,225,242,225,244,105,128, 10,145,246,239,247,
-    229,236,243,233,231,110,  2,144, 75,144, 82,228,229,246, 97,128,
-      9, 73,231,245,234,225,242,225,244,105,128, 10,201,242,239,110,
-    128,  1,210,233,242, 99,  2,144,107,144,112,236,101,128, 36,222,
-    245,237,230,236,229,120,133,  0,244,144,131,144,139,144,150,144,
-    158,144,170,225,227,245,244,101,128, 30,209,228,239,244,226,229,
-    236,239,119,128, 30,217,231,242,225,246,101,128, 30,211,232,239,
-    239,235,225,226,239,246,101,128, 30,213,244,233,236,228,101,128,
-     30,215,249,242,233,236,236,233, 99,128,  4, 62,100,  4,144,198,
-    144,221,144,227,144,250,226,108,  2,144,205,144,213,225,227,245,
-    244,101,128,  1, 81,231,242,225,246,101,128,  2, 13,229,246, 97,
-    128,  9, 19,233,229,242,229,243,233,115,129,  0,246,144,239,227,
-    249,242,233,236,236,233, 99,128,  4,231,239,244,226,229,236,239,
-    119,128, 30,205,101,129,  1, 83,145, 10,235,239,242,229,225,110,
-    128, 49, 90,103,  3,145, 27,145, 42,145, 49,239,238,229,107,129,
-      2,219,145, 36,227,237, 98,128,  3, 40,242,225,246,101,128,  0,
-    242,245,234,225,242,225,244,105,128, 10,147,104,  4,145, 69,145,
-     80,145, 90,145,168,225,242,237,229,238,233,225,110,128,  5,133,
-    233,242,225,231,225,238, 97,128, 48, 74,111,  2,145, 96,145,106,
-    239,235,225,226,239,246,101,128, 30,207,242,110,133,  1,161,145,
-    121,145,129,145,140,145,148,145,160,225,227,245,244,101,128, 30,
-    219,228,239,244,226,229,236,239,119,128, 30,227,231,242,225,246,
-    101,128, 30,221,232,239,239,235,225,226,239,246,101,128, 30,223,
-    244,233,236,228,101,128, 30,225,245,238,231,225,242,245,237,236,
-    225,245,116,128,  1, 81,105,129,  1,163,145,188,238,246,229,242,
-    244,229,228,226,242,229,246,101,128,  2, 15,107,  2,145,209,145,
-    233,225,244,225,235,225,238, 97,129, 48,170,145,221,232,225,236,
-    230,247,233,228,244,104,128,255,117,239,242,229,225,110,128, 49,
-     87,236,229,232,229,226,242,229,119,128,  5,171,109,  6,146, 10,
-    146, 38,146, 45,146,134,146,145,146,163,225,227,242,239,110,130,
-      1, 77,146, 22,146, 30,225,227,245,244,101,128, 30, 83,231,242,
-    225,246,101,128, 30, 81,228,229,246, 97,128,  9, 80,229,231, 97,
-    133,  3,201,146, 61,146, 65,146, 76,146, 90,146,106, 49,128,  3,
-    214,227,249,242,233,236,236,233, 99,128,  4, 97,236,225,244,233,
-    238,227,236,239,243,229,100,128,  2,119,242,239,245,238,228,227,
-    249,242,233,236,236,233, 99,128,  4,123,116,  2,146,112,146,127,
-    233,244,236,239,227,249,242,233,236,236,233, 99,128,  4,125,239,
-    238,239,115,128,  3,206,231,245,234,225,242,225,244,105,128, 10,
-    208,233,227,242,239,110,129,  3,191,146,155,244,239,238,239,115,
-    128,  3,204,239,238,239,243,240,225,227,101,128,255, 79,238,101,
-    145,  0, 49,146,213,146,222,146,232,147,  6,147, 31,147, 40,147,
-     49,147, 74,147,108,147,142,147,154,147,173,147,184,147,217,147,
-    227,147,235,147,246,225,242,225,226,233, 99,128,  6, 97,226,229,
-    238,231,225,236,105,128,  9,231,227,233,242,227,236,101,129, 36,
-     96,146,243,233,238,246,229,242,243,229,243,225,238,243,243,229,
-    242,233,102,128, 39,138,100,  2,147, 12,147, 18,229,246, 97,128,
-      9,103,239,244,229,238,236,229,225,228,229,114,128, 32, 36,229,
-    233,231,232,244,104,128, 33, 91,230,233,244,244,229,100,128,246,
-    220,231,117,  2,147, 56,147, 65,234,225,242,225,244,105,128, 10,
-    231,242,237,245,235,232,105,128, 10,103,232, 97,  3,147, 83,147,
-     94,147, 99,227,235,225,242,225,226,233, 99,128,  6, 97,236,102,
-    128,  0,189,238,231,250,232,239,117,128, 48, 33,105,  2,147,114,
-    147,132,228,229,239,231,242,225,240,232,233,227,240,225,242,229,
-    110,128, 50, 32,238,230,229,242,233,239,114,128, 32,129,237,239,
-    238,239,243,240,225,227,101,128,255, 17,238,245,237,229,242,225,
-    244,239,242,226,229,238,231,225,236,105,128,  9,244,239,236,228,
-    243,244,249,236,101,128,247, 49,112,  2,147,190,147,197,225,242,
-    229,110,128, 36,116,229,114,  2,147,204,147,210,233,239,100,128,
-     36,136,243,233,225,110,128,  6,241,241,245,225,242,244,229,114,
-    128,  0,188,242,239,237,225,110,128, 33,112,243,245,240,229,242,
-    233,239,114,128,  0,185,244,104,  2,147,253,148,  2,225,105,128,
-     14, 81,233,242,100,128, 33, 83,111,  3,148, 16,148, 50,148, 66,
-    103,  2,148, 22,148, 40,239,238,229,107,129,  1,235,148, 31,237,
-    225,227,242,239,110,128,  1,237,245,242,237,245,235,232,105,128,
-     10, 19,237,225,244,242,225,231,245,242,237,245,235,232,105,128,
-     10, 75,240,229,110,128,  2, 84,112,  3,148, 80,148, 87,148, 98,
-    225,242,229,110,128, 36,170,229,238,226,245,236,236,229,116,128,
-     37,230,244,233,239,110,128, 35, 37,114,  2,148,111,148,140,100,
-      2,148,117,148,128,230,229,237,233,238,233,238,101,128,  0,170,
-    237,225,243,227,245,236,233,238,101,128,  0,186,244,232,239,231,
-    239,238,225,108,128, 34, 31,115,  5,148,163,148,195,148,212,149,
-      1,149, 14,232,239,242,116,  2,148,172,148,179,228,229,246, 97,
-    128,  9, 18,246,239,247,229,236,243,233,231,238,228,229,246, 97,
-    128,  9, 74,236,225,243,104,129,  0,248,148,204,225,227,245,244,
-    101,128,  1,255,237,225,236,108,  2,148,221,148,232,232,233,242,
-    225,231,225,238, 97,128, 48, 73,235,225,244,225,235,225,238, 97,
-    129, 48,169,148,245,232,225,236,230,247,233,228,244,104,128,255,
-    107,244,242,239,235,229,225,227,245,244,101,128,  1,255,245,240,
-    229,242,233,239,114,128,246,240,116,  2,149, 30,149, 41,227,249,
-    242,233,236,236,233, 99,128,  4,127,233,236,228,101,130,  0,245,
-    149, 52,149, 60,225,227,245,244,101,128, 30, 77,228,233,229,242,
-    229,243,233,115,128, 30, 79,245,226,239,240,239,237,239,230,111,
-    128, 49, 33,118,  2,149, 89,149,170,229,114,  2,149, 96,149,162,
-    236,233,238,101,131, 32, 62,149,109,149,132,149,155, 99,  2,149,
-    115,149,127,229,238,244,229,242,236,233,238,101,128,254, 74,237,
-     98,128,  3,  5,100,  2,149,138,149,146,225,243,232,229,100,128,
-    254, 73,226,236,247,225,246,121,128,254, 76,247,225,246,121,128,
-    254, 75,243,227,239,242,101,128,  0,175,239,247,229,236,243,233,
-    231,110,  3,149,185,149,195,149,202,226,229,238,231,225,236,105,
-    128,  9,203,228,229,246, 97,128,  9, 75,231,245,234,225,242,225,
-    244,105,128, 10,203,112,145,  0,112,149,251,152,123,152,134,152,
-    143,152,155,154, 80,154, 90,155, 82,156,101,156,191,156,217,157,
-     92,157,100,158,  2,158, 60,158, 88,158, 98, 97, 14,150, 25,150,
-     57,150, 67,150, 74,150, 81,150,129,150,140,150,154,150,165,150,
-    212,150,226,151,238,152, 21,152,111, 97,  2,150, 31,150, 43,237,
-    240,243,243,241,245,225,242,101,128, 51,128,243,229,238,244,239,
-    243,241,245,225,242,101,128, 51, 43,226,229,238,231,225,236,105,
-    128,  9,170,227,245,244,101,128, 30, 85,228,229,246, 97,128,  9,
-     42,103,  2,150, 87,150,105,101,  2,150, 93,150,100,228,239,247,
-    110,128, 33,223,245,112,128, 33,222,117,  2,150,111,150,120,234,
-    225,242,225,244,105,128, 10,170,242,237,245,235,232,105,128, 10,
-     42,232,233,242,225,231,225,238, 97,128, 48,113,233,249,225,238,
-    238,239,233,244,232,225,105,128, 14, 47,235,225,244,225,235,225,
-    238, 97,128, 48,209,108,  2,150,171,150,196,225,244,225,236,233,
-    250,225,244,233,239,238,227,249,242,233,236,236,233,227,227,237,
-     98,128,  4,132,239,227,232,235,225,227,249,242,233,236,236,233,
-     99,128,  4,192,238,243,233,239,243,235,239,242,229,225,110,128,
-     49,127,114,  3,150,234,150,255,151,227, 97,  2,150,240,150,248,
-    231,242,225,240,104,128,  0,182,236,236,229,108,128, 34, 37,229,
-    110,  2,151,  6,151,116,236,229,230,116,136,  0, 40,151, 29,151,
-     44,151, 49,151, 54,151, 65,151, 77,151,100,151,105,225,236,244,
-    239,238,229,225,242,225,226,233, 99,128,253, 62,226,116,128,248,
-    237,229,120,128,248,236,233,238,230,229,242,233,239,114,128, 32,
-    141,237,239,238,239,243,240,225,227,101,128,255,  8,115,  2,151,
-     83,151, 90,237,225,236,108,128,254, 89,245,240,229,242,233,239,
-    114,128, 32,125,244,112,128,248,235,246,229,242,244,233,227,225,
-    108,128,254, 53,242,233,231,232,116,136,  0, 41,151,140,151,155,
-    151,160,151,165,151,176,151,188,151,211,151,216,225,236,244,239,
-    238,229,225,242,225,226,233, 99,128,253, 63,226,116,128,248,248,
-    229,120,128,248,247,233,238,230,229,242,233,239,114,128, 32,142,
-    237,239,238,239,243,240,225,227,101,128,255,  9,115,  2,151,194,
-    151,201,237,225,236,108,128,254, 90,245,240,229,242,233,239,114,
-    128, 32,126,244,112,128,248,246,246,229,242,244,233,227,225,108,
-    128,254, 54,244,233,225,236,228,233,230,102,128, 34,  2,115,  3,
-    151,246,152,  1,152, 13,229,241,232,229,226,242,229,119,128,  5,
-    192,232,244,225,232,229,226,242,229,119,128,  5,153,241,245,225,
-    242,101,128, 51,169,244,225,104,134,  5,183,152, 39,152, 53,152,
-     58,152, 67,152, 82,152, 98, 49,  2,152, 45,152, 49, 49,128,  5,
-    183,100,128,  5,183,178, 97,128,  5,183,232,229,226,242,229,119,
-    128,  5,183,238,225,242,242,239,247,232,229,226,242,229,119,128,
-      5,183,241,245,225,242,244,229,242,232,229,226,242,229,119,128,
-      5,183,247,233,228,229,232,229,226,242,229,119,128,  5,183,250,
-    229,242,232,229,226,242,229,119,128,  5,161,226,239,240,239,237,
-    239,230,111,128, 49,  6,227,233,242,227,236,101,128, 36,223,228,
-    239,244,225,227,227,229,238,116,128, 30, 87,101,137,  5,228,152,
-    177,152,188,152,208,152,220,152,240,153, 86,153, 97,153,118,154,
-     73,227,249,242,233,236,236,233, 99,128,  4, 63,228,225,231,229,
-    243,104,129,251, 68,152,199,232,229,226,242,229,119,128,251, 68,
-    229,250,233,243,241,245,225,242,101,128, 51, 59,230,233,238,225,
-    236,228,225,231,229,243,232,232,229,226,242,229,119,128,251, 67,
-    104,  5,152,252,153, 19,153, 27,153, 41,153, 71,225,114,  2,153,
-      3,153, 10,225,226,233, 99,128,  6,126,237,229,238,233,225,110,
-    128,  5,122,229,226,242,229,119,128,  5,228,230,233,238,225,236,
-    225,242,225,226,233, 99,128,251, 87,105,  2,153, 47,153, 62,238,
-    233,244,233,225,236,225,242,225,226,233, 99,128,251, 88,242,225,
-    231,225,238, 97,128, 48,122,237,229,228,233,225,236,225,242,225,
-    226,233, 99,128,251, 89,235,225,244,225,235,225,238, 97,128, 48,
-    218,237,233,228,228,236,229,232,239,239,235,227,249,242,233,236,
-    236,233, 99,128,  4,167,114,  5,153,130,153,142,153,184,154, 49,
-    154, 62,225,230,229,232,229,226,242,229,119,128,251, 78,227,229,
-    238,116,131,  0, 37,153,155,153,164,153,176,225,242,225,226,233,
-     99,128,  6,106,237,239,238,239,243,240,225,227,101,128,255,  5,
-    243,237,225,236,108,128,254,106,105,  2,153,190,154, 31,239,100,
-    134,  0, 46,153,207,153,218,153,229,153,241,153,252,154,  8,225,
-    242,237,229,238,233,225,110,128,  5,137,227,229,238,244,229,242,
-    229,100,128,  0,183,232,225,236,230,247,233,228,244,104,128,255,
-     97,233,238,230,229,242,233,239,114,128,246,231,237,239,238,239,
-    243,240,225,227,101,128,255, 14,115,  2,154, 14,154, 21,237,225,
-    236,108,128,254, 82,245,240,229,242,233,239,114,128,246,232,243,
-    240,239,237,229,238,233,231,242,229,229,235,227,237, 98,128,  3,
-     66,240,229,238,228,233,227,245,236,225,114,128, 34,165,244,232,
-    239,245,243,225,238,100,128, 32, 48,243,229,244, 97,128, 32,167,
-    230,243,241,245,225,242,101,128, 51,138,104,  3,154, 98,154,148,
-    155, 29, 97,  3,154,106,154,116,154,123,226,229,238,231,225,236,
-    105,128,  9,171,228,229,246, 97,128,  9, 43,231,117,  2,154,130,
-    154,139,234,225,242,225,244,105,128, 10,171,242,237,245,235,232,
-    105,128, 10, 43,105,133,  3,198,154,162,154,166,154,252,155,  4,
-    155, 15, 49,128,  3,213,229,245,240,104,  4,154,179,154,214,154,
-    229,154,238, 97,  2,154,185,154,200,227,233,242,227,236,229,235,
-    239,242,229,225,110,128, 50,122,240,225,242,229,238,235,239,242,
-    229,225,110,128, 50, 26,227,233,242,227,236,229,235,239,242,229,
-    225,110,128, 50,108,235,239,242,229,225,110,128, 49, 77,240,225,
-    242,229,238,235,239,242,229,225,110,128, 50, 12,236,225,244,233,
-    110,128,  2,120,238,244,232,245,244,232,225,105,128, 14, 58,243,
-    249,237,226,239,236,231,242,229,229,107,128,  3,213,111,  3,155,
-     37,155, 42,155, 68,239,107,128,  1,165,240,104,  2,155, 49,155,
-     58,225,238,244,232,225,105,128, 14, 30,245,238,231,244,232,225,
-    105,128, 14, 28,243,225,237,240,232,225,239,244,232,225,105,128,
-     14, 32,105,133,  3,192,155, 96,156, 52,156, 63,156, 74,156, 88,
-    229,245,112,  6,155,112,155,147,155,179,155,207,155,221,156, 17,
-     97,  2,155,118,155,133,227,233,242,227,236,229,235,239,242,229,
-    225,110,128, 50,115,240,225,242,229,238,235,239,242,229,225,110,
-    128, 50, 19,227,105,  2,155,154,155,166,229,245,227,235,239,242,
-    229,225,110,128, 49,118,242,227,236,229,235,239,242,229,225,110,
-    128, 50,101,107,  2,155,185,155,199,233,249,229,239,235,235,239,
-    242,229,225,110,128, 49,114,239,242,229,225,110,128, 49, 66,240,
-    225,242,229,238,235,239,242,229,225,110,128, 50,  5,243,233,239,
-    115,  2,155,230,156,  2,107,  2,155,236,155,250,233,249,229,239,
-    235,235,239,242,229,225,110,128, 49,116,239,242,229,225,110,128,
-     49, 68,244,233,235,229,245,244,235,239,242,229,225,110,128, 49,
-    117,116,  2,156, 23,156, 38,232,233,229,245,244,232,235,239,242,
-    229,225,110,128, 49,119,233,235,229,245,244,235,239,242,229,225,
-    110,128, 49,115,232,233,242,225,231,225,238, 97,128, 48,116,235,
-    225,244,225,235,225,238, 97,128, 48,212,243,249,237,226,239,236,
-    231,242,229,229,107,128,  3,214,247,242,225,242,237,229,238,233,
-    225,110,128,  5,131,236,245,115,132,  0, 43,156,115,156,126,156,
-    135,156,168,226,229,236,239,247,227,237, 98,128,  3, 31,227,233,
-    242,227,236,101,128, 34,149,109,  2,156,141,156,148,233,238,245,
-    115,128,  0,177,111,  2,156,154,156,158,100,128,  2,214,238,239,
-    243,240,225,227,101,128,255, 11,115,  2,156,174,156,181,237,225,
-    236,108,128,254, 98,245,240,229,242,233,239,114,128, 32,122,109,
-      2,156,197,156,208,239,238,239,243,240,225,227,101,128,255, 80,
-    243,241,245,225,242,101,128, 51,216,111,  5,156,229,156,240,157,
-     51,157, 62,157, 72,232,233,242,225,231,225,238, 97,128, 48,125,
-    233,238,244,233,238,231,233,238,228,229,120,  4,157,  4,157, 16,
-    157, 28,157, 41,228,239,247,238,247,232,233,244,101,128, 38, 31,
-    236,229,230,244,247,232,233,244,101,128, 38, 28,242,233,231,232,
-    244,247,232,233,244,101,128, 38, 30,245,240,247,232,233,244,101,
-    128, 38, 29,235,225,244,225,235,225,238, 97,128, 48,221,240,236,
-    225,244,232,225,105,128, 14, 27,243,244,225,236,237,225,242,107,
-    129, 48, 18,157, 85,230,225,227,101,128, 48, 32,240,225,242,229,
-    110,128, 36,171,114,  3,157,108,157,134,157,159,101,  2,157,114,
-    157,122,227,229,228,229,115,128, 34,122,243,227,242,233,240,244,
-    233,239,110,128, 33, 30,233,237,101,  2,157,142,157,148,237,239,
-    100,128,  2,185,242,229,246,229,242,243,229,100,128, 32, 53,111,
-      4,157,169,157,176,157,186,157,199,228,245,227,116,128, 34, 15,
-    234,229,227,244,233,246,101,128, 35,  5,236,239,238,231,229,228,
-    235,225,238, 97,128, 48,252,112,  2,157,205,157,242,101,  2,157,
-    211,157,218,236,236,239,114,128, 35, 24,242,243,117,  2,157,226,
-    157,233,226,243,229,116,128, 34,130,240,229,242,243,229,116,128,
-     34,131,239,242,244,233,239,110,129, 34, 55,157,253,225,108,128,
-     34, 29,115,  2,158,  8,158, 51,105,130,  3,200,158, 16,158, 27,
-    227,249,242,233,236,236,233, 99,128,  4,113,236,233,240,238,229,
-    245,237,225,244,225,227,249,242,233,236,236,233,227,227,237, 98,
-    128,  4,134,243,241,245,225,242,101,128, 51,176,117,  2,158, 66,
-    158, 77,232,233,242,225,231,225,238, 97,128, 48,119,235,225,244,
-    225,235,225,238, 97,128, 48,215,246,243,241,245,225,242,101,128,
-     51,180,247,243,241,245,225,242,101,128, 51,186,113,136,  0,113,
-    158,128,159,177,159,188,159,197,159,204,159,216,159,254,160,  6,
-     97,  4,158,138,158,161,158,225,159,160,100,  2,158,144,158,150,
-    229,246, 97,128,  9, 88,237,225,232,229,226,242,229,119,128,  5,
-    168,102,  4,158,171,158,180,158,194,158,210,225,242,225,226,233,
-     99,128,  6, 66,230,233,238,225,236,225,242,225,226,233, 99,128,
-    254,214,233,238,233,244,233,225,236,225,242,225,226,233, 99,128,
-    254,215,237,229,228,233,225,236,225,242,225,226,233, 99,128,254,
-    216,237,225,244,115,136,  5,184,158,248,159, 12,159, 26,159, 31,
-    159, 36,159, 45,159, 60,159,147, 49,  3,159,  0,159,  4,159,  8,
-     48,128,  5,184, 97,128,  5,184, 99,128,  5,184, 50,  2,159, 18,
-    159, 22, 55,128,  5,184, 57,128,  5,184,179, 51,128,  5,184,228,
-    101,128,  5,184,232,229,226,242,229,119,128,  5,184,238,225,242,
-    242,239,247,232,229,226,242,229,119,128,  5,184,113,  2,159, 66,
-    159,132,225,244,225,110,  4,159, 79,159, 88,159,103,159,119,232,
-    229,226,242,229,119,128,  5,184,238,225,242,242,239,247,232,229,
-    226,242,229,119,128,  5,184,241,245,225,242,244,229,242,232,229,
-    226,242,229,119,128,  5,184,247,233,228,229,232,229,226,242,229,
-    119,128,  5,184,245,225,242,244,229,242,232,229,226,242,229,119,
-    128,  5,184,247,233,228,229,232,229,226,242,229,119,128,  5,184,
-    242,238,229,249,240,225,242,225,232,229,226,242,229,119,128,  5,
-    159,226,239,240,239,237,239,230,111,128, 49, 17,227,233,242,227,
-    236,101,128, 36,224,232,239,239,107,128,  2,160,237,239,238,239,
-    243,240,225,227,101,128,255, 81,239,102,130,  5,231,159,225,159,
-    245,228,225,231,229,243,104,129,251, 71,159,236,232,229,226,242,
-    229,119,128,251, 71,232,229,226,242,229,119,128,  5,231,240,225,
-    242,229,110,128, 36,172,117,  4,160, 16,160, 28,160,117,160,204,
-    225,242,244,229,242,238,239,244,101,128, 38,105,226,245,244,115,
-    135,  5,187,160, 49,160, 54,160, 59,160, 64,160, 73,160, 88,160,
-    104,177, 56,128,  5,187,178, 53,128,  5,187,179, 49,128,  5,187,
-    232,229,226,242,229,119,128,  5,187,238,225,242,242,239,247,232,
-    229,226,242,229,119,128,  5,187,241,245,225,242,244,229,242,232,
-    229,226,242,229,119,128,  5,187,247,233,228,229,232,229,226,242,
-    229,119,128,  5,187,229,243,244,233,239,110,133,  0, 63,160,136,
-    160,159,160,176,160,184,160,196,225,114,  2,160,143,160,150,225,
-    226,233, 99,128,  6, 31,237,229,238,233,225,110,128,  5, 94,228,
-    239,247,110,129,  0,191,160,168,243,237,225,236,108,128,247,191,
-    231,242,229,229,107,128,  3,126,237,239,238,239,243,240,225,227,
-    101,128,255, 31,243,237,225,236,108,128,247, 63,239,244,101,  4,
-    160,216,161, 31,161, 51,161, 80,228,226,108,133,  0, 34,160,232,
-    160,239,160,246,161,  2,161, 23,226,225,243,101,128, 32, 30,236,
-    229,230,116,128, 32, 28,237,239,238,239,243,240,225,227,101,128,
-    255,  2,240,242,233,237,101,129, 48, 30,161, 12,242,229,246,229,
-    242,243,229,100,128, 48, 29,242,233,231,232,116,128, 32, 29,236,
-    229,230,116,129, 32, 24,161, 40,242,229,246,229,242,243,229,100,
-    128, 32, 27,114,  2,161, 57,161, 67,229,246,229,242,243,229,100,
-    128, 32, 27,233,231,232,116,129, 32, 25,161, 76,110,128,  1, 73,
-    243,233,238,231,108,  2,161, 90,161, 97,226,225,243,101,128, 32,
-     26,101,129,  0, 39,161,103,237,239,238,239,243,240,225,227,101,
-    128,255,  7,114,145,  0,114,161,153,162,157,162,168,162,215,163,
-     10,164, 27,164, 51,164,146,166,180,166,217,166,229,167, 27,167,
-     35,167,197,167,208,167,243,168, 87, 97, 11,161,177,161,188,161,
-    198,161,205,162, 14,162, 30,162, 55,162, 66,162, 91,162,114,162,
-    151,225,242,237,229,238,233,225,110,128,  5,124,226,229,238,231,
-    225,236,105,128,  9,176,227,245,244,101,128,  1, 85,100,  4,161,
-    215,161,221,161,235,162,  5,229,246, 97,128,  9, 48,233,227,225,
-    108,129, 34, 26,161,230,229,120,128,248,229,239,246,229,242,243,
-    243,241,245,225,242,101,129, 51,174,161,251,228,243,241,245,225,
-    242,101,128, 51,175,243,241,245,225,242,101,128, 51,173,230,101,
-    129,  5,191,162, 21,232,229,226,242,229,119,128,  5,191,231,117,
-      2,162, 37,162, 46,234,225,242,225,244,105,128, 10,176,242,237,
-    245,235,232,105,128, 10, 48,232,233,242,225,231,225,238, 97,128,
-     48,137,235,225,244,225,235,225,238, 97,129, 48,233,162, 79,232,
-    225,236,230,247,233,228,244,104,128,255,151,236,239,247,229,242,
-    228,233,225,231,239,238,225,236,226,229,238,231,225,236,105,128,
-      9,241,109,  2,162,120,162,143,233,228,228,236,229,228,233,225,
-    231,239,238,225,236,226,229,238,231,225,236,105,128,  9,240,243,
-    232,239,242,110,128,  2,100,244,233,111,128, 34, 54,226,239,240,
-    239,237,239,230,111,128, 49, 22, 99,  4,162,178,162,185,162,194,
-    162,202,225,242,239,110,128,  1, 89,229,228,233,236,236, 97,128,
-      1, 87,233,242,227,236,101,128, 36,225,239,237,237,225,225,227,
-    227,229,238,116,128,  1, 87,100,  2,162,221,162,231,226,236,231,
-    242,225,246,101,128,  2, 17,239,116,  2,162,238,162,247,225,227,
-    227,229,238,116,128, 30, 89,226,229,236,239,119,129, 30, 91,163,
-      1,237,225,227,242,239,110,128, 30, 93,101,  6,163, 24,163, 69,
-    163,104,163,159,163,184,163,217,102,  2,163, 30,163, 43,229,242,
-    229,238,227,229,237,225,242,107,128, 32, 59,236,229,248,243,117,
-      2,163, 53,163, 60,226,243,229,116,128, 34,134,240,229,242,243,
-    229,116,128, 34,135,231,233,243,244,229,114,  2,163, 80,163, 85,
-    229,100,128,  0,174,115,  2,163, 91,163, 97,225,238,115,128,248,
-    232,229,242,233,102,128,246,218,104,  3,163,112,163,135,163,149,
-    225,114,  2,163,119,163,126,225,226,233, 99,128,  6, 49,237,229,
-    238,233,225,110,128,  5,128,230,233,238,225,236,225,242,225,226,
-    233, 99,128,254,174,233,242,225,231,225,238, 97,128, 48,140,235,
-    225,244,225,235,225,238, 97,129, 48,236,163,172,232,225,236,230,
-    247,233,228,244,104,128,255,154,243,104,130,  5,232,163,193,163,
-    208,228,225,231,229,243,232,232,229,226,242,229,119,128,251, 72,
-    232,229,226,242,229,119,128,  5,232,118,  3,163,225,163,238,164,
-     14,229,242,243,229,228,244,233,236,228,101,128, 34, 61,233, 97,
-      2,163,245,163,254,232,229,226,242,229,119,128,  5,151,237,245,
-    231,242,225,243,232,232,229,226,242,229,119,128,  5,151,236,239,
-    231,233,227,225,236,238,239,116,128, 35, 16,230,233,243,232,232,
-    239,239,107,129,  2,126,164, 40,242,229,246,229,242,243,229,100,
-    128,  2,127,104,  2,164, 57,164, 80, 97,  2,164, 63,164, 73,226,
-    229,238,231,225,236,105,128,  9,221,228,229,246, 97,128,  9, 93,
-    111,131,  3,193,164, 90,164,119,164,133,239,107,129,  2,125,164,
-     97,244,245,242,238,229,100,129,  2,123,164,108,243,245,240,229,
-    242,233,239,114,128,  2,181,243,249,237,226,239,236,231,242,229,
-    229,107,128,  3,241,244,233,227,232,239,239,235,237,239,100,128,
-      2,222,105,  6,164,160,165,204,165,250,166,  5,166, 30,166,166,
-    229,245,108,  9,164,182,164,217,164,232,164,246,165, 36,165, 50,
-    165,136,165,149,165,184, 97,  2,164,188,164,203,227,233,242,227,
-    236,229,235,239,242,229,225,110,128, 50,113,240,225,242,229,238,
-    235,239,242,229,225,110,128, 50, 17,227,233,242,227,236,229,235,
-    239,242,229,225,110,128, 50, 99,232,233,229,245,232,235,239,242,
-    229,225,110,128, 49, 64,107,  2,164,252,165, 28,233,249,229,239,
-    107,  2,165,  6,165, 15,235,239,242,229,225,110,128, 49, 58,243,
-    233,239,243,235,239,242,229,225,110,128, 49,105,239,242,229,225,
-    110,128, 49, 57,237,233,229,245,237,235,239,242,229,225,110,128,
-     49, 59,112,  3,165, 58,165, 90,165,105, 97,  2,165, 64,165, 78,
-    238,243,233,239,243,235,239,242,229,225,110,128, 49,108,242,229,
-    238,235,239,242,229,225,110,128, 50,  3,232,233,229,245,240,232,
-    235,239,242,229,225,110,128, 49, 63,233,229,245,112,  2,165,114,
-    165,123,235,239,242,229,225,110,128, 49, 60,243,233,239,243,235,
-    239,242,229,225,110,128, 49,107,243,233,239,243,235,239,242,229,
-    225,110,128, 49, 61,116,  2,165,155,165,170,232,233,229,245,244,
-    232,235,239,242,229,225,110,128, 49, 62,233,235,229,245,244,235,
-    239,242,229,225,110,128, 49,106,249,229,239,242,233,238,232,233,
-    229,245,232,235,239,242,229,225,110,128, 49,109,231,232,116,  2,
-    165,212,165,220,225,238,231,236,101,128, 34, 31,116,  2,165,226,
-    165,240,225,227,235,226,229,236,239,247,227,237, 98,128,  3, 25,
-    242,233,225,238,231,236,101,128, 34,191,232,233,242,225,231,225,
-    238, 97,128, 48,138,235,225,244,225,235,225,238, 97,129, 48,234,
-    166, 18,232,225,236,230,247,233,228,244,104,128,255,152,110,  2,
-    166, 36,166,152,103,131,  2,218,166, 46,166, 57,166, 63,226,229,
-    236,239,247,227,237, 98,128,  3, 37,227,237, 98,128,  3, 10,232,
-    225,236,102,  2,166, 72,166,118,236,229,230,116,131,  2,191,166,
-     85,166, 96,166,107,225,242,237,229,238,233,225,110,128,  5, 89,
-    226,229,236,239,247,227,237, 98,128,  3, 28,227,229,238,244,229,
-    242,229,100,128,  2,211,242,233,231,232,116,130,  2,190,166,130,
-    166,141,226,229,236,239,247,227,237, 98,128,  3, 57,227,229,238,
-    244,229,242,229,100,128,  2,210,246,229,242,244,229,228,226,242,
-    229,246,101,128,  2, 19,244,244,239,242,245,243,241,245,225,242,
-    101,128, 51, 81,108,  2,166,186,166,197,233,238,229,226,229,236,
-    239,119,128, 30, 95,239,238,231,236,229,103,129,  2,124,166,208,
-    244,245,242,238,229,100,128,  2,122,237,239,238,239,243,240,225,
-    227,101,128,255, 82,111,  3,166,237,166,248,167, 17,232,233,242,
-    225,231,225,238, 97,128, 48,141,235,225,244,225,235,225,238, 97,
-    129, 48,237,167,  5,232,225,236,230,247,233,228,244,104,128,255,
-    155,242,245,225,244,232,225,105,128, 14, 35,240,225,242,229,110,
-    128, 36,173,114,  3,167, 43,167, 79,167,109, 97,  3,167, 51,167,
-     61,167, 68,226,229,238,231,225,236,105,128,  9,220,228,229,246,
-     97,128,  9, 49,231,245,242,237,245,235,232,105,128, 10, 92,229,
-    104,  2,167, 86,167, 95,225,242,225,226,233, 99,128,  6,145,230,
-    233,238,225,236,225,242,225,226,233, 99,128,251,141,246,239,227,
-    225,236,233, 99,  4,167,125,167,135,167,142,167,153,226,229,238,
-    231,225,236,105,128,  9,224,228,229,246, 97,128,  9, 96,231,245,
-    234,225,242,225,244,105,128, 10,224,246,239,247,229,236,243,233,
-    231,110,  3,167,169,167,179,167,186,226,229,238,231,225,236,105,
-    128,  9,196,228,229,246, 97,128,  9, 68,231,245,234,225,242,225,
-    244,105,128, 10,196,243,245,240,229,242,233,239,114,128,246,241,
-    116,  2,167,214,167,222,226,236,239,227,107,128, 37,144,245,242,
-    238,229,100,129,  2,121,167,232,243,245,240,229,242,233,239,114,
-    128,  2,180,117,  4,167,253,168,  8,168, 33,168, 80,232,233,242,
-    225,231,225,238, 97,128, 48,139,235,225,244,225,235,225,238, 97,
-    129, 48,235,168, 21,232,225,236,230,247,233,228,244,104,128,255,
-    153,112,  2,168, 39,168, 74,229,101,  2,168, 46,168, 60,237,225,
-    242,235,226,229,238,231,225,236,105,128,  9,242,243,233,231,238,
-    226,229,238,231,225,236,105,128,  9,243,233,225,104,128,246,221,
-    244,232,225,105,128, 14, 36,246,239,227,225,236,233, 99,  4,168,
-    103,168,113,168,120,168,131,226,229,238,231,225,236,105,128,  9,
-    139,228,229,246, 97,128,  9, 11,231,245,234,225,242,225,244,105,
-    128, 10,139,246,239,247,229,236,243,233,231,110,  3,168,147,168,
-    157,168,164,226,229,238,231,225,236,105,128,  9,195,228,229,246,
-     97,128,  9, 67,231,245,234,225,242,225,244,105,128, 10,195,115,
-    147,  0,115,168,217,170,187,170,198,171, 68,171,107,174, 49,174,
-     60,176,203,179, 85,179,131,179,158,180, 93,180,160,181,193,181,
-    203,182,133,182,206,183,120,183,130, 97,  9,168,237,168,247,169,
-     12,169, 84,169,109,169,120,169,145,169,177,169,217,226,229,238,
-    231,225,236,105,128,  9,184,227,245,244,101,129,  1, 91,169,  0,
-    228,239,244,225,227,227,229,238,116,128, 30,101,100,  5,169, 24,
-    169, 33,169, 39,169, 53,169, 69,225,242,225,226,233, 99,128,  6,
-     53,229,246, 97,128,  9, 56,230,233,238,225,236,225,242,225,226,
-    233, 99,128,254,186,233,238,233,244,233,225,236,225,242,225,226,
-    233, 99,128,254,187,237,229,228,233,225,236,225,242,225,226,233,
-     99,128,254,188,231,117,  2,169, 91,169,100,234,225,242,225,244,
-    105,128, 10,184,242,237,245,235,232,105,128, 10, 56,232,233,242,
-    225,231,225,238, 97,128, 48, 85,235,225,244,225,235,225,238, 97,
-    129, 48,181,169,133,232,225,236,230,247,233,228,244,104,128,255,
-    123,236,236,225,236,236,225,232,239,245,225,236,225,249,232,229,
-    247,225,243,225,236,236,225,237,225,242,225,226,233, 99,128,253,
-    250,237,229,235,104,130,  5,225,169,188,169,208,228,225,231,229,
-    243,104,129,251, 65,169,199,232,229,226,242,229,119,128,251, 65,
-    232,229,226,242,229,119,128,  5,225,242, 97,  5,169,230,170, 48,
-    170, 56,170,106,170,114, 97,  5,169,242,169,250,170,  2,170, 33,
-    170, 41,225,244,232,225,105,128, 14, 50,229,244,232,225,105,128,
-     14, 65,233,237,225,233,109,  2,170, 12,170, 23,225,236,225,233,
-    244,232,225,105,128, 14, 68,245,225,238,244,232,225,105,128, 14,
-     67,237,244,232,225,105,128, 14, 51,244,232,225,105,128, 14, 48,
-    229,244,232,225,105,128, 14, 64,105,  3,170, 64,170, 88,170, 99,
-    105,  2,170, 70,170, 81,236,229,230,244,244,232,225,105,128,248,
-    134,244,232,225,105,128, 14, 53,236,229,230,244,244,232,225,105,
-    128,248,133,244,232,225,105,128, 14, 52,239,244,232,225,105,128,
-     14, 66,117,  3,170,122,170,172,170,179,101,  3,170,130,170,154,
-    170,165,101,  2,170,136,170,147,236,229,230,244,244,232,225,105,
-    128,248,136,244,232,225,105,128, 14, 55,236,229,230,244,244,232,
-    225,105,128,248,135,244,232,225,105,128, 14, 54,244,232,225,105,
-    128, 14, 56,245,244,232,225,105,128, 14, 57,226,239,240,239,237,
-    239,230,111,128, 49, 25, 99,  5,170,210,170,231,170,240,171, 33,
-    171, 55,225,242,239,110,129,  1, 97,170,219,228,239,244,225,227,
-    227,229,238,116,128, 30,103,229,228,233,236,236, 97,128,  1, 95,
-    232,247, 97,131,  2, 89,170,252,171,  7,171, 26,227,249,242,233,
-    236,236,233, 99,128,  4,217,228,233,229,242,229,243,233,243,227,
-    249,242,233,236,236,233, 99,128,  4,219,232,239,239,107,128,  2,
-     90,233,242, 99,  2,171, 41,171, 46,236,101,128, 36,226,245,237,
-    230,236,229,120,128,  1, 93,239,237,237,225,225,227,227,229,238,
-    116,128,  2, 25,228,239,116,  2,171, 76,171, 85,225,227,227,229,
-    238,116,128, 30, 97,226,229,236,239,119,129, 30, 99,171, 95,228,
-    239,244,225,227,227,229,238,116,128, 30,105,101,  9,171,127,171,
-    143,171,178,171,243,172, 90,172,117,172,142,172,223,172,250,225,
-    231,245,236,236,226,229,236,239,247,227,237, 98,128,  3, 60, 99,
-      2,171,149,171,171,239,238,100,129, 32, 51,171,157,244,239,238,
-    229,227,232,233,238,229,243,101,128,  2,202,244,233,239,110,128,
-      0,167,229,110,  4,171,189,171,198,171,212,171,228,225,242,225,
-    226,233, 99,128,  6, 51,230,233,238,225,236,225,242,225,226,233,
-     99,128,254,178,233,238,233,244,233,225,236,225,242,225,226,233,
-     99,128,254,179,237,229,228,233,225,236,225,242,225,226,233, 99,
-    128,254,180,231,239,108,135,  5,182,172,  7,172, 21,172, 26,172,
-     35,172, 50,172, 66,172, 77, 49,  2,172, 13,172, 17, 51,128,  5,
-    182,102,128,  5,182,178, 99,128,  5,182,232,229,226,242,229,119,
-    128,  5,182,238,225,242,242,239,247,232,229,226,242,229,119,128,
-      5,182,241,245,225,242,244,229,242,232,229,226,242,229,119,128,
-      5,182,244,225,232,229,226,242,229,119,128,  5,146,247,233,228,
-    229,232,229,226,242,229,119,128,  5,182,104,  2,172, 96,172,107,
-    225,242,237,229,238,233,225,110,128,  5,125,233,242,225,231,225,
-    238, 97,128, 48, 91,235,225,244,225,235,225,238, 97,129, 48,187,
-    172,130,232,225,236,230,247,233,228,244,104,128,255,126,237,105,
-      2,172,149,172,192,227,239,236,239,110,131,  0, 59,172,163,172,
-    172,172,184,225,242,225,226,233, 99,128,  6, 27,237,239,238,239,
-    243,240,225,227,101,128,255, 27,243,237,225,236,108,128,254, 84,
-    246,239,233,227,229,228,237,225,242,235,235,225,238, 97,129, 48,
-    156,172,211,232,225,236,230,247,233,228,244,104,128,255,159,238,
-    116,  2,172,230,172,240,233,243,241,245,225,242,101,128, 51, 34,
-    239,243,241,245,225,242,101,128, 51, 35,246,229,110,142,  0, 55,
-    173, 28,173, 37,173, 47,173, 77,173, 84,173, 94,173,119,173,146,
-    173,180,173,192,173,203,173,236,173,244,173,255,225,242,225,226,
-    233, 99,128,  6,103,226,229,238,231,225,236,105,128,  9,237,227,
-    233,242,227,236,101,129, 36,102,173, 58,233,238,246,229,242,243,
-    229,243,225,238,243,243,229,242,233,102,128, 39,144,228,229,246,
-     97,128,  9,109,229,233,231,232,244,232,115,128, 33, 94,231,117,
-      2,173,101,173,110,234,225,242,225,244,105,128, 10,237,242,237,
-    245,235,232,105,128, 10,109,232, 97,  2,173,126,173,137,227,235,
-    225,242,225,226,233, 99,128,  6,103,238,231,250,232,239,117,128,
-     48, 39,105,  2,173,152,173,170,228,229,239,231,242,225,240,232,
-    233,227,240,225,242,229,110,128, 50, 38,238,230,229,242,233,239,
-    114,128, 32,135,237,239,238,239,243,240,225,227,101,128,255, 23,
-    239,236,228,243,244,249,236,101,128,247, 55,112,  2,173,209,173,
-    216,225,242,229,110,128, 36,122,229,114,  2,173,223,173,229,233,
-    239,100,128, 36,142,243,233,225,110,128,  6,247,242,239,237,225,
-    110,128, 33,118,243,245,240,229,242,233,239,114,128, 32,119,116,
-      2,174,  5,174, 43,229,229,110,  2,174, 13,174, 22,227,233,242,
-    227,236,101,128, 36,112,112,  2,174, 28,174, 35,225,242,229,110,
-    128, 36,132,229,242,233,239,100,128, 36,152,232,225,105,128, 14,
-     87,230,244,232,249,240,232,229,110,128,  0,173,104,  7,174, 76,
-    175, 50,175, 61,175, 75,176, 20,176, 33,176,197, 97,  6,174, 90,
-    174,101,174,111,174,122,175,  9,175, 34,225,242,237,229,238,233,
-    225,110,128,  5,119,226,229,238,231,225,236,105,128,  9,182,227,
-    249,242,233,236,236,233, 99,128,  4, 72,100,  2,174,128,174,224,
-    228, 97,  4,174,139,174,148,174,179,174,193,225,242,225,226,233,
-     99,128,  6, 81,228,225,237,237, 97,  2,174,158,174,167,225,242,
-    225,226,233, 99,128,252, 97,244,225,238,225,242,225,226,233, 99,
-    128,252, 94,230,225,244,232,225,225,242,225,226,233, 99,128,252,
-     96,235,225,243,242, 97,  2,174,203,174,212,225,242,225,226,233,
-     99,128,252, 98,244,225,238,225,242,225,226,233, 99,128,252, 95,
-    101,132, 37,146,174,236,174,243,174,251,175,  4,228,225,242,107,
-    128, 37,147,236,233,231,232,116,128, 37,145,237,229,228,233,245,
-    109,128, 37,146,246, 97,128,  9, 54,231,117,  2,175, 16,175, 25,
-    234,225,242,225,244,105,128, 10,182,242,237,245,235,232,105,128,
-     10, 54,236,243,232,229,236,229,244,232,229,226,242,229,119,128,
-      5,147,226,239,240,239,237,239,230,111,128, 49, 21,227,232,225,
-    227,249,242,233,236,236,233, 99,128,  4, 73,101,  4,175, 85,175,
-    150,175,160,175,177,229,110,  4,175, 96,175,105,175,119,175,135,
-    225,242,225,226,233, 99,128,  6, 52,230,233,238,225,236,225,242,
-    225,226,233, 99,128,254,182,233,238,233,244,233,225,236,225,242,
-    225,226,233, 99,128,254,183,237,229,228,233,225,236,225,242,225,
-    226,233, 99,128,254,184,233,227,239,240,244,233, 99,128,  3,227,
-    241,229,108,129, 32,170,175,168,232,229,226,242,229,119,128, 32,
-    170,246, 97,134,  5,176,175,194,175,209,175,223,175,232,175,247,
-    176,  7, 49,  2,175,200,175,205,177, 53,128,  5,176, 53,128,  5,
-    176, 50,  2,175,215,175,219, 50,128,  5,176,101,128,  5,176,232,
-    229,226,242,229,119,128,  5,176,238,225,242,242,239,247,232,229,
-    226,242,229,119,128,  5,176,241,245,225,242,244,229,242,232,229,
-    226,242,229,119,128,  5,176,247,233,228,229,232,229,226,242,229,
-    119,128,  5,176,232,225,227,249,242,233,236,236,233, 99,128,  4,
-    187,105,  2,176, 39,176, 50,237,225,227,239,240,244,233, 99,128,
-      3,237,110,131,  5,233,176, 60,176,143,176,152,100,  2,176, 66,
-    176,132,225,231,229,243,104,130,251, 73,176, 78,176, 87,232,229,
-    226,242,229,119,128,251, 73,115,  2,176, 93,176,113,232,233,238,
-    228,239,116,129,251, 44,176,104,232,229,226,242,229,119,128,251,
-     44,233,238,228,239,116,129,251, 45,176,123,232,229,226,242,229,
-    119,128,251, 45,239,244,232,229,226,242,229,119,128,  5,193,232,
-    229,226,242,229,119,128,  5,233,115,  2,176,158,176,178,232,233,
-    238,228,239,116,129,251, 42,176,169,232,229,226,242,229,119,128,
-    251, 42,233,238,228,239,116,129,251, 43,176,188,232,229,226,242,
-    229,119,128,251, 43,239,239,107,128,  2,130,105,  8,176,221,177,
-      9,177, 20,177, 45,177, 75,177, 83,177, 96,178, 11,231,237, 97,
-    131,  3,195,176,233,176,237,176,245, 49,128,  3,194,230,233,238,
-    225,108,128,  3,194,236,245,238,225,244,229,243,249,237,226,239,
-    236,231,242,229,229,107,128,  3,242,232,233,242,225,231,225,238,
-     97,128, 48, 87,235,225,244,225,235,225,238, 97,129, 48,183,177,
-     33,232,225,236,230,247,233,228,244,104,128,255,124,236,245,113,
-      2,177, 53,177, 62,232,229,226,242,229,119,128,  5,189,236,229,
-    230,244,232,229,226,242,229,119,128,  5,189,237,233,236,225,114,
-    128, 34, 60,238,228,239,244,232,229,226,242,229,119,128,  5,194,
-    239,115,  6,177,111,177,146,177,178,177,206,177,220,177,252, 97,
-      2,177,117,177,132,227,233,242,227,236,229,235,239,242,229,225,
-    110,128, 50,116,240,225,242,229,238,235,239,242,229,225,110,128,
-     50, 20,227,105,  2,177,153,177,165,229,245,227,235,239,242,229,
-    225,110,128, 49,126,242,227,236,229,235,239,242,229,225,110,128,
-     50,102,107,  2,177,184,177,198,233,249,229,239,235,235,239,242,
-    229,225,110,128, 49,122,239,242,229,225,110,128, 49, 69,238,233,
-    229,245,238,235,239,242,229,225,110,128, 49,123,112,  2,177,226,
-    177,239,225,242,229,238,235,239,242,229,225,110,128, 50,  6,233,
-    229,245,240,235,239,242,229,225,110,128, 49,125,244,233,235,229,
-    245,244,235,239,242,229,225,110,128, 49,124,120,141,  0, 54,178,
-     41,178, 50,178, 60,178, 90,178, 97,178,122,178,149,178,183,178,
-    195,178,206,178,239,178,247,179,  2,225,242,225,226,233, 99,128,
-      6,102,226,229,238,231,225,236,105,128,  9,236,227,233,242,227,
-    236,101,129, 36,101,178, 71,233,238,246,229,242,243,229,243,225,
-    238,243,243,229,242,233,102,128, 39,143,228,229,246, 97,128,  9,
-    108,231,117,  2,178,104,178,113,234,225,242,225,244,105,128, 10,
-    236,242,237,245,235,232,105,128, 10,108,232, 97,  2,178,129,178,
-    140,227,235,225,242,225,226,233, 99,128,  6,102,238,231,250,232,
-    239,117,128, 48, 38,105,  2,178,155,178,173,228,229,239,231,242,
-    225,240,232,233,227,240,225,242,229,110,128, 50, 37,238,230,229,
-    242,233,239,114,128, 32,134,237,239,238,239,243,240,225,227,101,
-    128,255, 22,239,236,228,243,244,249,236,101,128,247, 54,112,  2,
-    178,212,178,219,225,242,229,110,128, 36,121,229,114,  2,178,226,
-    178,232,233,239,100,128, 36,141,243,233,225,110,128,  6,246,242,
-    239,237,225,110,128, 33,117,243,245,240,229,242,233,239,114,128,
-     32,118,116,  2,179,  8,179, 79,229,229,110,  2,179, 16,179, 58,
-     99,  2,179, 22,179, 30,233,242,227,236,101,128, 36,111,245,242,
-    242,229,238,227,249,228,229,238,239,237,233,238,225,244,239,242,
-    226,229,238,231,225,236,105,128,  9,249,112,  2,179, 64,179, 71,
-    225,242,229,110,128, 36,131,229,242,233,239,100,128, 36,151,232,
-    225,105,128, 14, 86,108,  2,179, 91,179,111,225,243,104,129,  0,
-     47,179, 99,237,239,238,239,243,240,225,227,101,128,255, 15,239,
-    238,103,129,  1,127,179,119,228,239,244,225,227,227,229,238,116,
-    128, 30,155,109,  2,179,137,179,147,233,236,229,230,225,227,101,
-    128, 38, 58,239,238,239,243,240,225,227,101,128,255, 83,111,  6,
-    179,172,179,222,179,233,180,  2,180, 47,180, 58,102,  2,179,178,
-    179,192,240,225,243,245,241,232,229,226,242,229,119,128,  5,195,
-    116,  2,179,198,179,207,232,249,240,232,229,110,128,  0,173,243,
-    233,231,238,227,249,242,233,236,236,233, 99,128,  4, 76,232,233,
-    242,225,231,225,238, 97,128, 48, 93,235,225,244,225,235,225,238,
-     97,129, 48,189,179,246,232,225,236,230,247,233,228,244,104,128,
-    255,127,236,233,228,245,115,  2,180, 12,180, 29,236,239,238,231,
-    239,246,229,242,236,225,249,227,237, 98,128,  3, 56,243,232,239,
-    242,244,239,246,229,242,236,225,249,227,237, 98,128,  3, 55,242,
-    245,243,233,244,232,225,105,128, 14, 41,115,  3,180, 66,180, 76,
-    180, 84,225,236,225,244,232,225,105,128, 14, 40,239,244,232,225,
-    105,128, 14, 11,245,225,244,232,225,105,128, 14, 42,240, 97,  3,
-    180,102,180,122,180,154,227,101,129,  0, 32,180,109,232,225,227,
-    235,225,242,225,226,233, 99,128,  0, 32,228,101,129, 38, 96,180,
-    129,243,245,233,116,  2,180,138,180,146,226,236,225,227,107,128,
-     38, 96,247,232,233,244,101,128, 38,100,242,229,110,128, 36,174,
-    241,245,225,242,101, 11,180,188,180,199,180,213,180,238,180,255,
-    181, 25,181, 40,181, 73,181,100,181,156,181,171,226,229,236,239,
-    247,227,237, 98,128,  3, 59, 99,  2,180,205,180,209, 99,128, 51,
-    196,109,128, 51,157,228,233,225,231,239,238,225,236,227,242,239,
-    243,243,232,225,244,227,232,230,233,236,108,128, 37,169,232,239,
-    242,233,250,239,238,244,225,236,230,233,236,108,128, 37,164,107,
-      2,181,  5,181,  9,103,128, 51,143,109,129, 51,158,181, 15,227,
-    225,240,233,244,225,108,128, 51,206,108,  2,181, 31,181, 35,110,
-    128, 51,209,239,103,128, 51,210,109,  4,181, 50,181, 54,181, 59,
-    181, 63,103,128, 51,142,233,108,128, 51,213,109,128, 51,156,243,
-    241,245,225,242,229,100,128, 51,161,239,242,244,232,239,231,239,
-    238,225,236,227,242,239,243,243,232,225,244,227,232,230,233,236,
-    108,128, 37,166,245,240,240,229,114,  2,181,110,181,133,236,229,
-    230,244,244,239,236,239,247,229,242,242,233,231,232,244,230,233,
-    236,108,128, 37,167,242,233,231,232,244,244,239,236,239,247,229,
-    242,236,229,230,244,230,233,236,108,128, 37,168,246,229,242,244,
-    233,227,225,236,230,233,236,108,128, 37,165,247,232,233,244,229,
-    247,233,244,232,243,237,225,236,236,226,236,225,227,107,128, 37,
-    163,242,243,241,245,225,242,101,128, 51,219,115,  2,181,209,182,
-    123, 97,  4,181,219,181,229,181,236,181,247,226,229,238,231,225,
-    236,105,128,  9,183,228,229,246, 97,128,  9, 55,231,245,234,225,
-    242,225,244,105,128, 10,183,238,103,  8,182, 10,182, 24,182, 38,
-    182, 52,182, 67,182, 81,182, 95,182,108,227,233,229,245,227,235,
-    239,242,229,225,110,128, 49, 73,232,233,229,245,232,235,239,242,
-    229,225,110,128, 49,133,233,229,245,238,231,235,239,242,229,225,
-    110,128, 49,128,235,233,249,229,239,235,235,239,242,229,225,110,
-    128, 49, 50,238,233,229,245,238,235,239,242,229,225,110,128, 49,
-    101,240,233,229,245,240,235,239,242,229,225,110,128, 49, 67,243,
-    233,239,243,235,239,242,229,225,110,128, 49, 70,244,233,235,229,
-    245,244,235,239,242,229,225,110,128, 49, 56,245,240,229,242,233,
-    239,114,128,246,242,116,  2,182,139,182,162,229,242,236,233,238,
-    103,129,  0,163,182,150,237,239,238,239,243,240,225,227,101,128,
-    255,225,242,239,235,101,  2,182,171,182,188,236,239,238,231,239,
-    246,229,242,236,225,249,227,237, 98,128,  3, 54,243,232,239,242,
-    244,239,246,229,242,236,225,249,227,237, 98,128,  3, 53,117,  7,
-    182,222,182,254,183, 20,183, 31,183, 72,183, 82,183, 86,226,243,
-    229,116,130, 34,130,182,233,182,244,238,239,244,229,241,245,225,
-    108,128, 34,138,239,242,229,241,245,225,108,128, 34,134, 99,  2,
-    183,  4,183, 12,227,229,229,228,115,128, 34,123,232,244,232,225,
-    116,128, 34, 11,232,233,242,225,231,225,238, 97,128, 48, 89,107,
-      2,183, 37,183, 61,225,244,225,235,225,238, 97,129, 48,185,183,
-     49,232,225,236,230,247,233,228,244,104,128,255,125,245,238,225,
-    242,225,226,233, 99,128,  6, 82,237,237,225,244,233,239,110,128,
-     34, 17,110,128, 38, 60,240,229,242,243,229,116,130, 34,131,183,
-     99,183,110,238,239,244,229,241,245,225,108,128, 34,139,239,242,
-    229,241,245,225,108,128, 34,135,246,243,241,245,225,242,101,128,
-     51,220,249,239,245,247,225,229,242,225,243,241,245,225,242,101,
-    128, 51,124,116,144,  0,116,183,183,184,192,184,213,185,100,185,
-    140,187,188,191, 70,192,145,192,157,192,169,193,202,193,227,194,
-     57,194,237,195,165,195,255, 97, 10,183,205,183,215,183,236,183,
-    243,184, 12,184, 90,184,107,184,132,184,146,184,150,226,229,238,
-    231,225,236,105,128,  9,164,227,107,  2,183,222,183,229,228,239,
-    247,110,128, 34,164,236,229,230,116,128, 34,163,228,229,246, 97,
-    128,  9, 36,231,117,  2,183,250,184,  3,234,225,242,225,244,105,
-    128, 10,164,242,237,245,235,232,105,128, 10, 36,104,  4,184, 22,
-    184, 31,184, 45,184, 75,225,242,225,226,233, 99,128,  6, 55,230,
-    233,238,225,236,225,242,225,226,233, 99,128,254,194,105,  2,184,
-     51,184, 66,238,233,244,233,225,236,225,242,225,226,233, 99,128,
-    254,195,242,225,231,225,238, 97,128, 48, 95,237,229,228,233,225,
-    236,225,242,225,226,233, 99,128,254,196,233,243,249,239,245,229,
-    242,225,243,241,245,225,242,101,128, 51,125,235,225,244,225,235,
-    225,238, 97,129, 48,191,184,120,232,225,236,230,247,233,228,244,
-    104,128,255,128,244,247,229,229,236,225,242,225,226,233, 99,128,
-      6, 64,117,128,  3,196,118,130,  5,234,184,158,184,183,228,225,
-    231,229,115,129,251, 74,184,168,104,129,251, 74,184,174,232,229,
-    226,242,229,119,128,251, 74,232,229,226,242,229,119,128,  5,234,
-     98,  2,184,198,184,203,225,114,128,  1,103,239,240,239,237,239,
-    230,111,128, 49, 10, 99,  6,184,227,184,234,184,241,184,250,185,
-     60,185, 87,225,242,239,110,128,  1,101,227,245,242,108,128,  2,
-    168,229,228,233,236,236, 97,128,  1, 99,232,229,104,  4,185,  6,
-    185, 15,185, 29,185, 45,225,242,225,226,233, 99,128,  6,134,230,
-    233,238,225,236,225,242,225,226,233, 99,128,251,123,233,238,233,
-    244,233,225,236,225,242,225,226,233, 99,128,251,124,237,229,228,
-    233,225,236,225,242,225,226,233, 99,128,251,125,233,242, 99,  2,
-    185, 68,185, 73,236,101,128, 36,227,245,237,230,236,229,248,226,
-    229,236,239,119,128, 30,113,239,237,237,225,225,227,227,229,238,
-    116,128,  1, 99,100,  2,185,106,185,116,233,229,242,229,243,233,
-    115,128, 30,151,239,116,  2,185,123,185,132,225,227,227,229,238,
-    116,128, 30,107,226,229,236,239,119,128, 30,109,101,  9,185,160,
-    185,171,185,191,186,201,186,226,187, 34,187,101,187,106,187,158,
-    227,249,242,233,236,236,233, 99,128,  4, 66,228,229,243,227,229,
-    238,228,229,242,227,249,242,233,236,236,233, 99,128,  4,173,104,
-      7,185,207,185,216,185,230,186, 14,186, 44,186, 85,186,183,225,
-    242,225,226,233, 99,128,  6, 42,230,233,238,225,236,225,242,225,
-    226,233, 99,128,254,150,232,225,232,105,  2,185,239,185,254,238,
-    233,244,233,225,236,225,242,225,226,233, 99,128,252,162,243,239,
-    236,225,244,229,228,225,242,225,226,233, 99,128,252, 12,105,  2,
-    186, 20,186, 35,238,233,244,233,225,236,225,242,225,226,233, 99,
-    128,254,151,242,225,231,225,238, 97,128, 48,102,234,229,229,237,
-    105,  2,186, 54,186, 69,238,233,244,233,225,236,225,242,225,226,
-    233, 99,128,252,161,243,239,236,225,244,229,228,225,242,225,226,
-    233, 99,128,252, 11,109,  2,186, 91,186,125,225,242,226,245,244,
-     97,  2,186,102,186,111,225,242,225,226,233, 99,128,  6, 41,230,
-    233,238,225,236,225,242,225,226,233, 99,128,254,148,101,  2,186,
-    131,186,144,228,233,225,236,225,242,225,226,233, 99,128,254,152,
-    229,237,105,  2,186,152,186,167,238,233,244,233,225,236,225,242,
-    225,226,233, 99,128,252,164,243,239,236,225,244,229,228,225,242,
-    225,226,233, 99,128,252, 14,238,239,239,238,230,233,238,225,236,
-    225,242,225,226,233, 99,128,252,115,235,225,244,225,235,225,238,
-     97,129, 48,198,186,214,232,225,236,230,247,233,228,244,104,128,
-    255,131,108,  2,186,232,186,251,229,240,232,239,238,101,129, 33,
-     33,186,243,226,236,225,227,107,128, 38, 14,233,243,232, 97,  2,
-    187,  4,187, 19,231,229,228,239,236,225,232,229,226,242,229,119,
-    128,  5,160,241,229,244,225,238,225,232,229,226,242,229,119,128,
-      5,169,110,  4,187, 44,187, 53,187, 72,187, 93,227,233,242,227,
-    236,101,128, 36,105,233,228,229,239,231,242,225,240,232,233,227,
-    240,225,242,229,110,128, 50, 41,112,  2,187, 78,187, 85,225,242,
-    229,110,128, 36,125,229,242,233,239,100,128, 36,145,242,239,237,
-    225,110,128, 33,121,243,104,128,  2,167,116,131,  5,216,187,116,
-    187,136,187,145,228,225,231,229,243,104,129,251, 56,187,127,232,
-    229,226,242,229,119,128,251, 56,232,229,226,242,229,119,128,  5,
-    216,243,229,227,249,242,233,236,236,233, 99,128,  4,181,246,233,
-    114,  2,187,166,187,175,232,229,226,242,229,119,128,  5,155,236,
-    229,230,244,232,229,226,242,229,119,128,  5,155,104,  6,187,202,
-    188, 98,188,220,189, 96,190,  3,191, 60, 97,  5,187,214,187,224,
-    187,231,188,  0,188, 29,226,229,238,231,225,236,105,128,  9,165,
-    228,229,246, 97,128,  9, 37,231,117,  2,187,238,187,247,234,225,
-    242,225,244,105,128, 10,165,242,237,245,235,232,105,128, 10, 37,
-    108,  2,188,  6,188, 15,225,242,225,226,233, 99,128,  6, 48,230,
-    233,238,225,236,225,242,225,226,233, 99,128,254,172,238,244,232,
-    225,235,232,225,116,  3,188, 44,188, 75,188, 82,236,239,119,  2,
-    188, 52,188, 63,236,229,230,244,244,232,225,105,128,248,152,242,
-    233,231,232,244,244,232,225,105,128,248,151,244,232,225,105,128,
-     14, 76,245,240,240,229,242,236,229,230,244,244,232,225,105,128,
-    248,150,101,  3,188,106,188,170,188,193,104,  4,188,116,188,125,
-    188,139,188,155,225,242,225,226,233, 99,128,  6, 43,230,233,238,
-    225,236,225,242,225,226,233, 99,128,254,154,233,238,233,244,233,
-    225,236,225,242,225,226,233, 99,128,254,155,237,229,228,233,225,
-    236,225,242,225,226,233, 99,128,254,156,242,101,  2,188,177,188,
-    186,229,248,233,243,244,115,128, 34,  3,230,239,242,101,128, 34,
-     52,244, 97,130,  3,184,188,202,188,206, 49,128,  3,209,243,249,
-    237,226,239,236,231,242,229,229,107,128,  3,209,105,  2,188,226,
-    189, 56,229,245,244,104,  4,188,239,189, 18,189, 33,189, 42, 97,
-      2,188,245,189,  4,227,233,242,227,236,229,235,239,242,229,225,
-    110,128, 50,121,240,225,242,229,238,235,239,242,229,225,110,128,
-     50, 25,227,233,242,227,236,229,235,239,242,229,225,110,128, 50,
-    107,235,239,242,229,225,110,128, 49, 76,240,225,242,229,238,235,
-    239,242,229,225,110,128, 50, 11,242,244,229,229,110,  2,189, 66,
-    189, 75,227,233,242,227,236,101,128, 36,108,112,  2,189, 81,189,
-     88,225,242,229,110,128, 36,128,229,242,233,239,100,128, 36,148,
-    111,  6,189,110,189,127,189,132,189,146,189,151,189,204,238,225,
-    238,231,237,239,238,244,232,239,244,232,225,105,128, 14, 17,239,
-    107,128,  1,173,240,232,245,244,232,225,239,244,232,225,105,128,
-     14, 18,242,110,128,  0,254,244,104,  3,189,160,189,184,189,194,
-     97,  2,189,166,189,176,232,225,238,244,232,225,105,128, 14, 23,
-    238,244,232,225,105,128, 14, 16,239,238,231,244,232,225,105,128,
-     14, 24,245,238,231,244,232,225,105,128, 14, 22,245,243,225,238,
-    100,  2,189,214,189,225,227,249,242,233,236,236,233, 99,128,  4,
-    130,243,243,229,240,225,242,225,244,239,114,  2,189,240,189,249,
-    225,242,225,226,233, 99,128,  6,108,240,229,242,243,233,225,110,
-    128,  6,108,242,229,101,144,  0, 51,190, 41,190, 50,190, 60,190,
-     90,190, 97,190,107,190,132,190,159,190,193,190,205,190,224,190,
-    235,191, 12,191, 34,191, 42,191, 53,225,242,225,226,233, 99,128,
-      6, 99,226,229,238,231,225,236,105,128,  9,233,227,233,242,227,
-    236,101,129, 36, 98,190, 71,233,238,246,229,242,243,229,243,225,
-    238,243,243,229,242,233,102,128, 39,140,228,229,246, 97,128,  9,
-    105,229,233,231,232,244,232,115,128, 33, 92,231,117,  2,190,114,
-    190,123,234,225,242,225,244,105,128, 10,233,242,237,245,235,232,
-    105,128, 10,105,232, 97,  2,190,139,190,150,227,235,225,242,225,
-    226,233, 99,128,  6, 99,238,231,250,232,239,117,128, 48, 35,105,
-      2,190,165,190,183,228,229,239,231,242,225,240,232,233,227,240,
-    225,242,229,110,128, 50, 34,238,230,229,242,233,239,114,128, 32,
-    131,237,239,238,239,243,240,225,227,101,128,255, 19,238,245,237,
-    229,242,225,244,239,242,226,229,238,231,225,236,105,128,  9,246,
-    239,236,228,243,244,249,236,101,128,247, 51,112,  2,190,241,190,
-    248,225,242,229,110,128, 36,118,229,114,  2,190,255,191,  5,233,
-    239,100,128, 36,138,243,233,225,110,128,  6,243,241,245,225,242,
-    244,229,242,115,129,  0,190,191, 25,229,237,228,225,243,104,128,
-    246,222,242,239,237,225,110,128, 33,114,243,245,240,229,242,233,
-    239,114,128,  0,179,244,232,225,105,128, 14, 83,250,243,241,245,
-    225,242,101,128, 51,148,105,  7,191, 86,191, 97,191,212,192, 54,
-    192, 66,192,115,192,132,232,233,242,225,231,225,238, 97,128, 48,
-     97,107,  2,191,103,191,127,225,244,225,235,225,238, 97,129, 48,
-    193,191,115,232,225,236,230,247,233,228,244,104,128,255,129,229,
-    245,116,  4,191,139,191,174,191,189,191,198, 97,  2,191,145,191,
-    160,227,233,242,227,236,229,235,239,242,229,225,110,128, 50,112,
-    240,225,242,229,238,235,239,242,229,225,110,128, 50, 16,227,233,
-    242,227,236,229,235,239,242,229,225,110,128, 50, 98,235,239,242,
-    229,225,110,128, 49, 55,240,225,242,229,238,235,239,242,229,225,
-    110,128, 50,  2,236,228,101,133,  2,220,191,228,191,239,192,  0,
-    192, 12,192, 40,226,229,236,239,247,227,237, 98,128,  3, 48, 99,
-      2,191,245,191,250,237, 98,128,  3,  3,239,237, 98,128,  3,  3,
-    228,239,245,226,236,229,227,237, 98,128,  3, 96,111,  2,192, 18,
-    192, 28,240,229,242,225,244,239,114,128, 34, 60,246,229,242,236,
-    225,249,227,237, 98,128,  3, 52,246,229,242,244,233,227,225,236,
-    227,237, 98,128,  3, 62,237,229,243,227,233,242,227,236,101,128,
-     34,151,112,  2,192, 72,192,102,229,232, 97,  2,192, 80,192, 89,
-    232,229,226,242,229,119,128,  5,150,236,229,230,244,232,229,226,
-    242,229,119,128,  5,150,240,233,231,245,242,237,245,235,232,105,
-    128, 10,112,244,236,239,227,249,242,233,236,236,233,227,227,237,
-     98,128,  4,131,247,238,225,242,237,229,238,233,225,110,128,  5,
-    127,236,233,238,229,226,229,236,239,119,128, 30,111,237,239,238,
-    239,243,240,225,227,101,128,255, 84,111,  7,192,185,192,196,192,
-    207,192,232,193, 96,193,108,193,192,225,242,237,229,238,233,225,
-    110,128,  5,105,232,233,242,225,231,225,238, 97,128, 48,104,235,
-    225,244,225,235,225,238, 97,129, 48,200,192,220,232,225,236,230,
-    247,233,228,244,104,128,255,132,110,  3,192,240,193, 82,193, 87,
-    101,  4,192,250,193, 63,193, 70,193, 76,226,225,114,  4,193,  6,
-    193, 35,193, 45,193, 54,229,248,244,242, 97,  2,193, 16,193, 26,
-    232,233,231,232,237,239,100,128,  2,229,236,239,247,237,239,100,
-    128,  2,233,232,233,231,232,237,239,100,128,  2,230,236,239,247,
-    237,239,100,128,  2,232,237,233,228,237,239,100,128,  2,231,230,
-    233,246,101,128,  1,189,243,233,120,128,  1,133,244,247,111,128,
-      1,168,239,115,128,  3,132,243,241,245,225,242,101,128, 51, 39,
-    240,225,244,225,235,244,232,225,105,128, 14, 15,242,244,239,233,
-    243,229,243,232,229,236,236,226,242,225,227,235,229,116,  2,193,
-    131,193,161,236,229,230,116,130, 48, 20,193,142,193,150,243,237,
-    225,236,108,128,254, 93,246,229,242,244,233,227,225,108,128,254,
-     57,242,233,231,232,116,130, 48, 21,193,173,193,181,243,237,225,
-    236,108,128,254, 94,246,229,242,244,233,227,225,108,128,254, 58,
-    244,225,239,244,232,225,105,128, 14, 21,240, 97,  2,193,209,193,
-    221,236,225,244,225,236,232,239,239,107,128,  1,171,242,229,110,
-    128, 36,175,114,  3,193,235,194, 10,194, 25,225,228,229,237,225,
-    242,107,129, 33, 34,193,247,115,  2,193,253,194,  3,225,238,115,
-    128,248,234,229,242,233,102,128,246,219,229,244,242,239,230,236,
-    229,248,232,239,239,107,128,  2,136,233,225,103,  4,194, 37,194,
-     42,194, 47,194, 52,228,110,128, 37,188,236,102,128, 37,196,242,
-    116,128, 37,186,245,112,128, 37,178,115,132,  2,166,194, 69,194,
-    108,194,214,194,227,225,228,105,130,  5,230,194, 79,194, 99,228,
-    225,231,229,243,104,129,251, 70,194, 90,232,229,226,242,229,119,
-    128,251, 70,232,229,226,242,229,119,128,  5,230,101,  2,194,114,
-    194,125,227,249,242,233,236,236,233, 99,128,  4, 70,242,101,134,
-      5,181,194,142,194,156,194,161,194,170,194,185,194,201, 49,  2,
-    194,148,194,152, 50,128,  5,181,101,128,  5,181,178, 98,128,  5,
-    181,232,229,226,242,229,119,128,  5,181,238,225,242,242,239,247,
-    232,229,226,242,229,119,128,  5,181,241,245,225,242,244,229,242,
-    232,229,226,242,229,119,128,  5,181,247,233,228,229,232,229,226,
-    242,229,119,128,  5,181,232,229,227,249,242,233,236,236,233, 99,
-    128,  4, 91,245,240,229,242,233,239,114,128,246,243,116,  4,194,
-    247,195, 41,195,106,195,157, 97,  3,194,255,195,  9,195, 16,226,
-    229,238,231,225,236,105,128,  9,159,228,229,246, 97,128,  9, 31,
-    231,117,  2,195, 23,195, 32,234,225,242,225,244,105,128, 10,159,
-    242,237,245,235,232,105,128, 10, 31,229,104,  4,195, 52,195, 61,
-    195, 75,195, 91,225,242,225,226,233, 99,128,  6,121,230,233,238,
-    225,236,225,242,225,226,233, 99,128,251,103,233,238,233,244,233,
-    225,236,225,242,225,226,233, 99,128,251,104,237,229,228,233,225,
-    236,225,242,225,226,233, 99,128,251,105,232, 97,  3,195,115,195,
-    125,195,132,226,229,238,231,225,236,105,128,  9,160,228,229,246,
-     97,128,  9, 32,231,117,  2,195,139,195,148,234,225,242,225,244,
-    105,128, 10,160,242,237,245,235,232,105,128, 10, 32,245,242,238,
-    229,100,128,  2,135,117,  3,195,173,195,184,195,209,232,233,242,
-    225,231,225,238, 97,128, 48,100,235,225,244,225,235,225,238, 97,
-    129, 48,196,195,197,232,225,236,230,247,233,228,244,104,128,255,
-    130,243,237,225,236,108,  2,195,219,195,230,232,233,242,225,231,
-    225,238, 97,128, 48, 99,235,225,244,225,235,225,238, 97,129, 48,
-    195,195,243,232,225,236,230,247,233,228,244,104,128,255,111,119,
-      2,196,  5,196,110,101,  2,196, 11,196, 59,236,246,101,  3,196,
-     21,196, 30,196, 51,227,233,242,227,236,101,128, 36,107,112,  2,
-    196, 36,196, 43,225,242,229,110,128, 36,127,229,242,233,239,100,
-    128, 36,147,242,239,237,225,110,128, 33,123,238,244,121,  3,196,
-     69,196, 78,196, 89,227,233,242,227,236,101,128, 36,115,232,225,
-    238,231,250,232,239,117,128, 83, 68,112,  2,196, 95,196,102,225,
-    242,229,110,128, 36,135,229,242,233,239,100,128, 36,155,111,142,
-      0, 50,196,142,196,151,196,161,196,191,196,243,197, 12,197, 39,
-    197, 73,197, 85,197,104,197,115,197,148,197,156,197,180,225,242,
-    225,226,233, 99,128,  6, 98,226,229,238,231,225,236,105,128,  9,
-    232,227,233,242,227,236,101,129, 36, 97,196,172,233,238,246,229,
-    242,243,229,243,225,238,243,243,229,242,233,102,128, 39,139,100,
-      2,196,197,196,203,229,246, 97,128,  9,104,239,116,  2,196,210,
-    196,221,229,238,236,229,225,228,229,114,128, 32, 37,236,229,225,
-    228,229,114,129, 32, 37,196,232,246,229,242,244,233,227,225,108,
-    128,254, 48,231,117,  2,196,250,197,  3,234,225,242,225,244,105,
-    128, 10,232,242,237,245,235,232,105,128, 10,104,232, 97,  2,197,
-     19,197, 30,227,235,225,242,225,226,233, 99,128,  6, 98,238,231,
-    250,232,239,117,128, 48, 34,105,  2,197, 45,197, 63,228,229,239,
-    231,242,225,240,232,233,227,240,225,242,229,110,128, 50, 33,238,
-    230,229,242,233,239,114,128, 32,130,237,239,238,239,243,240,225,
-    227,101,128,255, 18,238,245,237,229,242,225,244,239,242,226,229,
-    238,231,225,236,105,128,  9,245,239,236,228,243,244,249,236,101,
-    128,247, 50,112,  2,197,121,197,128,225,242,229,110,128, 36,117,
-    229,114,  2,197,135,197,141,233,239,100,128, 36,137,243,233,225,
-    110,128,  6,242,242,239,237,225,110,128, 33,113,115,  2,197,162,
-    197,170,244,242,239,235,101,128,  1,187,245,240,229,242,233,239,
-    114,128,  0,178,244,104,  2,197,187,197,192,225,105,128, 14, 82,
-    233,242,228,115,128, 33, 84,117,145,  0,117,197,237,197,245,198,
-     30,198, 87,198,225,199,  6,199,129,199,145,199,196,200, 10,200,
-     91,200,100,200,219,200,243,201, 95,201,123,201,237,225,227,245,
-    244,101,128,  0,250, 98,  4,197,255,198,  4,198, 13,198, 23,225,
-    114,128,  2,137,229,238,231,225,236,105,128,  9,137,239,240,239,
-    237,239,230,111,128, 49, 40,242,229,246,101,128,  1,109, 99,  3,
-    198, 38,198, 45,198, 77,225,242,239,110,128,  1,212,233,242, 99,
-      2,198, 53,198, 58,236,101,128, 36,228,245,237,230,236,229,120,
-    129,  0,251,198, 69,226,229,236,239,119,128, 30,119,249,242,233,
-    236,236,233, 99,128,  4, 67,100,  5,198, 99,198,110,198,133,198,
-    139,198,215,225,244,244,225,228,229,246, 97,128,  9, 81,226,108,
-      2,198,117,198,125,225,227,245,244,101,128,  1,113,231,242,225,
-    246,101,128,  2, 21,229,246, 97,128,  9,  9,233,229,242,229,243,
-    233,115,133,  0,252,198,159,198,167,198,175,198,198,198,206,225,
-    227,245,244,101,128,  1,216,226,229,236,239,119,128, 30,115, 99,
-      2,198,181,198,188,225,242,239,110,128,  1,218,249,242,233,236,
-    236,233, 99,128,  4,241,231,242,225,246,101,128,  1,220,237,225,
-    227,242,239,110,128,  1,214,239,244,226,229,236,239,119,128, 30,
-    229,103,  2,198,231,198,238,242,225,246,101,128,  0,249,117,  2,
-    198,244,198,253,234,225,242,225,244,105,128, 10,137,242,237,245,
-    235,232,105,128, 10,  9,104,  3,199, 14,199, 24,199,102,233,242,
-    225,231,225,238, 97,128, 48, 70,111,  2,199, 30,199, 40,239,235,
-    225,226,239,246,101,128, 30,231,242,110,133,  1,176,199, 55,199,
-     63,199, 74,199, 82,199, 94,225,227,245,244,101,128, 30,233,228,
-    239,244,226,229,236,239,119,128, 30,241,231,242,225,246,101,128,
-     30,235,232,239,239,235,225,226,239,246,101,128, 30,237,244,233,
-    236,228,101,128, 30,239,245,238,231,225,242,245,237,236,225,245,
-    116,129,  1,113,199,118,227,249,242,233,236,236,233, 99,128,  4,
-    243,233,238,246,229,242,244,229,228,226,242,229,246,101,128,  2,
-     23,107,  3,199,153,199,177,199,188,225,244,225,235,225,238, 97,
-    129, 48,166,199,165,232,225,236,230,247,233,228,244,104,128,255,
-    115,227,249,242,233,236,236,233, 99,128,  4,121,239,242,229,225,
-    110,128, 49, 92,109,  2,199,202,199,255, 97,  2,199,208,199,241,
-    227,242,239,110,130,  1,107,199,219,199,230,227,249,242,233,236,
-    236,233, 99,128,  4,239,228,233,229,242,229,243,233,115,128, 30,
-    123,244,242,225,231,245,242,237,245,235,232,105,128, 10, 65,239,
-    238,239,243,240,225,227,101,128,255, 85,110,  2,200, 16,200, 71,
-    228,229,242,243,227,239,242,101,132,  0, 95,200, 35,200, 41,200,
-     53,200, 64,228,226,108,128, 32, 23,237,239,238,239,243,240,225,
-    227,101,128,255, 63,246,229,242,244,233,227,225,108,128,254, 51,
-    247,225,246,121,128,254, 79,105,  2,200, 77,200, 82,239,110,128,
-     34, 42,246,229,242,243,225,108,128, 34,  0,239,231,239,238,229,
-    107,128,  1,115,112,  5,200,112,200,119,200,127,200,142,200,193,
-    225,242,229,110,128, 36,176,226,236,239,227,107,128, 37,128,240,
-    229,242,228,239,244,232,229,226,242,229,119,128,  5,196,243,233,
-    236,239,110,131,  3,197,200,156,200,177,200,185,228,233,229,242,
-    229,243,233,115,129,  3,203,200,169,244,239,238,239,115,128,  3,
-    176,236,225,244,233,110,128,  2,138,244,239,238,239,115,128,  3,
-    205,244,225,227,107,  2,200,202,200,213,226,229,236,239,247,227,
-    237, 98,128,  3, 29,237,239,100,128,  2,212,114,  2,200,225,200,
-    237,225,231,245,242,237,245,235,232,105,128, 10,115,233,238,103,
-    128,  1,111,115,  3,200,251,201, 10,201, 55,232,239,242,244,227,
-    249,242,233,236,236,233, 99,128,  4, 94,237,225,236,108,  2,201,
-     19,201, 30,232,233,242,225,231,225,238, 97,128, 48, 69,235,225,
-    244,225,235,225,238, 97,129, 48,165,201, 43,232,225,236,230,247,
-    233,228,244,104,128,255,105,244,242,225,233,231,232,116,  2,201,
-     67,201, 78,227,249,242,233,236,236,233, 99,128,  4,175,243,244,
-    242,239,235,229,227,249,242,233,236,236,233, 99,128,  4,177,244,
-    233,236,228,101,130,  1,105,201,107,201,115,225,227,245,244,101,
-    128, 30,121,226,229,236,239,119,128, 30,117,117,  5,201,135,201,
-    145,201,152,201,177,201,193,226,229,238,231,225,236,105,128,  9,
-    138,228,229,246, 97,128,  9, 10,231,117,  2,201,159,201,168,234,
-    225,242,225,244,105,128, 10,138,242,237,245,235,232,105,128, 10,
-     10,237,225,244,242,225,231,245,242,237,245,235,232,105,128, 10,
-     66,246,239,247,229,236,243,233,231,110,  3,201,209,201,219,201,
-    226,226,229,238,231,225,236,105,128,  9,194,228,229,246, 97,128,
-      9, 66,231,245,234,225,242,225,244,105,128, 10,194,246,239,247,
-    229,236,243,233,231,110,  3,201,253,202,  7,202, 14,226,229,238,
-    231,225,236,105,128,  9,193,228,229,246, 97,128,  9, 65,231,245,
-    234,225,242,225,244,105,128, 10,193,118,139,  0,118,202, 51,202,
-    199,202,208,202,219,203,148,203,155,203,253,204,  9,204,109,204,
-    117,204,138, 97,  4,202, 61,202, 68,202, 93,202,104,228,229,246,
-     97,128,  9, 53,231,117,  2,202, 75,202, 84,234,225,242,225,244,
-    105,128, 10,181,242,237,245,235,232,105,128, 10, 53,235,225,244,
-    225,235,225,238, 97,128, 48,247,118,132,  5,213,202,116,202,143,
-    202,175,202,187,228,225,231,229,243,104,130,251, 53,202,129,202,
-    134,182, 53,128,251, 53,232,229,226,242,229,119,128,251, 53,104,
-      2,202,149,202,157,229,226,242,229,119,128,  5,213,239,236,225,
-    109,129,251, 75,202,166,232,229,226,242,229,119,128,251, 75,246,
-    225,246,232,229,226,242,229,119,128,  5,240,249,239,228,232,229,
-    226,242,229,119,128,  5,241,227,233,242,227,236,101,128, 36,229,
-    228,239,244,226,229,236,239,119,128, 30,127,101,  6,202,233,202,
-    244,203, 52,203, 63,203, 69,203,136,227,249,242,233,236,236,233,
-     99,128,  4, 50,104,  4,202,254,203,  7,203, 21,203, 37,225,242,
-    225,226,233, 99,128,  6,164,230,233,238,225,236,225,242,225,226,
-    233, 99,128,251,107,233,238,233,244,233,225,236,225,242,225,226,
-    233, 99,128,251,108,237,229,228,233,225,236,225,242,225,226,233,
-     99,128,251,109,235,225,244,225,235,225,238, 97,128, 48,249,238,
-    245,115,128, 38, 64,242,244,233,227,225,108,  2,203, 80,203, 86,
-    226,225,114,128,  0,124,236,233,238,101,  4,203, 99,203,110,203,
-    121,203,130,225,226,239,246,229,227,237, 98,128,  3, 13,226,229,
-    236,239,247,227,237, 98,128,  3, 41,236,239,247,237,239,100,128,
-      2,204,237,239,100,128,  2,200,247,225,242,237,229,238,233,225,
-    110,128,  5,126,232,239,239,107,128,  2,139,105,  3,203,163,203,
-    174,203,213,235,225,244,225,235,225,238, 97,128, 48,248,242,225,
-    237, 97,  3,203,185,203,195,203,202,226,229,238,231,225,236,105,
-    128,  9,205,228,229,246, 97,128,  9, 77,231,245,234,225,242,225,
-    244,105,128, 10,205,243,225,242,231, 97,  3,203,225,203,235,203,
-    242,226,229,238,231,225,236,105,128,  9,131,228,229,246, 97,128,
-      9,  3,231,245,234,225,242,225,244,105,128, 10,131,237,239,238,
-    239,243,240,225,227,101,128,255, 86,111,  3,204, 17,204, 28,204,
-     98,225,242,237,229,238,233,225,110,128,  5,120,233,227,229,100,
-      2,204, 37,204, 73,233,244,229,242,225,244,233,239,110,  2,204,
-     51,204, 62,232,233,242,225,231,225,238, 97,128, 48,158,235,225,
-    244,225,235,225,238, 97,128, 48,254,237,225,242,235,235,225,238,
-     97,129, 48,155,204, 86,232,225,236,230,247,233,228,244,104,128,
-    255,158,235,225,244,225,235,225,238, 97,128, 48,250,240,225,242,
-    229,110,128, 36,177,116,  2,204,123,204,130,233,236,228,101,128,
-     30,125,245,242,238,229,100,128,  2,140,117,  2,204,144,204,155,
-    232,233,242,225,231,225,238, 97,128, 48,148,235,225,244,225,235,
-    225,238, 97,128, 48,244,119,143,  0,119,204,200,205,177,205,187,
-    205,210,205,250,206, 61,206, 69,208, 40,208, 81,208, 93,208,168,
-    208,176,208,183,208,194,208,203, 97,  8,204,218,204,225,204,235,
-    204,246,205, 28,205, 60,205, 72,205,108,227,245,244,101,128, 30,
-    131,229,235,239,242,229,225,110,128, 49, 89,232,233,242,225,231,
-    225,238, 97,128, 48,143,107,  2,204,252,205, 20,225,244,225,235,
-    225,238, 97,129, 48,239,205,  8,232,225,236,230,247,233,228,244,
-    104,128,255,156,239,242,229,225,110,128, 49, 88,243,237,225,236,
-    108,  2,205, 38,205, 49,232,233,242,225,231,225,238, 97,128, 48,
-    142,235,225,244,225,235,225,238, 97,128, 48,238,244,244,239,243,
-    241,245,225,242,101,128, 51, 87,118,  2,205, 78,205, 86,229,228,
-    225,243,104,128, 48, 28,249,245,238,228,229,242,243,227,239,242,
-    229,246,229,242,244,233,227,225,108,128,254, 52,119,  3,205,116,
-    205,125,205,139,225,242,225,226,233, 99,128,  6, 72,230,233,238,
-    225,236,225,242,225,226,233, 99,128,254,238,232,225,237,250,225,
-    225,226,239,246,101,  2,205,154,205,163,225,242,225,226,233, 99,
-    128,  6, 36,230,233,238,225,236,225,242,225,226,233, 99,128,254,
-    134,226,243,241,245,225,242,101,128, 51,221,227,233,242, 99,  2,
-    205,196,205,201,236,101,128, 36,230,245,237,230,236,229,120,128,
-      1,117,100,  2,205,216,205,226,233,229,242,229,243,233,115,128,
-     30,133,239,116,  2,205,233,205,242,225,227,227,229,238,116,128,
-     30,135,226,229,236,239,119,128, 30,137,101,  4,206,  4,206, 15,
-    206, 27,206, 51,232,233,242,225,231,225,238, 97,128, 48,145,233,
-    229,242,243,244,242,225,243,115,128, 33, 24,107,  2,206, 33,206,
-     43,225,244,225,235,225,238, 97,128, 48,241,239,242,229,225,110,
-    128, 49, 94,239,235,239,242,229,225,110,128, 49, 93,231,242,225,
-    246,101,128, 30,129,232,233,244,101,  8,206, 90,206, 99,206,183,
-    207, 17,207,101,207,146,207,198,207,254,226,245,236,236,229,116,
-    128, 37,230, 99,  2,206,105,206,125,233,242,227,236,101,129, 37,
-    203,206,115,233,238,246,229,242,243,101,128, 37,217,239,242,238,
-    229,242,226,242,225,227,235,229,116,  2,206,142,206,162,236,229,
-    230,116,129, 48, 14,206,151,246,229,242,244,233,227,225,108,128,
-    254, 67,242,233,231,232,116,129, 48, 15,206,172,246,229,242,244,
-    233,227,225,108,128,254, 68,100,  2,206,189,206,230,233,225,237,
-    239,238,100,129, 37,199,206,200,227,239,238,244,225,233,238,233,
-    238,231,226,236,225,227,235,243,237,225,236,236,228,233,225,237,
-    239,238,100,128, 37,200,239,247,238,240,239,233,238,244,233,238,
-    103,  2,206,246,207,  6,243,237,225,236,236,244,242,233,225,238,
-    231,236,101,128, 37,191,244,242,233,225,238,231,236,101,128, 37,
-    189,236,101,  2,207, 24,207, 66,230,244,240,239,233,238,244,233,
-    238,103,  2,207, 39,207, 55,243,237,225,236,236,244,242,233,225,
-    238,231,236,101,128, 37,195,244,242,233,225,238,231,236,101,128,
-     37,193,238,244,233,227,245,236,225,242,226,242,225,227,235,229,
-    116,  2,207, 86,207, 93,236,229,230,116,128, 48, 22,242,233,231,
-    232,116,128, 48, 23,242,233,231,232,244,240,239,233,238,244,233,
-    238,103,  2,207,119,207,135,243,237,225,236,236,244,242,233,225,
-    238,231,236,101,128, 37,185,244,242,233,225,238,231,236,101,128,
-     37,183,115,  3,207,154,207,184,207,192,109,  2,207,160,207,172,
-    225,236,236,243,241,245,225,242,101,128, 37,171,233,236,233,238,
-    231,230,225,227,101,128, 38, 58,241,245,225,242,101,128, 37,161,
-    244,225,114,128, 38,  6,116,  2,207,204,207,215,229,236,229,240,
-    232,239,238,101,128, 38, 15,239,242,244,239,233,243,229,243,232,
-    229,236,236,226,242,225,227,235,229,116,  2,207,239,207,246,236,
-    229,230,116,128, 48, 24,242,233,231,232,116,128, 48, 25,245,240,
-    240,239,233,238,244,233,238,103,  2,208, 13,208, 29,243,237,225,
-    236,236,244,242,233,225,238,231,236,101,128, 37,181,244,242,233,
-    225,238,231,236,101,128, 37,179,105,  2,208, 46,208, 57,232,233,
-    242,225,231,225,238, 97,128, 48,144,107,  2,208, 63,208, 73,225,
-    244,225,235,225,238, 97,128, 48,240,239,242,229,225,110,128, 49,
-     95,237,239,238,239,243,240,225,227,101,128,255, 87,111,  4,208,
-    103,208,114,208,139,208,157,232,233,242,225,231,225,238, 97,128,
-     48,146,235,225,244,225,235,225,238, 97,129, 48,242,208,127,232,
-    225,236,230,247,233,228,244,104,128,255,102,110,129, 32,169,208,
-    145,237,239,238,239,243,240,225,227,101,128,255,230,247,225,229,
-    238,244,232,225,105,128, 14, 39,240,225,242,229,110,128, 36,178,
-    242,233,238,103,128, 30,152,243,245,240,229,242,233,239,114,128,
-      2,183,244,245,242,238,229,100,128,  2,141,249,238,110,128,  1,
-    191,120,137,  0,120,208,231,208,242,208,253,209,  6,209, 33,209,
-     46,209, 50,209, 62,209, 70,225,226,239,246,229,227,237, 98,128,
-      3, 61,226,239,240,239,237,239,230,111,128, 49, 18,227,233,242,
-    227,236,101,128, 36,231,100,  2,209, 12,209, 22,233,229,242,229,
-    243,233,115,128, 30,141,239,244,225,227,227,229,238,116,128, 30,
-    139,229,232,225,242,237,229,238,233,225,110,128,  5,109,105,128,
-      3,190,237,239,238,239,243,240,225,227,101,128,255, 88,240,225,
-    242,229,110,128, 36,179,243,245,240,229,242,233,239,114,128,  2,
-    227,121,143,  0,121,209,115,210, 74,210, 97,210,137,212,103,212,
-    111,212,128,212,192,212,204,213,201,213,241,213,253,214,  8,214,
-     29,215,  2, 97, 11,209,139,209,151,209,161,209,168,209,175,209,
-    185,209,210,209,221,210,  3,210, 16,210, 62,225,228,239,243,241,
-    245,225,242,101,128, 51, 78,226,229,238,231,225,236,105,128,  9,
-    175,227,245,244,101,128,  0,253,228,229,246, 97,128,  9, 47,229,
-    235,239,242,229,225,110,128, 49, 82,231,117,  2,209,192,209,201,
-    234,225,242,225,244,105,128, 10,175,242,237,245,235,232,105,128,
-     10, 47,232,233,242,225,231,225,238, 97,128, 48,132,107,  2,209,
-    227,209,251,225,244,225,235,225,238, 97,129, 48,228,209,239,232,
-    225,236,230,247,233,228,244,104,128,255,148,239,242,229,225,110,
-    128, 49, 81,237,225,235,235,225,238,244,232,225,105,128, 14, 78,
-    243,237,225,236,108,  2,210, 26,210, 37,232,233,242,225,231,225,
-    238, 97,128, 48,131,235,225,244,225,235,225,238, 97,129, 48,227,
-    210, 50,232,225,236,230,247,233,228,244,104,128,255,108,244,227,
-    249,242,233,236,236,233, 99,128,  4, 99,227,233,242, 99,  2,210,
-     83,210, 88,236,101,128, 36,232,245,237,230,236,229,120,128,  1,
-    119,100,  2,210,103,210,113,233,229,242,229,243,233,115,128,  0,
-    255,239,116,  2,210,120,210,129,225,227,227,229,238,116,128, 30,
-    143,226,229,236,239,119,128, 30,245,101,  7,210,153,211,161,211,
-    170,211,188,211,220,212, 40,212, 91,104,  8,210,171,210,180,210,
-    214,210,228,211, 45,211, 61,211,120,211,138,225,242,225,226,233,
-     99,128,  6, 74,226,225,242,242,229,101,  2,210,191,210,200,225,
-    242,225,226,233, 99,128,  6,210,230,233,238,225,236,225,242,225,
-    226,233, 99,128,251,175,230,233,238,225,236,225,242,225,226,233,
-     99,128,254,242,232,225,237,250,225,225,226,239,246,101,  4,210,
-    247,211,  0,211, 14,211, 30,225,242,225,226,233, 99,128,  6, 38,
-    230,233,238,225,236,225,242,225,226,233, 99,128,254,138,233,238,
-    233,244,233,225,236,225,242,225,226,233, 99,128,254,139,237,229,
-    228,233,225,236,225,242,225,226,233, 99,128,254,140,233,238,233,
-    244,233,225,236,225,242,225,226,233, 99,128,254,243,237,101,  2,
-    211, 68,211, 81,228,233,225,236,225,242,225,226,233, 99,128,254,
-    244,229,237,105,  2,211, 89,211,104,238,233,244,233,225,236,225,
-    242,225,226,233, 99,128,252,221,243,239,236,225,244,229,228,225,
-    242,225,226,233, 99,128,252, 88,238,239,239,238,230,233,238,225,
-    236,225,242,225,226,233, 99,128,252,148,244,232,242,229,229,228,
-    239,244,243,226,229,236,239,247,225,242,225,226,233, 99,128,  6,
-    209,235,239,242,229,225,110,128, 49, 86,110,129,  0,165,211,176,
-    237,239,238,239,243,240,225,227,101,128,255,229,111,  2,211,194,
-    211,203,235,239,242,229,225,110,128, 49, 85,242,233,238,232,233,
-    229,245,232,235,239,242,229,225,110,128, 49,134,114,  3,211,228,
-    212,  8,212, 20,225,232,226,229,238,249,239,237,111,  2,211,242,
-    211,251,232,229,226,242,229,119,128,  5,170,236,229,230,244,232,
-    229,226,242,229,119,128,  5,170,233,227,249,242,233,236,236,233,
-     99,128,  4, 75,245,228,233,229,242,229,243,233,243,227,249,242,
-    233,236,236,233, 99,128,  4,249,243,233,229,245,238,103,  3,212,
-     53,212, 62,212, 78,235,239,242,229,225,110,128, 49,129,240,225,
-    238,243,233,239,243,235,239,242,229,225,110,128, 49,131,243,233,
-    239,243,235,239,242,229,225,110,128, 49,130,244,233,246,232,229,
-    226,242,229,119,128,  5,154,231,242,225,246,101,128, 30,243,232,
-    239,239,107,129,  1,180,212,120,225,226,239,246,101,128, 30,247,
-    105,  5,212,140,212,151,212,162,212,171,212,179,225,242,237,229,
-    238,233,225,110,128,  5,117,227,249,242,233,236,236,233, 99,128,
-      4, 87,235,239,242,229,225,110,128, 49, 98,238,249,225,238,103,
-    128, 38, 47,247,238,225,242,237,229,238,233,225,110,128,  5,130,
-    237,239,238,239,243,240,225,227,101,128,255, 89,111,  7,212,220,
-    213, 34,213, 45,213, 55,213, 93,213,139,213,148,100,131,  5,217,
-    212,230,212,250,213,  3,228,225,231,229,243,104,129,251, 57,212,
-    241,232,229,226,242,229,119,128,251, 57,232,229,226,242,229,119,
-    128,  5,217,249,239,100,  2,213, 11,213, 20,232,229,226,242,229,
-    119,128,  5,242,240,225,244,225,232,232,229,226,242,229,119,128,
-    251, 31,232,233,242,225,231,225,238, 97,128, 48,136,233,235,239,
-    242,229,225,110,128, 49,137,107,  2,213, 61,213, 85,225,244,225,
-    235,225,238, 97,129, 48,232,213, 73,232,225,236,230,247,233,228,
-    244,104,128,255,150,239,242,229,225,110,128, 49, 91,243,237,225,
-    236,108,  2,213,103,213,114,232,233,242,225,231,225,238, 97,128,
-     48,135,235,225,244,225,235,225,238, 97,129, 48,231,213,127,232,
-    225,236,230,247,233,228,244,104,128,255,110,244,231,242,229,229,
-    107,128,  3,243,121,  2,213,154,213,191, 97,  2,213,160,213,170,
-    229,235,239,242,229,225,110,128, 49,136,107,  2,213,176,213,184,
-    239,242,229,225,110,128, 49,135,244,232,225,105,128, 14, 34,233,
-    238,231,244,232,225,105,128, 14, 13,112,  2,213,207,213,214,225,
-    242,229,110,128, 36,180,239,231,229,231,242,225,237,237,229,238,
-    105,129,  3,122,213,230,231,242,229,229,235,227,237, 98,128,  3,
-     69,114,129,  1,166,213,247,233,238,103,128, 30,153,243,245,240,
-    229,242,233,239,114,128,  2,184,116,  2,214, 14,214, 21,233,236,
-    228,101,128, 30,249,245,242,238,229,100,128,  2,142,117,  5,214,
-     41,214, 52,214, 62,214,100,214,232,232,233,242,225,231,225,238,
-     97,128, 48,134,233,235,239,242,229,225,110,128, 49,140,107,  2,
-    214, 68,214, 92,225,244,225,235,225,238, 97,129, 48,230,214, 80,
-    232,225,236,230,247,233,228,244,104,128,255,149,239,242,229,225,
-    110,128, 49, 96,115,  3,214,108,214,146,214,187,226,233,103,  2,
-    214,116,214,127,227,249,242,233,236,236,233, 99,128,  4,107,233,
-    239,244,233,230,233,229,228,227,249,242,233,236,236,233, 99,128,
-      4,109,236,233,244,244,236,101,  2,214,157,214,168,227,249,242,
-    233,236,236,233, 99,128,  4,103,233,239,244,233,230,233,229,228,
-    227,249,242,233,236,236,233, 99,128,  4,105,237,225,236,108,  2,
-    214,196,214,207,232,233,242,225,231,225,238, 97,128, 48,133,235,
-    225,244,225,235,225,238, 97,129, 48,229,214,220,232,225,236,230,
-    247,233,228,244,104,128,255,109,249,101,  2,214,239,214,248,235,
-    239,242,229,225,110,128, 49,139,239,235,239,242,229,225,110,128,
-     49,138,249, 97,  2,215,  9,215, 19,226,229,238,231,225,236,105,
-    128,  9,223,228,229,246, 97,128,  9, 95,122,142,  0,122,215, 58,
-    216, 66,216, 77,216,120,216,147,217,182,218, 34,218, 76,218, 88,
-    218,100,218,128,218,136,218,152,218,161, 97, 10,215, 80,215, 91,
-    215, 98,215,105,215,116,215,194,215,224,215,235,216, 15,216, 27,
-    225,242,237,229,238,233,225,110,128,  5,102,227,245,244,101,128,
-      1,122,228,229,246, 97,128,  9, 91,231,245,242,237,245,235,232,
-    105,128, 10, 91,104,  4,215,126,215,135,215,149,215,179,225,242,
-    225,226,233, 99,128,  6, 56,230,233,238,225,236,225,242,225,226,
-    233, 99,128,254,198,105,  2,215,155,215,170,238,233,244,233,225,
-    236,225,242,225,226,233, 99,128,254,199,242,225,231,225,238, 97,
-    128, 48, 86,237,229,228,233,225,236,225,242,225,226,233, 99,128,
-    254,200,233,110,  2,215,201,215,210,225,242,225,226,233, 99,128,
-      6, 50,230,233,238,225,236,225,242,225,226,233, 99,128,254,176,
-    235,225,244,225,235,225,238, 97,128, 48,182,241,229,102,  2,215,
-    243,216,  1,231,225,228,239,236,232,229,226,242,229,119,128,  5,
-    149,241,225,244,225,238,232,229,226,242,229,119,128,  5,148,242,
-    241,225,232,229,226,242,229,119,128,  5,152,249,233,110,130,  5,
-    214,216, 37,216, 57,228,225,231,229,243,104,129,251, 54,216, 48,
-    232,229,226,242,229,119,128,251, 54,232,229,226,242,229,119,128,
-      5,214,226,239,240,239,237,239,230,111,128, 49, 23, 99,  3,216,
-     85,216, 92,216,114,225,242,239,110,128,  1,126,233,242, 99,  2,
-    216,100,216,105,236,101,128, 36,233,245,237,230,236,229,120,128,
-     30,145,245,242,108,128,  2,145,228,239,116,130,  1,124,216,130,
-    216,139,225,227,227,229,238,116,128,  1,124,226,229,236,239,119,
-    128, 30,147,101,  6,216,161,216,172,216,215,216,226,216,237,217,
-    177,227,249,242,233,236,236,233, 99,128,  4, 55,100,  2,216,178,
-    216,197,229,243,227,229,238,228,229,242,227,249,242,233,236,236,
-    233, 99,128,  4,153,233,229,242,229,243,233,243,227,249,242,233,
-    236,236,233, 99,128,  4,223,232,233,242,225,231,225,238, 97,128,
-     48, 92,235,225,244,225,235,225,238, 97,128, 48,188,242,111,140,
-      0, 48,217, 10,217, 19,217, 29,217, 36,217, 61,217, 74,217, 85,
-    217, 97,217,108,217,118,217,129,217,136,225,242,225,226,233, 99,
-    128,  6, 96,226,229,238,231,225,236,105,128,  9,230,228,229,246,
-     97,128,  9,102,231,117,  2,217, 43,217, 52,234,225,242,225,244,
-    105,128, 10,230,242,237,245,235,232,105,128, 10,102,232,225,227,
-    235,225,242,225,226,233, 99,128,  6, 96,233,238,230,229,242,233,
-    239,114,128, 32,128,237,239,238,239,243,240,225,227,101,128,255,
-     16,239,236,228,243,244,249,236,101,128,247, 48,240,229,242,243,
-    233,225,110,128,  6,240,243,245,240,229,242,233,239,114,128, 32,
-    112,244,232,225,105,128, 14, 80,247,233,228,244,104,  3,217,148,
-    217,157,217,169,234,239,233,238,229,114,128,254,255,238,239,238,
-    234,239,233,238,229,114,128, 32, 12,243,240,225,227,101,128, 32,
-     11,244, 97,128,  3,182,104,  2,217,188,217,199,226,239,240,239,
-    237,239,230,111,128, 49, 19,101,  4,217,209,217,220,217,236,217,
-    247,225,242,237,229,238,233,225,110,128,  5,106,226,242,229,246,
-    229,227,249,242,233,236,236,233, 99,128,  4,194,227,249,242,233,
-    236,236,233, 99,128,  4, 54,100,  2,217,253,218, 16,229,243,227,
-    229,238,228,229,242,227,249,242,233,236,236,233, 99,128,  4,151,
-    233,229,242,229,243,233,243,227,249,242,233,236,236,233, 99,128,
-      4,221,105,  3,218, 42,218, 53,218, 64,232,233,242,225,231,225,
-    238, 97,128, 48, 88,235,225,244,225,235,225,238, 97,128, 48,184,
-    238,239,242,232,229,226,242,229,119,128,  5,174,236,233,238,229,
-    226,229,236,239,119,128, 30,149,237,239,238,239,243,240,225,227,
-    101,128,255, 90,111,  2,218,106,218,117,232,233,242,225,231,225,
-    238, 97,128, 48, 94,235,225,244,225,235,225,238, 97,128, 48,190,
-    240,225,242,229,110,128, 36,181,242,229,244,242,239,230,236,229,
-    248,232,239,239,107,128,  2,144,243,244,242,239,235,101,128,  1,
-    182,117,  2,218,167,218,178,232,233,242,225,231,225,238, 97,128,
-     48, 90,235,225,244,225,235,225,238, 97,128, 48,186
-  };
-
-
-  /*
-   *  This function searches the compressed table efficiently.
-   */
-  static unsigned long
-  ft_get_adobe_glyph_index( const char*  name,
-                            const char*  limit )
-  {
-    int                   c = 0;
-    int                   count, min, max;
-    const unsigned char*  p = ft_adobe_glyph_list;
-
-
-    if ( name == 0 || name >= limit )
-      goto NotFound;
-
-    c     = *name++;
-    count = p[1];
-    p    += 2;
-
-    min = 0;
-    max = count;
-
-    while ( min < max )
-    {
-      int                   mid = ( min + max ) >> 1;
-      const unsigned char*  q   = p + mid * 2;
-      int                   c2;
-
-
-      q = ft_adobe_glyph_list + ( ( (int)q[0] << 8 ) | q[1] );
-
-      c2 = q[0] & 127;
-      if ( c2 == c )
-      {
-        p = q;
-        goto Found;
-      }
-      if ( c2 < c )
-        min = mid + 1;
-      else
-        max = mid;
-    }
-    goto NotFound;
-
-  Found:
-    for (;;)
-    {
-      /* assert (*p & 127) == c */
-
-      if ( name >= limit )
-      {
-        if ( (p[0] & 128) == 0 &&
-             (p[1] & 128) != 0 )
-          return (unsigned long)( ( (int)p[2] << 8 ) | p[3] );
-
-        goto NotFound;
-      }
-      c = *name++;
-      if ( p[0] & 128 )
-      {
-        p++;
-        if ( c != (p[0] & 127) )
-          goto NotFound;
-
-        continue;
-      }
-
-      p++;
-      count = p[0] & 127;
-      if ( p[0] & 128 )
-        p += 2;
-
-      p++;
-
-      for ( ; count > 0; count--, p += 2 )
-      {
-        int                   offset = ( (int)p[0] << 8 ) | p[1];
-        const unsigned char*  q      = ft_adobe_glyph_list + offset;
-
-        if ( c == ( q[0] & 127 ) )
-        {
-          p = q;
-          goto NextIter;
-        }
-      }
-      goto NotFound;
-
-    NextIter:
-      ;
-    }
-
-  NotFound:
-    return 0;
-  }
-
-#endif /* FT_CONFIG_OPTION_ADOBE_GLYPH_LIST */
-
-
-/* END */
@@ -1,25 +0,0 @@
-/***************************************************************************/
-/*                                                                         */
-/*  type42.c                                                               */
-/*                                                                         */
-/*    FreeType Type 42 driver component.                                   */
-/*                                                                         */
-/*  Copyright 2002 by                                                      */
-/*  David Turner, Robert Wilhelm, and Werner Lemberg.                      */
-/*                                                                         */
-/*  This file is part of the FreeType project, and may only be used,       */
-/*  modified, and distributed under the terms of the FreeType project      */
-/*  license, LICENSE.TXT.  By continuing to use, modify, or distribute     */
-/*  this file you indicate that you have read the license and              */
-/*  understand and accept it fully.                                        */
-/*                                                                         */
-/***************************************************************************/
-
-#define FT_MAKE_OPTION_SINGLE_OBJECT
-
-#include <ft2build.h>
-#include "t42objs.c"
-#include "t42parse.c"
-#include "t42drivr.c"
-
-/* END */
@@ -0,0 +1,71 @@
+/* Generated by tools/glyph_atlas.c, don't edit */
+/* Ubuntu-R.ttf, 30 px: "microBYTE" */
+#pragma once
+
+#include <stdint.h>
+
+typedef struct glyph_atlas_entry {
+	uint32_t utf_code;
+	uint8_t bitmap_width;
+	uint8_t bitmap_height;
+	int8_t bitmap_left;
+	int8_t bitmap_top;
+	uint8_t advance;
+	uint16_t offset;	// Of the bitmap on glyph_atlas_bitmap
+} glyph_atlas_entry_t;
+
+#define GLYPH_ATLAS_MAX_PIXEL_HEIGHT 30
+#define GLYPH_ATLAS_ORIGIN 5
+#define GLYPH_ATLAS_SIZE 9
+
+static const glyph_atlas_entry_t glyph_atlas[GLYPH_ATLAS_SIZE] = {
+	{ 0x6d, 21, 16, 2, 16, 25, 0 },	// m
+	{ 0x69, 5, 22, 1, 22, 7, 84 },	// i
+	{ 0x63, 12, 16, 1, 16, 14, 112 },	// c
+	{ 0x72, 10, 16, 2, 16, 12, 160 },	// r
+	{ 0x6f, 16, 16, 1, 16, 18, 200 },	// o
+	{ 0x42, 14, 21, 3, 21, 19, 264 },	// B
+	{ 0x59, 17, 21, 0, 21, 17, 338 },	// Y
+	{ 0x54, 17, 21, 0, 21, 17, 428 },	// T
+	{ 0x45, 13, 21, 3, 21, 17, 518 },	// E
+};
+
+static const uint8_t glyph_atlas_bitmap[587] = {
+	0xe9, 0xff, 0x02, 0xfd, 0x0b, 0xfc, 0xff, 0xbf, 0xff, 0xff, 0xf1, 0x03, 0xf4, 0x1f, 0xd0, 0xcf,
+	0x0f, 0x80, 0x2f, 0x00, 0xbe, 0x3f, 0x00, 0xfd, 0x00, 0xf0, 0xff, 0x00, 0xf0, 0x03, 0xc0, 0xff,
+	0x03, 0xc0, 0x0f, 0x00, 0xff, 0x0f, 0x00, 0x3f, 0x00, 0xfc, 0x3f, 0x00, 0xfc, 0x00, 0xf0, 0xff,
+	0x00, 0xf0, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x0f, 0x00, 0xff, 0x0f, 0x00, 0x3f, 0x00, 0xfc, 0x3f,
+	0x00, 0xfc, 0x00, 0xf0, 0xff, 0x00, 0xf0, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0x0f, 0x00, 0xff, 0x0f,
+	0x00, 0x3f, 0x00, 0xfc, 0xfc, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0x3f, 0xfc, 0xf0,
+	0xc3, 0x0f, 0x3f, 0xfc, 0xf0, 0xc3, 0x0f, 0x3f, 0xfc, 0xf0, 0xc3, 0x0f, 0x3f, 0xfc, 0xf0, 0x03,
+	0x00, 0xf9, 0x6f, 0xc0, 0xff, 0xbf, 0xf0, 0x0b, 0x50, 0xfc, 0x01, 0x00, 0xbd, 0x00, 0x00, 0x7e,
+	0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x7e, 0x00,
+	0x00, 0xbd, 0x00, 0x00, 0xfc, 0x01, 0x00, 0xf4, 0x0b, 0x50, 0xd0, 0xff, 0xff, 0x00, 0xf9, 0x6f,
+	0xe4, 0xff, 0xfb, 0xff, 0xbf, 0x7f, 0x00, 0xf0, 0x03, 0x00, 0x3f, 0x00, 0xf0, 0x03, 0x00, 0x3f,
+	0x00, 0xf0, 0x03, 0x00, 0x3f, 0x00, 0xf0, 0x03, 0x00, 0x3f, 0x00, 0xf0, 0x03, 0x00, 0x3f, 0x00,
+	0xf0, 0x03, 0x00, 0x3f, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf9, 0x6f, 0x00, 0xc0, 0xff, 0xff, 0x02,
+	0xf0, 0x0b, 0xe0, 0x0f, 0xf8, 0x01, 0x40, 0x2f, 0xfd, 0x00, 0x00, 0x7f, 0x7e, 0x00, 0x00, 0xbd,
+	0x3f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xfc,
+	0x7e, 0x00, 0x00, 0xbd, 0xfd, 0x00, 0x00, 0x7f, 0xfc, 0x01, 0x40, 0x3f, 0xf0, 0x0b, 0xe0, 0x0f,
+	0xc0, 0xff, 0xff, 0x03, 0x00, 0xf9, 0x6f, 0x00, 0xfe, 0xff, 0x06, 0xf0, 0xff, 0xff, 0x07, 0xff,
+	0xff, 0xff, 0xf0, 0x03, 0xe0, 0x2f, 0x3f, 0x00, 0xf4, 0xf3, 0x03, 0x00, 0x3f, 0x3f, 0x00, 0xf4,
+	0xf3, 0x03, 0xd0, 0x1f, 0xff, 0xff, 0x7f, 0xf0, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xf1, 0x03,
+	0x90, 0x7f, 0x3f, 0x00, 0xe0, 0xfb, 0x03, 0x00, 0xfc, 0x3f, 0x00, 0xc0, 0xff, 0x03, 0x00, 0xfc,
+	0x3f, 0x00, 0xe0, 0xfb, 0x03, 0xd0, 0x7f, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0x0b, 0xfe, 0xff,
+	0x06, 0x00, 0x7e, 0x00, 0x00, 0xf4, 0xf2, 0x02, 0x00, 0xf0, 0x83, 0x0f, 0x00, 0xc0, 0x0b, 0xbc,
+	0x00, 0xc0, 0x0f, 0xe0, 0x03, 0x40, 0x2f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0xf8, 0x01, 0xbd, 0x00,
+	0xc0, 0x0f, 0xfc, 0x00, 0x00, 0xbe, 0xf8, 0x02, 0x00, 0xf0, 0xf7, 0x03, 0x00, 0x40, 0xff, 0x07,
+	0x00, 0x00, 0xfc, 0x0f, 0x00, 0x00, 0xd0, 0x1f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc,
+	0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+	0xfc, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xc0, 0x0f,
+	0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xc0,
+	0x0f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00,
+	0xc0, 0x0f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00,
+	0x00, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf0, 0x03,
+	0x00, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xcf,
+	0x0f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf0, 0x03, 0x00, 0xc0, 0x0f, 0x00, 0x00,
+	0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xc3, 0x0f, 0x00, 0x00, 0x3f, 0x00, 0x00,
+	0xfc, 0x00, 0x00, 0xf0, 0x03, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xfc, 0x00, 0x00,
+	0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03,
+};
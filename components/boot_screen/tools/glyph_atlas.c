@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Offline tool of the boot screen: rasterizes the glyphs of the boot text with
+ * FreeType and writes them as a gray2 atlas header, so the firmware only has to
+ * blit them. The glyphs are packed like the old font_render.c did it, 4 pixels
+ * per byte, pixel i at bits (i & 3) * 2, each glyph starting on a new byte.
+ *
+ * It runs on the host with the FreeType of the system, build it from
+ * components/boot_screen with:
+ *
+ *   gcc -O2 tools/glyph_atlas.c $(pkg-config --cflags --libs freetype2) -o glyph_atlas
+ *
+ * glyph_atlas.h was made with FreeType 2.4.12, other versions may hint the glyphs a little
+ * differently.
+ *
+ * Usage: glyph_atlas font.ttf pixel_size characters output.h
+ *   e.g. ./glyph_atlas Ubuntu-R.ttf 30 microBYTE glyph_atlas.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "ft2build.h"
+#include FT_FREETYPE_H
+
+#define GLYPH_MAX 128
+
+typedef struct {
+	uint32_t utf_code;
+	int width;
+	int height;
+	int left;
+	int top;
+	int advance;
+	size_t offset;
+} atlas_glyph_t;
+
+static atlas_glyph_t glyphs[GLYPH_MAX];
+static uint8_t atlas[GLYPH_MAX * 1024];
+
+// The face is loaded from memory like the firmware did.
+static uint8_t *read_font(const char *path, long *size) {
+	FILE *file = fopen(path, "rb");
+	if (file == NULL) return NULL;
+
+	fseek(file, 0, SEEK_END);
+	*size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	uint8_t *data = malloc(*size);
+	if (data != NULL && fread(data, 1, *size, file) != (size_t)*size) {
+		free(data);
+		data = NULL;
+	}
+	fclose(file);
+
+	return data;
+}
+
+static int add_glyph(FT_Face face, uint32_t code, int n, size_t *atlas_size) {
+	for (int i = 0; i < n; ++i) {
+		if (glyphs[i].utf_code == code) return n;
+	}
+	if (n == GLYPH_MAX) {
+		fprintf(stderr, "Too many glyphs\n");
+		exit(1);
+	}
+
+	FT_UInt index = FT_Get_Char_Index(face, code);
+	if (index == 0 || FT_Load_Glyph(face, index, FT_LOAD_DEFAULT) || FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL)) {
+		fprintf(stderr, "Glyph 0x%x not rendered\n", code);
+		exit(1);
+	}
+
+	FT_GlyphSlot slot = face->glyph;
+	size_t bytes = ((size_t)slot->bitmap.width * slot->bitmap.rows + 3) >> 2;
+	if (*atlas_size + bytes > sizeof(atlas)) {
+		fprintf(stderr, "Atlas full\n");
+		exit(1);
+	}
+
+	atlas_glyph_t *glyph = &glyphs[n];
+	glyph->utf_code = code;
+	glyph->width = slot->bitmap.width;
+	glyph->height = slot->bitmap.rows;
+	glyph->left = slot->bitmap_left;
+	glyph->top = slot->bitmap_top;
+	glyph->advance = slot->advance.x >> 6;
+	glyph->offset = *atlas_size;
+
+	uint8_t *bitmap = atlas + *atlas_size;
+	size_t pos = 0;
+	for (unsigned int y = 0; y < slot->bitmap.rows; ++y) {
+		for (unsigned int x = 0; x < slot->bitmap.width; ++x) {
+			uint8_t color = slot->bitmap.buffer[y * slot->bitmap.pitch + x];
+			bitmap[pos >> 2] |= ((color >> 6) << ((pos & 0x03) << 1));
+			pos++;
+		}
+	}
+	*atlas_size += bytes;
+
+	return n + 1;
+}
+
+int main(int argc, char **argv) {
+	if (argc != 5) {
+		fprintf(stderr, "Usage: glyph_atlas font.ttf pixel_size characters output.h\n");
+		return 1;
+	}
+
+	FT_Library library;
+	FT_Face face;
+	int pixel_size = atoi(argv[2]);
+	long font_size = 0;
+	uint8_t *font = read_font(argv[1], &font_size);
+
+	if (font == NULL || FT_Init_FreeType(&library) || FT_New_Memory_Face(library, font, font_size, 0, &face) || FT_Set_Pixel_Sizes(face, 0, pixel_size)) {
+		fprintf(stderr, "Can't load %s\n", argv[1]);
+		return 1;
+	}
+
+	// Same line metrics than font_cache_init
+	int max_pixel_height = (pixel_size * (face->bbox.yMax - face->bbox.yMin)) / face->units_per_EM + 1;
+	int origin = (pixel_size * (-face->bbox.yMin)) / face->units_per_EM;
+
+	// Only ASCII is expected on the boot text
+	int n = 0;
+	size_t atlas_size = 0;
+	for (const char *c = argv[3]; *c; ++c) {
+		n = add_glyph(face, (uint8_t)*c, n, &atlas_size);
+	}
+
+	FILE *out = fopen(argv[4], "w");
+	if (out == NULL) {
+		fprintf(stderr, "Can't write %s\n", argv[4]);
+		return 1;
+	}
+
+	fprintf(out, "/* Generated by tools/glyph_atlas.c, don't edit */\n");
+	fprintf(out, "/* %s, %d px: \"%s\" */\n", argv[1], pixel_size, argv[3]);
+	fprintf(out, "#pragma once\n\n#include <stdint.h>\n\n");
+	fprintf(out, "typedef struct glyph_atlas_entry {\n");
+	fprintf(out, "\tuint32_t utf_code;\n");
+	fprintf(out, "\tuint8_t bitmap_width;\n");
+	fprintf(out, "\tuint8_t bitmap_height;\n");
+	fprintf(out, "\tint8_t bitmap_left;\n");
+	fprintf(out, "\tint8_t bitmap_top;\n");
+	fprintf(out, "\tuint8_t advance;\n");
+	fprintf(out, "\tuint16_t offset;\t// Of the bitmap on glyph_atlas_bitmap\n");
+	fprintf(out, "} glyph_atlas_entry_t;\n\n");
+	fprintf(out, "#define GLYPH_ATLAS_MAX_PIXEL_HEIGHT %d\n", max_pixel_height);
+	fprintf(out, "#define GLYPH_ATLAS_ORIGIN %d\n", origin);
+	fprintf(out, "#define GLYPH_ATLAS_SIZE %d\n\n", n);
+
+	fprintf(out, "static const glyph_atlas_entry_t glyph_atlas[GLYPH_ATLAS_SIZE] = {\n");
+	for (int i = 0; i < n; ++i) {
+		fprintf(out, "\t{ 0x%02x, %d, %d, %d, %d, %d, %zu },\t// %c\n", glyphs[i].utf_code, glyphs[i].width, glyphs[i].height,
+			glyphs[i].left, glyphs[i].top, glyphs[i].advance, glyphs[i].offset, (char)glyphs[i].utf_code);
+	}
+	fprintf(out, "};\n\n");
+
+	fprintf(out, "static const uint8_t glyph_atlas_bitmap[%zu] = {\n", atlas_size);
+	for (size_t i = 0; i < atlas_size; i += 16) {
+		fprintf(out, "\t");
+		for (size_t j = i; j < i + 16 && j < atlas_size; ++j) {
+			fprintf(out, "0x%02x,%s", atlas[j], (j + 1 < i + 16 && j + 1 < atlas_size) ? " " : "");
+		}
+		fprintf(out, "\n");
+	}
+	fprintf(out, "};\n");
+
+	fclose(out);
+	FT_Done_Face(face);
+	FT_Done_FreeType(library);
+	free(font);
+
+	return 0;
+}
@@ -17,6 +17,7 @@
 #include "freertos/task.h"
 
 #include "esp_log.h"
+#include "esp_attr.h"
 
 /*********************
  *      DEFINES
@@ -34,6 +35,7 @@ static const char *TAG = "ST7789_driver";
 static void ST7789_send_cmd(st7789_driver_t *driver, const st7789_command_t *command);
 static void ST7789_config(st7789_driver_t *driver);
 static void ST7789_pre_cb(spi_transaction_t *transaction);
+static void ST7789_post_cb(spi_transaction_t *transaction);
 static void ST7789_queue_empty(st7789_driver_t *driver);
 static void ST7789_multi_cmd(st7789_driver_t *driver, const st7789_command_t *sequence);
 
@@ -62,6 +64,8 @@ bool ST7789_init(st7789_driver_t *driver){
 	driver->data.data = true;
 	driver->command.driver = driver;
 	driver->command.data = false;
+	driver->async.driver = driver;
+	driver->async.data = true;
 
     // Set the RESET and DC PIN
     gpio_pad_select_gpio(HSPI_RST);
@@ -89,6 +93,7 @@ bool ST7789_init(st7789_driver_t *driver){
 		.spics_io_num   = -1,
 		.queue_size     = ST7789_SPI_QUEUE_SIZE,
 		.pre_cb         = ST7789_pre_cb,
+		.post_cb        = ST7789_post_cb,
 	};
 
     if(spi_bus_initialize(HSPI_HOST, &buscfg, 1) != ESP_OK){
@@ -174,6 +179,25 @@ void ST7789_write_pixels(st7789_driver_t *driver, st7789_color_t *pixels, size_t
 	driver->queue_fill++;
 }
 
+void ST7789_write_area_async(st7789_driver_t *driver, uint16_t start_x, uint16_t start_y, uint16_t end_x, uint16_t end_y,
+							 st7789_color_t *pixels, size_t length, void (*done_cb)(void *arg), void *arg){
+	// The window commands wait until the previous transfers are finished
+	ST7789_set_window(driver, start_x, start_y, end_x, end_y);
+
+	driver->async.done_cb = done_cb;
+	driver->async.done_arg = arg;
+
+	spi_transaction_t *trans = &driver->trans_async;
+	memset(trans, 0, sizeof(*trans));
+	trans->tx_buffer = pixels;
+	trans->user = &driver->async;
+	trans->length = length * sizeof(st7789_color_t) * 8;
+	trans->rxlength = 0;
+
+	spi_device_queue_trans(driver->spi, trans, portMAX_DELAY);
+	driver->queue_fill++;
+}
+
 void ST7789_write_lines(st7789_driver_t *driver, int ypos, int xpos, int width, uint16_t *linedata, int lineCount){
    // ST7789_set_window(driver,xpos,ypos,240,ypos +20);
     int size = width * 2 * 8 * lineCount;
@@ -233,6 +257,11 @@ static void ST7789_pre_cb(spi_transaction_t *transaction) {
 	gpio_set_level(HSPI_DC, data->data);
 }
 
+static void IRAM_ATTR ST7789_post_cb(spi_transaction_t *transaction) {
+	const st7789_transaction_data_t *data = (st7789_transaction_data_t *)transaction->user;
+	if (data->done_cb != NULL) data->done_cb(data->done_arg);
+}
+
 static void ST7789_config(st7789_driver_t *driver){
 
     const uint8_t caset[4] = {
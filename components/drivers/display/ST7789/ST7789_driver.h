@@ -100,6 +100,8 @@ struct st7789_driver;
 typedef struct st7789_transaction_data {
 	struct st7789_driver *driver;
 	bool data;
+	void (*done_cb)(void *arg);	// Called from the SPI interrupt once the transaction is sent
+	void *done_arg;
 } st7789_transaction_data_t;
 
 typedef uint16_t st7789_color_t;
@@ -118,12 +120,14 @@ typedef struct st7789_driver {
 	size_t buffer_size;
 	st7789_transaction_data_t data;
 	st7789_transaction_data_t command;
+	st7789_transaction_data_t async;
 	st7789_color_t *buffer;
 	st7789_color_t *buffer_primary;
 	st7789_color_t *buffer_secondary;
 	st7789_color_t *current_buffer;
 	spi_transaction_t trans_a;
 	spi_transaction_t trans_b;
+	spi_transaction_t trans_async;
 } st7789_driver_t;
 
 typedef struct st7789_command {
@@ -199,6 +203,28 @@ void ST7789_fill_area(st7789_driver_t *driver, st7789_color_t color, uint16_t st
  */
 void ST7789_write_pixels(st7789_driver_t *driver, st7789_color_t *pixels, size_t length);
 
+/*
+ * Function:  ST7789_write_area_async 
+ * --------------------
+ * 
+ * Send a block of pixels to an area of the display without waiting for the transfer.
+ * The previous transfers are finished before setting the new area. The pixels must
+ * stay untouched until done_cb is called.
+ * 
+ * Arguments:
+ * 	-driver: Screen driver structure.
+ * 	-start_x, start_y, end_x, end_y: Area of the display, both ends included.
+ * 	-pixels: DMA capable buffer with the pixels.
+ * 	-length: Number of pixels.
+ * 	-done_cb: Called from the SPI interrupt once the pixels are sent, it must be on IRAM.
+ * 	-arg: Argument of done_cb.
+ * 
+ * Returns: Nothing.
+ * 
+ */
+void ST7789_write_area_async(st7789_driver_t *driver, uint16_t start_x, uint16_t start_y, uint16_t end_x, uint16_t end_y,
+							 st7789_color_t *pixels, size_t length, void (*done_cb)(void *arg), void *arg);
+
 /*
  * Function:  ST7789_write_lines 
  * --------------------
@@ -6,6 +6,7 @@
 #include "esp_system.h"
 
 #include "esp_log.h"
+#include "esp_attr.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -35,6 +36,19 @@
 
 #define PIXEL_MASK (0x1F) 
 
+// Kind of the last emulator frame
+#define FRAME_NONE  0
+#define FRAME_GBC   1
+#define FRAME_NES   2
+#define FRAME_SMS   3
+#define FRAME_GG    4
+
+// Speed label of the fast forward, 3x5 pixels glyphs drawn twice as big
+#define SPEED_X      4
+#define SPEED_Y      4
+#define SPEED_SCALE  2
+#define SPEED_GLYPH  (4 * SPEED_SCALE)   // Width of a glyph and its gap
+
 uint16_t *line[LINE_BUFFERS];
 
 extern uint16_t myPalette[];
@@ -56,12 +70,31 @@ st7789_driver_t display = {
 
 static const char *TAG = "Display_HAL";
 
+// Last frame sent by the emulator, the thumbnails of the save slots are taken from it
+static const void *last_frame = NULL;
+static uint8_t last_frame_type = FRAME_NONE;
+static const uint16_t *last_palette = NULL;
+
+// Set by the emulator task, drawn on the first lines of the next frames
+static volatile uint16_t speed_shown = 0;
+static uint16_t speed_drawn = 0;
+
+// Digits, 'x' and '.', a row of 3 pixels per byte
+static const uint8_t speed_font[12][5] = {
+    {7,5,5,5,7}, {2,6,2,2,7}, {7,1,7,4,7}, {7,1,7,1,7}, {5,5,7,1,1},
+    {7,4,7,1,7}, {7,4,7,5,7}, {7,1,1,1,1}, {7,5,7,5,7}, {7,5,7,1,7},
+    {0,5,2,5,0}, {0,0,0,0,2}
+};
+
 /**********************
 *  STATIC PROTOTYPES
 **********************/
 static uint16_t getPixelGBC(const uint16_t *bufs, uint16_t x, uint16_t y, uint16_t w2, uint16_t h2);
 static uint8_t getPixelSMS(const uint8_t *bufs, uint16_t x, uint16_t y, uint16_t w2, uint16_t h2, bool GAME_GEAR);
 static uint8_t getPixelNES(const uint8_t *bufs, uint16_t x, uint16_t y, uint16_t w2, uint16_t h2);
+static bool NES_lines_dirty(const uint32_t *dirty_lines, int first, int last);
+static void display_HAL_flush_done(void *arg);
+static void speed_draw(uint16_t *buffer, int width);
 
 /**********************
  *   GLOBAL FUNCTIONS
@@ -103,19 +136,10 @@ void display_HAL_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t *
 
     uint32_t size = lv_area_get_width(area) * lv_area_get_height(area);
 
-    //Set the area to print on the screen
-    ST7789_set_window(&display,area->x1,area->y1,area->x2 ,area->y2);
-
-    //Save the buffer data and the size of the data to send
-    display.current_buffer = (void *)color_map;
-    display.buffer_size = size;
-
-    //Send it
-    //ST7789_write_pixels(&display, display.current_buffer, display.buffer_size);
-    ST7789_swap_buffers(&display);
-
-    //Tell to LVGL that is ready to send another frame
-    lv_disp_flush_ready(drv);
+    //Send the buffer to the area without waiting, LVGL draws on its other buffer meanwhile.
+    //It's given back to LVGL from the SPI interrupt once it's sent.
+    ST7789_write_area_async(&display, area->x1, area->y1, area->x2, area->y2,
+                            (st7789_color_t *)color_map, size, display_HAL_flush_done, drv);
 }
 
 // Emulators frame generation functions.
@@ -140,6 +164,9 @@ void display_HAL_gb_frame(const uint16_t *data){
         short outputWidth = 240;
         short xpos = (SCR_WIDTH - outputWidth) / 2;
 
+        last_frame = data;
+        last_frame_type = FRAME_GBC;
+
         for (int y = 0; y < outputHeight; y += LINE_COUNT)
         {
             for (int i = 0; i < LINE_COUNT; ++i)
@@ -156,6 +183,8 @@ void display_HAL_gb_frame(const uint16_t *data){
                 }
             }
             
+            if(y == 0) speed_draw(display.current_buffer, outputWidth);
+
             sending_line = calc_line;
             calc_line = (calc_line == 1) ? 0 : 1;
            // ST7789_swap_buffers(&display);
@@ -164,7 +193,7 @@ void display_HAL_gb_frame(const uint16_t *data){
     }
 }
 
-void display_HAL_NES_frame(const uint8_t *data){
+void display_HAL_NES_frame(const uint8_t *data, const uint32_t *dirty_lines){
     uint16_t calc_line = 0;
     uint16_t sending_line = 0;
 
@@ -184,8 +213,19 @@ void display_HAL_NES_frame(const uint8_t *data){
         short outputHeight = 240;
         short outputWidth = 240 + (240 - 240);
         short xpos = (240 - outputWidth) / 2;
+        int y_ratio = (int)(((NES_FRAME_HEIGHT - 1) << 16) / outputHeight) + 1;
+
+        last_frame = data;
+        last_frame_type = FRAME_NES;
 
         for (int y = 0; y < outputHeight; y += LINE_COUNT){
+            // The block is kept on the screen if none of the frame lines it's scaled from changed
+            if(dirty_lines != NULL && !(y == 0 && (speed_shown != 0 || speed_drawn != 0))){
+                int last = y + LINE_COUNT - 1;
+                if(last >= outputHeight) last = outputHeight - 1;
+                if(!NES_lines_dirty(dirty_lines, (y_ratio * y) >> 16, (y_ratio * last) >> 16)) continue;
+            }
+
             for (int i = 0; i < LINE_COUNT; ++i){
                 if ((y + i) >= outputHeight)
                 break;
@@ -197,6 +237,8 @@ void display_HAL_NES_frame(const uint8_t *data){
                 }
             }
 
+            if(y == 0) speed_draw(display.current_buffer, outputWidth);
+
             sending_line = calc_line;
             calc_line = (calc_line == 1) ? 0 : 1;
             ST7789_write_lines(&display,y, xpos, outputWidth, line[sending_line], LINE_COUNT);
@@ -225,6 +267,10 @@ void display_HAL_SMS_frame(const uint8_t *data, uint16_t color[], bool GAMEGEAR)
         short outputWidth = SCR_WIDTH;
         short xpos = (SCR_WIDTH - outputWidth) / 2;
 
+        last_frame = data;
+        last_frame_type = GAMEGEAR ? FRAME_GG : FRAME_SMS;
+        last_palette = color;
+
         for (int y = 0; y < outputHeight; y += LINE_COUNT){
             for (int i = 0; i < LINE_COUNT; ++i){
                 if ((y + i) >= outputHeight)
@@ -239,6 +285,9 @@ void display_HAL_SMS_frame(const uint8_t *data, uint16_t color[], bool GAMEGEAR)
                     //line[calc_line][index++] = color[getPixelSms(data, x, (y + i), outputWidth, outputHeight)];
                 }
             }
+
+            if(y == 0) speed_draw(display.current_buffer, outputWidth);
+
             sending_line = calc_line;
             calc_line = (calc_line == 1) ? 0 : 1;
             ST7789_write_lines(&display,y, xpos, outputWidth, line[sending_line], LINE_COUNT);
@@ -247,10 +296,89 @@ void display_HAL_SMS_frame(const uint8_t *data, uint16_t color[], bool GAMEGEAR)
 
 }
 
+void display_HAL_set_speed(uint16_t speed){
+    speed_shown = speed;
+}
+
+// Nearest pixels of the last frame, the emulators don't draw on it until the next one is sent
+void display_HAL_thumbnail(uint16_t *thumb, uint16_t size){
+    uint16_t width, height;
+
+    switch(last_frame_type){
+        case FRAME_GBC: width = GBC_FRAME_WIDTH; height = GBC_FRAME_HEIGHT; break;
+        case FRAME_NES: width = NES_FRAME_WIDTH; height = NES_FRAME_HEIGHT; break;
+        case FRAME_SMS: width = SMS_FRAME_WIDTH; height = SMS_FRAME_HEIGHT; break;
+        case FRAME_GG:  width = GG_FRAME_WIDTH;  height = GG_FRAME_HEIGHT;  break;
+        default:
+            memset(thumb, 0, size * size * sizeof(uint16_t));
+            return;
+    }
+
+    for(int y = 0; y < size; y++){
+        int yv = ((2 * y + 1) * height) / (2 * size);
+
+        for(int x = 0; x < size; x++){
+            int xv = ((2 * x + 1) * width) / (2 * size);
+            uint16_t sample;
+
+            if(last_frame_type == FRAME_GBC){
+                sample = ((const uint16_t *)last_frame)[yv * GBC_FRAME_WIDTH + xv];
+                sample = (sample >> 8) | (sample << 8);
+            }
+            else if(last_frame_type == FRAME_NES){
+                sample = myPalette[((const uint8_t *)last_frame)[yv * NES_FRAME_WIDTH + xv]];
+            }
+            else{
+                // The Game Gear screen is a window of the Master System one
+                int index = (last_frame_type == FRAME_GG) ? yv * SMS_FRAME_WIDTH + xv + 48 : yv * SMS_FRAME_WIDTH + xv;
+                sample = last_palette[((const uint8_t *)last_frame)[index] & PIXEL_MASK];
+                sample = (sample >> 8) | (sample << 8);
+            }
+
+            thumb[y * size + x] = sample;
+        }
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static void IRAM_ATTR display_HAL_flush_done(void *arg){
+    //Tell to LVGL that the buffer can be used again
+    lv_disp_flush_ready((lv_disp_drv_t *)arg);
+}
+
+// White label on a black box over the first lines of the frame, white and black don't need the byte swap
+static void speed_draw(uint16_t *buffer, int width){
+    uint16_t speed = speed_shown;
+    speed_drawn = speed;
+    if(speed == 0) return;
+
+    char text[8];
+    int len = snprintf(text, sizeof(text), "x%u.%u", speed / 10, speed % 10);
+    if(len >= sizeof(text)) len = sizeof(text) - 1;
+
+    int box_width = len * SPEED_GLYPH + SPEED_SCALE * 2;
+    int box_height = 5 * SPEED_SCALE + SPEED_SCALE * 2;
+    for(int y = SPEED_Y - SPEED_SCALE; y < SPEED_Y - SPEED_SCALE + box_height; y++){
+        for(int x = SPEED_X - SPEED_SCALE; x < SPEED_X - SPEED_SCALE + box_width && x < width; x++) buffer[y * width + x] = 0x0000;
+    }
+
+    for(int c = 0; c < len; c++){
+        int glyph = (text[c] == 'x') ? 10 : (text[c] == '.') ? 11 : text[c] - '0';
+
+        for(int row = 0; row < 5 * SPEED_SCALE; row++){
+            uint8_t bits = speed_font[glyph][row / SPEED_SCALE];
+
+            for(int col = 0; col < 3 * SPEED_SCALE; col++){
+                int x = SPEED_X + c * SPEED_GLYPH + col;
+                if(x < width && (bits & (4 >> (col / SPEED_SCALE)))) buffer[(SPEED_Y + row) * width + x] = 0xFFFF;
+            }
+        }
+    }
+}
+
 static uint8_t getPixelSMS(const uint8_t *bufs, uint16_t x, uint16_t y, uint16_t w2, uint16_t h2, bool GAME_GEAR){
     uint16_t frame_width = SMS_FRAME_WIDTH;
     uint16_t frame_height = SMS_FRAME_HEIGHT;
@@ -298,6 +426,13 @@ static uint8_t getPixelSMS(const uint8_t *bufs, uint16_t x, uint16_t y, uint16_t
     return col;
 }
 
+static bool NES_lines_dirty(const uint32_t *dirty_lines, int first, int last){
+    for (int y = first; y <= last; y++){
+        if (dirty_lines[y >> 5] & (1u << (y & 31))) return true;
+    }
+    return false;
+}
+
 static uint8_t getPixelNES(const uint8_t *bufs, uint16_t x, uint16_t y, uint16_t w2, uint16_t h2){
 
     int x_diff, y_diff, xv, yv, red, green, blue, col, a, b, c, d, index;
@@ -75,13 +75,17 @@ void display_HAL_gb_frame(const uint16_t *data);
  * Process the emulator information to set the color and scale of the frame, and send the
  * information to the screen driver.
  * 
+ * Only the blocks of lines scaled from a changed line of the frame are sent.
+ * 
  * Arguments:
  *  - data: Frame data of the NES color emulator.
+ *  - dirty_lines: Bitmask with a bit per line of the frame, set if it changed since the
+ *                 last one drawn. NULL to draw the whole frame.
  * 
  * Returns: Nothing
  * 
  */
-void display_HAL_NES_frame(const uint8_t *data);
+void display_HAL_NES_frame(const uint8_t *data, const uint32_t *dirty_lines);
 
 /*
  * Function:  display_HAL_SMS_frame 
@@ -100,6 +104,35 @@ void display_HAL_NES_frame(const uint8_t *data);
  */
 void display_HAL_SMS_frame(const uint8_t *data, uint16_t color[], bool GAMEGEAR);
 
+/*
+ * Function:  display_HAL_thumbnail 
+ * --------------------
+ * 
+ * Scale down the last frame sent by the emulator, for the previews of the save slots.
+ * 
+ * Arguments:
+ *  - thumb: Buffer of size x size pixels, RGB565 on the byte order of the screen.
+ *  - size: Side of the thumbnail.
+ * 
+ * Returns: Nothing
+ * 
+ */
+void display_HAL_thumbnail(uint16_t *thumb, uint16_t size);
+
+/*
+ * Function:  display_HAL_set_speed 
+ * --------------------
+ * 
+ * Show the emulation speed on the top left corner of the game frames, while fast forwarding.
+ * 
+ * Arguments:
+ *  - speed: Tenths of the speed of the real console, 25 shows x2.5. Set to 0 to hide it.
+ * 
+ * Returns: Nothing
+ * 
+ */
+void display_HAL_set_speed(uint16_t speed);
+
 /*
  * Function:  display_HAL_get_buffer 
  * --------------------
@@ -0,0 +1,79 @@
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <sys/stat.h>
+
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include "sd_cart.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CART_BLOCK_SIZE     (64*1024)
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static const char *TAG = "SD_CART";
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint8_t *sd_cart_load(const char *path, size_t *size, size_t extra){
+    struct stat st;
+    if(stat(path, &st) == -1 || st.st_size == 0 || st.st_size > SD_CART_SIZE_MAX){
+        ESP_LOGE(TAG, "Can't load %s", path);
+        return NULL;
+    }
+
+    uint32_t start = esp_timer_get_time() / 1000;
+
+    uint8_t *image = heap_caps_malloc(st.st_size + extra, MALLOC_CAP_SPIRAM);
+    if(image == NULL) image = malloc(st.st_size + extra);
+    if(image == NULL){
+        ESP_LOGE(TAG, "No memory for %s, %ld bytes", path, (long)st.st_size);
+        return NULL;
+    }
+
+    FILE *fd = fopen(path, "rb");
+    if(fd == NULL){
+        ESP_LOGE(TAG, "Error opening %s", path);
+        free(image);
+        return NULL;
+    }
+
+    // Without buffer the blocks are read by the FAT driver straight into the image
+    setvbuf(fd, NULL, _IONBF, 0);
+
+    size_t r = 0;
+    while(r < st.st_size){
+        size_t len = st.st_size - r;
+        if(len > CART_BLOCK_SIZE) len = CART_BLOCK_SIZE;
+
+        size_t count = fread(image + r, 1, len, fd);
+        r += count;
+        if(count < len) break;
+    }
+    fclose(fd);
+
+    if(r != st.st_size){
+        ESP_LOGE(TAG, "Error reading %s", path);
+        free(image);
+        return NULL;
+    }
+
+    memset(image + r, 0, extra);
+    *size = r;
+
+    ESP_LOGI(TAG, "%s loaded, %u bytes in %u ms", path, (unsigned int)r, (unsigned int)(esp_timer_get_time() / 1000 - start));
+    return image;
+}
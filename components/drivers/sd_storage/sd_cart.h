@@ -0,0 +1,34 @@
+#pragma once
+/*********************
+ *      INCLUDES
+ *********************/
+#include "stdint.h"
+#include "stdbool.h"
+#include "stddef.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SD_CART_SIZE_MAX    (3*1024*1024)   // Bigger games are copied to the flash by sd_get_file_flash
+
+/*********************
+ *      FUNCTIONS
+ *********************/
+
+/*
+ * Function:  sd_cart_load
+ * --------------------
+ *
+ * Read a whole game file into a single allocation, on the SPIRAM if there is room.
+ * The file is read straight into it in big blocks, without the stdio buffer, so the
+ * emulators can parse the header in place and use the ROM banks as views into it.
+ *
+ * Arguments:
+ *  -path: Route of the game file.
+ *  -size: Bytes of the file.
+ *  -extra: Zeroed bytes added after the file, for cartridge memory that the file doesn't have.
+ *
+ * Returns: The image, release it with free(). NULL if the file can't be read.
+ *
+ */
+uint8_t *sd_cart_load(const char *path, size_t *size, size_t extra);
@@ -0,0 +1,216 @@
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <sys/stat.h>
+#include <sys/unistd.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp32/rom/crc.h"
+
+#include "sd_save.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SAVE_QUEUE_LEN      2
+#define SAVE_PATH_MAX       300
+
+#define SAVE_TRAILER_MAGIC  0x31564153  // "SAV1"
+
+// Appended to the state, the files of older firmwares don't have it
+struct save_trailer{
+    uint32_t magic;
+    uint32_t crc;
+};
+
+// A job without data is a sync mark, the writer gives the semaphore once it gets it
+struct save_job{
+    char path[SAVE_PATH_MAX];
+    uint8_t *data;
+    size_t size;
+    SemaphoreHandle_t done;
+};
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static const char *TAG = "SD_SAVE";
+
+static QueueHandle_t saveQueue = NULL;
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void sd_save_task(void *arg);
+static bool save_write(const char *path, const uint8_t *data, size_t size);
+static uint8_t *save_read(const char *path, size_t *size);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void sd_save_init(){
+    saveQueue = xQueueCreate(SAVE_QUEUE_LEN, sizeof(struct save_job));
+
+    // Core 0, the SD card is written while the emulator keeps running on the core 1
+    xTaskCreatePinnedToCore(&sd_save_task, "SD save", 1024*4, NULL, 1, NULL, 0);
+}
+
+uint8_t *sd_save_alloc(size_t size){
+    uint8_t *data = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if(data == NULL) data = malloc(size);
+    return data;
+}
+
+bool sd_save_write(const char *path, uint8_t *data, size_t size){
+    if(strlen(path) >= SAVE_PATH_MAX){
+        free(data);
+        return false;
+    }
+
+    struct save_job job;
+    strcpy(job.path, path);
+    job.data = data;
+    job.size = size;
+    job.done = NULL;
+
+    if(saveQueue == NULL){
+        bool ok = save_write(job.path, job.data, job.size);
+        free(job.data);
+        return ok;
+    }
+
+    return xQueueSend(saveQueue, &job, portMAX_DELAY) == pdPASS;
+}
+
+uint8_t *sd_save_read(const char *path, size_t *size){
+    if(strlen(path) >= SAVE_PATH_MAX) return NULL;
+
+    // A state still on the queue would be newer than the file
+    sd_save_sync();
+
+    uint8_t *data = save_read(path, size);
+    if(data == NULL){
+        char tmp_path[SAVE_PATH_MAX + 4];
+        sprintf(tmp_path, "%s.tmp", path);
+        data = save_read(tmp_path, size);
+        if(data != NULL) ESP_LOGW(TAG, "Save recovered from %s", tmp_path);
+    }
+
+    return data;
+}
+
+void sd_save_sync(){
+    if(saveQueue == NULL) return;
+
+    struct save_job job;
+    memset(&job, 0, sizeof(job));
+    job.done = xSemaphoreCreateBinary();
+    if(job.done == NULL) return;
+
+    xQueueSend(saveQueue, &job, portMAX_DELAY);
+    xSemaphoreTake(job.done, portMAX_DELAY);
+    vSemaphoreDelete(job.done);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void sd_save_task(void *arg){
+    struct save_job job;
+
+    while(1){
+        if(!xQueueReceive(saveQueue, &job, portMAX_DELAY)) continue;
+
+        if(job.data != NULL){
+            if(save_write(job.path, job.data, job.size)) ESP_LOGI(TAG, "%s written, %u bytes", job.path, (unsigned int)job.size);
+            free(job.data);
+        }
+
+        if(job.done != NULL) xSemaphoreGive(job.done);
+    }
+}
+
+// The old file is only replaced once the new one is complete on the card
+static bool save_write(const char *path, const uint8_t *data, size_t size){
+    char tmp_path[SAVE_PATH_MAX + 4];
+    sprintf(tmp_path, "%s.tmp", path);
+
+    struct save_trailer trailer;
+    trailer.magic = SAVE_TRAILER_MAGIC;
+    trailer.crc = crc32_le(0, data, size);
+
+    FILE *fd = fopen(tmp_path, "wb");
+    if(fd == NULL){
+        ESP_LOGE(TAG, "Error creating %s", tmp_path);
+        return false;
+    }
+
+    bool ok = fwrite(data, 1, size, fd) == size;
+    if(ok) ok = fwrite(&trailer, 1, sizeof(trailer), fd) == sizeof(trailer);
+    if(ok) ok = fflush(fd) == 0 && fsync(fileno(fd)) == 0;
+    if(fclose(fd) != 0) ok = false;
+
+    if(!ok){
+        ESP_LOGE(TAG, "Error writing %s", tmp_path);
+        remove(tmp_path);
+        return false;
+    }
+
+    // FAT can't rename over an existing file. If the power fails between both calls,
+    // only the .tmp is left and sd_save_read loads it.
+    remove(path);
+    if(rename(tmp_path, path) != 0){
+        ESP_LOGE(TAG, "Error renaming %s", tmp_path);
+        return false;
+    }
+
+    return true;
+}
+
+// Read the whole file and check its trailer, the returned size doesn't include it
+static uint8_t *save_read(const char *path, size_t *size){
+    struct stat st;
+    if(stat(path, &st) == -1 || st.st_size == 0 || st.st_size > SD_SAVE_SIZE_MAX + sizeof(struct save_trailer)) return NULL;
+
+    uint8_t *data = sd_save_alloc(st.st_size);
+    if(data == NULL) return NULL;
+
+    FILE *fd = fopen(path, "rb");
+    if(fd == NULL || fread(data, 1, st.st_size, fd) != st.st_size){
+        ESP_LOGE(TAG, "Error reading %s", path);
+        if(fd != NULL) fclose(fd);
+        free(data);
+        return NULL;
+    }
+    fclose(fd);
+
+    *size = st.st_size;
+
+    struct save_trailer trailer;
+    if(*size > sizeof(trailer)){
+        memcpy(&trailer, data + *size - sizeof(trailer), sizeof(trailer));
+        if(trailer.magic == SAVE_TRAILER_MAGIC){
+            *size -= sizeof(trailer);
+            if(crc32_le(0, data, *size) != trailer.crc){
+                ESP_LOGE(TAG, "Broken save %s, wrong CRC", path);
+                free(data);
+                return NULL;
+            }
+        }
+    }
+
+    return data;
+}
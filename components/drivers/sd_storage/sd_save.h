@@ -0,0 +1,88 @@
+#pragma once
+/*********************
+ *      INCLUDES
+ *********************/
+#include "stdint.h"
+#include "stdbool.h"
+#include "stddef.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SD_SAVE_SIZE_MAX    (256*1024)  // Biggest save state, a GBC game with 128KB of cartridge RAM takes ~190KB
+
+/*********************
+ *      FUNCTIONS
+ *********************/
+
+/*
+ * Function:  sd_save_init
+ * --------------------
+ *
+ * Start the save writer task. The save states are written to the SD card by this task,
+ * so the emulator only has to wait for the state to be serialized on the RAM.
+ *
+ * Returns: Nothing.
+ *
+ */
+void sd_save_init();
+
+/*
+ * Function:  sd_save_alloc
+ * --------------------
+ *
+ * Get a buffer for a save state, on the SPIRAM if there is room.
+ *
+ * Arguments:
+ *  -size: Size of the state.
+ *
+ * Returns: The buffer or NULL.
+ *
+ */
+uint8_t *sd_save_alloc(size_t size);
+
+/*
+ * Function:  sd_save_write
+ * --------------------
+ *
+ * Queue a save state to the save writer. It stores the state on name.tmp with a CRC trailer
+ * and renames it over the old file, so the previous save survives a failed write.
+ * It could wait if the writer has already two states pending.
+ *
+ * Arguments:
+ *  -path: Route of the save file.
+ *  -data: State from sd_save_alloc, the writer frees it even if the write fails.
+ *  -size: Bytes of the state.
+ *
+ * Returns: True if the state was queued.
+ *
+ */
+bool sd_save_write(const char *path, uint8_t *data, size_t size);
+
+/*
+ * Function:  sd_save_read
+ * --------------------
+ *
+ * Read a whole save state and check its CRC. If the file is broken or missing, the name.tmp
+ * left by an interrupted write is tried. Files without trailer, from older firmwares,
+ * are given as they are.
+ *
+ * Arguments:
+ *  -path: Route of the save file.
+ *  -size: Bytes of the state, without the trailer.
+ *
+ * Returns: The state, free it once loaded. NULL if there is no valid save.
+ *
+ */
+uint8_t *sd_save_read(const char *path, size_t *size);
+
+/*
+ * Function:  sd_save_sync
+ * --------------------
+ *
+ * Wait until every queued state is on the SD card. Call it before restarting the system.
+ *
+ * Returns: Nothing.
+ *
+ */
+void sd_save_sync();
@@ -0,0 +1,182 @@
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <sys/stat.h>
+#include <sys/unistd.h>
+
+#include "esp_log.h"
+
+#include "sd_storage.h"
+#include "sd_save.h"
+#include "sd_slots.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SLOT_PATH_MAX       300
+#define SLOT_INDEX_MAGIC    0x31584449  // "IDX1"
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static const char *TAG = "SD_SLOTS";
+
+// Index of the running game. The saves are done by the emulator task between frames, so they
+// never run at the same time.
+static struct sd_slot_index *slot_index = NULL;
+static uint8_t index_console;
+static uint32_t index_hash;
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static bool index_path(char *path, size_t size, uint8_t console, const char *game_name);
+static uint32_t name_hash(const char *name);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool sd_slot_path(char *path, size_t size, uint8_t console, const char *game_name, uint8_t slot){
+    const char *folder = sd_console_folder(console);
+    if(folder == NULL || slot > SD_SLOT_RESUME) return false;
+
+    int len;
+    if(slot == 0) len = snprintf(path, size, "%s/Save_Data/%s.sav", folder, game_name);
+    else if(slot == SD_SLOT_RESUME) len = snprintf(path, size, "%s/Save_Data/%s.resume.sav", folder, game_name);
+    else len = snprintf(path, size, "%s/Save_Data/%s.%u.sav", folder, game_name, slot);
+
+    return len > 0 && len < size;
+}
+
+bool sd_slot_saved(uint8_t console, const char *game_name, uint8_t slot, sd_slot_thumb_cb thumb_cb){
+    char path[SLOT_PATH_MAX];
+    if(slot == SD_SLOT_RESUME) return true;
+    if(slot >= SD_SLOT_NUM || !index_path(path, sizeof(path), console, game_name)) return false;
+
+    uint32_t hash = name_hash(game_name);
+    if(slot_index == NULL || index_console != console || index_hash != hash){
+        free(slot_index);
+        slot_index = sd_slot_index_read(console, game_name);
+
+        if(slot_index == NULL){
+            slot_index = (struct sd_slot_index *)sd_save_alloc(sizeof(struct sd_slot_index));
+            if(slot_index == NULL) return false;
+            memset(slot_index, 0, sizeof(struct sd_slot_index));
+            slot_index->magic = SLOT_INDEX_MAGIC;
+        }
+        index_console = console;
+        index_hash = hash;
+    }
+
+    struct sd_slot *entry = &slot_index->slot[slot];
+    entry->used = 1;
+    entry->console = console;
+    entry->serial = ++slot_index->serial;
+    entry->timestamp = time(NULL);
+    if(thumb_cb != NULL) thumb_cb(entry->thumb, SD_SLOT_THUMB_SIZE);
+    else memset(entry->thumb, 0, sizeof(entry->thumb));
+
+    // The writer frees its copy, the running game keeps this one
+    uint8_t *data = sd_save_alloc(sizeof(struct sd_slot_index));
+    if(data == NULL) return false;
+    memcpy(data, slot_index, sizeof(struct sd_slot_index));
+
+    return sd_save_write(path, data, sizeof(struct sd_slot_index));
+}
+
+struct sd_slot_index *sd_slot_index_read(uint8_t console, const char *game_name){
+    char path[SLOT_PATH_MAX];
+    if(!index_path(path, sizeof(path), console, game_name)) return NULL;
+
+    size_t size = 0;
+    struct sd_slot_index *index = (struct sd_slot_index *)sd_save_read(path, &size);
+    if(index == NULL) return NULL;
+
+    if(size != sizeof(struct sd_slot_index) || index->magic != SLOT_INDEX_MAGIC){
+        ESP_LOGE(TAG, "Invalid slot index %s", path);
+        free(index);
+        return NULL;
+    }
+
+    // The index is queued right after the state, a state the writer failed to write leaves a slot without file
+    struct stat st;
+    for(uint8_t i = 0; i < SD_SLOT_NUM; i++){
+        if(index->slot[i].used && (!sd_slot_path(path, sizeof(path), console, game_name, i) || stat(path, &st) != 0)){
+            ESP_LOGW(TAG, "Slot %d of %s has no state", i, game_name);
+            index->slot[i].used = 0;
+        }
+    }
+
+    return index;
+}
+
+uint8_t sd_slot_latest(uint8_t console, const char *game_name){
+    struct sd_slot_index *index = sd_slot_index_read(console, game_name);
+    if(index == NULL) return 0;
+
+    uint8_t latest = 0;
+    uint32_t serial = 0;
+    for(uint8_t i = 0; i < SD_SLOT_NUM; i++){
+        if(index->slot[i].used && index->slot[i].serial > serial){
+            serial = index->slot[i].serial;
+            latest = i;
+        }
+    }
+    free(index);
+
+    return latest;
+}
+
+bool sd_slot_exist(uint8_t console, const char *game_name){
+    char path[SLOT_PATH_MAX];
+    struct stat st;
+
+    if(sd_slot_path(path, sizeof(path), console, game_name, 0) && stat(path, &st) == 0) return true;
+    return index_path(path, sizeof(path), console, game_name) && stat(path, &st) == 0;
+}
+
+void sd_slot_remove(uint8_t console, const char *game_name){
+    char path[SLOT_PATH_MAX];
+
+    // A state still on the queue would be written after the removal
+    sd_save_sync();
+
+    for(uint8_t i = 0; i <= SD_SLOT_RESUME; i++){
+        if(sd_slot_path(path, sizeof(path), console, game_name, i)) remove(path);
+    }
+    if(index_path(path, sizeof(path), console, game_name)) remove(path);
+
+    if(slot_index != NULL && index_console == console && index_hash == name_hash(game_name)){
+        free(slot_index);
+        slot_index = NULL;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool index_path(char *path, size_t size, uint8_t console, const char *game_name){
+    const char *folder = sd_console_folder(console);
+    if(folder == NULL) return false;
+
+    int len = snprintf(path, size, "%s/Save_Data/%s.idx", folder, game_name);
+    return len > 0 && len < size;
+}
+
+// FNV-1a
+static uint32_t name_hash(const char *name){
+    uint32_t hash = 2166136261u;
+    while(*name){
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
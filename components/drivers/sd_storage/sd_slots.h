@@ -0,0 +1,139 @@
+#pragma once
+/*********************
+ *      INCLUDES
+ *********************/
+#include "stdint.h"
+#include "stdbool.h"
+#include "stddef.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SD_SLOT_NUM         4       // Slot 0 is the quick save of the save buttons
+#define SD_SLOT_RESUME      SD_SLOT_NUM // Quick resume snapshot, it isn't on the index nor on the menu
+#define SD_SLOT_THUMB_SIZE  60      // Side of the thumbnails in pixels
+
+// Header of a save slot, kept on the index file of the game
+struct sd_slot{
+    uint8_t used;
+    uint8_t console;
+    uint16_t reserved;
+    uint32_t serial;        // Saves of the game so far, the newest slot has the biggest one
+    uint32_t timestamp;     // time() of the save
+    uint16_t thumb[SD_SLOT_THUMB_SIZE * SD_SLOT_THUMB_SIZE];   // RGB565 on the byte order of the display
+};
+
+// Index file of a game, the menu shows the slots reading only this file
+struct sd_slot_index{
+    uint32_t magic;
+    uint32_t serial;        // Last serial given
+    struct sd_slot slot[SD_SLOT_NUM];
+};
+
+// Draw the thumbnail of the game on thumb, size x size pixels
+typedef void (*sd_slot_thumb_cb)(uint16_t *thumb, uint16_t size);
+
+/*********************
+ *      FUNCTIONS
+ *********************/
+
+/*
+ * Function:  sd_slot_path
+ * --------------------
+ *
+ * Route of the save state of a slot. The slot 0 is the name.sav file of the older firmwares,
+ * the others are name.<slot>.sav and the quick resume snapshot is name.resume.sav.
+ *
+ * Arguments:
+ *  -path: Buffer for the route.
+ *  -size: Bytes of the buffer.
+ *  -console: Console of the game.
+ *  -game_name: File name of the game.
+ *  -slot: Slot number, from 0 to SD_SLOT_NUM - 1, or SD_SLOT_RESUME.
+ *
+ * Returns: True if the route fits on the buffer.
+ *
+ */
+bool sd_slot_path(char *path, size_t size, uint8_t console, const char *game_name, uint8_t slot);
+
+/*
+ * Function:  sd_slot_saved
+ * --------------------
+ *
+ * Record a state just queued to the save writer on the index of the game, with a thumbnail
+ * of the game screen. The index is queued after the state, but it doesn't wait for the writer:
+ * if the state isn't written, the slot keeps its previous file, or none.
+ * The quick resume snapshot isn't recorded.
+ *
+ * Arguments:
+ *  -console: Console of the game.
+ *  -game_name: File name of the game.
+ *  -slot: Slot of the state.
+ *  -thumb_cb: Function which draws the thumbnail, NULL to leave it black.
+ *
+ * Returns: True if the index was queued.
+ *
+ */
+bool sd_slot_saved(uint8_t console, const char *game_name, uint8_t slot, sd_slot_thumb_cb thumb_cb);
+
+/*
+ * Function:  sd_slot_index_read
+ * --------------------
+ *
+ * Read the index of a game. Meant for the storage worker, it waits for the pending saves.
+ * The slots without a state file are marked as not used.
+ *
+ * Arguments:
+ *  -console: Console of the game.
+ *  -game_name: File name of the game.
+ *
+ * Returns: The index, free it once used. NULL if the game doesn't have one.
+ *
+ */
+struct sd_slot_index *sd_slot_index_read(uint8_t console, const char *game_name);
+
+/*
+ * Function:  sd_slot_latest
+ * --------------------
+ *
+ * Get the slot saved last by the player, to resume a game from the game library. The
+ * slots without a state file are skipped.
+ *
+ * Arguments:
+ *  -console: Console of the game.
+ *  -game_name: File name of the game.
+ *
+ * Returns: The slot number, 0 if the game doesn't have index.
+ *
+ */
+uint8_t sd_slot_latest(uint8_t console, const char *game_name);
+
+/*
+ * Function:  sd_slot_exist
+ * --------------------
+ *
+ * Check if the game has any save, without reading the index.
+ *
+ * Arguments:
+ *  -console: Console of the game.
+ *  -game_name: File name of the game.
+ *
+ * Returns: True if there is a quick save or an index.
+ *
+ */
+bool sd_slot_exist(uint8_t console, const char *game_name);
+
+/*
+ * Function:  sd_slot_remove
+ * --------------------
+ *
+ * Remove every save state of a game, its quick resume snapshot and its index.
+ *
+ * Arguments:
+ *  -console: Console of the game.
+ *  -game_name: File name of the game.
+ *
+ * Returns: Nothing.
+ *
+ */
+void sd_slot_remove(uint8_t console, const char *game_name);
@@ -5,6 +5,9 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <stdlib.h>
+#include <strings.h>
+
 #include <dirent.h>
 #include <errno.h>
 #include <sys/unistd.h>
@@ -13,6 +16,8 @@
 #include "esp_err.h"
 #include "esp_log.h"
 #include "esp_vfs_fat.h"
+#include "esp_heap_caps.h"
+#include "esp32/rom/crc.h"
 
 #include "driver/sdmmc_host.h"
 #include "driver/sdspi_host.h"
@@ -21,6 +26,7 @@
 #include "system_configuration.h"
 #include "system_manager.h"
 #include "sd_storage.h"
+#include "sd_slots.h"
 #include "driver/spi_common.h"
 
 /*********************
@@ -29,6 +35,22 @@
 #define MOUNT_POINT     "/sdcard"
 #define SPI_DMA_CHAN    2
 
+#define INDEX_FILE      ".index"
+#define INDEX_MAGIC     0x58444947  // "GIDX"
+#define INDEX_VERSION   1
+
+// Layout of the index file: header, sorted entries, names pool
+struct sd_index_header{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t names_size;
+    uint32_t dir_mtime;     // mtime of the console folder
+    uint32_t sav_mtime;     // mtime of its Save_Data folder
+    uint32_t dir_sign;      // Hash of the game names listed in the console folder
+    uint32_t sav_sign;      // Hash of the names listed in the Save_Data folder
+};
+
 
 /**********************
 *      VARIABLES
@@ -41,7 +63,13 @@ struct sd_card_info sd_card_info;
 **********************/
 static const char *TAG = "SD_CARD";
 
-static void organize_list(char *list[30], uint8_t index);
+static const char *sort_names;
+
+static bool is_game_file(const char *name, uint8_t console);
+static uint32_t folder_signature(const char *path, uint8_t console);
+static bool index_load(struct sd_game_library *lib, const char *path);
+static bool index_write(struct sd_game_library *lib, const char *path);
+static bool index_rebuild(struct sd_game_library *lib, const char *folder, const char *path, const struct sd_index_header *now);
 
 /**********************
  *      MACROS
@@ -159,70 +187,95 @@ bool sd_init(){
 }
 
 
-uint8_t sd_game_list(char *game_list[100],uint8_t console){
-    
-    struct dirent *entry;
-    // Open the folder of the specific console
-    DIR *dir = NULL;
-    if(console == NES) dir =  opendir("/sdcard/NES");
-    else if(console == GAMEBOY) dir =  opendir("/sdcard/GameBoy");
-    else if(console == GAMEBOY_COLOR) dir =  opendir("/sdcard/GameBoy_Color");
-    else if(console == SNES) dir =  opendir("/sdcard/SNES");
-    else if(console == SMS) dir =  opendir("/sdcard/Master_System");
-    else if(console == GG) dir =  opendir("/sdcard/Game_Gear");
+/*** Game library index ***/
 
+bool sd_game_library_open(struct sd_game_library *lib, uint8_t console){
+    char index_path[64];
+    char sav_path[64];
+    struct stat st;
 
-    if (!dir) {
+    memset(lib, 0, sizeof(*lib));
+    lib->console = console;
+
+    const char *folder = sd_console_folder(console);
+    if(folder == NULL){
+        ESP_LOGE(TAG, "Unknown console : 0x%02x", console);
+        return false;
+    }
+    sprintf(index_path, "%s/%s", folder, INDEX_FILE);
+    sprintf(sav_path, "%s/Save_Data", folder);
+
+    // Current state of the folders, checked against the one recorded in the index
+    struct sd_index_header now = {0};
+    if(stat(folder, &st) == -1){
         ESP_LOGE(TAG, "Failed to stat dir : 0x%02x", console);
+        return false;
+    }
+    now.dir_mtime = st.st_mtime;
+    if(stat(sav_path, &st) == 0) now.sav_mtime = st.st_mtime;
+    now.dir_sign = folder_signature(folder, console);
+    now.sav_sign = folder_signature(sav_path, 0xFF);
+
+    if(index_load(lib, index_path)){
+        struct sd_index_header *hdr = lib->block;
+        if(hdr->dir_mtime == now.dir_mtime && hdr->sav_mtime == now.sav_mtime &&
+           hdr->dir_sign == now.dir_sign && hdr->sav_sign == now.sav_sign){
+            ESP_LOGI(TAG, "Game index %s: %u games", index_path, lib->count);
+            return true;
+        }
+    }
+
+    ESP_LOGI(TAG, "Game index %s out of date, rebuilding", index_path);
+    return index_rebuild(lib, folder, index_path, &now);
+}
+
+void sd_game_library_close(struct sd_game_library *lib){
+    if(lib->block != NULL && lib->dirty){
+        char index_path[64];
+        sprintf(index_path, "%s/%s", sd_console_folder(lib->console), INDEX_FILE);
+        index_write(lib, index_path);
+    }
+    free(lib->block);
+    memset(lib, 0, sizeof(*lib));
+}
+
+const char *sd_game_library_name(const struct sd_game_library *lib, uint32_t index){
+    return lib->names + lib->entries[index].name;
+}
+
+uint32_t sd_game_library_crc(struct sd_game_library *lib, uint32_t index){
+    const size_t BLOCK_SIZE = 4096;
+    struct sd_game_entry *entry = &lib->entries[index];
+    char path[320];
+
+    if(entry->flags & SD_GAME_CRC) return entry->crc;
+
+    sprintf(path, "%s/%s", sd_console_folder(lib->console), sd_game_library_name(lib, index));
+    FILE *fd = fopen(path, "rb");
+    if(fd == NULL){
+        ESP_LOGE(TAG, "Error opening: %s ", path);
         return 0;
     }
-    
-    //Loop to find the game of each console base on the file extension
-    uint8_t i =0;
-    while((entry = readdir(dir)) != NULL){
- 
-        size_t nameLength = strlen(entry->d_name);
 
-        // TODO: Rework game list maker, set by alphabetical order
-        if ((strcmp(entry->d_name + (nameLength - 4), ".nes") == 0) && console == NES) {
-            game_list[i] = malloc(256);
-            sprintf(game_list[i],"%s",entry->d_name);
-            ESP_LOGI(TAG, "Found %s ",(char *)game_list[i]);
-            //if(i>0) organize_list(game_list, i);
-            i++;
-        }
-        else if ((strcmp(entry->d_name + (nameLength - 3), ".gb") == 0) && console == GAMEBOY){
-            game_list[i] = malloc(256);
-            sprintf(game_list[i],"%s",entry->d_name);
-            ESP_LOGI(TAG, "Found %s ",(char *)game_list[i]);
-            //if(i>0) organize_list(game_list, i);
-            i++;
-        }
-        else if ((strcmp(entry->d_name + (nameLength - 4), ".gbc") == 0) && console == GAMEBOY_COLOR){
-            game_list[i] = malloc(256);
-            sprintf(game_list[i],"%s",entry->d_name);
-            ESP_LOGI(TAG, "Found %s ",(char *)game_list[i]);
-            //if(i>0) organize_list(game_list, i);
-            i++;
-        }
-        else if ((strcmp(entry->d_name + (nameLength - 4), ".sms") == 0) && console == SMS){
-            game_list[i] = malloc(256);
-            sprintf(game_list[i],"%s",entry->d_name);
-            ESP_LOGI(TAG, "Found %s ",(char *)game_list[i]);
-            //if(i>0) organize_list(game_list, i);
-            i++;
-        }
-        else if ((strcmp(entry->d_name + (nameLength - 3), ".gg") == 0) && console == GG){
-            game_list[i] = malloc(256);
-            sprintf(game_list[i],"%s",entry->d_name);
-            ESP_LOGI(TAG, "Found %s ",(char *)game_list[i]);
-            //if(i>0) organize_list(game_list, i);
-            i++;
-        }
+    uint8_t *buffer = heap_caps_malloc(BLOCK_SIZE, MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
+    if(buffer == NULL){
+        fclose(fd);
+        return 0;
     }
 
-    // Return the number of files
-    return i;
+    uint32_t crc = 0;
+    size_t count;
+    while((count = fread(buffer, 1, BLOCK_SIZE, fd)) > 0){
+        crc = crc32_le(crc, buffer, count);
+    }
+    fclose(fd);
+    free(buffer);
+
+    entry->crc = crc;
+    entry->flags |= SD_GAME_CRC;
+    lib->dirty = true;
+
+    return crc;
 }
 
 uint8_t sd_app_list(char *app_list[100],bool update){
@@ -239,15 +292,17 @@ uint8_t sd_app_list(char *app_list[100],bool update){
     
     // Only find .bin file on the apps folder
     uint8_t i =0;
-    while((entry = readdir(dir)) != NULL){
+    while((entry = readdir(dir)) != NULL && i < 100){
         size_t nameLength = strlen(entry->d_name);
-        app_list[i] = malloc(nameLength + 1);
-        if(strcmp(entry->d_name + (nameLength - 4), ".bin") == 0) {
+        if(nameLength > 4 && strcmp(entry->d_name + (nameLength - 4), ".bin") == 0) {
+            app_list[i] = malloc(nameLength + 1);
+            if(app_list[i] == NULL) break;
             sprintf(app_list[i],"%s",entry->d_name);
             ESP_LOGI(TAG, "Found %s ",app_list[i]);
             i++;
         }
     }
+    closedir(dir);
 
     return i;
 }
@@ -340,47 +395,258 @@ bool sd_mounted(){
 }
 
 bool sd_sav_exist(char *file_name, uint8_t emulator){
-    char *file_route = malloc(256);
-    
-    if(emulator == GAMEBOY) sprintf(file_route,"/sdcard/GameBoy/Save_Data/%s.sav",file_name);
-    else if(emulator == GAMEBOY_COLOR) sprintf(file_route,"/sdcard/GameBoy_Color/Save_Data/%s.sav",file_name);
-    else if(emulator == NES) sprintf(file_route,"/sdcard/NES/Save_Data/%s.sav",file_name);
-    else if(emulator == SMS) sprintf(file_route,"/sdcard/Master_System/Save_Data/%s.sav",file_name);
-    else if(emulator == GG) sprintf(file_route,"/sdcard/Game_Gear/Save_Data/%s.sav",file_name);
+    return sd_slot_exist(emulator, file_name);
+}
+
+void sd_sav_remove(char *file_name, uint8_t emulator){
+    sd_slot_remove(emulator, file_name);
+}
+
+const char *sd_console_folder(uint8_t console){
+    switch(console){
+        case NES:           return "/sdcard/NES";
+        case GAMEBOY:       return "/sdcard/GameBoy";
+        case GAMEBOY_COLOR: return "/sdcard/GameBoy_Color";
+        case SNES:          return "/sdcard/SNES";
+        case SMS:           return "/sdcard/Master_System";
+        case GG:            return "/sdcard/Game_Gear";
+        default:            return NULL;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool is_game_file(const char *name, uint8_t console){
+    const char *extension;
+    switch(console){
+        case NES:           extension = ".nes"; break;
+        case GAMEBOY:       extension = ".gb";  break;
+        case GAMEBOY_COLOR: extension = ".gbc"; break;
+        case SMS:           extension = ".sms"; break;
+        case GG:            extension = ".gg";  break;
+        default:            return false;
+    }
+
+    size_t name_length = strlen(name);
+    size_t extension_length = strlen(extension);
+    if(name[0] == '.' || name_length <= extension_length) return false;
+
+    return strcmp(name + name_length - extension_length, extension) == 0;
+}
 
+// FNV-1a hash of the names listed in a folder, only the games of a console unless console is 0xFF
+static uint32_t folder_signature(const char *path, uint8_t console){
+    uint32_t hash = 2166136261u;
+    struct dirent *entry;
+
+    DIR *dir = opendir(path);
+    if(!dir) return 0;
+
+    while((entry = readdir(dir)) != NULL){
+        if(console != 0xFF && !is_game_file(entry->d_name, console)) continue;
+
+        for(const char *c = entry->d_name; ; c++){
+            hash = (hash ^ (uint8_t)*c) * 16777619u;
+            if(*c == '\0') break;
+        }
+    }
+    closedir(dir);
+
+    return hash;
+}
+
+static void *index_alloc(size_t size){
+    void *block = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if(block == NULL) block = malloc(size);
+    return block;
+}
+
+static bool index_load(struct sd_game_library *lib, const char *path){
+    struct sd_index_header hdr;
     struct stat st;
-    if(stat(file_route, &st) == -1){
-        free(file_route);
+
+    if(stat(path, &st) == -1) return false;
+
+    FILE *fd = fopen(path, "rb");
+    if(fd == NULL) return false;
+
+    // Check the header before trusting the sizes it holds
+    if(fread(&hdr, sizeof(hdr), 1, fd) != 1 || hdr.magic != INDEX_MAGIC || hdr.version != INDEX_VERSION ||
+       st.st_size != sizeof(hdr) + hdr.count * sizeof(struct sd_game_entry) + hdr.names_size){
+        ESP_LOGW(TAG, "Invalid game index %s", path);
+        fclose(fd);
         return false;
     }
 
-    free(file_route);
+    uint8_t *block = index_alloc(st.st_size);
+    if(block == NULL){
+        fclose(fd);
+        return false;
+    }
+
+    memcpy(block, &hdr, sizeof(hdr));
+    size_t rest = st.st_size - sizeof(hdr);
+    bool ok = fread(block + sizeof(hdr), 1, rest, fd) == rest;
+    fclose(fd);
+
+    struct sd_game_entry *entries = (struct sd_game_entry *)(block + sizeof(hdr));
+    char *names = (char *)(entries + hdr.count);
+
+    // Every name has to be inside the pool and terminated
+    if(ok && hdr.names_size > 0 && names[hdr.names_size - 1] != '\0') ok = false;
+    for(uint32_t i = 0; ok && i < hdr.count; i++){
+        if(entries[i].name >= hdr.names_size) ok = false;
+    }
+
+    if(!ok){
+        ESP_LOGW(TAG, "Invalid game index %s", path);
+        free(block);
+        return false;
+    }
 
+    lib->block = block;
+    lib->entries = entries;
+    lib->names = names;
+    lib->count = hdr.count;
     return true;
 }
 
-void sd_sav_remove(char *file_name, uint8_t emulator){
-    char *file_route = malloc(256);
-    if(emulator == GAMEBOY) sprintf(file_route,"/sdcard/GameBoy/Save_Data/%s.sav",file_name);
-    else if(emulator == GAMEBOY_COLOR) sprintf(file_route,"/sdcard/GameBoy_Color/Save_Data/%s.sav",file_name);
-    else if(emulator == NES) sprintf(file_route,"/sdcard/NES/Save_Data/%s.sav",file_name);
-    else if(emulator == SMS) sprintf(file_route,"/sdcard/Master_System/Save_Data/%s.sav",file_name);
-    else if(emulator == GG) sprintf(file_route,"/sdcard/Game_Gear/Save_Data/%s.sav",file_name);
-
-    remove(file_route);
+static bool index_write(struct sd_game_library *lib, const char *path){
+    struct sd_index_header *hdr = lib->block;
+
+    FILE *fd = fopen(path, "wb");
+    if(fd == NULL){
+        ESP_LOGE(TAG, "Error writing: %s ", path);
+        return false;
+    }
+
+    bool ok = fwrite(hdr, sizeof(*hdr), 1, fd) == 1;
+    if(ok && lib->count) ok = fwrite(lib->entries, sizeof(struct sd_game_entry), lib->count, fd) == lib->count;
+    if(ok && hdr->names_size) ok = fwrite(lib->names, 1, hdr->names_size, fd) == hdr->names_size;
+    fclose(fd);
+
+    if(!ok){
+        ESP_LOGE(TAG, "Error writing: %s ", path);
+        remove(path);
+        return false;
+    }
+
+    lib->dirty = false;
+    return true;
 }
 
-static void organize_list(char *list[30], uint8_t index){
-    uint8_t index_aux = index;
-    char * list_aux = malloc(256);
-    while(strcmp(list[index_aux-1],list[index_aux])>0 && index_aux > 0){
-        memcpy(list_aux,list[index_aux -1],255);
-        memcpy(list[index_aux-1],list[index_aux],255);
-        memcpy(list[index_aux],list_aux,255);
-        index_aux --;
-        if(!index_aux) break;
-    }
-    free(list_aux);
-    
+static int entry_compare(const void *a, const void *b){
+    return strcasecmp(sort_names + ((const struct sd_game_entry *)a)->name,
+                      sort_names + ((const struct sd_game_entry *)b)->name);
+}
+
+// Look for a game in a loaded (sorted) library
+static struct sd_game_entry *index_find(const struct sd_game_library *lib, const char *name){
+    int low = 0;
+    int high = (int)lib->count - 1;
+
+    while(low <= high){
+        int mid = (low + high) / 2;
+        int cmp = strcasecmp(name, lib->names + lib->entries[mid].name);
+        if(cmp == 0) return &lib->entries[mid];
+        if(cmp < 0) high = mid - 1;
+        else low = mid + 1;
+    }
+    return NULL;
 }
 
+static bool index_rebuild(struct sd_game_library *lib, const char *folder, const char *path, const struct sd_index_header *now){
+    struct sd_game_library old = *lib;
+    struct dirent *entry;
+    struct stat st;
+    char file_path[320];
+    uint32_t capacity = 0;
+    uint32_t names_size = 0;
+
+    lib->block = NULL;
+    lib->entries = NULL;
+    lib->names = NULL;
+    lib->count = 0;
+
+    DIR *dir = opendir(folder);
+    if(!dir){
+        ESP_LOGE(TAG, "Failed to stat dir : 0x%02x", lib->console);
+        free(old.block);
+        return false;
+    }
+
+    // First pass to size the whole index in one allocation
+    while((entry = readdir(dir)) != NULL){
+        if(!is_game_file(entry->d_name, lib->console)) continue;
+        capacity++;
+        names_size += strlen(entry->d_name) + 1;
+    }
+
+    uint8_t *block = index_alloc(sizeof(struct sd_index_header) + capacity * sizeof(struct sd_game_entry) + names_size);
+    if(block == NULL){
+        ESP_LOGE(TAG, "Not enough memory for the game index");
+        closedir(dir);
+        free(old.block);
+        return false;
+    }
+
+    struct sd_index_header *hdr = (struct sd_index_header *)block;
+    struct sd_game_entry *entries = (struct sd_game_entry *)(block + sizeof(*hdr));
+    char *names = (char *)(entries + capacity);
+    uint32_t count = 0;
+    uint32_t used = 0;
+
+    rewinddir(dir);
+    while((entry = readdir(dir)) != NULL && count < capacity){
+        if(!is_game_file(entry->d_name, lib->console)) continue;
+
+        size_t length = strlen(entry->d_name) + 1;
+        if(used + length > names_size) break;
+
+        struct sd_game_entry *game = &entries[count++];
+        memset(game, 0, sizeof(*game));
+        game->name = used;
+        memcpy(names + used, entry->d_name, length);
+        used += length;
+
+        sprintf(file_path, "%s/%s", folder, entry->d_name);
+        if(stat(file_path, &st) == 0){
+            game->size = st.st_size;
+            game->mtime = st.st_mtime;
+        }
+
+        // Keep the CRC of the files that didn't change
+        struct sd_game_entry *previous = index_find(&old, entry->d_name);
+        if(previous != NULL && (previous->flags & SD_GAME_CRC) &&
+           previous->size == game->size && previous->mtime == game->mtime){
+            game->crc = previous->crc;
+            game->flags |= SD_GAME_CRC;
+        }
+
+        if(sd_slot_exist(lib->console, entry->d_name)) game->flags |= SD_GAME_SAVE;
+    }
+    closedir(dir);
+    free(old.block);
+
+    sort_names = names;
+    qsort(entries, count, sizeof(*entries), entry_compare);
+
+    *hdr = *now;
+    hdr->magic = INDEX_MAGIC;
+    hdr->version = INDEX_VERSION;
+    hdr->count = count;
+    hdr->names_size = used;
+
+    lib->block = block;
+    lib->entries = entries;
+    lib->names = names;
+    lib->count = count;
+
+    // The library is usable even if the index couldn't be saved
+    index_write(lib, path);
+
+    ESP_LOGI(TAG, "Game index %s: %u games", path, count);
+    return true;
+}
@@ -1,3 +1,4 @@
+#pragma once
 /*********************
  *      INCLUDES
  *********************/
@@ -19,6 +20,26 @@ struct sd_card_info{
     uint32_t card_speed;
 };
 
+#define SD_GAME_SAVE        0x01    // A save file exists for the game
+#define SD_GAME_CRC         0x02    // The crc field is valid
+
+struct sd_game_entry{
+    uint32_t name;      // Offset of the file name in the names pool
+    uint32_t size;
+    uint32_t mtime;
+    uint32_t crc;
+    uint32_t flags;
+};
+
+struct sd_game_library{
+    uint8_t console;
+    uint32_t count;
+    struct sd_game_entry *entries;  // Sorted by name
+    char *names;
+    void *block;                    // Single allocation holding the whole index
+    bool dirty;
+};
+
 /*********************
  *      EXTERNS
  *********************/
@@ -41,19 +62,67 @@ bool sd_init();
 
 
 /*
- * Function:  sd_game_list 
+ * Function:  sd_game_library_open 
  * --------------------
  * 
- * This function  gives the number of game available and the name of them for each console.
+ * Load the game library of a console from its index file (e.g. /sdcard/NES/.index).
+ * The index is a sorted table of the games with their size, mtime, CRC and save flag.
+ * It's only rebuilt when the console folder or its Save_Data folder changed, reusing
+ * the entries of the files that didn't change.
+ * 
+ * Note: FAT doesn't always update the folder mtime when files are added, so the names
+ * listed in the folders are checked against a signature stored in the index too.
  * 
  * Arguments:
- *  -game_list: Array with a list of available games.
+ *  -lib: Library to fill, release it with sd_game_library_close.
  *  -console: Console to check the available games.
  * 
- * Returns: Number of available games for the console.
+ * Returns: True if the library was loaded, lib->count can be 0.
+ * 
+ */
+bool sd_game_library_open(struct sd_game_library *lib, uint8_t console);
+
+/*
+ * Function:  sd_game_library_close 
+ * --------------------
+ * 
+ * Release a game library, writing back the index if CRCs were computed meanwhile.
+ * 
+ * Arguments:
+ *  -lib: Library to release.
+ * 
+ * Returns: Nothing.
+ * 
+ */
+void sd_game_library_close(struct sd_game_library *lib);
+
+/*
+ * Function:  sd_game_library_name 
+ * --------------------
+ * 
+ * Arguments:
+ *  -lib: Opened library.
+ *  -index: Entry of the library.
+ * 
+ * Returns: File name of the game.
  * 
  */
-uint8_t sd_game_list(char *game_list[100], uint8_t console);
+const char *sd_game_library_name(const struct sd_game_library *lib, uint32_t index);
+
+/*
+ * Function:  sd_game_library_crc 
+ * --------------------
+ * 
+ * CRC32 of a game file. It's computed the first time it's requested and kept in the index.
+ * 
+ * Arguments:
+ *  -lib: Opened library.
+ *  -index: Entry of the library.
+ * 
+ * Returns: CRC32 of the file, 0 if it couldn't be read.
+ * 
+ */
+uint32_t sd_game_library_crc(struct sd_game_library *lib, uint32_t index);
 
 /*
  * Function:  sd_app_list 
@@ -158,4 +227,18 @@ bool sd_sav_exist(char *file_name,uint8_t emulator);
  * Returns: Nothing.
  * 
  */
-void sd_sav_remove(char *file_name,uint8_t emulator);
\ No newline at end of file
+void sd_sav_remove(char *file_name,uint8_t emulator);
+
+/*
+ * Function:  sd_console_folder 
+ * --------------------
+ * 
+ * Get the folder of the games of a console.
+ * 
+ * Arguments:
+ *      - console: Console of the folder.
+ * 
+ * Returns: The route, NULL if the console doesn't have folder.
+ * 
+ */
+const char *sd_console_folder(uint8_t console);
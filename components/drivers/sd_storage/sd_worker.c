@@ -0,0 +1,172 @@
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+#include "esp_log.h"
+
+#include "sd_storage.h"
+#include "sd_worker.h"
+#include "sd_slots.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define REQUEST_QUEUE_LEN   4
+#define RESPONSE_QUEUE_LEN  4
+
+#define SAV_CACHE_SIZE      8
+
+// Result of a save probe, the hash avoids comparing the names of the other entries
+struct sav_cache_entry{
+    bool valid;
+    bool exist;
+    uint8_t console;
+    uint32_t hash;
+    char name[256];
+};
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static const char *TAG = "SD_WORKER";
+
+static QueueHandle_t requestQueue;
+static QueueHandle_t responseQueue;
+
+static uint32_t last_id = 0;
+
+// Only accessed from the worker task
+static struct sav_cache_entry sav_cache[SAV_CACHE_SIZE];
+static uint8_t sav_cache_next = 0;
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void sd_worker_task(void *arg);
+static uint32_t name_hash(const char *name);
+static struct sav_cache_entry *sav_cache_find(const char *name, uint8_t console);
+static void sav_cache_store(const char *name, uint8_t console, bool exist);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void sd_worker_init(){
+    requestQueue = xQueueCreate(REQUEST_QUEUE_LEN, sizeof(struct sd_request));
+    responseQueue = xQueueCreate(RESPONSE_QUEUE_LEN, sizeof(struct sd_response));
+
+    // Same core and priority than the GUI task, both share the core by time slicing
+    xTaskCreatePinnedToCore(&sd_worker_task, "SD worker", 1024*4, NULL, 1, NULL, 0);
+}
+
+uint32_t sd_worker_request(struct sd_request *request){
+    // Only the GUI task sends requests, so the id doesn't need a lock
+    if(++last_id == 0) last_id = 1;
+    request->id = last_id;
+
+    if(xQueueSend(requestQueue, request, 0) != pdPASS){
+        ESP_LOGE(TAG, "Request queue full");
+        return 0;
+    }
+
+    return request->id;
+}
+
+bool sd_worker_response(struct sd_response *response){
+    return xQueueReceive(responseQueue, response, 0) == pdPASS;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void sd_worker_task(void *arg){
+    struct sd_request request;
+    struct sd_response response;
+
+    while(1){
+        if(!xQueueReceive(requestQueue, &request, portMAX_DELAY)) continue;
+
+        memset(&response, 0, sizeof(response));
+        response.type = request.type;
+        response.id = request.id;
+
+        if(request.type == SD_REQ_LIBRARY){
+            // The save files may have changed since the last list
+            memset(sav_cache, 0, sizeof(sav_cache));
+            response.ok = sd_game_library_open(&response.library, request.console);
+        }
+        else if(request.type == SD_REQ_SAV_EXIST){
+            struct sav_cache_entry *cached = sav_cache_find(request.name, request.console);
+            if(cached != NULL) response.sav_exist = cached->exist;
+            else{
+                response.sav_exist = sd_sav_exist(request.name, request.console);
+                sav_cache_store(request.name, request.console, response.sav_exist);
+            }
+            response.ok = true;
+        }
+        else if(request.type == SD_REQ_SAV_REMOVE){
+            sd_sav_remove(request.name, request.console);
+            sav_cache_store(request.name, request.console, false);
+            response.ok = true;
+        }
+        else if(request.type == SD_REQ_APP_LIST){
+            response.app_list = calloc(SD_APP_LIST_MAX, sizeof(char *));
+            if(response.app_list != NULL){
+                response.app_num = sd_app_list(response.app_list, request.update);
+                response.ok = true;
+            }
+        }
+        else if(request.type == SD_REQ_SLOT_INDEX){
+            response.data = sd_slot_index_read(request.console, request.name);
+            if(response.data != NULL) response.size = sizeof(struct sd_slot_index);
+            response.ok = response.data != NULL;
+        }
+
+        xQueueSend(responseQueue, &response, portMAX_DELAY);
+    }
+}
+
+// FNV-1a
+static uint32_t name_hash(const char *name){
+    uint32_t hash = 2166136261u;
+    while(*name){
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static struct sav_cache_entry *sav_cache_find(const char *name, uint8_t console){
+    uint32_t hash = name_hash(name);
+
+    for(int i = 0; i < SAV_CACHE_SIZE; i++){
+        if(sav_cache[i].valid && sav_cache[i].console == console && sav_cache[i].hash == hash
+           && strcmp(sav_cache[i].name, name) == 0) return &sav_cache[i];
+    }
+
+    return NULL;
+}
+
+static void sav_cache_store(const char *name, uint8_t console, bool exist){
+    struct sav_cache_entry *entry = sav_cache_find(name, console);
+
+    if(entry == NULL){
+        entry = &sav_cache[sav_cache_next];
+        sav_cache_next = (sav_cache_next + 1) % SAV_CACHE_SIZE;
+    }
+
+    entry->valid = true;
+    entry->exist = exist;
+    entry->console = console;
+    entry->hash = name_hash(name);
+    snprintf(entry->name, sizeof(entry->name), "%s", name);
+}
@@ -0,0 +1,86 @@
+#pragma once
+/*********************
+ *      INCLUDES
+ *********************/
+#include "stdint.h"
+#include "stdbool.h"
+#include "stddef.h"
+
+#include "sd_storage.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+// Request types
+#define SD_REQ_LIBRARY      0x00    // Open the game library of a console
+#define SD_REQ_SAV_EXIST    0x01    // Check if a game has a save file
+#define SD_REQ_SAV_REMOVE   0x02    // Remove the save file of a game
+#define SD_REQ_APP_LIST     0x03    // List the external applications or the update binaries
+#define SD_REQ_SLOT_INDEX   0x05    // Read the save slots of a game
+
+#define SD_APP_LIST_MAX     100
+
+struct sd_request{
+    uint8_t type;
+    uint8_t console;
+    bool update;                    // SD_REQ_APP_LIST: Look for update binaries
+    uint32_t id;                    // Set by sd_worker_request
+    char name[256];                 // Game name or file path
+};
+
+struct sd_response{
+    uint8_t type;
+    uint32_t id;                    // Id of the request
+    bool ok;
+    struct sd_game_library library; // SD_REQ_LIBRARY: Release it with sd_game_library_close
+    bool sav_exist;                 // SD_REQ_SAV_EXIST
+    char **app_list;                // SD_REQ_APP_LIST: Free each name and the list
+    uint8_t app_num;
+    void *data;                     // SD_REQ_SLOT_INDEX: Free it once used
+    size_t size;
+};
+
+/*********************
+ *      FUNCTIONS
+ *********************/
+
+/*
+ * Function:  sd_worker_init
+ * --------------------
+ *
+ * Start the storage worker task. The SD card accesses of the GUI are sent to this task,
+ * so slow reads don't block the menu.
+ *
+ * Returns: Nothing.
+ *
+ */
+void sd_worker_init();
+
+/*
+ * Function:  sd_worker_request
+ * --------------------
+ *
+ * Queue a request to the storage worker, it doesn't wait for the result.
+ *
+ * Arguments:
+ *  -request: Request to send, the id field is filled by this function.
+ *
+ * Returns: Id of the request, 0 if the queue is full.
+ *
+ */
+uint32_t sd_worker_request(struct sd_request *request);
+
+/*
+ * Function:  sd_worker_response
+ * --------------------
+ *
+ * Get a finished request without waiting. Meant to be polled from a lv_task.
+ *
+ * Arguments:
+ *  -response: Result of the request.
+ *
+ * Returns: True if there was a response available.
+ *
+ */
+bool sd_worker_response(struct sd_response *response);
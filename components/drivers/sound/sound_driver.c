@@ -24,6 +24,11 @@ float volume_level;
 **********************/
 static const char *TAG = "SOUND_DRIVER";
 
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void audio_scale(short *stereoAudioBuffer, uint32_t frameCount);
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -42,7 +47,8 @@ bool audio_init(uint32_t sample_rate){
         .dma_buf_count = 6,
         .dma_buf_len = 512,
         .intr_alloc_flags = 0, 
-        .use_apll = false};
+        .use_apll = false,
+        .tx_desc_auto_clear = true}; // Silence instead of the last buffer repeated if the emulator is late
 
     if(i2s_driver_install(I2S_NUM, &i2s_config, 0, NULL) != ESP_OK){
         ESP_LOGE(TAG,"I2S driver error install error");
@@ -71,15 +77,7 @@ void audio_submit(short *stereoAudioBuffer, uint32_t frameCount){
     uint32_t audio_length = frameCount * 2 * sizeof(int16_t);
     size_t count;
 
-    // Normalize the size of the sample to avoid size bigger than +- 32767
-    for(short i = 0; i < frameCount * 2; ++i){
-        int sample = stereoAudioBuffer[i] * volume_level; // Set the volumen level to the sample
-
-        if (sample > 32767) sample = 32767;
-        else if (sample < -32767) sample = -32767;
-
-        stereoAudioBuffer[i] = (short)sample;
-    }
+    audio_scale(stereoAudioBuffer, frameCount);
 
     i2s_write(I2S_NUM, (const char *)stereoAudioBuffer, audio_length, &count, portMAX_DELAY);
 
@@ -89,6 +87,13 @@ void audio_submit(short *stereoAudioBuffer, uint32_t frameCount){
     }
 }
 
+void audio_submit_nowait(short *stereoAudioBuffer, uint32_t frameCount){
+    size_t count;
+
+    audio_scale(stereoAudioBuffer, frameCount);
+    i2s_write(I2S_NUM, (const char *)stereoAudioBuffer, frameCount * 2 * sizeof(int16_t), &count, 0);
+}
+
 void audio_terminate(){
     i2s_zero_dma_buffer(I2S_NUM); // Clean the DMA buffer
     i2s_stop(I2S_NUM);
@@ -105,4 +110,20 @@ void audio_volume_set(float level){
     if(level >= 0 || level <= 100) volume_level = level/100.0f;
     ESP_LOGI(TAG,"Volumen level set: %i",(uint8_t)volume_level *100);
     system_save_config(SYS_VOLUME,level);
-}
\ No newline at end of file
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void audio_scale(short *stereoAudioBuffer, uint32_t frameCount){
+    // Normalize the size of the sample to avoid size bigger than +- 32767
+    for(short i = 0; i < frameCount * 2; ++i){
+        int sample = stereoAudioBuffer[i] * volume_level; // Set the volumen level to the sample
+
+        if (sample > 32767) sample = 32767;
+        else if (sample < -32767) sample = -32767;
+
+        stereoAudioBuffer[i] = (short)sample;
+    }
+}
@@ -45,6 +45,22 @@ bool audio_init(uint32_t sample_rate);
  */
 void audio_submit(short *stereoAudioBuffer, uint32_t frameCount);
 
+/*
+ * Function:  audio_submit_nowait 
+ * --------------------
+ * 
+ * Like audio_submit, but only the samples which fit on the free DMA buffers are sent, the rest
+ * are dropped. For the fast forward, the emulator isn't paced by the audio.
+ * 
+ * Arguments:
+ *  -stereoAudioBuffer: Pointer to the stereo audio buffer which previously should be filled by the emulator.
+ *  -framecount: Stereo samples of the buffer.
+ * 
+ * Returns: Nothing.
+ * 
+ */
+void audio_submit_nowait(short *stereoAudioBuffer, uint32_t frameCount);
+
 /*
  * Function:  audio_terminate 
  * --------------------
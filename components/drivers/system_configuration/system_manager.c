@@ -7,6 +7,7 @@
 #include "soc/dport_reg.h"
 #include "soc/efuse_periph.h"
 #include "esp32/spiram.h"
+#include "esp_timer.h"
 
 #include "nvs_flash.h"
 #include "nvs.h"
@@ -14,6 +15,10 @@
 
 nvs_handle_t config_handle;
 
+static struct BOOT_STAGE boot_timeline[BOOT_STAGE_MAX];
+static uint8_t boot_stage_num = 0;
+static portMUX_TYPE boot_timeline_lock = portMUX_INITIALIZER_UNLOCKED;
+
 
 /**********************
  *   GLOBAL FUNCTIONS
@@ -123,3 +128,67 @@ int8_t system_get_config(uint8_t config){
     return value;
 }
 
+// The snapshot is written just before a restart or a power loss, so it's committed right away
+void system_save_resume(uint8_t console, const char *game_name){
+    nvs_open("nvs", NVS_READWRITE, &config_handle);
+    nvs_set_u8(config_handle, "resume_con", console);
+    nvs_set_str(config_handle, "resume_game", game_name);
+    nvs_commit(config_handle);
+    nvs_close(config_handle);
+}
+
+bool system_get_resume(uint8_t *console, char *game_name, size_t size){
+    bool found = false;
+
+    nvs_open("nvs", NVS_READWRITE, &config_handle);
+    if(nvs_get_u8(config_handle, "resume_con", console) == ESP_OK && \
+    nvs_get_str(config_handle, "resume_game", game_name, &size) == ESP_OK){
+        found = true;
+    }
+    nvs_close(config_handle);
+
+    return found;
+}
+
+void system_clear_resume(){
+    nvs_open("nvs", NVS_READWRITE, &config_handle);
+    nvs_erase_key(config_handle, "resume_con");
+    nvs_erase_key(config_handle, "resume_game");
+    nvs_commit(config_handle);
+    nvs_close(config_handle);
+}
+
+uint8_t system_boot_stage_start(const char *name){
+    uint32_t now = esp_timer_get_time() / 1000;
+    uint8_t stage = BOOT_STAGE_MAX;
+
+    portENTER_CRITICAL(&boot_timeline_lock);
+    if(boot_stage_num < BOOT_STAGE_MAX){
+        stage = boot_stage_num++;
+        boot_timeline[stage].name = name;
+        boot_timeline[stage].start = now;
+        boot_timeline[stage].end = now;
+    }
+    portEXIT_CRITICAL(&boot_timeline_lock);
+
+    return stage;
+}
+
+void system_boot_stage_end(uint8_t stage){
+    if(stage >= BOOT_STAGE_MAX) return;
+
+    uint32_t now = esp_timer_get_time() / 1000;
+
+    portENTER_CRITICAL(&boot_timeline_lock);
+    boot_timeline[stage].end = now;
+    portEXIT_CRITICAL(&boot_timeline_lock);
+}
+
+uint8_t system_boot_timeline(struct BOOT_STAGE *timeline){
+    portENTER_CRITICAL(&boot_timeline_lock);
+    uint8_t num = boot_stage_num;
+    memcpy(timeline, boot_timeline, sizeof(struct BOOT_STAGE) * num);
+    portEXIT_CRITICAL(&boot_timeline_lock);
+
+    return num;
+}
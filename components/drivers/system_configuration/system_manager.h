@@ -1,5 +1,6 @@
 #include "stdbool.h"
 #include "stdint.h"
+#include "stddef.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 
@@ -40,12 +41,28 @@ QueueHandle_t batteryQueue;
 #define SYS_GUI_COLOR       0x02
 #define SYS_STATE_SAV_BTN   0x03
 
+//Boot timeline
+#define BOOT_STAGE_MAX      16
+
+// Struct to save the duration of a boot stage, the times are in ms since the power on
+struct BOOT_STAGE{
+    const char *name;
+    uint32_t start;
+    uint32_t end;
+};
+
+// load_save_game of MODE_GAME
+#define GAME_LOAD_NONE      0   // New game
+#define GAME_LOAD_LATEST    1   // Slot saved last by the player
+#define GAME_LOAD_RESUME    2   // Quick resume snapshot
+
 // Struct to send data from emulator or inner stuff to the main control loop
 struct SYSTEM_MODE{
     uint8_t mode;
     uint8_t status;
     uint8_t console;
-    uint8_t load_save_game;
+    uint8_t load_save_game;         // MODE_GAME: GAME_LOAD_NONE, GAME_LOAD_LATEST or GAME_LOAD_RESUME
+    uint8_t slot;                   // MODE_SAVE_GAME, MODE_LOAD_GAME: Save slot
     uint8_t volume_level;
     uint8_t brightness_level;
     char game_name[200];
@@ -178,4 +195,90 @@ void system_save_config(uint8_t config, int8_t value);
  * Returns: Value of the configuration.
  * 
  */
-int8_t system_get_config(uint8_t config);
\ No newline at end of file
+int8_t system_get_config(uint8_t config);
+
+/*
+ * Function:  system_save_resume
+ * --------------------
+ * 
+ *  Save the quick resume snapshot: which game was running, its state is on the save file
+ *  of the game. On the next power on, the game is started again with that state.
+ * 
+* Arguments:
+ * 	- console: Console of the game.
+ * 	- game_name: Name of the game.
+ * 
+ * Returns: Nothing
+ * 
+ */
+void system_save_resume(uint8_t console, const char *game_name);
+
+/*
+ * Function:  system_get_resume
+ * --------------------
+ * 
+ *  Get the quick resume snapshot, if there is one.
+ * 
+* Arguments:
+ * 	- console: Console of the game.
+ * 	- game_name: Buffer to save the name of the game.
+ * 	- size: Size of the buffer.
+ * 
+ * Returns: True if there is a snapshot.
+ * 
+ */
+bool system_get_resume(uint8_t *console, char *game_name, size_t size);
+
+/*
+ * Function:  system_clear_resume
+ * --------------------
+ * 
+ *  Remove the quick resume snapshot, e.g. when other game is started from the menu.
+ * 
+ * Returns: Nothing
+ * 
+ */
+void system_clear_resume();
+
+/*
+ * Function:  system_boot_stage_start
+ * --------------------
+ * 
+ *  Start measuring a stage of the boot timeline. It can be called from several tasks at 
+ *  the same time, so the subsystems initialized in parallel can be measured.
+ * 
+* Arguments:
+ * 	- name: Name of the stage, it must be a constant string.
+ * 
+ * Returns: Index of the stage, BOOT_STAGE_MAX if the timeline is full.
+ * 
+ */
+uint8_t system_boot_stage_start(const char *name);
+
+/*
+ * Function:  system_boot_stage_end
+ * --------------------
+ * 
+ *  Finish a stage of the boot timeline.
+ * 
+* Arguments:
+ * 	- stage: Index returned by system_boot_stage_start.
+ * 
+ * Returns: Nothing
+ * 
+ */
+void system_boot_stage_end(uint8_t stage);
+
+/*
+ * Function:  system_boot_timeline
+ * --------------------
+ * 
+ *  Get a copy of the boot timeline, e.g. to show it on the settings menu.
+ * 
+* Arguments:
+ * 	- timeline: Array of BOOT_STAGE_MAX stages to save the timeline.
+ * 
+ * Returns: Number of stages saved.
+ * 
+ */
+uint8_t system_boot_timeline(struct BOOT_STAGE *timeline);
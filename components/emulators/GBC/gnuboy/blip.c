@@ -0,0 +1,144 @@
+#pragma GCC optimize ("O3")
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "blip.h"
+
+#include <esp_attr.h>
+
+
+/* fraction of the nyquist frequency passed by the kernel */
+#define BLIP_CUTOFF 0.9
+
+static int16_t DRAM_ATTR blip_kernel[BLIP_PHASES][BLIP_WIDTH];
+static int kernel_ready;
+
+
+/*
+	Blackman windowed sinc impulse for every sub-sample phase,
+	each phase normalized to an exact gain of 1 << BLIP_KERNEL_BITS
+	so that integrating the buffer never drifts.
+*/
+static void blip_kernel_init()
+{
+	int p, i, sum;
+	double k[BLIP_WIDTH], total, x, w, s;
+
+	for (p = 0; p < BLIP_PHASES; p++)
+	{
+		total = 0;
+		for (i = 0; i < BLIP_WIDTH; i++)
+		{
+			x = i - (BLIP_WIDTH/2 - 1) - (double)p / BLIP_PHASES;
+			w = 0.42 + 0.5 * cos(M_PI * x / (BLIP_WIDTH/2))
+				+ 0.08 * cos(2 * M_PI * x / (BLIP_WIDTH/2));
+			s = x ? sin(M_PI * BLIP_CUTOFF * x) / (M_PI * BLIP_CUTOFF * x) : 1;
+			k[i] = s * w;
+			total += k[i];
+		}
+		sum = 0;
+		for (i = 0; i < BLIP_WIDTH; i++)
+		{
+			blip_kernel[p][i] = (int16_t)floor(k[i] * (1 << BLIP_KERNEL_BITS) / total + 0.5);
+			sum += blip_kernel[p][i];
+		}
+		blip_kernel[p][BLIP_WIDTH/2 - 1] += (1 << BLIP_KERNEL_BITS) - sum;
+	}
+	kernel_ready = 1;
+}
+
+/*
+	clock - source clock rate in Hz
+	rate - output sample rate in Hz
+	size - maximum number of output samples per frame
+	returns 0 if the buffer could not be allocated
+*/
+int blip_init(struct blip *b, int clock, int rate, int size)
+{
+	if (!kernel_ready) blip_kernel_init();
+
+	if (!b->buf || b->size != size)
+	{
+		free(b->buf);
+		b->buf = malloc((size + BLIP_WIDTH) * sizeof *b->buf);
+		b->size = b->buf ? size : 0;
+	}
+	b->factor = (unsigned)(((uint64_t)rate << BLIP_FRAC_BITS) / clock);
+	blip_clear(b);
+	return b->buf != NULL;
+}
+
+void blip_free(struct blip *b)
+{
+	free(b->buf);
+	b->buf = NULL;
+	b->size = 0;
+}
+
+void blip_clear(struct blip *b)
+{
+	if (b->buf) memset(b->buf, 0, (b->size + BLIP_WIDTH) * sizeof *b->buf);
+	b->offset = 0;
+	b->sum = 0;
+}
+
+void IRAM_ATTR blip_add_delta(struct blip *b, unsigned t, int delta)
+{
+	int i;
+	unsigned fixed = b->offset + t * b->factor;
+	unsigned pos = fixed >> BLIP_FRAC_BITS;
+	const int16_t *k = blip_kernel[(fixed >> (BLIP_FRAC_BITS - BLIP_PHASE_BITS)) & (BLIP_PHASES - 1)];
+	int32_t *out;
+
+	/* frame longer than the buffer, drop it rather than write past the end */
+	if (pos >= (unsigned)b->size) return;
+
+	out = b->buf + pos;
+	for (i = 0; i < BLIP_WIDTH; i++)
+		out[i] += k[i] * delta;
+}
+
+/*
+	Ends the frame at time t and integrates its samples into out.
+
+	max - room in out, in samples
+	stride - distance between two samples in out (2 for interleaved stereo)
+	returns number of samples written
+*/
+int IRAM_ATTR blip_read(struct blip *b, unsigned t, int16_t *out, int max, int stride)
+{
+	int i, n, s;
+	unsigned fixed = b->offset + t * b->factor;
+	int count = fixed >> BLIP_FRAC_BITS;
+	int32_t sum = b->sum;
+
+	if (!b->buf) return 0;
+	if (count > b->size)
+	{
+		count = b->size;
+		fixed = (fixed & ((1 << BLIP_FRAC_BITS) - 1)) + ((unsigned)count << BLIP_FRAC_BITS);
+	}
+	n = count < max ? count : max;
+
+	for (i = 0; i < n; i++)
+	{
+		sum += b->buf[i];
+		s = sum >> BLIP_KERNEL_BITS;
+		if (s > 32767) s = 32767;
+		else if (s < -32768) s = -32768;
+		*out = (int16_t)s;
+		out += stride;
+	}
+	/* samples that did not fit are dropped but still integrated */
+	for (; i < count; i++)
+		sum += b->buf[i];
+
+	memmove(b->buf, b->buf + count, BLIP_WIDTH * sizeof *b->buf);
+	memset(b->buf + BLIP_WIDTH, 0, count * sizeof *b->buf);
+
+	b->sum = sum;
+	b->offset = fixed - ((unsigned)count << BLIP_FRAC_BITS);
+	return n;
+}
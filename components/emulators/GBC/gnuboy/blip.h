@@ -0,0 +1,38 @@
+#ifndef __BLIP_H__
+#define __BLIP_H__
+
+
+#include <stdint.h>
+
+/*
+	Band-limited step buffer.
+
+	Amplitude changes are added as deltas at a time expressed in
+	source clocks (2MHz units for gnuboy) since the start of the
+	current frame. At the end of the frame the buffer is integrated
+	into output samples, so the cost depends on the number of
+	waveform edges rather than on the output sample rate.
+*/
+
+#define BLIP_FRAC_BITS   20
+#define BLIP_PHASE_BITS  5
+#define BLIP_PHASES      (1 << BLIP_PHASE_BITS)
+#define BLIP_WIDTH       16
+#define BLIP_KERNEL_BITS 15
+
+struct blip
+{
+	int32_t *buf;
+	int size;
+	unsigned factor;
+	unsigned offset;
+	int32_t sum;
+};
+
+int blip_init(struct blip *b, int clock, int rate, int size);
+void blip_free(struct blip *b);
+void blip_clear(struct blip *b);
+void blip_add_delta(struct blip *b, unsigned t, int delta);
+int blip_read(struct blip *b, unsigned t, int16_t *out, int max, int stride);
+
+#endif
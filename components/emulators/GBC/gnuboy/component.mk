@@ -8,6 +8,10 @@
 #
 
 CFLAGS += -DGNUBOY_NO_MINIZIP -DGNUBOY_NO_SCREENSHOT -DIS_LITTLE_ENDIAN
+# Band-limited (blip buffer) sound synthesis instead of the per-sample mixer
+#CFLAGS += -DGNUBOY_BLIP_SOUND
+# Cache of decoded tile patterns, invalidated per tile on vram writes
+CFLAGS += -DGNUBOY_TILE_CACHE
 #COMPONENT_DEPENDS :=
 COMPONENT_ADD_INCLUDEDIRS := .
 COMPONENT_SRCDIRS := .
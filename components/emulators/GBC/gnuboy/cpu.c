@@ -344,17 +344,83 @@ void IRAM_ATTR cpu_timers(int cnt)
 	sound_advance(cnt);
 }
 
+/*
+	Event scheduler
+
+	Instead of advancing div/timer/lcdc/sound after every instruction,
+	cpu_emulate() only accumulates the elapsed time in cpu_pend and
+	brings the rest of the system up to date (cpu_sync) once it reaches
+	cpu_next, the time of the next event the CPU must not run past:
+	an LCDC state change or a timer overflow. Any io register access
+	also syncs first, so the CPU never observes stale state.
+
+	Serial and RTC are not timed in this core (serial transfers
+	complete immediately, RTC ticks once per frame), so they never
+	limit a batch.
+*/
+
+static int cpu_pend;
+static int cpu_next;
+static int stop_mask, stop_hit;
+
+/* returns time to the next event, expressed in 2MHz units */
+static int IRAM_ATTR cpu_next_event()
+{
+	int cnt, unit;
+
+	cnt = cpu.lcdc;
+	if (cnt < 1) cnt = 1;
+
+	if (R_TAC & 0x04)
+	{
+		unit = ((-R_TAC) & 3) << 1;
+		/* time to TIMA overflow in div/timer units... */
+		unit = (512 * (256 - R_TIMA) - cpu.tim + (1<<unit) - 1) >> unit;
+		/* ...and in 2MHz units */
+		unit = (unit + (1<<cpu.speed) - 1) >> cpu.speed;
+		if (unit < 1) unit = 1;
+		if (unit < cnt) cnt = unit;
+	}
+	return cnt;
+}
+
+/* cpu_sync()
+	Advance div, timer, lcdc and sound by the time the CPU ran since
+	the last sync, then schedule the next event
+*/
+void IRAM_ATTR cpu_sync()
+{
+	int cnt = cpu_pend;
+
+	if (cnt)
+	{
+		cpu_pend = 0;
+		div_advance(cnt << cpu.speed);
+		timer_advance(cnt << cpu.speed);
+		sound_advance(cnt);
+		lcdc_advance(cnt);
+	}
+	/* a stop event ends the batch at the current instruction */
+	cpu_next = stop_hit ? 0 : cpu_next_event();
+}
+
+/* cpu_event()
+	Called by lcdc on CPU_STOP_* conditions, ends cpu_emulate_until()
+*/
+void IRAM_ATTR cpu_event(int ev)
+{
+	stop_hit |= ev & stop_mask;
+}
+
 /* cpu_idle()
 	Skip idle phase of CPU operation, if any
 
 	max - maximum time to skip expressed in 2MHz units
 	returns number of cycles skipped
 */
-/* FIXME: bring cpu_timers() out, make caller advance system */
 int IRAM_ATTR cpu_idle(int max)
 {
-	int cnt, unit;
-
+	int cnt;
 
 	if (!(cpu.halt && IME)) return 0;
 	if (R_IF & R_IE)
@@ -363,26 +429,13 @@ int IRAM_ATTR cpu_idle(int max)
 		return 0;
 	}
 
-	/* Make sure we don't miss lcdc status events! */
-	if ((R_IE & (IF_VBLANK | IF_STAT)) && (max > cpu.lcdc))
-		max = cpu.lcdc;
-
-	/* If timer interrupt cannot happen, this is very simple! */
-	if (!((R_IE & IF_TIMER) && (R_TAC & 0x04)))
-	{
-		cpu_timers(max);
-		return max;
-	}
+	/* Nothing can wake the CPU up before the next event, go straight to it */
+	cnt = cpu_next - cpu_pend;
+	if (cnt > max) cnt = max;
+	if (cnt < 1) cnt = 1;
 
-	/* Figure out when the next timer interrupt will happen */
-	unit = ((-R_TAC) & 3) << 1;
-	cnt = (511 - cpu.tim + (1<<unit)) >> unit;
-	cnt += (255 - R_TIMA) << (9 - unit);
-
-	if (max < cnt)
-		cnt = max;
-
-	cpu_timers(cnt);
+	cpu_pend += cnt;
+	cpu_sync();
 	return cnt;
 }
 
@@ -409,12 +462,13 @@ int IRAM_ATTR cpu_emulate(int cycles)
 	static word w;
 
 	i = cycles;
+	cpu_sync();
 next:
 	/* Skip idle cycles */
 	if ((clen = cpu_idle(i)))
 	{
 		i -= clen;
-		if (i > 0) goto next;
+		if (i > 0 && !stop_hit) goto next;
 		return cycles-i;
 	}
 
@@ -912,6 +966,7 @@ next:
 		PC++;
 		if (R_KEY1 & 1)
 		{
+			cpu_sync();
 			cpu.speed = cpu.speed ^ 1;
 			R_KEY1 = (R_KEY1 & 0x7E) | (cpu.speed << 7);
 			break;
@@ -954,20 +1009,39 @@ next:
 		break;
 	}
 
-	/* Advance time counters */
-	/* FIXME: make use of cpu_timers() */
+	/* Advance time, the rest of the system catches up on the next event */
 	clen <<= 1;
-	div_advance(clen);
-	timer_advance(clen);
 	clen >>= cpu.speed;
-	lcdc_advance(clen);
-	sound_advance(clen);
-
+	cpu_pend += clen;
 	i -= clen;
+
+	if (cpu_pend >= cpu_next)
+	{
+		cpu_sync();
+		if (stop_hit) return cycles-i;
+	}
 	if (i > 0) goto next;
+	cpu_sync();
 	return cycles-i;
 }
 
+/* cpu_emulate_until()
+	Emulate CPU until one of the CPU_STOP_* events in mask happens
+
+	cycles - upper bound, expressed in 2MHz units
+	returns number of cycles emulated
+*/
+int IRAM_ATTR cpu_emulate_until(int mask, int cycles)
+{
+	int cnt;
+
+	stop_mask = mask;
+	stop_hit = 0;
+	cnt = cpu_emulate(cycles);
+	stop_mask = stop_hit = 0;
+	return cnt;
+}
+
 #endif /* ASM_CPU_EMULATE */
 
 
@@ -27,9 +27,16 @@ struct cpu
 extern struct cpu cpu;
 
 
+/* events that can end cpu_emulate_until() */
+#define CPU_STOP_VBLANK 0x01 /* LY reached 144 or lcd was switched */
+#define CPU_STOP_FRAME  0x02 /* LY went back to 0 */
+
 void cpu_timers(int cnt);
 void cpu_reset();
 int cpu_emulate(int cycles); /* NOTE there may be an ASM version of that */
+int cpu_emulate_until(int mask, int cycles);
+void cpu_sync();
+void cpu_event(int ev);
 
 void div_advance(int cnt);
 void timer_advance(int cnt);
@@ -74,9 +74,10 @@ void pal_release(byte n);
 byte pal_getcolor(int c, int r, int g, int b);
 
 /* save.c */
-#include <stdio.h> /* need FILE for below */
-void savestate(FILE *f);
-void loadstate(FILE *f);
+#include <stdio.h>
+int savestate_size();
+int savestate(byte *buf);
+int loadstate(const byte *buf, int size);
 
 /* inflate.c */
 int unzip (const unsigned char *data, long *p, void (* callback) (unsigned char d));
@@ -15,7 +15,9 @@
 #endif
 
 #include <stdlib.h>
+#include <stdio.h>
 #include <esp_attr.h>
+#include <esp_heap_caps.h>
 #include <stdint.h>
 
 struct lcd lcd;
@@ -74,6 +76,51 @@ static byte *vdest;
 
 static byte pix[8];
 
+#ifdef GNUBOY_TILE_CACHE
+/*
+	Decoded pattern cache: one unflipped 8x8 block of 2bpp pixels per
+	(bank, tile). vram_write() invalidates the tile it touches and
+	vram_dirty() all of them; flips are applied when a row is fetched.
+	Falls back to decoding on every fetch if it could not be allocated.
+*/
+#define TILECACHE_TILES (384 * 2)
+
+static byte (*tilecache)[8][8];
+static byte tilevalid[TILECACHE_TILES];
+static unsigned tilecache_hits, tilecache_misses;
+
+static void tilecache_init()
+{
+	if (tilecache) return;
+	tilecache = heap_caps_malloc(TILECACHE_TILES * 64, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (!tilecache)
+		tilecache = heap_caps_malloc(TILECACHE_TILES * 64, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+	if (!tilecache)
+		printf("tilecache_init: not enough memory, patterns decoded on every fetch\n");
+}
+
+/* hit/miss counts since the last call */
+void tilecache_stats(unsigned *hits, unsigned *misses)
+{
+	*hits = tilecache_hits;
+	*misses = tilecache_misses;
+	tilecache_hits = tilecache_misses = 0;
+}
+
+__attribute__((optimize("unroll-loops")))
+static void IRAM_ATTR tilecache_decode(int slot, int index)
+{
+	int x, k, a;
+	const byte* const vram = lcd.vbank[0];
+	byte *dest = tilecache[slot][0];
+
+	a = index << 4;
+	for (x = 0; x < 8; x++, a += 2)
+		for (k = 0; k < 8; k++)
+			*(dest++) = ((vram[a] >> (7 - k)) & 1) | (((vram[a+1] >> (7 - k)) & 1) << 1);
+}
+#endif
+
 __attribute__((optimize("unroll-loops")))
 static const byte* IRAM_ATTR get_patpix(int i, int x)
 {
@@ -84,6 +131,29 @@ static const byte* IRAM_ATTR get_patpix(int i, int x)
 	int a, c;
 	const byte* const vram = lcd.vbank[0];
 
+#ifdef GNUBOY_TILE_CACHE
+	if (tilecache)
+	{
+		const int slot = (index & 0x1ff) + ((index & 0x200) ? 384 : 0);
+		const byte *row;
+
+		if (!tilevalid[slot])
+		{
+			tilecache_decode(slot, index);
+			tilevalid[slot] = 1;
+			tilecache_misses++;
+		}
+		else tilecache_hits++;
+
+		row = tilecache[slot][(rotation & 2) ? 7 - x : x];
+		if (!(rotation & 1)) return row;
+
+		for (j = 0; j < 8; j++)
+			pix[j] = row[7 - j];
+		return pix;
+	}
+#endif
+
 	switch (rotation)
 	{
 		case 0:
@@ -644,7 +714,6 @@ inline void lcd_begin()
 }
 
 
-extern int frame;
 extern uint16_t* displayBuffer[2];
 int lastLcdDisabled = 0;
 
@@ -652,9 +721,6 @@ void IRAM_ATTR lcd_refreshline()
 {
 	byte *dest;
 
-	if ((frame % 7) == 0) ++frame;
-
-
 	L = R_LY;
 	X = R_SCX;
 	Y = (R_SCY + L) & 0xff;
@@ -669,7 +735,8 @@ void IRAM_ATTR lcd_refreshline()
 	WT = (L - WY) >> 3;
 	WV = (L - WY) & 7;
 
-	if ((frame % 2) == 0)
+	/* nothing on the line is visible to the game, skip it when not displayed */
+	if (fb.enabled)
 	{
 		if (!(R_LCDC & 0x80))
 		{
@@ -782,11 +849,17 @@ inline void vram_write(int a, byte b)
 	{
 		lcd.vbank[R_VBK&1][a] = b;
 		if (a >= 0x1800) return;
+#ifdef GNUBOY_TILE_CACHE
+		tilevalid[((R_VBK&1) ? 384 : 0) + (a >> 4)] = 0;
+#endif
 	}
 }
 
 void vram_dirty()
 {
+#ifdef GNUBOY_TILE_CACHE
+	memset(tilevalid, 0, sizeof tilevalid);
+#endif
 }
 
 void pal_dirty()
@@ -811,6 +884,9 @@ void pal_dirty()
 void lcd_reset()
 {
 	memset(&lcd, 0, sizeof lcd);
+#ifdef GNUBOY_TILE_CACHE
+	tilecache_init();
+#endif
 
 	lcd_begin();
 	vram_dirty();
@@ -54,6 +54,9 @@ void pal_write_dmg(int i, int mapnum, byte d);
 void vram_write(int a, byte b);
 void pal_dirty();
 void vram_dirty();
+#ifdef GNUBOY_TILE_CACHE
+void tilecache_stats(unsigned *hits, unsigned *misses);
+#endif
 void lcd_reset();
 //void bg_scan_color();
 void updatepatpix();
@@ -82,6 +82,7 @@ void IRAM_ATTR lcdc_change(byte b)
 		stat_change(2);
 		C = 40;
 		lcd_begin();
+		cpu_event(CPU_STOP_VBLANK | CPU_STOP_FRAME);
 	}
 }
 
@@ -209,6 +210,7 @@ void IRAM_ATTR lcdc_trans()
 				C += 200;
 			}
 			R_LY++;
+			if (!R_LY) cpu_event(CPU_STOP_FRAME);
 			stat_trigger();
 			break;
 		case 2:
@@ -241,6 +243,7 @@ void IRAM_ATTR lcdc_trans()
 				}
 				else C += 10;
 				stat_change(1); /* -> vblank */
+				cpu_event(CPU_STOP_VBLANK);
 				break;
 			}
 			stat_change(2); /* -> search */
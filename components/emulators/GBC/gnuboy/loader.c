@@ -12,6 +12,9 @@
 #include "esp_timer.h"
 
 #include "sd_storage.h"
+#include "sd_cart.h"
+#include "sd_save.h"
+#include "sd_slots.h"
 #include "system_manager.h"
 #include "esp_log.h"
 
@@ -137,15 +140,14 @@ bool gbc_rom_load(const char *game_name, uint8_t console){
 
 	char * data = NULL; //Pointer to the memory region where the game will be saved.
 
-	if(game_size > 3*1024*1024){
+	if(game_size > SD_CART_SIZE_MAX){
 		ESP_LOGW(TAG,"Loading game on flash memory, this process could take several minutes.");
 		data = sd_get_file_flash(rom_name);
 	}
 	else{
-		//Allocate the size of the game.
 		ESP_LOGW(TAG,"Loading game on RAM memory");
-		data = malloc(game_size);
-		sd_get_file(rom_name,data);
+		data = (char *)sd_cart_load(rom_name, &game_size, 0);
+		if(data == NULL) return false;
 	}
 
 
@@ -334,18 +336,17 @@ int gbc_sram_save()
 }
 
 
-bool gbc_state_save(const char *game_name, uint8_t console){
+bool gbc_state_save(const char *game_name, uint8_t console, uint8_t slot){
 	char rom_name[300];
-	if(console == GAMEBOY) sprintf(rom_name,"/sdcard/GameBoy/Save_Data/%s.sav",game_name);
-	else{
-		sprintf(rom_name,"/sdcard/GameBoy_Color/Save_Data/%s.sav",game_name);
-	}
+	if(!sd_slot_path(rom_name, sizeof(rom_name), console, game_name, slot)) return false;
 	
-	FILE *f = fopen(rom_name, "w");
+	// The state is serialized on the RAM, the save writer task puts it on the SD card
+	int size = savestate_size();
+	byte *buf = sd_save_alloc(size);
 	
-	if (f != NULL){
-		savestate(f);
-		fclose(f);
+	if (buf != NULL){
+		savestate(buf);
+		if (!sd_save_write(rom_name, buf, size)) return false;
 		ESP_LOGI(TAG,"%s SAVE.",game_name);
 		return true;
 	}
@@ -356,26 +357,31 @@ bool gbc_state_save(const char *game_name, uint8_t console){
 }
 
 
-bool gbc_state_load(const char *game_name, uint8_t console){
+/* loadstate, and the caches of the emulator rebuilt from the restored state */
+int gbc_state_restore(const byte *buf, int size){
+	if (loadstate(buf, size) != 0) return -1;
+
+	vram_dirty();
+	pal_dirty();
+	sound_dirty();
+	mem_updatemap();
+	return 0;
+}
+
+bool gbc_state_load(const char *game_name, uint8_t console, uint8_t slot){
 	char rom_name[300];
-	if(console == GAMEBOY) sprintf(rom_name,"/sdcard/GameBoy/Save_Data/%s.sav",game_name);
-	else{
-		sprintf(rom_name,"/sdcard/GameBoy_Color/Save_Data/%s.sav",game_name);
-	}
+	if(!sd_slot_path(rom_name, sizeof(rom_name), console, game_name, slot)) return false;
 	
-	FILE *f = fopen(rom_name, "r");
-
-	if (f != NULL){
-		loadstate(f);
-		fclose(f);
-		vram_dirty();
-		pal_dirty();
-		sound_dirty();
-		mem_updatemap();
+	size_t size = 0;
+	byte *buf = sd_save_read(rom_name, &size);
+
+	if (buf != NULL && gbc_state_restore(buf, size) == 0){
+		free(buf);
 		ESP_LOGI(TAG,"%s LOAD.",game_name);
 		return true;
 	}
 	else{
+		free(buf);
 		ESP_LOGE(TAG,"Fail to load save data.");
 		return false;
 	}
@@ -17,8 +17,9 @@ extern loader_t loader;
 bool gbc_rom_load(const char *game_name, uint8_t console);
 int gbc_sram_load();
 int gbc_sram_save();
-bool gbc_state_load(const char *game_name, uint8_t console);
-bool gbc_state_save(const char *game_name, uint8_t console);
+bool gbc_state_load(const char *game_name, uint8_t console, uint8_t slot);
+bool gbc_state_save(const char *game_name, uint8_t console, uint8_t slot);
+int gbc_state_restore(const unsigned char *buf, int size);
 
 
 
@@ -7,12 +7,14 @@
 #include "hw.h"
 #include "regs.h"
 #include "mem.h"
+#include "cpu.h"
 #include "rtc.h"
 #include "lcd.h"
 #include "sound.h"
 
 #include "esp_partition.h"
 #include "esp_attr.h"
+#include "soc/soc_memory_layout.h"
 
 struct mbc mbc;
 struct rom rom;
@@ -53,62 +55,47 @@ void IRAM_ATTR mem_updatemap()
 		map[0x4] = map[0x5] = map[0x6] = map[0x7] = NULL;
 	}
 
-	//if (0 && (R_STAT & 0x03) == 0x03)
-	//{
-	map[0x8] = NULL;
-	map[0x9] = NULL;
-	//}
-	//else
-	//{
-		// map[0x8] = lcd.vbank[R_VBK & 1] - 0x8000;
-		// map[0x9] = lcd.vbank[R_VBK & 1] - 0x8000;
-	//}
-
-	// if (mbc.enableram && !(rtc.sel&8))
-	// {
-	//  	map[0xA] = ram.sbank[mbc.rambank] - 0xA000;
-	//  	map[0xB] = ram.sbank[mbc.rambank] - 0xA000;
-	// }
-	//  else
-	// {
-	map[0xA] = map[0xB] = NULL;
-	//}
-
-#if 1
+	/* vram of the selected bank, lcd reads it straight from lcd.vbank */
+	map[0x8] = lcd.vbank[R_VBK & 1] - 0x8000;
+	map[0x9] = lcd.vbank[R_VBK & 1] - 0x8000;
+
+	/* sram is only mapped while enabled, not showing rtc registers and
+	   not in psram (psram accesses keep the memw barriers of mem_read) */
+	if (mbc.enableram && !(rtc.sel&8) && mbc.rambank < mbc.ramsize
+		&& ram.sbank && !esp_ptr_external_ram(ram.sbank))
+	{
+		map[0xA] = ram.sbank[mbc.rambank] - 0xA000;
+		map[0xB] = ram.sbank[mbc.rambank] - 0xA000;
+	}
+	else
+	{
+		map[0xA] = map[0xB] = NULL;
+	}
+
 	map[0xC] = ram.ibank[0] - 0xC000;
 	n = R_SVBK & 0x07;
 	map[0xD] = ram.ibank[n?n:1] - 0xD000;
 	map[0xE] = ram.ibank[0] - 0xE000;
 	map[0xF] = NULL;
-#else
-	map[0xC] = NULL;
-	map[0xD] = NULL;
-	map[0xE] = NULL;
-	map[0xF] = NULL;
-#endif
 
-#if 0
 	map = mbc.wmap;
 	map[0x0] = map[0x1] = map[0x2] = map[0x3] = NULL;
 	map[0x4] = map[0x5] = map[0x6] = map[0x7] = NULL;
+#ifdef GNUBOY_TILE_CACHE
+	/* tile data writes go through vram_write() to invalidate the tile cache */
 	map[0x8] = map[0x9] = NULL;
-
-	// if (mbc.enableram && !(rtc.sel&8))
-	// {
-	// 	map[0xA] = ram.sbank[mbc.rambank] - 0xA000;
-	// 	map[0xB] = ram.sbank[mbc.rambank] - 0xA000;
-	// }
-	// else
-	// {
-	// 	map[0xA] = map[0xB] = NULL;
-	// }
-
-	map[0xC] = ram.ibank[0] - 0xC000;
-	n = R_SVBK & 0x07;
-	map[0xD] = ram.ibank[n?n:1] - 0xD000;
-	map[0xE] = ram.ibank[0] - 0xE000;
-	map[0xF] = NULL;
+#else
+	map[0x8] = mbc.rmap[0x8];
+	map[0x9] = mbc.rmap[0x9];
 #endif
+	map[0xA] = mbc.rmap[0xA];
+	map[0xB] = mbc.rmap[0xB];
+	/* writes through the map can't flag sram, assume it changes while enabled */
+	if (map[0xA]) ram.sram_dirty = 1;
+	map[0xC] = mbc.rmap[0xC];
+	map[0xD] = mbc.rmap[0xD];
+	map[0xE] = mbc.rmap[0xE];
+	map[0xF] = NULL;
 }
 
 
@@ -544,17 +531,18 @@ void IRAM_ATTR mem_write(int a, byte b)
 			break;
 		}
 		/* return writehi(a & 0xFF, b); */
-		if (a >= 0xFF10 && a <= 0xFF3F)
-		{
-			sound_write(a & 0xFF, b);
-			break;
-		}
 		if ((a & 0xFF80) == 0xFF80 && a != 0xFFFF)
 		{
 			ram.hi[a & 0xFF] = b;
 			break;
 		}
-		ioreg_write(a & 0xFF, b);
+		/* io registers see the system up to date, and may move the next event */
+		cpu_sync();
+		if (a >= 0xFF10 && a <= 0xFF3F)
+			sound_write(a & 0xFF, b);
+		else
+			ioreg_write(a & 0xFF, b);
+		cpu_sync();
 	}
 }
 
@@ -617,10 +605,11 @@ byte IRAM_ATTR mem_read(int a)
 		}
 		/* return readhi(a & 0xFF); */
 		if (a == 0xFFFF) return REG(0xFF);
-		if (a >= 0xFF10 && a <= 0xFF3F)
-			return sound_read(a & 0xFF);
 		if ((a & 0xFF80) == 0xFF80)
 			return ram.hi[a & 0xFF];
+		cpu_sync();
+		if (a >= 0xFF10 && a <= 0xFF3F)
+			return sound_read(a & 0xFF);
 		return ioreg_read(a & 0xFF);
 	}
 	return 0xff; /* not reached */
@@ -152,25 +152,29 @@ struct svar svars[] =
 	END
 };
 
-//byte buf[4096];
+/* The state is a 4096 bytes header block followed by the internal RAM,
+ * the video RAM and the cartridge RAM, each one aligned to a block. */
+int savestate_size()
+{
+	int irl = hw.cgb ? 8 : 2;
+	int vrl = hw.cgb ? 4 : 2;
+	int srl = mbc.ramsize << 1;
 
-void loadstate(FILE *f)
+	return (1+irl+vrl+srl) << 12;
+}
+
+int loadstate(const byte *buf, int size)
 {
 	int i, j;
-	//byte buf[4096];
-	byte* buf = malloc(4096);
-	if (!buf) abort();
-
-	un32 (*header)[2] = (un32 (*)[2])buf;
+	const un32 (*header)[2] = (const un32 (*)[2])buf;
 	un32 d;
 	int irl = hw.cgb ? 8 : 2;
 	int vrl = hw.cgb ? 4 : 2;
 	int srl = mbc.ramsize << 1;
 
-	ver = hramofs = hiofs = palofs = oamofs = wavofs = 0;
+	if (size < (1+irl+vrl) << 12) return -1;
 
-	fseek(f, 0, SEEK_SET);
-	fread(buf, 4096, 1, f);
+	ver = hramofs = hiofs = palofs = oamofs = wavofs = 0;
 
 	for (j = 0; header[j][0]; j++)
 	{
@@ -209,43 +213,24 @@ void loadstate(FILE *f)
 	vramblock = 1+irl;
 	sramblock = 1+irl+vrl;
 
-	fseek(f, iramblock<<12, SEEK_SET);
-	fread(ram.ibank, 4096, irl, f);
-
-	fseek(f, vramblock<<12, SEEK_SET);
-	fread(lcd.vbank, 4096, vrl, f);
-
-	fseek(f, sramblock<<12, SEEK_SET);
-
+	memcpy(ram.ibank, buf+(iramblock<<12), irl<<12);
+	memcpy(lcd.vbank, buf+(vramblock<<12), vrl<<12);
 
-	__asm__("nop");
-	__asm__("nop");
-	__asm__("nop");
-	__asm__("nop");
-	__asm__("memw");
-	size_t count = fread(ram.sbank, 4096, srl, f);
-	__asm__("nop");
-	__asm__("nop");
-	__asm__("nop");
-	__asm__("nop");
-	__asm__("memw");
-
-	printf("loadstate: read sram addr=%p, size=0x%x, count=%d\n", (void*)ram.sbank, 4096 * srl, count);
-
-	//byte* ptr = (byte*)(0x3f800000 + 0x300000 + (0xbe7a & 0x1fff));
-	//printf("loadstate: watch = 0x%x, 0x%x, 0x%x, 0x%x\n", *ptr, *(ptr+1), *(ptr+2), *(ptr+3));
+	/* a short cartridge RAM is loaded as far as it goes, like fread did */
+	if (size > sramblock<<12)
+	{
+		int len = size - (sramblock<<12);
+		if (len > srl<<12) len = srl<<12;
+		memcpy(ram.sbank, buf+(sramblock<<12), len);
+	}
 
-	free(buf);
+	return 0;
 }
 
 
-void savestate(FILE *f)
+int savestate(byte *buf)
 {
 	int i;
-	//byte buf[4096];
-	byte* buf = malloc(4096);
-	if (!buf) abort();
-
 	un32 (*header)[2] = (un32 (*)[2])buf;
 	un32 d = 0;
 	int irl = hw.cgb ? 8 : 2;
@@ -260,7 +245,7 @@ void savestate(FILE *f)
 	hiofs = 4096 - 768;
 	palofs = 4096 - 512;
 	oamofs = 4096 - 256;
-	memset(buf, 0, /*sizeof buf*/4096);
+	memset(buf, 0, 4096);
 
 	for (i = 0; svars[i].len > 0; i++)
 	{
@@ -286,40 +271,9 @@ void savestate(FILE *f)
 	memcpy(buf+oamofs, lcd.oam.mem, sizeof lcd.oam);
 	memcpy(buf+wavofs, snd.wave, sizeof snd.wave);
 
-	fseek(f, 0, SEEK_SET);
-	fwrite(buf, 4096, 1, f);
-
-	fseek(f, iramblock<<12, SEEK_SET);
-	fwrite(ram.ibank, 4096, irl, f);
-
-	fseek(f, vramblock<<12, SEEK_SET);
-	fwrite(lcd.vbank, 4096, vrl, f);
-
-	fseek(f, sramblock<<12, SEEK_SET);
-
-	//byte* ptr = (byte*)(0x3f800000 + 0x300000 + (0xbe7a & 0x1fff));
-	//printf("savesate: watch = 0x%x, 0x%x, 0x%x, 0x%x\n", *ptr, *(ptr+1), *(ptr+2), *(ptr+3));
-
-	byte* tmp = ram.sbank;
-	for (int j = 0; j < srl; ++j)
-	{
-		memcpy(buf, (void*)tmp, 4096);
-
-		__asm__("nop");
-		__asm__("nop");
-		__asm__("nop");
-		__asm__("nop");
-		__asm__("memw");
-		size_t count = fwrite(buf, 4096, 1, f);
-		__asm__("nop");
-		__asm__("nop");
-		__asm__("nop");
-		__asm__("nop");
-		__asm__("memw");
-
-		printf("savesate: wrote sram addr=%p, size=0x%x, count=%d\n", (void*)tmp, 4096, count);
-		tmp += 4096;
-	}
+	memcpy(buf+(iramblock<<12), ram.ibank, irl<<12);
+	memcpy(buf+(vramblock<<12), lcd.vbank, vrl<<12);
+	memcpy(buf+(sramblock<<12), ram.sbank, srl<<12);
 
-	free(buf);
+	return (1+irl+vrl+srl) << 12;
 }
@@ -11,6 +11,9 @@
 #include "regs.h"
 #include "rc.h"
 #include "noise.h"
+#ifdef GNUBOY_BLIP_SOUND
+#include "blip.h"
+#endif
 
 #include <esp_attr.h>
 #include "freertos/FreeRTOS.h"
@@ -65,6 +68,33 @@ rcvar_t sound_exports[] =
 	RCV_END
 };
 
+#ifdef GNUBOY_BLIP_SOUND
+/*
+	Band-limited backend: instead of stepping the channels once per
+	output sample, every channel is run from edge to edge and each
+	change of its output level is recorded as a delta in a blip
+	buffer, timestamped in 2MHz units since the start of the frame.
+	sound_write() catches up to the current cpu time before touching
+	a register, so writes take effect at the cycle they happen.
+*/
+
+struct blipchan
+{
+	int phase;
+	int delay;
+	int l, r;
+};
+
+static struct blipchan bch[4];
+static struct blip blip_l, blip_r;
+static unsigned blip_now;
+
+static void sound_update();
+#define sound_catchup() sound_update()
+#else
+#define sound_catchup() sound_mix()
+#endif
+
 
 inline static void s1_freq_d(int d)
 {
@@ -99,6 +129,9 @@ inline static void s4_freq()
 
 void sound_dirty()
 {
+#ifdef GNUBOY_BLIP_SOUND
+	int i;
+#endif
 	S1.swlen = ((R_NR10>>4) & 7) << 14;
 	S1.len = (64-(R_NR11&63)) << 13;
 	S1.envol = R_NR12 >> 4;
@@ -120,6 +153,10 @@ void sound_dirty()
 	S4.endir |= S4.endir - 1;
 	S4.enlen = (R_NR42 & 7) << 15;
 	s4_freq();
+#ifdef GNUBOY_BLIP_SOUND
+	for (i = 0; i < 4; i++)
+		bch[i].phase = bch[i].delay = 0;
+#endif
 }
 
 void sound_off()
@@ -154,12 +191,263 @@ void gbc_sound_reset()
 	memset(&snd, 0, sizeof snd);
 	if (pcm.hz) snd.rate = (1<<21) / pcm.hz;//(1<<21) / pcm.hz;
 	else snd.rate = 0;
+#ifdef GNUBOY_BLIP_SOUND
+	if (pcm.hz && pcm.len)
+	{
+		blip_init(&blip_l, 1<<21, pcm.hz, pcm.len >> pcm.stereo);
+		if (pcm.stereo) blip_init(&blip_r, 1<<21, pcm.hz, pcm.len >> 1);
+	}
+	memset(bch, 0, sizeof bch);
+	blip_clear(&blip_l);
+	blip_clear(&blip_r);
+	blip_now = 0;
+#endif
 	memcpy(WAVE, hw.cgb ? cgbwave : dmgwave, 16);
 	memcpy(ram.hi+0x30, WAVE, 16);
 	sound_off();
 	R_NR52 = 0xF1;
 }
 
+#ifdef GNUBOY_BLIP_SOUND
+
+static void blip_level(int ch, unsigned t, int s)
+{
+	struct blipchan *b = &bch[ch];
+	int l = 0, r = 0;
+
+	if (R_NR51 & (16 << ch)) l = (s * (R_NR50 & 0x07)) << 4;
+	if (R_NR51 & (1 << ch)) r = (s * ((R_NR50 & 0x70)>>4)) << 4;
+	if (!pcm.stereo)
+	{
+		l = (l + r) >> 1;
+		r = 0;
+	}
+
+	if (l != b->l)
+	{
+		blip_add_delta(&blip_l, t, l - b->l);
+		b->l = l;
+	}
+	if (r != b->r)
+	{
+		blip_add_delta(&blip_r, t, r - b->r);
+		b->r = r;
+	}
+}
+
+static inline int s3_sample(int phase)
+{
+	int s = WAVE[phase >> 1];
+	if (phase & 1) s &= 15;
+	else s >>= 4;
+	s -= 8;
+	if (R_NR32 & 96) s <<= (3 - ((R_NR32>>5)&3));
+	else s = 0;
+	return s;
+}
+
+static inline int s4_sample(int phase)
+{
+	int s;
+	if (R_NR43 & 8) s = 1 & (noise7[(phase>>3)&15] >> (7-(phase&7)));
+	else s = 1 & (noise15[(phase>>3)&4095] >> (7-(phase&7)));
+	s = (-s) & S4.envol;
+	return s + (s << 1);
+}
+
+/* current output level of every channel at time t */
+static void blip_levels(unsigned t)
+{
+	blip_level(0, t, S1.on ? (sqwave[R_NR11>>6][bch[0].phase] & S1.envol) << 2 : 0);
+	blip_level(1, t, S2.on ? (sqwave[R_NR21>>6][bch[1].phase] & S2.envol) << 2 : 0);
+	blip_level(2, t, S3.on ? s3_sample(bch[2].phase) : 0);
+	blip_level(3, t, S4.on ? s4_sample(bch[3].phase) : 0);
+}
+
+/* emit the duty steps of a square channel over the next n units */
+static void blip_square(int ch, struct sndchan *c, int duty, int n)
+{
+	struct blipchan *b = &bch[ch];
+	int d = 2048 - (((REG(RI_NR14 + 5*ch)&7)<<8) + REG(RI_NR13 + 5*ch));
+	int t;
+
+	/* above what the output rate can carry, hold the level */
+	if (!c->on || RATE > (d<<4)) return;
+
+	for (t = b->delay; t < n; t += d << 1)
+	{
+		b->phase = (b->phase + 1) & 7;
+		blip_level(ch, blip_now + t, (sqwave[duty][b->phase] & c->envol) << 2);
+	}
+	b->delay = t - n;
+}
+
+static void blip_wave(int n)
+{
+	struct blipchan *b = &bch[2];
+	int d = 2048 - (((R_NR34&7)<<8) + R_NR33);
+	int t;
+
+	if (!S3.on || RATE > (d<<3)) return;
+
+	for (t = b->delay; t < n; t += d)
+	{
+		b->phase = (b->phase + 1) & 31;
+		blip_level(2, blip_now + t, s3_sample(b->phase));
+	}
+	b->delay = t - n;
+}
+
+static void blip_noise(int n)
+{
+	struct blipchan *b = &bch[3];
+	int r = R_NR43 & 7;
+	int d = (r ? r << 3 : 4) << (R_NR43 >> 4);
+	int mask = (R_NR43 & 8) ? 127 : 32767;
+	int t;
+
+	if (!S4.on) return;
+
+	/* no more than two shifts per output sample, like the mixer */
+	if (d < (RATE >> 1)) d = RATE >> 1;
+	if (d < 1) d = 1;
+
+	for (t = b->delay; t < n; t += d)
+	{
+		b->phase = (b->phase + 1) & mask;
+		blip_level(3, blip_now + t, s4_sample(b->phase));
+	}
+	b->delay = t - n;
+}
+
+static inline int blip_until(int len, int cnt, int n)
+{
+	len -= cnt;
+	if (len < 1) len = 1;
+	return len < n ? len : n;
+}
+
+static inline void blip_envelope(struct sndchan *c, int n)
+{
+	if (c->enlen && (c->encnt += n) >= c->enlen)
+	{
+		c->encnt -= c->enlen;
+		c->envol += c->endir;
+		if (c->envol < 0) c->envol = 0;
+		if (c->envol > 15) c->envol = 15;
+	}
+}
+
+/*
+	Run the channels up to the current cpu time. Time is split at
+	every length/envelope/sweep event so that between two events the
+	channel parameters are constant and only waveform edges are left.
+*/
+static void IRAM_ATTR sound_update()
+{
+	int cnt, n, f, sh;
+
+	cnt = cpu.snd;
+	cpu.snd = 0;
+	if (!RATE) return;
+
+	while (cnt > 0)
+	{
+		n = cnt;
+		if (S1.on)
+		{
+			if (R_NR14 & 64) n = blip_until(S1.len, S1.cnt, n);
+			if (S1.enlen) n = blip_until(S1.enlen, S1.encnt, n);
+			if (S1.swlen) n = blip_until(S1.swlen, S1.swcnt, n);
+		}
+		if (S2.on)
+		{
+			if (R_NR24 & 64) n = blip_until(S2.len, S2.cnt, n);
+			if (S2.enlen) n = blip_until(S2.enlen, S2.encnt, n);
+		}
+		if (S3.on && (R_NR34 & 64)) n = blip_until(S3.len, S3.cnt, n);
+		if (S4.on)
+		{
+			if (R_NR44 & 64) n = blip_until(S4.len, S4.cnt, n);
+			if (S4.enlen) n = blip_until(S4.enlen, S4.encnt, n);
+		}
+
+		blip_square(0, &S1, R_NR11>>6, n);
+		blip_square(1, &S2, R_NR21>>6, n);
+		blip_wave(n);
+		blip_noise(n);
+
+		blip_now += n;
+		cnt -= n;
+
+		if (S1.on)
+		{
+			if ((R_NR14 & 64) && ((S1.cnt += n) >= S1.len))
+				S1.on = 0;
+			blip_envelope(&S1, n);
+			if (S1.swlen && (S1.swcnt += n) >= S1.swlen)
+			{
+				S1.swcnt -= S1.swlen;
+				f = S1.swfreq;
+				sh = (R_NR10 & 7);
+				if (R_NR10 & 8) f -= (f >> sh);
+				else f += (f >> sh);
+				if (f > 2047)
+					S1.on = 0;
+				else
+				{
+					S1.swfreq = f;
+					R_NR13 = f;
+					R_NR14 = (R_NR14 & 0xF8) | (f>>8);
+					s1_freq_d(2048 - f);
+				}
+			}
+		}
+		if (S2.on)
+		{
+			if ((R_NR24 & 64) && ((S2.cnt += n) >= S2.len))
+				S2.on = 0;
+			blip_envelope(&S2, n);
+		}
+		if (S3.on && (R_NR34 & 64) && ((S3.cnt += n) >= S3.len))
+			S3.on = 0;
+		if (S4.on)
+		{
+			if ((R_NR44 & 64) && ((S4.cnt += n) >= S4.len))
+				S4.on = 0;
+			blip_envelope(&S4, n);
+		}
+
+		blip_levels(blip_now);
+	}
+	R_NR52 = (R_NR52&0xf0) | S1.on | (S2.on<<1) | (S3.on<<2) | (S4.on<<3);
+}
+
+/* End of frame: turn the deltas recorded so far into pcm samples */
+void IRAM_ATTR sound_mix()
+{
+	int max, n;
+
+	if (!RATE) return;
+
+	sound_update();
+
+	if (pcm.buf)
+	{
+		max = (pcm.len - pcm.pos) >> pcm.stereo;
+		n = blip_read(&blip_l, blip_now, pcm.buf + pcm.pos, max, pcm.stereo + 1);
+		if (pcm.stereo) blip_read(&blip_r, blip_now, pcm.buf + pcm.pos + 1, max, 2);
+		pcm.pos += n << pcm.stereo;
+	}
+	else
+	{
+		blip_read(&blip_l, blip_now, NULL, 0, 1);
+		blip_read(&blip_r, blip_now, NULL, 0, 2);
+	}
+	blip_now = 0;
+}
+
+#else
 
 void IRAM_ATTR sound_mix()
 {
@@ -293,11 +581,12 @@ void IRAM_ATTR sound_mix()
 	R_NR52 = (R_NR52&0xf0) | S1.on | (S2.on<<1) | (S3.on<<2) | (S4.on<<3);
 }
 
+#endif /* GNUBOY_BLIP_SOUND */
 
 
 byte sound_read(byte r)
 {
-	sound_mix();
+	sound_catchup();
 	/* printf("read %02X: %02X\n", r, REG(r)); */
 	return REG(r);
 }
@@ -310,7 +599,14 @@ void s1_init()
 	S1.endir = (R_NR12>>3) & 1;
 	S1.endir |= S1.endir - 1;
 	S1.enlen = (R_NR12 & 7) << 15;
-	if (!S1.on) S1.pos = 0;
+	if (!S1.on)
+	{
+		S1.pos = 0;
+#ifdef GNUBOY_BLIP_SOUND
+		bch[0].phase = 0;
+		bch[0].delay = 0;
+#endif
+	}
 	S1.on = 1;
 	S1.cnt = 0;
 	S1.encnt = 0;
@@ -322,7 +618,14 @@ void s2_init()
 	S2.endir = (R_NR22>>3) & 1;
 	S2.endir |= S2.endir - 1;
 	S2.enlen = (R_NR22 & 7) << 15;
-	if (!S2.on) S2.pos = 0;
+	if (!S2.on)
+	{
+		S2.pos = 0;
+#ifdef GNUBOY_BLIP_SOUND
+		bch[1].phase = 0;
+		bch[1].delay = 0;
+#endif
+	}
 	S2.on = 1;
 	S2.cnt = 0;
 	S2.encnt = 0;
@@ -331,7 +634,14 @@ void s2_init()
 void s3_init()
 {
 	int i;
-	if (!S3.on) S3.pos = 0;
+	if (!S3.on)
+	{
+		S3.pos = 0;
+#ifdef GNUBOY_BLIP_SOUND
+		bch[2].phase = 0;
+		bch[2].delay = 0;
+#endif
+	}
 	S3.cnt = 0;
 	S3.on = R_NR30 >> 7;
 	if (S3.on) for (i = 0; i < 16; i++)
@@ -346,6 +656,10 @@ void s4_init()
 	S4.enlen = (R_NR42 & 7) << 15;
 	S4.on = 1;
 	S4.pos = 0;
+#ifdef GNUBOY_BLIP_SOUND
+	bch[3].phase = 0;
+	bch[3].delay = 0;
+#endif
 	S4.cnt = 0;
 	S4.encnt = 0;
 }
@@ -362,12 +676,12 @@ void IRAM_ATTR sound_write(byte r, byte b)
 	if (!(R_NR52 & 128) && r != RI_NR52) return;
 	if ((r & 0xF0) == 0x30)
 	{
-		if (S3.on) sound_mix();
+		if (S3.on) sound_catchup();
 		if (!S3.on)
 			WAVE[r-0x30] = ram.hi[r] = b;
 		return;
 	}
-	sound_mix();
+	sound_catchup();
 	switch (r)
 	{
 	case RI_NR10:
@@ -468,4 +782,7 @@ void IRAM_ATTR sound_write(byte r, byte b)
 	default:
 		return;
 	}
+#ifdef GNUBOY_BLIP_SOUND
+	blip_levels(blip_now);
+#endif
 }
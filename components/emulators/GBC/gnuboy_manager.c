@@ -9,13 +9,17 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #include "user_input.h"
 #include "display_HAL.h"
 #include "system_configuration.h"
 #include "system_manager.h"
 #include "sound_driver.h"
+#include "sd_slots.h"
+#include "rewind.h"
 
 // GNUBoy libraries
 
@@ -38,6 +42,10 @@ static void run_to_vblank();
 static void videoTask(void *arg);
 static void gnuBoyTask(void *arg);
 static void input_set();
+static void fast_forward_speed();
+static bool save_state(uint8_t slot);
+static size_t rewind_save(uint8_t *state);
+static int rewind_load(const uint8_t *state, size_t size);
 
 /**********************
  *  TASK HANDLERS
@@ -72,7 +80,21 @@ uint elapsedTime = 0;
 
 volatile bool videoTaskIsRunning = false;
 
-bool load_save_game = false;
+uint8_t load_save_game = GAME_LOAD_NONE;
+
+// Slot to restore at the start of the next frame, -1 if none
+static volatile int8_t load_slot = -1;
+
+// Slot to save at the start of the next frame, -1 if none. The task which asks for it waits on save_done.
+static volatile int8_t save_slot = -1;
+static volatile bool save_ok = false;
+static SemaphoreHandle_t save_done = NULL;
+
+// The L button is held, the game goes back through the rewind history
+static bool rewind_held = false;
+
+// The R button is held, the game runs unthrottled drawing one of each FAST_FORWARD_FRAMES
+static bool fast_forward = false;
 
 
 ////////////////////////////////////////////////
@@ -88,6 +110,12 @@ bool button_ss_gb = false; //Variable to save if we want to use state save/load
 
 #define AUDIO_SAMPLE_RATE (32000)
 
+#define FAST_FORWARD_FRAMES 4
+#define FAST_FORWARD_REPORT 60      // Frames between the updates of the speed shown
+#define GBC_FRAME_US        16742   // 70224 cycles at 4.19 MHz
+#define AUDIO_WAIT_MS       20      // Longest wait for the audio task before checking the save requests
+#define STATE_TIMEOUT       2000    // ms to wait the emulator to reach the end of a frame
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -97,6 +125,7 @@ void gnuboy_start(){
     // Queue creation
     vidQueue = xQueueCreate(7, sizeof(uint16_t *));
     audioQueue = xQueueCreate(1, sizeof(uint16_t *));
+    if(save_done == NULL) save_done = xSemaphoreCreateBinary();
 
     button_ss_gb = system_get_config(SYS_STATE_SAV_BTN);
 
@@ -122,16 +151,36 @@ void gnuboy_suspend(){
 }
 
 /** 
- * TODO: Improve game save.
- * Basically it works, but when you try to save every 30 seconds, the SD card crashed so, it corrupt 
- * the file save. On the other hand I notice that some texture dissapear when the game is saved.
+ * The state is written by the save writer task on a new file with a CRC, which replaces the old one
+ * once it's complete, so a crash of the SD card while saving doesn't corrupt the previous save.
+ * TODO: I notice that some texture dissapear when the game is saved.
  * */
 
-void gnuboy_save(){
-    gbc_state_save(game_name, console_use);
+bool gnuboy_save(uint8_t slot){
+    // The emulator saves between frames, a suspended one runs until there and is suspended again
+    bool suspended = eTaskGetState(gnuBoyTask_handler) == eSuspended;
+
+    xSemaphoreTake(save_done, 0);
+    save_ok = false;
+    save_slot = slot;
+
+    if(suspended) vTaskResume(gnuBoyTask_handler);
+    bool done = xSemaphoreTake(save_done, STATE_TIMEOUT / portTICK_RATE_MS) == pdTRUE;
+    if(suspended) vTaskSuspend(gnuBoyTask_handler);
+
+    if(!done){
+        save_slot = -1;
+        ESP_LOGE(TAG, "GNUBoy didn't reach the end of a frame, slot %d not saved", slot);
+        return false;
+    }
+    return save_ok;
 }
 
-bool gnuboy_execute_game(const char *name, uint8_t console, bool load ){
+void gnuboy_load(uint8_t slot){
+    load_slot = slot;
+}
+
+bool gnuboy_execute_game(const char *name, uint8_t console, uint8_t load ){
 
     ESP_LOGI(TAG,"Loading GameBoy Color game: %s",name);
 
@@ -288,9 +337,12 @@ static void gnuBoyTask(void *arg){
     lcd_begin();
 
     //Load SRAM save data to perform state save.
-    if(load_save_game){
-         if(!gbc_state_load(game_name,console_use)) ESP_LOGW(TAG,"Error loading save game, starting new save game.");
+    if(load_save_game != GAME_LOAD_NONE){
+         uint8_t slot = (load_save_game == GAME_LOAD_RESUME) ? SD_SLOT_RESUME : sd_slot_latest(console_use,game_name);
+         if(!gbc_state_load(game_name,console_use,slot)) ESP_LOGW(TAG,"Error loading save game, starting new save game.");
     }
+
+    rewind_init(savestate_size());
    
     //Variables to get an aprox FPS count of the game
     uint startTime;
@@ -300,13 +352,30 @@ static void gnuBoyTask(void *arg){
 
     //TODO: This loop needs to be improved.
     while(1){
+        // The state is saved and restored between frames, the menu may have suspended the task in the middle of one
+        if(save_slot >= 0){
+            save_ok = save_state(save_slot);
+            save_slot = -1;
+            xSemaphoreGive(save_done);
+        }
+
+        if(load_slot >= 0){
+            if(!gbc_state_load(game_name, console_use, load_slot)) ESP_LOGE(TAG,"Error loading slot %d", load_slot);
+            load_slot = -1;
+        }
+
+        if(rewind_held) rewind_step(rewind_load);
+
         startTime = xthal_get_ccount();
         //Render a frame with audio
         run_to_vblank();
         stopTime = xthal_get_ccount();
 
+        if(!rewind_held) rewind_frame(rewind_save);
+
         //Get the status of the input buttons
         input_set();
+        fast_forward_speed();
 
         if (stopTime > startTime) elapsedTime = (stopTime - startTime);
         else elapsedTime = ((uint64_t)stopTime + (uint64_t)0xffffffff) - (startTime);
@@ -320,6 +389,11 @@ static void gnuBoyTask(void *arg){
             float fps = actualFrameCount / seconds;
 
             printf("FPS:%f\n", fps);
+#ifdef GNUBOY_TILE_CACHE
+            unsigned hits, misses;
+            tilecache_stats(&hits, &misses);
+            printf("Tile cache: %u hits, %u misses\n", hits, misses);
+#endif
 
             actualFrameCount = 0;
             totalElapsedTime = 0;
@@ -332,12 +406,21 @@ static void gnuBoyTask(void *arg){
 static void run_to_vblank(){
    //Frame and sound generation
 
+    // Render every other frame, shifting the phase every 7 frames so games
+    // that flicker sprites on alternate frames don't lose them for good
+    if (fast_forward) fb.enabled = (frame % FAST_FORWARD_FRAMES) == 0;
+    else{
+        if ((frame % 7) == 0) ++frame;
+        fb.enabled = (frame % 2) == 0;
+    }
+
     cpu_emulate(32832);
 
-    while (R_LY > 0 && R_LY < 144) emu_step(); // Step through visible line scanning phase 
+    // Run the rest of the visible lines in one batch, up to the start of vblank
+    if (R_LY > 0 && R_LY < 144) cpu_emulate_until(CPU_STOP_VBLANK, 35112);
 
     //Yes, skipframe.
-    if ((frame % 2) == 0)
+    if (fb.enabled)
     {
         xQueueSend(vidQueue, &framebuffer, 0);
 
@@ -357,17 +440,25 @@ static void run_to_vblank(){
         currentAudioBufferPtr = audioBuffer[currentAudioBuffer];
         currentAudioSampleCount = pcm.pos;
 
-        xQueueSend(audioQueue, &currentAudioBufferPtr, portMAX_DELAY);
-
-        // Swap buffers
-        currentAudioBuffer = currentAudioBuffer ? 0 : 1;
-        pcm.buf = audioBuffer[currentAudioBuffer];
+        // The audio task paces the emulator, except while fast forwarding. Then the buffer is
+        // dropped if the last one is still playing, and filled again on the next frame.
+        // A save asked while the audio task is suspended ends the wait, the frame is finished without it.
+        BaseType_t sent;
+        do sent = xQueueSend(audioQueue, &currentAudioBufferPtr, fast_forward ? 0 : AUDIO_WAIT_MS / portTICK_RATE_MS);
+        while (sent != pdPASS && !fast_forward && save_slot < 0);
+
+        if (sent == pdPASS){
+            // Swap buffers
+            currentAudioBuffer = currentAudioBuffer ? 0 : 1;
+            pcm.buf = audioBuffer[currentAudioBuffer];
+        }
         pcm.pos = 0;
     }
 
     if (!(R_LCDC & 0x80)) cpu_emulate(32832);
 
-    while (R_LY > 0) emu_step(); // Step through vblank phase 
+    // Run through the vblank phase in one batch, up to line 0 of the next frame
+    if (R_LY > 0) cpu_emulate_until(CPU_STOP_FRAME, 35112);
  
 }
 
@@ -385,8 +476,50 @@ static void input_set(){
     pad_set(PAD_SELECT,!((inputs_value >> 12) & 0x01));
 
     //Special function to instant load/save progress pushing x and y buttons
-    if(!((inputs_value >> 6) & 0x01) && button_ss_gb) gbc_state_load(game_name,console_use);
-    if(!((inputs_value >> 7) & 0x01) && button_ss_gb) gnuboy_save();
+    if(!((inputs_value >> 6) & 0x01) && button_ss_gb) gbc_state_load(game_name,console_use,0);
+    if(!((inputs_value >> 7) & 0x01) && button_ss_gb) save_state(0);
+
+    rewind_held = !((inputs_value >> 13) & 0x01);
+    fast_forward = !((inputs_value >> 5) & 0x01);
+}
+
+// Emulated time against the real one, shown on the screen while fast forwarding
+static void fast_forward_speed(){
+    static bool measuring = false;
+    static int frames = 0;
+    static int64_t start = 0;
+
+    if(!fast_forward){
+        if(measuring) display_HAL_set_speed(0);
+        measuring = false;
+        return;
+    }
+
+    if(!measuring){
+        measuring = true;
+        frames = 0;
+        start = esp_timer_get_time();
+        return;
+    }
+
+    if(++frames == FAST_FORWARD_REPORT){
+        int64_t now = esp_timer_get_time();
+        display_HAL_set_speed(frames * GBC_FRAME_US * 10LL / (now - start));
+        frames = 0;
+        start = now;
+    }
+}
+
+static bool save_state(uint8_t slot){
+    if(!gbc_state_save(game_name, console_use, slot)) return false;
+    return sd_slot_saved(console_use, game_name, slot, display_HAL_thumbnail);
+}
+
+static size_t rewind_save(uint8_t *state){
+    return savestate(state);
+}
 
+static int rewind_load(const uint8_t *state, size_t size){
+    return gbc_state_restore(state, size);
 }
 
@@ -38,11 +38,29 @@ void gnuboy_suspend();
  * Function:  gnuboy_save 
  * --------------------
  * 
- * Save the progress of the game into a file on the SD card.
+ * Save the progress of the game on a slot of the SD card, with a thumbnail on the slot index.
+ * The emulator saves it at the end of the frame, a suspended emulator runs until there and is
+ * suspended again.
+ * 
+ * Arguments:
+ * -slot: Save slot, from 0 to SD_SLOT_NUM - 1.
+ * 
+ *  Returns: True if the state was queued to the save writer.
+ */
+bool gnuboy_save(uint8_t slot);
+
+/*
+ * Function:  gnuboy_load 
+ * --------------------
+ * 
+ * Restore the state of a slot. The emulator task loads it before its next frame.
+ * 
+ * Arguments:
+ * -slot: Save slot, from 0 to SD_SLOT_NUM - 1.
  * 
  *  Returns: Nothing
  */
-void gnuboy_save();
+void gnuboy_load(uint8_t slot);
 
 /*
  * Function:  gnuboy_load_game 
@@ -53,7 +71,8 @@ void gnuboy_save();
  * Arguments:
  * -name: Name of the game.
  * -console: Console to execute GAMEBOY_COLOR/GAMEBOY
+ * -load: State to restore, GAME_LOAD_NONE, GAME_LOAD_LATEST or GAME_LOAD_RESUME.
  * 
  *  Returns: Nothing
  */
-bool gnuboy_execute_game(const char *name, uint8_t console, bool load);
\ No newline at end of file
+bool gnuboy_execute_game(const char *name, uint8_t console, uint8_t load);
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
 
 #include "display_HAL.h"
 #include "NES_manager.h"
@@ -15,16 +17,32 @@ TaskHandle_t videoTask_handler;
 TaskHandle_t audioTask_handler;
 TaskHandle_t nofrendoTask_handler;
 
+#define NES_STATE_TIMEOUT   2000    // ms to wait the emulator to reach the end of a frame
+
+static const char *TAG = "NES_manager";
+
+// The GUI draws over the game while it's paused, the next frame is drawn whole
+static volatile bool nes_redraw = true;
+
+// nofrendo keeps the CPU registers on locals while it runs a frame, so the states are saved and
+// restored by the emulator task between frames. The other tasks leave the slot here and wait.
+static volatile int8_t load_slot = -1;
+static volatile int8_t save_slot = -1;
+static volatile bool state_ok = false;
+static SemaphoreHandle_t state_done = NULL;
+
 /*********Static definition of tasks**************/
 static void nofrendo_task(void *arg);
 static void nofrendo_video_task(void *arg);
 static void nofrendo_audio_task(void *arg);
+static bool state_request(volatile int8_t *request, uint8_t slot);
 
 void NES_start(const char *game_name){
     TaskHandle_t idle_0 = xTaskGetIdleTaskHandleForCPU(0);
     esp_task_wdt_delete(idle_0);
 
-    nofrendo_vidQueue = xQueueCreate(7, sizeof(bitmap_t *));
+    nofrendo_vidQueue = xQueueCreate(7, sizeof(struct nes_frame *));
+    if(state_done == NULL) state_done = xSemaphoreCreateBinary();
     //nofrendo_audioQueue = xQueueCreate(10, sizeof(int16_t *));
 
     xTaskCreatePinnedToCore(&nofrendo_video_task, "nofrendo_video_task", 2048, NULL, 1, &videoTask_handler, 0);
@@ -33,6 +51,7 @@ void NES_start(const char *game_name){
 }
 
 void NES_resume(){
+    nes_redraw = true;
     vTaskResume(videoTask_handler);
     //vTaskResume(audioTask_handler);
     vTaskResume(nofrendoTask_handler);
@@ -44,12 +63,53 @@ void NES_suspend(){
     //vTaskSuspend(audioTask_handler);
 }
 
-void NES_load_game(){
-    state_load();
+bool NES_load_game(uint8_t slot){
+    return state_request(&load_slot, slot);
+}
+
+bool NES_save_game(uint8_t slot){
+    return state_request(&save_slot, slot);
 }
 
-void NES_save_game(){
-    state_save();
+void NES_state_requests(){
+    int8_t slot;
+
+    if((slot = load_slot) >= 0){
+        state_setslot(slot);
+        state_ok = state_load() == 0;
+        load_slot = -1;
+        xSemaphoreGive(state_done);
+    }
+
+    if((slot = save_slot) >= 0){
+        state_setslot(slot);
+        state_ok = state_save() == 0;
+        save_slot = -1;
+        xSemaphoreGive(state_done);
+    }
+
+    // The save buttons of the game use the slot 0, like on the other emulators
+    state_setslot(0);
+}
+
+// A suspended emulator is resumed until it finishes the frame, and suspended again
+static bool state_request(volatile int8_t *request, uint8_t slot){
+    bool suspended = eTaskGetState(nofrendoTask_handler) == eSuspended;
+
+    xSemaphoreTake(state_done, 0);
+    state_ok = false;
+    *request = slot;
+
+    if(suspended) vTaskResume(nofrendoTask_handler);
+    bool done = xSemaphoreTake(state_done, NES_STATE_TIMEOUT / portTICK_RATE_MS) == pdTRUE;
+    if(suspended) vTaskSuspend(nofrendoTask_handler);
+
+    if(!done){
+        *request = -1;
+        ESP_LOGE(TAG, "The emulator didn't reach the end of a frame, slot %d not done", slot);
+        return false;
+    }
+    return state_ok;
 }
 
 
@@ -65,10 +125,15 @@ static void nofrendo_task(void *arg){
 }
 
 static void nofrendo_video_task(void *arg){
-    bitmap_t *bmp = NULL;
+    struct nes_frame *frame = NULL;
+    uint32_t lines[NES_DIRTY_WORDS];
 	while (1){
-		xQueueReceive(nofrendo_vidQueue, &bmp, portMAX_DELAY);
-        display_HAL_NES_frame((const uint8_t **)bmp->line[0]);
+		xQueueReceive(nofrendo_vidQueue, &frame, portMAX_DELAY);
+        NES_frame_lines(frame, lines);
+        bool redraw = nes_redraw;
+        nes_redraw = false;
+        display_HAL_NES_frame((const uint8_t *)frame->bmp->line[0], redraw ? NULL : lines);
+        xQueueSend(nofrendo_frameQueue, &frame, portMAX_DELAY);
 	}
 }
 
@@ -1,5 +1,18 @@
+#include <stdint.h>
+#include <stdbool.h>
 #include <freertos/queue.h>
 
+/*********************
+ *      DEFINES
+ *********************/
+#define NES_DIRTY_WORDS     ((240 + 31) / 32)   // One bit per line of the NES frame
+
+// Frame of the emulator pool, with the lines changed since the frame sent before it
+struct nes_frame{
+    struct bitmap_s *bmp;
+    uint32_t dirty[NES_DIRTY_WORDS];
+};
+
 /*********************
  *      FUNCTIONS
  *********************/
@@ -40,24 +53,56 @@ void NES_suspend();
  * Function:  NES_load_game 
  * --------------------
  * 
- * Load the selected game from the SD card and if it exists the save game.
+ * Restore the state saved on a slot. It's done by the emulator at the end of the frame, a
+ * suspended emulator runs until there and is suspended again.
  * 
  * Arguments:
- * -name: Name of the game.
+ * -slot: Save slot, from 0 to SD_SLOT_NUM - 1.
  * 
- *  Returns: Nothing
+ *  Returns: True if the state was restored.
  */
-void NES_load_game();
+bool NES_load_game(uint8_t slot);
 
 /*
  * Function:  NES_save_game 
  * --------------------
  * 
- * Save the progress of the game into a file on the SD card.
+ * Save the progress of the game on a slot of the SD card, with a thumbnail on the slot index.
+ * Like NES_load_game, it waits the emulator to reach the end of the frame.
+ * 
+ * Arguments:
+ * -slot: Save slot, from 0 to SD_SLOT_NUM - 1.
+ * 
+ *  Returns: True if the state was queued to the save writer.
+ */
+bool NES_save_game(uint8_t slot);
+
+/*
+ * Function:  NES_state_requests 
+ * --------------------
+ * 
+ * Serve the loads and saves asked by NES_load_game and NES_save_game. The emulator calls it
+ * between frames, when the CPU registers are on the nes context.
+ * 
+ *  Returns: Nothing
+ */
+void NES_state_requests();
+
+/*
+ * Function:  NES_frame_lines 
+ * --------------------
+ * 
+ * Get the lines to draw of a frame given by nofrendo_vidQueue. They are the lines
+ * changed since the previous frame plus the ones of the frames dropped on the way.
+ * 
+ * Arguments:
+ * -frame: Frame to show.
+ * -lines: Bitmask of NES_DIRTY_WORDS words, a bit per line of the frame.
  * 
  *  Returns: Nothing
  */
-void NES_save_game();
+void NES_frame_lines(const struct nes_frame *frame, uint32_t *lines);
 
-QueueHandle_t nofrendo_vidQueue;
+QueueHandle_t nofrendo_vidQueue;    // struct nes_frame * waiting to be shown
+QueueHandle_t nofrendo_frameQueue;  // Frames already shown, free to be drawn again
 QueueHandle_t nofrendo_audioQueue;
@@ -58,10 +58,19 @@ static bitmap_t *_make_bitmap(uint8 *data_addr, bool hw, int width,
       bitmap->pitch = (bitmap->pitch + 3) & ~3;
    }
 
-   /* Allocate using pitch (not width) to avoid buffer overflow */
-   bitmap->data = NOFRENDO_MALLOC(height * bitmap->pitch);
-   if (NULL == bitmap->data)
-      return NULL;
+   /* Allocate using pitch (not width) to avoid buffer overflow,
+   ** a hardware bitmap uses the memory it's given
+   */
+   if (NULL != data_addr)
+   {
+      bitmap->data = data_addr;
+   }
+   else
+   {
+      bitmap->data = NOFRENDO_MALLOC(height * bitmap->pitch);
+      if (NULL == bitmap->data)
+         return NULL;
+   }
 
    /* Set up line pointers */
    if (false == bitmap->hardware)
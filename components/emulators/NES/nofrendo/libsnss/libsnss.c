@@ -57,6 +57,54 @@ swap16(unsigned short source)
 
 #define MIN(a, b) (((a) < (b)) ? (a) : (b))
 
+/* the state is kept in a memory buffer, these work like fread/fwrite of
+   a single item and a relative fseek */
+static int
+SNSS_Read(void *data, unsigned int size, SNSS_FILE *snssFile)
+{
+   if (size > snssFile->length - snssFile->position)
+   {
+      return 0;
+   }
+
+   memcpy(data, snssFile->buffer + snssFile->position, size);
+   snssFile->position += size;
+
+   return 1;
+}
+
+static int
+SNSS_Write(const void *data, unsigned int size, SNSS_FILE *snssFile)
+{
+   if (size > snssFile->bufferSize - snssFile->position)
+   {
+      return 0;
+   }
+
+   memcpy(snssFile->buffer + snssFile->position, data, size);
+   snssFile->position += size;
+   if (snssFile->position > snssFile->length)
+   {
+      snssFile->length = snssFile->position;
+   }
+
+   return 1;
+}
+
+static int
+SNSS_Seek(SNSS_FILE *snssFile, int offset)
+{
+   if ((offset < 0 && (unsigned int)-offset > snssFile->position) ||
+       (offset > 0 && (unsigned int)offset > snssFile->length - snssFile->position))
+   {
+      return -1;
+   }
+
+   snssFile->position += offset;
+
+   return 0;
+}
+
 /**************************************************************************/
 
 static SNSS_RETURN_CODE
@@ -64,7 +112,7 @@ SNSS_ReadBlockHeader(SnssBlockHeader *header, SNSS_FILE *snssFile)
 {
    char headerBytes[12];
 
-   if (fread(headerBytes, 12, 1, snssFile->fp) != 1)
+   if (SNSS_Read(headerBytes, 12, snssFile) != 1)
    {
       return SNSS_READ_FAILED;
    }
@@ -101,7 +149,7 @@ SNSS_WriteBlockHeader(SnssBlockHeader *header, SNSS_FILE *snssFile)
    headerBytes[10] = ((char *)&tempInt)[2];
    headerBytes[11] = ((char *)&tempInt)[3];
 
-   if (fwrite(headerBytes, 12, 1, snssFile->fp) != 1)
+   if (SNSS_Write(headerBytes, 12, snssFile) != 1)
    {
       return SNSS_WRITE_FAILED;
    }
@@ -152,7 +200,7 @@ SNSS_GetErrorString(SNSS_RETURN_CODE code)
 static SNSS_RETURN_CODE
 SNSS_ReadFileHeader(SNSS_FILE *snssFile)
 {
-   if (fread(snssFile->headerBlock.tag, 4, 1, snssFile->fp) != 1)
+   if (SNSS_Read(snssFile->headerBlock.tag, 4, snssFile) != 1)
    {
       return SNSS_READ_FAILED;
    }
@@ -164,7 +212,7 @@ SNSS_ReadFileHeader(SNSS_FILE *snssFile)
 
    snssFile->headerBlock.tag[4] = '\0';
 
-   if (fread(&snssFile->headerBlock.numberOfBlocks, sizeof(unsigned int), 1, snssFile->fp) != 1)
+   if (SNSS_Read(&snssFile->headerBlock.numberOfBlocks, sizeof(unsigned int), snssFile) != 1)
    {
       return SNSS_READ_FAILED;
    }
@@ -190,7 +238,7 @@ SNSS_WriteFileHeader(SNSS_FILE *snssFile)
    writeBuffer[6] = ((char *)&tempInt)[2];
    writeBuffer[7] = ((char *)&tempInt)[3];
 
-   if (fwrite(writeBuffer, 8, 1, snssFile->fp) != 1)
+   if (SNSS_Write(writeBuffer, 8, snssFile) != 1)
    {
       return SNSS_WRITE_FAILED;
    }
@@ -202,7 +250,8 @@ SNSS_WriteFileHeader(SNSS_FILE *snssFile)
 /* general file manipulation functions */
 /**************************************************************************/
 SNSS_RETURN_CODE
-SNSS_OpenFile(SNSS_FILE **snssFile, const char *filename, SNSS_OPEN_MODE mode)
+SNSS_OpenBuffer(SNSS_FILE **snssFile, unsigned char *buffer, unsigned int size,
+                SNSS_OPEN_MODE mode)
 {
    if (!snssFileBlock)
    {
@@ -219,27 +268,22 @@ SNSS_OpenFile(SNSS_FILE **snssFile, const char *filename, SNSS_OPEN_MODE mode)
 
    (*snssFile)->mode = mode;
 
-   if (SNSS_OPEN_READ == mode)
-   {
-      (*snssFile)->fp = fopen(filename, "rb");
-   }
-   else
-   {
-      (*snssFile)->fp = fopen(filename, "wb");
-      (*snssFile)->headerBlock.numberOfBlocks = 0;
-   }
-
-   if (NULL == (*snssFile)->fp)
+   if (NULL == buffer)
    {
       return SNSS_OPEN_FAILED;
    }
 
+   (*snssFile)->buffer = buffer;
+   (*snssFile)->bufferSize = size;
+
    if (SNSS_OPEN_READ == mode)
    {
+      (*snssFile)->length = size;
       return SNSS_ReadFileHeader(*snssFile);
    }
    else
    {
+      (*snssFile)->headerBlock.numberOfBlocks = 0;
       return SNSS_WriteFileHeader(*snssFile);
    }
 }
@@ -249,35 +293,31 @@ SNSS_OpenFile(SNSS_FILE **snssFile, const char *filename, SNSS_OPEN_MODE mode)
 SNSS_RETURN_CODE
 SNSS_CloseFile(SNSS_FILE **snssFile)
 {
-   int prevLoc;
-   SNSS_RETURN_CODE code;
+   unsigned int prevLoc;
+   SNSS_RETURN_CODE code = SNSS_OK;
 
    /* file was never open, so this should indicate success- kinda. */
-   if (NULL == *snssFile)
+   if (NULL == *snssFile || NULL == (*snssFile)->buffer)
    {
       return SNSS_OK;
    }
 
    if (SNSS_OPEN_WRITE == (*snssFile)->mode)
    {
-      prevLoc = ftell((*snssFile)->fp);
-      fseek((*snssFile)->fp, 0, SEEK_SET);
+      prevLoc = (*snssFile)->position;
+      (*snssFile)->position = 0;
 
       /* write the header again to update block count */
-      if (SNSS_OK != (code = SNSS_WriteFileHeader(*snssFile)))
-      {
-         return SNSS_CLOSE_FAILED;
-      }
+      code = SNSS_WriteFileHeader(*snssFile);
 
-      fseek((*snssFile)->fp, prevLoc, SEEK_SET);
+      (*snssFile)->position = prevLoc;
    }
 
-   if (fclose((*snssFile)->fp) != 0)
-   {
-      return SNSS_CLOSE_FAILED;
-   }
+   /* the buffer belongs to the caller, it's only released, so the error
+      path can close it twice */
+   (*snssFile)->buffer = NULL;
 
-   return SNSS_OK;
+   return (SNSS_OK == code) ? SNSS_OK : SNSS_CLOSE_FAILED;
 }
 
 /**************************************************************************/
@@ -287,14 +327,14 @@ SNSS_GetNextBlockType(SNSS_BLOCK_TYPE *blockType, SNSS_FILE *snssFile)
 {
    char tagBuffer[TAG_LENGTH + 1];
 
-   if (fread(tagBuffer, TAG_LENGTH, 1, snssFile->fp) != 1)
+   if (SNSS_Read(tagBuffer, TAG_LENGTH, snssFile) != 1)
    {
       return SNSS_READ_FAILED;
    }
    tagBuffer[TAG_LENGTH] = '\0';
 
    /* reset the file pointer to the start of the block */
-   if (fseek(snssFile->fp, -TAG_LENGTH, SEEK_CUR) != 0)
+   if (SNSS_Seek(snssFile, -TAG_LENGTH) != 0)
    {
       return SNSS_READ_FAILED;
    }
@@ -340,20 +380,20 @@ SNSS_SkipNextBlock(SNSS_FILE *snssFile)
    unsigned int blockLength;
 
    /* skip the block's tag and version */
-   if (fseek(snssFile->fp, TAG_LENGTH + sizeof(unsigned int), SEEK_CUR) != 0)
+   if (SNSS_Seek(snssFile, TAG_LENGTH + sizeof(unsigned int)) != 0)
    {
       return SNSS_READ_FAILED;
    }
 
    /* get the block data length */
-   if (fread(&blockLength, sizeof(unsigned int), 1, snssFile->fp) != 1)
+   if (SNSS_Read(&blockLength, sizeof(unsigned int), snssFile) != 1)
    {
       return SNSS_READ_FAILED;
    }
    blockLength = swap32(blockLength);
 
    /* skip over the block data */
-   if (fseek(snssFile->fp, blockLength, SEEK_CUR) != 0)
+   if (SNSS_Seek(snssFile, blockLength) != 0)
    {
       return SNSS_READ_FAILED;
    }
@@ -379,7 +419,7 @@ SNSS_ReadBaseBlock(SNSS_FILE *snssFile)
       return SNSS_READ_FAILED;
    }
 
-   if (fread(blockBytes, MIN(header.blockLength, BASE_BLOCK_LENGTH), 1, snssFile->fp) != 1)
+   if (SNSS_Read(blockBytes, MIN(header.blockLength, BASE_BLOCK_LENGTH), snssFile) != 1)
    {
       return SNSS_READ_FAILED;
    }
@@ -449,7 +489,7 @@ SNSS_WriteBaseBlock(SNSS_FILE *snssFile)
    blockBytes[0x192F] = snssFile->baseBlock.spriteRamAddress;
    blockBytes[0x1930] = snssFile->baseBlock.tileXOffset;
 
-   if (fwrite(blockBytes, BASE_BLOCK_LENGTH, 1, snssFile->fp) != 1)
+   if (SNSS_Write(blockBytes, BASE_BLOCK_LENGTH, snssFile) != 1)
    {
       return SNSS_WRITE_FAILED;
    }
@@ -473,7 +513,7 @@ SNSS_ReadVramBlock(SNSS_FILE *snssFile)
       return SNSS_READ_FAILED;
    }
 
-   if (fread(snssFile->vramBlock.vram, MIN(header.blockLength, VRAM_16K), 1, snssFile->fp) != 1)
+   if (SNSS_Read(snssFile->vramBlock.vram, MIN(header.blockLength, VRAM_16K), snssFile) != 1)
    {
       return SNSS_READ_FAILED;
    }
@@ -500,7 +540,7 @@ SNSS_WriteVramBlock(SNSS_FILE *snssFile)
       return returnCode;
    }
 
-   if (fwrite(snssFile->vramBlock.vram, snssFile->vramBlock.vramSize, 1, snssFile->fp) != 1)
+   if (SNSS_Write(snssFile->vramBlock.vram, snssFile->vramBlock.vramSize, snssFile) != 1)
    {
       return SNSS_WRITE_FAILED;
    }
@@ -524,13 +564,13 @@ SNSS_ReadSramBlock(SNSS_FILE *snssFile)
       return SNSS_READ_FAILED;
    }
 
-   if (fread(&snssFile->sramBlock.sramEnabled, 1, 1, snssFile->fp) != 1)
+   if (SNSS_Read(&snssFile->sramBlock.sramEnabled, 1, snssFile) != 1)
    {
       return SNSS_READ_FAILED;
    }
 
    /* read blockLength - 1 bytes to get all of the SRAM */
-   if (fread(&snssFile->sramBlock.sram, MIN(header.blockLength - 1, SRAM_8K), 1, snssFile->fp) != 1)
+   if (SNSS_Read(&snssFile->sramBlock.sram, MIN(header.blockLength - 1, SRAM_8K), snssFile) != 1)
    {
       return SNSS_READ_FAILED;
    }
@@ -558,12 +598,12 @@ SNSS_WriteSramBlock(SNSS_FILE *snssFile)
       return returnCode;
    }
 
-   if (fwrite(&snssFile->sramBlock.sramEnabled, 1, 1, snssFile->fp) != 1)
+   if (SNSS_Write(&snssFile->sramBlock.sramEnabled, 1, snssFile) != 1)
    {
       return SNSS_WRITE_FAILED;
    }
 
-   if (fwrite(snssFile->sramBlock.sram, snssFile->sramBlock.sramSize, 1, snssFile->fp) != 1)
+   if (SNSS_Write(snssFile->sramBlock.sram, snssFile->sramBlock.sramSize, snssFile) != 1)
    {
       return SNSS_WRITE_FAILED;
    }
@@ -598,7 +638,7 @@ SNSS_ReadMapperBlock(SNSS_FILE *snssFile)
       return SNSS_OUT_OF_MEMORY;
    }
 
-   if (fread(blockBytes, MIN(0x8 + 0x10 + 0x80, header.blockLength), 1, snssFile->fp) != 1)
+   if (SNSS_Read(blockBytes, MIN(0x8 + 0x10 + 0x80, header.blockLength), snssFile) != 1)
    {
       return SNSS_READ_FAILED;
    }
@@ -656,7 +696,7 @@ SNSS_WriteMapperBlock(SNSS_FILE *snssFile)
 
    memcpy(&blockBytes[0x18], &snssFile->mapperBlock.extraData.mapperData, 0x80);
 
-   if (fwrite(blockBytes, MAPPER_BLOCK_LENGTH, 1, snssFile->fp) != 1)
+   if (SNSS_Write(blockBytes, MAPPER_BLOCK_LENGTH, snssFile) != 1)
    {
       return SNSS_WRITE_FAILED;
    }
@@ -704,7 +744,7 @@ SNSS_ReadSoundBlock(SNSS_FILE *snssFile)
       return SNSS_READ_FAILED;
    }
 
-   if (fread(snssFile->soundBlock.soundRegisters, MIN(header.blockLength, 0x16), 1, snssFile->fp) != 1)
+   if (SNSS_Read(snssFile->soundBlock.soundRegisters, MIN(header.blockLength, 0x16), snssFile) != 1)
    {
       return SNSS_READ_FAILED;
    }
@@ -729,7 +769,7 @@ SNSS_WriteSoundBlock(SNSS_FILE *snssFile)
       return returnCode;
    }
 
-   if (fwrite(snssFile->soundBlock.soundRegisters, SOUND_BLOCK_LENGTH, 1, snssFile->fp) != 1)
+   if (SNSS_Write(snssFile->soundBlock.soundRegisters, SOUND_BLOCK_LENGTH, snssFile) != 1)
    {
       return SNSS_WRITE_FAILED;
    }
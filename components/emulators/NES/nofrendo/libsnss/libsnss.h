@@ -316,7 +316,10 @@ typedef struct _SnssSoundBlock
 
 typedef struct _SNSS_FILE
 {
-   FILE *fp;
+   unsigned char *buffer;
+   unsigned int bufferSize;
+   unsigned int position;
+   unsigned int length; /* bytes of the state on the buffer */
    SNSS_OPEN_MODE mode;
    SnssFileHeader headerBlock;
    SnssBaseBlock baseBlock;
@@ -327,14 +330,18 @@ typedef struct _SNSS_FILE
    SnssSoundBlock soundBlock;
 } SNSS_FILE;
 
+/* biggest state, with one block of each type */
+#define SNSS_MAX_LENGTH (8 + 6 * 12 + BASE_BLOCK_LENGTH + VRAM_16K + 1 + SRAM_8K + \
+                         MAPPER_BLOCK_LENGTH + SOUND_BLOCK_LENGTH)
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif /* __cplusplus */
 
    /* general file manipulation routines */
-   SNSS_RETURN_CODE SNSS_OpenFile(SNSS_FILE **snssFile, const char *filename,
-                                  SNSS_OPEN_MODE mode);
+   SNSS_RETURN_CODE SNSS_OpenBuffer(SNSS_FILE **snssFile, unsigned char *buffer,
+                                    unsigned int size, SNSS_OPEN_MODE mode);
    SNSS_RETURN_CODE SNSS_CloseFile(SNSS_FILE **snssFile);
 
    /* block traversal */
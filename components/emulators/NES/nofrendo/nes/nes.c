@@ -365,47 +365,105 @@ static void system_video(bool draw)
 }
 
 /* main emulation loop */
-extern void do_audio_frame();
+/* Each frame is due a frame period after the previous one on the microsecond
+** clock, the ns left over are carried so the rounding never adds up. When the
+** emulation is a frame late, frames are emulated without drawing, up to
+** skip_limit in a row. Past that the schedule restarts from now.
+*/
 void nes_emulate(void)
 {
-   int last_ticks, frames_to_render;
+   uint32 now, deadline, deadline_ns = 0;
+   uint32 stat_start;
+   int32 late;
+   int period_us = nes.frame_period / 1000;
+   int skipped = 0;
+   int stat_frames = 0, stat_skipped = 0, stat_resyncs = 0;
 
    osd_setsound(nes.apu->process);
 
-   last_ticks = nofrendo_ticks;
-   frames_to_render = 0;
    nes.scanline_cycles = 0;
    nes.fiq_cycles = (int)NES_FIQ_PERIOD;
 
+   deadline = stat_start = osd_getmicros();
+
    while (false == nes.poweroff)
    {
-      if (nofrendo_ticks != last_ticks)
-      {
-         int tick_diff = nofrendo_ticks - last_ticks;
-
-         frames_to_render += tick_diff;
-         gui_tick(tick_diff);
-         last_ticks = nofrendo_ticks;
-      }
+      now = osd_getmicros();
+      late = (int32)(now - deadline);
 
       if (true == nes.pause)
       {
          /* TODO: dim the screen, and pause/silence the apu */
          system_video(true);
-         frames_to_render = 0;
+         osd_waitmicros(period_us);
+         deadline = osd_getmicros();
+         continue;
+      }
+
+      if (nes.fast_forward > 0)
+      {
+         /* unthrottled, one of each fast_forward frames is drawn */
+         bool draw = (++skipped >= nes.fast_forward);
+         if (draw)
+            skipped = 0;
+         deadline = now;
+         deadline_ns = 0;
+         nes_renderframe(draw);
+         system_video(draw);
       }
-      else if (frames_to_render > 1)
+      else if (false == nes.autoframeskip)
       {
-         frames_to_render--;
+         /* unthrottled emulation */
+         deadline = now;
+         nes_renderframe(true);
+         system_video(true);
+      }
+      else if (late >= period_us && skipped < nes.skip_limit)
+      {
+         skipped++;
+         stat_skipped++;
          nes_renderframe(false);
          system_video(false);
       }
-      else if ((1 == frames_to_render && true == nes.autoframeskip) || false == nes.autoframeskip)
+      else
       {
-         frames_to_render = 0;
+         if (late >= period_us)
+         {
+            /* still late after skipping, the lost time isn't made up */
+            deadline = now;
+            deadline_ns = 0;
+            stat_resyncs++;
+         }
+         else if (late < 0)
+         {
+            osd_waitmicros(-late);
+         }
+
+         skipped = 0;
          nes_renderframe(true);
          system_video(true);
       }
+
+      gui_tick(1);
+
+      deadline_ns += nes.frame_period;
+      deadline += deadline_ns / 1000;
+      deadline_ns %= 1000;
+
+      /* deviation from a real NES, positive if the emulation is slower */
+      if (++stat_frames == nes.refresh_rate * 10)
+      {
+         int emulated_us = stat_frames * (nes.frame_period / 1000) + stat_frames * (nes.frame_period % 1000) / 1000;
+         int switches;
+
+         now = osd_getmicros();
+         nofrendo_log_printf("%d frames, %d skipped, %d resyncs, %d us off real time\n",
+                             stat_frames, stat_skipped, stat_resyncs, (int)(now - stat_start) - emulated_us);
+         switches = ppu_getbankswitches(true) * 10 / stat_frames;
+         nofrendo_log_printf("%d.%d CHR bank switches per frame\n", switches / 10, switches % 10);
+         stat_start = now;
+         stat_frames = stat_skipped = stat_resyncs = 0;
+      }
    }
 }
 
@@ -473,6 +531,11 @@ void nes_togglepause(void)
    nes.pause ^= true;
 }
 
+void nes_setfastforward(int frames)
+{
+   nes.fast_forward = frames;
+}
+
 /* insert a cart into the NES */
 int nes_insertcart(const char *filename, nes_t *machine)
 {
@@ -505,6 +568,18 @@ int nes_insertcart(const char *filename, nes_t *machine)
 
    nes_setcontext(machine);
 
+   /* PAL games expect 50 frames per second, and the sound of a frame lasts longer */
+   if (machine->rominfo->flags & ROM_FLAG_PAL)
+   {
+      sndinfo_t osd_sound;
+
+      osd_getsoundinfo(&osd_sound);
+      apu_setparams(0, osd_sound.sample_rate, 50, osd_sound.bps);
+      nes.refresh_rate = 50;
+      nes.frame_period = NES_PAL_FRAME_PERIOD;
+      nofrendo_log_printf("PAL game, running at 50Hz\n");
+   }
+
    nes_reset(HARD_RESET);
    return 0;
 
@@ -535,6 +610,10 @@ nes_t *nes_create(void)
 #endif /* NOFRENDO_DOUBLE_FRAMEBUFFER */
 
    machine->autoframeskip = true;
+   machine->skip_limit = NES_SKIP_LIMIT;
+   machine->fast_forward = 0;
+   machine->refresh_rate = NES_REFRESH_RATE;
+   machine->frame_period = (50 == NES_REFRESH_RATE) ? NES_PAL_FRAME_PERIOD : NES_NTSC_FRAME_PERIOD;
 
    /* cpu */
    machine->cpu = NOFRENDO_MALLOC(sizeof(nes6502_context));
@@ -44,6 +44,10 @@
 #define NES_REFRESH_RATE 60
 #endif /* !PAL */
 
+/* exact frame periods in ns, an NTSC frame is 29780.5 cycles of 1.789773MHz */
+#define NES_NTSC_FRAME_PERIOD 16639267
+#define NES_PAL_FRAME_PERIOD 20000000
+
 #define MAX_MEM_HANDLERS 32
 
 enum
@@ -78,6 +82,10 @@ typedef struct nes_s
    /* Timing stuff */
    float scanline_cycles;
    bool autoframeskip;
+   int skip_limit;      /* most frames in a row emulated without drawing */
+   int fast_forward;    /* frames emulated per drawn one, unthrottled. 0 if off */
+   int refresh_rate;    /* 60 NTSC, 50 PAL */
+   uint32 frame_period; /* in ns */
 
    /* control */
    bool poweroff;
@@ -107,6 +115,7 @@ extern void nes_reset(int reset_type);
 
 extern void nes_poweroff(void);
 extern void nes_togglepause(void);
+extern void nes_setfastforward(int frames);
 
 #endif /* _NES_H_ */
 
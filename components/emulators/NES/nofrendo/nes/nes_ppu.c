@@ -55,6 +55,60 @@
 /* the NES PPU */
 static ppu_t ppu;
 
+/* Tile lines are expanded with tables instead of bit by bit.  A bitplane
+** byte spreads to a 2 bit per pixel word, leftmost pixel in the low bits,
+** so both planes of a tile line give 8 pixels in one 16 bit word.  Each
+** byte of that word is 4 pixels, and bg_color4 maps it to their colors in
+** a 32-bit little endian word.
+*/
+static uint16 plane_spread[256];
+static uint16 plane_spread_flip[256];
+static uint32 bg_color4[4][256];
+static uint8 bg_color4_pal[16];
+
+static void ppu_buildtables(void)
+{
+   int i, bit;
+
+   for (i = 0; i < 256; i++)
+   {
+      plane_spread[i] = 0;
+      plane_spread_flip[i] = 0;
+
+      for (bit = 0; bit < 8; bit++)
+      {
+         if (i & (0x80 >> bit))
+            plane_spread[i] |= 1 << (bit * 2);
+         if (i & (1 << bit))
+            plane_spread_flip[i] |= 1 << (bit * 2);
+      }
+   }
+}
+
+/* only the background palettes changed since the last line are rebuilt,
+** the palette is written by the game, the state loader and reset
+*/
+static void ppu_updatecolor4(void)
+{
+   int pal, i;
+
+   for (pal = 0; pal < 4; pal++)
+   {
+      const uint8 *colors = ppu.palette + (pal << 2);
+
+      if (0 == memcmp(bg_color4_pal + (pal << 2), colors, 4))
+         continue;
+
+      memcpy(bg_color4_pal + (pal << 2), colors, 4);
+
+      for (i = 0; i < 256; i++)
+      {
+         bg_color4[pal][i] = colors[i & 3] | (colors[(i >> 2) & 3] << 8) |
+                             (colors[(i >> 4) & 3] << 16) | ((uint32)colors[i >> 6] << 24);
+      }
+   }
+}
+
 void ppu_displaysprites(bool display)
 {
    ppu.drawsprites = display;
@@ -139,6 +193,7 @@ ppu_t *ppu_create(void)
    if (false == pal_generated)
    {
       pal_generate();
+      ppu_buildtables();
       pal_generated = true;
    }
 
@@ -156,8 +211,27 @@ void ppu_destroy(ppu_t **src_ppu)
    }
 }
 
+/* CHR bank switches that changed a pattern table page, for the profiling */
+static int bank_switches = 0;
+
+int ppu_getbankswitches(bool reset_flag)
+{
+   int switches = bank_switches;
+
+   if (reset_flag)
+      bank_switches = 0;
+
+   return switches;
+}
+
+/* ppu.page holds a pointer per 1kB, already offset by the page address,
+** so PPU_MEM is a single index.  Mappers only touch it on bank switches.
+*/
 void ppu_setpage(int size, int page_num, uint8 *location)
 {
+   if (page_num < 8 && ppu.page[page_num] != location)
+      bank_switches++;
+
    /* deliberately fall through */
    switch (size)
    {
@@ -588,113 +662,49 @@ INLINE void draw_bgtile(uint8 *surface, uint8 pat1, uint8 pat2,
    *surface = colors[pattern & 3];
 }
 
-INLINE int draw_oamtile(uint8 *surface, uint8 attrib, uint8 pat1,
-                        uint8 pat2, const uint8 *col_tbl, bool check_strike)
+/* draw the 2 bit pixels of a sprite line, clipped to the right edge */
+INLINE int draw_oampixels(uint8 *surface, uint8 attrib, uint32 pixels,
+                          int width, const uint8 *col_tbl, bool check_strike)
 {
    int strike_pixel = -1;
-   uint32 color = ((pat2 & 0xAA) << 8) | ((pat2 & 0x55) << 1) | ((pat1 & 0xAA) << 7) | (pat1 & 0x55);
+   int i;
 
-   /* sprite is not 100% transparent */
-   if (color)
+   for (i = 0; pixels && i < width; i++, pixels >>= 2)
    {
-      uint8 colors[8];
+      uint8 color = pixels & 3;
 
-      /* swap pixels around if our tile is flipped */
-      if (0 == (attrib & OAMF_HFLIP))
-      {
-         colors[0] = (color >> 14) & 3;
-         colors[1] = (color >> 6) & 3;
-         colors[2] = (color >> 12) & 3;
-         colors[3] = (color >> 4) & 3;
-         colors[4] = (color >> 10) & 3;
-         colors[5] = (color >> 2) & 3;
-         colors[6] = (color >> 8) & 3;
-         colors[7] = color & 3;
-      }
-      else
-      {
-         colors[7] = (color >> 14) & 3;
-         colors[6] = (color >> 6) & 3;
-         colors[5] = (color >> 12) & 3;
-         colors[4] = (color >> 4) & 3;
-         colors[3] = (color >> 10) & 3;
-         colors[2] = (color >> 2) & 3;
-         colors[1] = (color >> 8) & 3;
-         colors[0] = color & 3;
-      }
+      if (0 == color)
+         continue;
 
-      /* check for solid sprite pixel overlapping solid bg pixel */
-      if (check_strike)
-      {
-         if (colors[0] && BG_SOLID(surface[0]))
-            strike_pixel = 0;
-         else if (colors[1] && BG_SOLID(surface[1]))
-            strike_pixel = 1;
-         else if (colors[2] && BG_SOLID(surface[2]))
-            strike_pixel = 2;
-         else if (colors[3] && BG_SOLID(surface[3]))
-            strike_pixel = 3;
-         else if (colors[4] && BG_SOLID(surface[4]))
-            strike_pixel = 4;
-         else if (colors[5] && BG_SOLID(surface[5]))
-            strike_pixel = 5;
-         else if (colors[6] && BG_SOLID(surface[6]))
-            strike_pixel = 6;
-         else if (colors[7] && BG_SOLID(surface[7]))
-            strike_pixel = 7;
-      }
+      /* check for solid sprite pixel overlapping solid bg pixel, the
+      ** pixels on its right aren't drawn yet
+      */
+      if (check_strike && strike_pixel < 0 && BG_SOLID(surface[i]))
+         strike_pixel = i;
 
-      /* draw the character */
       if (attrib & OAMF_BEHIND)
-      {
-         if (colors[0])
-            surface[0] = SP_PIXEL | (BG_CLEAR(surface[0]) ? col_tbl[colors[0]] : surface[0]);
-         if (colors[1])
-            surface[1] = SP_PIXEL | (BG_CLEAR(surface[1]) ? col_tbl[colors[1]] : surface[1]);
-         if (colors[2])
-            surface[2] = SP_PIXEL | (BG_CLEAR(surface[2]) ? col_tbl[colors[2]] : surface[2]);
-         if (colors[3])
-            surface[3] = SP_PIXEL | (BG_CLEAR(surface[3]) ? col_tbl[colors[3]] : surface[3]);
-         if (colors[4])
-            surface[4] = SP_PIXEL | (BG_CLEAR(surface[4]) ? col_tbl[colors[4]] : surface[4]);
-         if (colors[5])
-            surface[5] = SP_PIXEL | (BG_CLEAR(surface[5]) ? col_tbl[colors[5]] : surface[5]);
-         if (colors[6])
-            surface[6] = SP_PIXEL | (BG_CLEAR(surface[6]) ? col_tbl[colors[6]] : surface[6]);
-         if (colors[7])
-            surface[7] = SP_PIXEL | (BG_CLEAR(surface[7]) ? col_tbl[colors[7]] : surface[7]);
-      }
-      else
-      {
-         if (colors[0] && SP_CLEAR(surface[0]))
-            surface[0] = SP_PIXEL | col_tbl[colors[0]];
-         if (colors[1] && SP_CLEAR(surface[1]))
-            surface[1] = SP_PIXEL | col_tbl[colors[1]];
-         if (colors[2] && SP_CLEAR(surface[2]))
-            surface[2] = SP_PIXEL | col_tbl[colors[2]];
-         if (colors[3] && SP_CLEAR(surface[3]))
-            surface[3] = SP_PIXEL | col_tbl[colors[3]];
-         if (colors[4] && SP_CLEAR(surface[4]))
-            surface[4] = SP_PIXEL | col_tbl[colors[4]];
-         if (colors[5] && SP_CLEAR(surface[5]))
-            surface[5] = SP_PIXEL | col_tbl[colors[5]];
-         if (colors[6] && SP_CLEAR(surface[6]))
-            surface[6] = SP_PIXEL | col_tbl[colors[6]];
-         if (colors[7] && SP_CLEAR(surface[7]))
-            surface[7] = SP_PIXEL | col_tbl[colors[7]];
-      }
+         surface[i] = SP_PIXEL | (BG_CLEAR(surface[i]) ? col_tbl[color] : surface[i]);
+      else if (SP_CLEAR(surface[i]))
+         surface[i] = SP_PIXEL | col_tbl[color];
    }
 
    return strike_pixel;
 }
 
+/* 33 tiles are drawn on an aligned line, 4 pixels a store, and the
+** visible part is copied to the bitmap past the fine x scroll
+*/
+static uint32 bg_line[(33 * 8) / 4];
+
 static void ppu_renderbg(uint8 *vidbuf)
 {
-   uint8 *bmp_ptr, *data_ptr, *tile_ptr, *attrib_ptr;
-   uint32 refresh_vaddr, bg_offset, attrib_base;
+   uint32 *line_ptr;
+   uint8 *data_ptr, *tile_ptr, *attrib_ptr;
+   const uint32 *colors;
+   uint32 refresh_vaddr, bg_offset, attrib_base, pixels;
    int tile_count;
    uint8 tile_index, x_tile, y_tile;
-   uint8 col_high, attrib, attrib_shift;
+   uint8 attrib, attrib_shift;
 
    /* draw a line of transparent background color if bg is disabled */
    if (false == ppu.bg_on)
@@ -703,7 +713,9 @@ static void ppu_renderbg(uint8 *vidbuf)
       return;
    }
 
-   bmp_ptr = vidbuf - ppu.tile_xofs;              /* scroll x */
+   ppu_updatecolor4();
+
+   line_ptr = bg_line;
    refresh_vaddr = 0x2000 + (ppu.vaddr & 0x0FE0); /* mask out x tile */
    x_tile = ppu.vaddr & 0x1F;
    y_tile = (ppu.vaddr >> 5) & 0x1F;                  /* to simplify calculations */
@@ -715,7 +727,7 @@ static void ppu_renderbg(uint8 *vidbuf)
    attrib_ptr = &PPU_MEM(attrib_base + (x_tile >> 2));
    attrib = *attrib_ptr++;
    attrib_shift = (x_tile & 2) + ((y_tile & 2) << 1);
-   col_high = ((attrib >> attrib_shift) & 3) << 2;
+   colors = bg_color4[(attrib >> attrib_shift) & 3];
 
    /* ppu fetches 33 tiles */
    tile_count = 33;
@@ -729,8 +741,9 @@ static void ppu_renderbg(uint8 *vidbuf)
       if (ppu.latchfunc)
          ppu.latchfunc(ppu.bg_base, tile_index);
 
-      draw_bgtile(bmp_ptr, data_ptr[0], data_ptr[8], ppu.palette + col_high);
-      bmp_ptr += 8;
+      pixels = plane_spread[data_ptr[0]] | (plane_spread[data_ptr[8]] << 1);
+      *line_ptr++ = colors[pixels & 0xFF];
+      *line_ptr++ = colors[pixels >> 8];
 
       x_tile++;
 
@@ -754,10 +767,13 @@ static void ppu_renderbg(uint8 *vidbuf)
          }
 
          attrib_shift ^= 2;
-         col_high = ((attrib >> attrib_shift) & 3) << 2;
+         colors = bg_color4[(attrib >> attrib_shift) & 3];
       }
    }
 
+   /* scroll x */
+   memcpy(vidbuf, (uint8 *)bg_line + ppu.tile_xofs, NES_SCREEN_WIDTH);
+
    /* Blank left hand column if need be */
    if (ppu.bg_mask)
    {
@@ -778,28 +794,28 @@ typedef struct obj_s
    uint8 x_loc;
 } obj_t;
 
-/* TODO: fetch valid OAM a scanline before, like the Real Thing */
-static void ppu_renderoam(uint8 *vidbuf, int scanline)
+/* sprite line found by the OAM evaluation */
+typedef struct oamline_s
 {
-   uint8 *buf_ptr;
-   uint32 vram_offset, savecol[2] = {0};
+   uint16 pixels; /* 2 bits a pixel, leftmost in the low bits, flip applied */
+   uint8 x_loc;
+   uint8 atr;
+   uint8 sprite_num;
+} oamline_t;
+
+static oamline_t oam_line[PPU_MAXSPRITE];
+
+/* Find the sprites on a scanline and fetch their pattern lines, in OAM
+** order.  The latch of each sprite is handled before fetching it, like
+** when they were drawn one by one.
+*/
+static int ppu_evaloam(int scanline)
+{
+   uint32 vram_offset;
    int sprite_num, spritecount;
    obj_t *sprite_ptr;
    uint8 sprite_height;
 
-   if (false == ppu.obj_on)
-      return;
-
-   /* Get our buffer pointer */
-   buf_ptr = vidbuf;
-
-   /* Save left hand column? */
-   if (ppu.obj_mask)
-   {
-      savecol[0] = ((uint32 *)buf_ptr)[0];
-      savecol[1] = ((uint32 *)buf_ptr)[1];
-   }
-
    sprite_height = ppu.obj_height;
    vram_offset = ppu.obj_base;
    spritecount = 0;
@@ -808,13 +824,12 @@ static void ppu_renderoam(uint8 *vidbuf, int scanline)
 
    for (sprite_num = 0; sprite_num < 64; sprite_num++, sprite_ptr++)
    {
-      uint8 *data_ptr, *bmp_ptr;
+      uint8 *data_ptr;
       uint32 vram_adr;
       int y_offset;
-      uint8 tile_index, attrib, col_high;
-      uint8 sprite_y, sprite_x;
-      bool check_strike;
-      int strike_pixel;
+      uint8 tile_index, attrib;
+      uint8 sprite_y;
+      const uint16 *spread;
 
       sprite_y = sprite_ptr->y_loc + 1;
 
@@ -822,19 +837,13 @@ static void ppu_renderoam(uint8 *vidbuf, int scanline)
       if ((sprite_y > scanline) || (sprite_y <= (scanline - sprite_height)) || (0 == sprite_y) || (sprite_y >= 240))
          continue;
 
-      sprite_x = sprite_ptr->x_loc;
       tile_index = sprite_ptr->tile;
       attrib = sprite_ptr->atr;
 
-      bmp_ptr = buf_ptr + sprite_x;
-
       /* Handle $FD/$FE tile VROM switching (PunchOut) */
       if (ppu.latchfunc)
          ppu.latchfunc(vram_offset, tile_index);
 
-      /* Get upper two bits of color */
-      col_high = ((attrib & 3) << 2);
-
       /* 8x16 even sprites use $0000, odd use $1000 */
       if (16 == ppu.obj_height)
          vram_adr = ((tile_index & 1) << 12) | ((tile_index & 0xFE) << 4);
@@ -864,13 +873,13 @@ static void ppu_renderoam(uint8 *vidbuf, int scanline)
          data_ptr += y_offset;
       }
 
-      /* if we're on sprite 0 and sprite 0 strike flag isn't set,
-      ** check for a strike 
-      */
-      check_strike = (0 == sprite_num) && (false == ppu.strikeflag);
-      strike_pixel = draw_oamtile(bmp_ptr, attrib, data_ptr[0], data_ptr[8], ppu.palette + 16 + col_high, check_strike);
-      if (strike_pixel >= 0)
-         ppu_setstrike(strike_pixel);
+      /* swap pixels around if our tile is flipped */
+      spread = (attrib & OAMF_HFLIP) ? plane_spread_flip : plane_spread;
+
+      oam_line[spritecount].pixels = spread[data_ptr[0]] | (spread[data_ptr[8]] << 1);
+      oam_line[spritecount].x_loc = sprite_ptr->x_loc;
+      oam_line[spritecount].atr = attrib;
+      oam_line[spritecount].sprite_num = sprite_num;
 
       /* maximum of 8 sprites per scanline */
       if (++spritecount == PPU_MAXSPRITE)
@@ -880,6 +889,51 @@ static void ppu_renderoam(uint8 *vidbuf, int scanline)
       }
    }
 
+   return spritecount;
+}
+
+/* TODO: fetch valid OAM a scanline before, like the Real Thing */
+static void ppu_renderoam(uint8 *vidbuf, int scanline)
+{
+   uint8 *buf_ptr;
+   uint32 savecol[2] = {0};
+   int i, spritecount;
+
+   if (false == ppu.obj_on)
+      return;
+
+   /* Get our buffer pointer */
+   buf_ptr = vidbuf;
+
+   /* Save left hand column? */
+   if (ppu.obj_mask)
+   {
+      savecol[0] = ((uint32 *)buf_ptr)[0];
+      savecol[1] = ((uint32 *)buf_ptr)[1];
+   }
+
+   spritecount = ppu_evaloam(scanline);
+
+   for (i = 0; i < spritecount; i++)
+   {
+      oamline_t *sprite = &oam_line[i];
+      uint8 col_high;
+      bool check_strike;
+      int strike_pixel;
+
+      /* Get upper two bits of color */
+      col_high = ((sprite->atr & 3) << 2);
+
+      /* if we're on sprite 0 and sprite 0 strike flag isn't set,
+      ** check for a strike 
+      */
+      check_strike = (0 == sprite->sprite_num) && (false == ppu.strikeflag);
+      strike_pixel = draw_oampixels(buf_ptr + sprite->x_loc, sprite->atr, sprite->pixels,
+                                    NES_SCREEN_WIDTH - sprite->x_loc, ppu.palette + 16 + col_high, check_strike);
+      if (strike_pixel >= 0)
+         ppu_setstrike(strike_pixel);
+   }
+
    /* Restore lefthand column */
    if (ppu.obj_mask)
    {
@@ -889,111 +943,41 @@ static void ppu_renderoam(uint8 *vidbuf, int scanline)
 }
 
 /* Fake rendering a line */
-/* This is needed for sprite 0 hits when we're skipping drawing a frame */
+/* Only what the game can read back is computed when we're skipping drawing
+** a frame: the sprite 0 strike and the max sprite flag.  Lines that can
+** strike, and every line of games using the $FD/$FE latch, go through the
+** real renderers into a scratch line so the result matches a drawn frame.
+*/
+static uint8 fake_line[8 + NES_SCREEN_WIDTH + 16];
+
 static void ppu_fakeoam(int scanline)
 {
-   uint8 *data_ptr;
    obj_t *sprite_ptr;
-   uint32 vram_adr, color;
-   int y_offset;
-   uint8 pat1, pat2;
-   uint8 tile_index, attrib;
-   uint8 sprite_height, sprite_y, sprite_x;
+   uint8 sprite_height, sprite_y;
 
-   /* we don't need to be here if strike flag is set */
+   if (ppu.latchfunc)
+   {
+      ppu_renderbg(fake_line + 8);
+      ppu_renderoam(fake_line + 8, scanline);
+      return;
+   }
 
-   if (false == ppu.obj_on || ppu.strikeflag)
+   if (false == ppu.obj_on)
       return;
 
    sprite_height = ppu.obj_height;
    sprite_ptr = (obj_t *)ppu.oam;
-   sprite_y = sprite_ptr->y_loc + 1;
-
-   /* Check to see if sprite is out of range */
-   if ((sprite_y > scanline) || (sprite_y <= (scanline - sprite_height)) || (0 == sprite_y) || (sprite_y > 240))
-      return;
-
-   sprite_x = sprite_ptr->x_loc;
-   tile_index = sprite_ptr->tile;
-   attrib = sprite_ptr->atr;
-
-   /* 8x16 even sprites use $0000, odd use $1000 */
-   if (16 == ppu.obj_height)
-      vram_adr = ((tile_index & 1) << 12) | ((tile_index & 0xFE) << 4);
-   else
-      vram_adr = ppu.obj_base + (tile_index << 4);
 
-   data_ptr = &PPU_MEM(vram_adr);
-
-   /* Calculate offset (line within the sprite) */
-   y_offset = scanline - sprite_y;
-   if (y_offset > 7)
-      y_offset += 8;
-
-   /* Account for vertical flippage */
-   if (attrib & OAMF_VFLIP)
-   {
-      if (16 == ppu.obj_height)
-         y_offset -= 23;
-      else
-         y_offset -= 7;
-      data_ptr -= y_offset;
-   }
-   else
+   /* sprite 0 on this line, strike depends on the background */
+   sprite_y = sprite_ptr->y_loc + 1;
+   if (false == ppu.strikeflag && (sprite_y <= scanline) && (sprite_y > (scanline - sprite_height)) && (0 != sprite_y) && (sprite_y < 240))
    {
-      data_ptr += y_offset;
+      ppu_renderbg(fake_line + 8);
+      ppu_renderoam(fake_line + 8, scanline);
+      return;
    }
 
-   /* check for a solid sprite 0 pixel */
-   pat1 = data_ptr[0];
-   pat2 = data_ptr[8];
-   color = ((pat2 & 0xAA) << 8) | ((pat2 & 0x55) << 1) | ((pat1 & 0xAA) << 7) | (pat1 & 0x55);
-
-   if (color)
-   {
-      uint8 colors[8];
-
-      /* buckle up, it's going to get ugly... */
-      if (0 == (attrib & OAMF_HFLIP))
-      {
-         colors[0] = (color >> 14) & 3;
-         colors[1] = (color >> 6) & 3;
-         colors[2] = (color >> 12) & 3;
-         colors[3] = (color >> 4) & 3;
-         colors[4] = (color >> 10) & 3;
-         colors[5] = (color >> 2) & 3;
-         colors[6] = (color >> 8) & 3;
-         colors[7] = color & 3;
-      }
-      else
-      {
-         colors[7] = (color >> 14) & 3;
-         colors[6] = (color >> 6) & 3;
-         colors[5] = (color >> 12) & 3;
-         colors[4] = (color >> 4) & 3;
-         colors[3] = (color >> 10) & 3;
-         colors[2] = (color >> 2) & 3;
-         colors[1] = (color >> 8) & 3;
-         colors[0] = color & 3;
-      }
-
-      if (colors[0])
-         ppu_setstrike(sprite_x + 0);
-      else if (colors[1])
-         ppu_setstrike(sprite_x + 1);
-      else if (colors[2])
-         ppu_setstrike(sprite_x + 2);
-      else if (colors[3])
-         ppu_setstrike(sprite_x + 3);
-      else if (colors[4])
-         ppu_setstrike(sprite_x + 4);
-      else if (colors[5])
-         ppu_setstrike(sprite_x + 5);
-      else if (colors[6])
-         ppu_setstrike(sprite_x + 6);
-      else if (colors[7])
-         ppu_setstrike(sprite_x + 7);
-   }
+   ppu_evaloam(scanline);
 }
 
 bool ppu_enabled(void)
@@ -1019,14 +1003,25 @@ static void ppu_renderscanline(bitmap_t *bmp, int scanline, bool draw_flag)
       }
    }
 
-   if (draw_flag)
-      ppu_renderbg(buf);
+   if (false == draw_flag)
+   {
+      ppu_fakeoam(scanline);
+      return;
+   }
+
+   ppu_renderbg(buf);
 
    /* TODO: fetch obj data 1 scanline before */
-   if (true == ppu.drawsprites && true == draw_flag)
+   if (true == ppu.drawsprites)
+   {
       ppu_renderoam(buf, scanline);
+   }
    else
-      ppu_fakeoam(scanline);
+   {
+      /* sprites hidden, run them over a copy of the line for the flags */
+      memcpy(fake_line + 8, buf, NES_SCREEN_WIDTH);
+      ppu_renderoam(fake_line + 8, scanline);
+   }
 }
 
 void ppu_endscanline(int scanline)
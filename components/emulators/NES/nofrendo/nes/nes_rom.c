@@ -27,6 +27,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 
 #include "../noftypes.h"
 #include "nes_rom.h"
@@ -37,6 +38,7 @@
 #include "../gui.h"
 #include "../log.h"
 #include "../osd.h"
+#include "sd_cart.h"
 
 /* Max length for displayed filename */
 #define ROM_DISP_MAXLEN 20
@@ -141,55 +143,38 @@ static int rom_allocsram(rominfo_t *rominfo)
 }
 
 /* If there's a trainer, load it in at $7000 */
-static void rom_loadtrainer(FILE *fp, rominfo_t *rominfo)
+static void rom_loadtrainer(const uint8 *image, rominfo_t *rominfo)
 {
-   ASSERT(fp);
+   ASSERT(image);
    ASSERT(rominfo);
 
    if (rominfo->flags & ROM_FLAG_TRAINER)
    {
-      fread(rominfo->sram + TRAINER_OFFSET, TRAINER_LENGTH, 1, fp);
+      memcpy(rominfo->sram + TRAINER_OFFSET, image + sizeof(inesheader_t), TRAINER_LENGTH);
       nofrendo_log_printf("Read in trainer at $7000\n");
    }
 }
 
-static int rom_loadrom(FILE *fp, rominfo_t *rominfo)
+/* ROM and VROM are views into the image, nothing is copied */
+static int rom_loadrom(uint8 *image, size_t size, rominfo_t *rominfo)
 {
-   ASSERT(fp);
+   size_t offset = sizeof(inesheader_t);
+
+   ASSERT(image);
    ASSERT(rominfo);
 
-   /* Allocate ROM space, and load it up! */
-   // rominfo->rom = malloc(rominfo->rom_banks * ROM_BANK_LENGTH);
-   rominfo->rom = mem_alloc(rominfo->rom_banks * ROM_BANK_LENGTH, false);
-   if (NULL == rominfo->rom)
+   if (rominfo->flags & ROM_FLAG_TRAINER)
+      offset += TRAINER_LENGTH;
+
+   /* a game without VROM gets the zeroed block after the file */
+   if (offset + rominfo->rom_banks * ROM_BANK_LENGTH + rominfo->vrom_banks * VROM_BANK_LENGTH > size + VROM_BANK_LENGTH)
    {
-      gui_sendmsg(GUI_RED, "Could not allocate space for ROM image");
+      gui_sendmsg(GUI_RED, "%s is truncated", rominfo->filename);
       return -1;
    }
-   _fread(rominfo->rom, ROM_BANK_LENGTH, rominfo->rom_banks, fp);
 
-   /* If there's VROM, allocate and stuff it in */
-   if (rominfo->vrom_banks)
-   {
-      // rominfo->vrom = malloc((rominfo->vrom_banks * VROM_BANK_LENGTH));
-      rominfo->vrom = mem_alloc(rominfo->vrom_banks * VROM_BANK_LENGTH, false);
-      if (NULL == rominfo->vrom)
-      {
-         gui_sendmsg(GUI_RED, "Could not allocate space for VROM");
-         return -1;
-      }
-      _fread(rominfo->vrom, VROM_BANK_LENGTH, rominfo->vrom_banks, fp);
-   }
-   else
-   {
-      rominfo->vram = NOFRENDO_MALLOC(VRAM_LENGTH);
-      if (NULL == rominfo->vram)
-      {
-         gui_sendmsg(GUI_RED, "Could not allocate space for VRAM");
-         return -1;
-      }
-      memset(rominfo->vram, 0, VRAM_LENGTH);
-   }
+   rominfo->rom = image + offset;
+   rominfo->vrom = rominfo->rom + rominfo->rom_banks * ROM_BANK_LENGTH;
 
    return 0;
 }
@@ -252,6 +237,31 @@ static FILE *rom_findrom(const char *filename, rominfo_t *rominfo)
    return fp;
 }
 
+/* Read the whole file, like rom_findrom does with the name */
+static uint8 *rom_findimage(const char *filename, rominfo_t *rominfo, size_t *size)
+{
+   uint8 *image;
+
+   ASSERT(rominfo);
+
+   if (NULL == filename)
+      return NULL;
+
+   /* Make a copy of the name so we can extend it */
+   osd_fullname(rominfo->filename, filename);
+
+   /* there's room for the VROM of games that only have VRAM */
+   image = sd_cart_load(rominfo->filename, size, VROM_BANK_LENGTH);
+   if (NULL == image && NULL == strrchr(rominfo->filename, '.'))
+   {
+      /* Didn't find the file?  Maybe the .NES extension was omitted */
+      strncat(rominfo->filename, ".nes", PATH_MAX - strlen(rominfo->filename));
+      image = sd_cart_load(rominfo->filename, size, VROM_BANK_LENGTH);
+   }
+
+   return image;
+}
+
 /* Add ROM name to a list with dirty headers */
 static int rom_adddirty(char *filename)
 {
@@ -309,61 +319,75 @@ int rom_checkmagic(const char *filename)
    return -1;
 }
 
-static int rom_getheader(FILE *fp, rominfo_t *rominfo)
-{
 #define RESERVED_LENGTH 8
-   inesheader_t head;
+
+/* PAL games run at 50Hz. The TV system bit of the header is only trusted
+** when the bytes after it are clean, most dumps only tell it by their name
+*/
+static bool rom_ispal(const inesheader_t *head, const char *filename)
+{
+   uint8 reserved[RESERVED_LENGTH - 2];
+
+   memset(reserved, 0, sizeof(reserved));
+   if ((head->reserved[1] & 0x01) && 0 == memcmp(head->reserved + 2, reserved, sizeof(reserved)))
+      return true;
+
+   return (NULL != strstr(filename, "(E)") || NULL != strstr(filename, "(Europe)") ||
+           NULL != strstr(filename, "(PAL)"));
+}
+
+/* the header is parsed in place */
+static int rom_getheader(const uint8 *image, size_t size, rominfo_t *rominfo)
+{
+   const inesheader_t *head = (const inesheader_t *)image;
    uint8 reserved[RESERVED_LENGTH];
    bool header_dirty;
 
-   ASSERT(fp);
+   ASSERT(image);
    ASSERT(rominfo);
 
-   /* Read in the header */
-   _fread(&head, sizeof(head), 1, fp);
-
-   if (memcmp(head.ines_magic, ROM_INES_MAGIC, 4))
+   if (size < sizeof(inesheader_t) || memcmp(head->ines_magic, ROM_INES_MAGIC, 4))
    {
       gui_sendmsg(GUI_RED, "%s is not a valid ROM image", rominfo->filename);
       return -1;
    }
 
-   rominfo->rom_banks = head.rom_banks;
-   rominfo->vrom_banks = head.vrom_banks;
+   rominfo->rom_banks = head->rom_banks;
+   rominfo->vrom_banks = head->vrom_banks;
    if(!rominfo->vrom_banks) rominfo->vrom_banks = 1; //This solve a bug with the on game menu, if no vrom mem is allocated it doesn't work.
    /* iNES assumptions */
    rominfo->sram_banks = 8; /* 1kB banks, so 8KB */
    rominfo->vram_banks = 1; /* 8kB banks, so 8KB */
-   rominfo->mirror = (head.rom_type & ROM_MIRRORTYPE) ? MIRROR_VERT : MIRROR_HORIZ;
+   rominfo->mirror = (head->rom_type & ROM_MIRRORTYPE) ? MIRROR_VERT : MIRROR_HORIZ;
    rominfo->flags = 0;
-   if (head.rom_type & ROM_BATTERY)
+   if (head->rom_type & ROM_BATTERY)
       rominfo->flags |= ROM_FLAG_BATTERY;
-   if (head.rom_type & ROM_TRAINER)
+   if (head->rom_type & ROM_TRAINER)
       rominfo->flags |= ROM_FLAG_TRAINER;
-   if (head.rom_type & ROM_FOURSCREEN)
+   if (head->rom_type & ROM_FOURSCREEN)
       rominfo->flags |= ROM_FLAG_FOURSCREEN;
    /* TODO: fourscreen a mirroring type? */
-   rominfo->mapper_number = head.rom_type >> 4;
+   rominfo->mapper_number = head->rom_type >> 4;
 
    /* Do a compare - see if we've got a clean extended header */
    memset(reserved, 0, RESERVED_LENGTH);
-   if (0 == memcmp(head.reserved, reserved, RESERVED_LENGTH))
+   if (0 == memcmp(head->reserved, reserved, RESERVED_LENGTH))
    {
       /* We were clean */
       header_dirty = false;
-      rominfo->mapper_number |= (head.mapper_hinybble & 0xF0);
+      rominfo->mapper_number |= (head->mapper_hinybble & 0xF0);
    }
    else
    {
       header_dirty = true;
 
       /* @!?#@! DiskDude. */
-      if (('D' == head.mapper_hinybble) && (0 == memcmp(head.reserved, "iskDude!", 8)))
+      if (('D' == head->mapper_hinybble) && (0 == memcmp(head->reserved, "iskDude!", 8)))
          nofrendo_log_printf("`DiskDude!' found in ROM header, ignoring high mapper nybble\n");
       else
       {
          nofrendo_log_printf("ROM header dirty, possible problem\n");
-         rominfo->mapper_number |= (head.mapper_hinybble & 0xF0);
+         rominfo->mapper_number |= (head->mapper_hinybble & 0xF0);
       }
 
       rom_adddirty(rominfo->filename);
@@ -374,6 +398,9 @@ static int rom_getheader(FILE *fp, rominfo_t *rominfo)
    if (99 == rominfo->mapper_number)
       rominfo->flags |= ROM_FLAG_VERSUS;
 
+   if (rom_ispal(head, rominfo->filename))
+      rominfo->flags |= ROM_FLAG_PAL;
+
    return 0;
 }
 
@@ -420,7 +447,8 @@ char *rom_getinfo(rominfo_t *rominfo)
 /* Load a ROM image into memory */
 rominfo_t *rom_load(const char *filename)
 {
-   FILE *fp;
+   uint8 *image;
+   size_t size = 0;
    rominfo_t *rominfo;
 
    rominfo = NOFRENDO_MALLOC(sizeof(rominfo_t));
@@ -429,15 +457,16 @@ rominfo_t *rom_load(const char *filename)
 
    memset(rominfo, 0, sizeof(rominfo_t));
 
-   fp = rom_findrom(filename, rominfo);
+   image = rom_findimage(filename, rominfo, &size);
+   rominfo->image = image;
 
-   if (NULL == fp)
+   if (NULL == image)
       gui_sendmsg(GUI_RED, "%s not found, will use default ROM", filename);
 
    /* Get the header and stick it into rominfo struct */
-   if (NULL == fp)
+   if (NULL == image)
       intro_get_header(rominfo);
-   else if (rom_getheader(fp, rominfo))
+   else if (rom_getheader(image, size, rominfo))
       goto _fail;
 
    /* Make sure we really support the mapper */
@@ -454,21 +483,17 @@ rominfo_t *rom_load(const char *filename)
    if (rom_allocsram(rominfo))
       goto _fail;
 
-   if (NULL != fp)
-      rom_loadtrainer(fp, rominfo);
+   if (NULL != image)
+      rom_loadtrainer(image, rominfo);
 
-   if (NULL == fp)
+   if (NULL == image)
    {
       if (intro_get_rom(rominfo))
          goto _fail;
    }
-   else if (rom_loadrom(fp, rominfo))
+   else if (rom_loadrom(image, size, rominfo))
       goto _fail;
 
-   /* Close the file */
-   if (NULL != fp)
-      _fclose(fp);
-
    rom_loadsram(rominfo);
 
    /* See if there's a palette we can load up */
@@ -479,8 +504,6 @@ rominfo_t *rom_load(const char *filename)
    return rominfo;
 
 _fail:
-   if (NULL != fp)
-      _fclose(fp);
    rom_free(&rominfo);
    return NULL;
 }
@@ -506,10 +529,18 @@ void rom_free(rominfo_t **rominfo)
 
    if ((*rominfo)->sram)
       NOFRENDO_FREE((*rominfo)->sram);
-   if ((*rominfo)->rom)
-      NOFRENDO_FREE((*rominfo)->rom);
-   if ((*rominfo)->vrom)
-      NOFRENDO_FREE((*rominfo)->vrom);
+   /* the ROM and VROM of a file are part of its image */
+   if ((*rominfo)->image)
+   {
+      free((*rominfo)->image);
+   }
+   else
+   {
+      if ((*rominfo)->rom)
+         NOFRENDO_FREE((*rominfo)->rom);
+      if ((*rominfo)->vrom)
+         NOFRENDO_FREE((*rominfo)->vrom);
+   }
    if ((*rominfo)->vram)
       NOFRENDO_FREE((*rominfo)->vram);
 
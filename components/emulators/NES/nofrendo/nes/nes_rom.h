@@ -40,9 +40,13 @@ typedef enum
 #define ROM_FLAG_TRAINER 0x02
 #define ROM_FLAG_FOURSCREEN 0x04
 #define ROM_FLAG_VERSUS 0x08
+#define ROM_FLAG_PAL 0x10
 
 typedef struct rominfo_s
 {
+   /* whole cartridge file, ROM and VROM point into it */
+   uint8 *image;
+
    /* pointers to ROM and VROM */
    uint8 *rom, *vrom;
 
@@ -25,6 +25,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 
 #include "../noftypes.h"
 #include "nesstate.h"
@@ -34,9 +35,12 @@
 #include "../osd.h"
 #include "../libsnss/libsnss.h"
 #include "../cpu/nes6502.h"
+#include "sd_save.h"
+#include "sd_slots.h"
+#include "esp32/rom/crc.h"
 
 #define FIRST_STATE_SLOT 0
-#define LAST_STATE_SLOT 9
+#define LAST_STATE_SLOT SD_SLOT_RESUME
 
 static int state_slot = FIRST_STATE_SLOT;
 
@@ -336,33 +340,27 @@ static void load_mapperblock(nes_t *state, SNSS_FILE *snssFile)
    mmc_setcontext(state->mmc);
 }
 
-int state_save(void)
+/* biggest state given by state_save_mem */
+size_t state_size(void)
+{
+   return SNSS_MAX_LENGTH;
+}
+
+/* serialize the machine on buf, returns the length of the state or 0 */
+size_t state_save_mem(uint8_t *buf)
 {
    SNSS_FILE *snssFile;
    SNSS_RETURN_CODE status;
-   char fn[PATH_MAX + 1], ext[5];
+   size_t length;
    nes_t *machine;
+
    /* get the pointer to our NES machine context */
    machine = nes_getcontextptr();
-   
-   //Get game name
-   uint16_t route_len = strlen(machine->rominfo->filename) -4;
-   char *game_name = calloc(route_len - 13,sizeof(char));
-   strncpy(game_name,machine->rominfo->filename + 12, route_len - 8);
-   //Build save data route
-   sprintf(fn,"/sdcard/NES/Save_Data/%s.sav",game_name);
-
    ASSERT(machine);
-   /* build our filename using the image's name and the slot number */
-   
 
-   /* open our state file for writing */
-   status = SNSS_OpenFile(&snssFile, fn, SNSS_OPEN_WRITE);
-   if (SNSS_OK != status){
-      printf("Error opening\r\n");
+   status = SNSS_OpenBuffer(&snssFile, buf, state_size(), SNSS_OPEN_WRITE);
+   if (SNSS_OK != status)
       goto _error;
-   }
-      
 
    /* now get all of our blocks */
    if (0 == save_baseblock(machine, snssFile))
@@ -400,28 +398,26 @@ int state_save(void)
          goto _error;
    }
 
-   /* close the file, we're done */
+   /* close the buffer, we're done */
+   length = snssFile->length;
    status = SNSS_CloseFile(&snssFile);
    if (SNSS_OK != status)
       goto _error;
 
-   gui_sendmsg(GUI_GREEN, "State %d saved", state_slot);
-   free(game_name);
-   return 0;
+   return length;
 
 _error:
-   gui_sendmsg(GUI_RED, "error: %s", SNSS_GetErrorString(status));
+   nofrendo_log_printf("state save error: %s\n", SNSS_GetErrorString(status));
    SNSS_CloseFile(&snssFile);
-   free(game_name);
-   return -1;
+   return 0;
 }
 
-int state_load(void)
+/* restore the machine from a state of state_save_mem */
+int state_load_mem(const uint8_t *buf, size_t size)
 {
    SNSS_FILE *snssFile;
    SNSS_RETURN_CODE status;
    SNSS_BLOCK_TYPE block_type;
-   char fn[PATH_MAX + 1], ext[5];
    unsigned int i;
    nes_t *machine;
 
@@ -429,15 +425,8 @@ int state_load(void)
    machine = nes_getcontextptr();
    ASSERT(machine);
 
-   //Get game name
-   uint16_t route_len = strlen(machine->rominfo->filename) -4;
-   char *game_name = calloc(route_len - 13,sizeof(char));
-   strncpy(game_name,machine->rominfo->filename + 12, route_len - 8);
-   //Build save data route
-   sprintf(fn,"/sdcard/NES/Save_Data/%s.sav",game_name);
-
-   /* open our file for writing */
-   status = SNSS_OpenFile(&snssFile, fn, SNSS_OPEN_READ);
+   /* the buffer is only read */
+   status = SNSS_OpenBuffer(&snssFile, (unsigned char *) buf, size, SNSS_OPEN_READ);
    if (SNSS_OK != status)
       goto _error;
 
@@ -485,22 +474,428 @@ int state_load(void)
       }
    }
 
-   /* close file, we're done */
+   /* close the buffer, we're done */
    status = SNSS_CloseFile(&snssFile);
    if (SNSS_OK != status)
       goto _error;
 
-   gui_sendmsg(GUI_GREEN, "State %d restored", state_slot);
-   free(game_name);
    return 0;
 
 _error:
-   gui_sendmsg(GUI_RED, "error: %s", SNSS_GetErrorString(status));
+   nofrendo_log_printf("state load error: %s\n", SNSS_GetErrorString(status));
    SNSS_CloseFile(&snssFile);
-   free(game_name);
    return -1;
 }
 
+/*
+** Packed states
+**
+** The file on the SD card is a directory of the SNSS blocks followed by
+** each block packed with a small LZ77 coder. A block that didn't change
+** since the last save or load of the same game isn't packed again, its
+** packed bytes are copied from the previous file, and a state equal to
+** the one on the card isn't written at all. Files starting with the SNSS
+** tag, from older firmwares, are loaded as they are.
+*/
+
+#define STATE_PACK_MAGIC   0x3153534E  /* "NSS1" */
+#define STATE_PACK_BLOCKS  8
+
+#define SNSS_HEADER_LENGTH 8
+#define SNSS_BLOCK_HEADER  12
+
+typedef struct packheader_s
+{
+   uint32_t magic;
+   uint32_t blocks;
+} packheader_t;
+
+typedef struct packentry_s
+{
+   char tag[4];
+   uint32_t raw_size;   /* SNSS block with its header */
+   uint32_t pack_size;  /* same as raw_size if the block is stored as is */
+   uint32_t crc;        /* of the raw block */
+} packentry_t;
+
+#define STATE_PACK_DIR (sizeof(packheader_t) + STATE_PACK_BLOCKS * sizeof(packentry_t))
+
+/* LZ77 tokens: 0x00-0x7F are 1-128 literals, 0x80-0xFF a match of 3-130
+** bytes followed by its 16 bit offset. The SNSS blocks are smaller than
+** 64KB, so every offset fits.
+*/
+#define LZ_HASH_BITS       12
+#define LZ_MIN_MATCH       3
+#define LZ_MAX_MATCH       (0x7F + LZ_MIN_MATCH)
+#define LZ_MAX_LITERALS    0x80
+#define LZ_MAX_BLOCK       0xFFFF
+
+/* last file saved or loaded, its blocks are reused by the next save */
+static uint8_t *state_cache = NULL;
+
+static uint32_t read_be32(const uint8_t *data)
+{
+   return (data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+}
+
+static int lz_literals(const uint8_t *src, size_t count, uint8_t *dst, size_t *out, size_t limit)
+{
+   size_t n;
+
+   while (count)
+   {
+      n = (count > LZ_MAX_LITERALS) ? LZ_MAX_LITERALS : count;
+      if (*out + 1 + n > limit)
+         return -1;
+
+      dst[(*out)++] = n - 1;
+      memcpy(dst + *out, src, n);
+      *out += n;
+      src += n;
+      count -= n;
+   }
+
+   return 0;
+}
+
+/* returns the packed length, or 0 if it wouldn't fit in limit bytes */
+static size_t lz_pack(const uint8_t *src, size_t size, uint8_t *dst, size_t limit, uint16_t *table)
+{
+   size_t in = 0, out = 0, lit = 0;
+   size_t cand, len;
+   uint32_t hash;
+
+   memset(table, 0, sizeof(uint16_t) << LZ_HASH_BITS);
+
+   while (in + LZ_MIN_MATCH <= size)
+   {
+      hash = ((src[in] << 16) | (src[in + 1] << 8) | src[in + 2]) * 2654435761u;
+      hash >>= 32 - LZ_HASH_BITS;
+      cand = table[hash];
+      table[hash] = in;
+
+      if (cand < in && src[cand] == src[in] && src[cand + 1] == src[in + 1]
+          && src[cand + 2] == src[in + 2])
+      {
+         len = LZ_MIN_MATCH;
+         while (in + len < size && len < LZ_MAX_MATCH && src[cand + len] == src[in + len])
+            len++;
+
+         if (lz_literals(src + lit, in - lit, dst, &out, limit) || out + 3 > limit)
+            return 0;
+
+         dst[out++] = 0x80 | (len - LZ_MIN_MATCH);
+         dst[out++] = (in - cand) & 0xFF;
+         dst[out++] = (in - cand) >> 8;
+
+         in += len;
+         lit = in;
+      }
+      else
+      {
+         in++;
+      }
+   }
+
+   if (lz_literals(src + lit, size - lit, dst, &out, limit))
+      return 0;
+
+   return out;
+}
+
+static int lz_unpack(const uint8_t *src, size_t size, uint8_t *dst, size_t raw_size)
+{
+   size_t in = 0, out = 0, n, offset, i;
+   uint8_t token;
+
+   while (in < size)
+   {
+      token = src[in++];
+      if (token < 0x80)
+      {
+         n = token + 1;
+         if (in + n > size || out + n > raw_size)
+            return -1;
+
+         memcpy(dst + out, src + in, n);
+         in += n;
+      }
+      else
+      {
+         n = (token & 0x7F) + LZ_MIN_MATCH;
+         if (in + 2 > size)
+            return -1;
+
+         offset = src[in] | (src[in + 1] << 8);
+         in += 2;
+         if (0 == offset || offset > out || out + n > raw_size)
+            return -1;
+
+         /* runs overlap their own output, so they're copied forward */
+         if (offset >= n)
+            memcpy(dst + out, dst + out - offset, n);
+         else
+            for (i = 0; i < n; i++)
+               dst[out + i] = dst[out + i - offset];
+      }
+      out += n;
+   }
+
+   return (out == raw_size) ? 0 : -1;
+}
+
+/* copy the packed block from the cached file if it has the same one */
+static size_t state_reuseblock(const packentry_t *entry, uint8_t *dst)
+{
+   packheader_t header;
+   packentry_t cached;
+   size_t offset;
+   uint32_t i;
+
+   if (NULL == state_cache)
+      return 0;
+
+   memcpy(&header, state_cache, sizeof(header));
+   offset = sizeof(header) + header.blocks * sizeof(packentry_t);
+
+   for (i = 0; i < header.blocks; i++)
+   {
+      memcpy(&cached, state_cache + sizeof(header) + i * sizeof(cached), sizeof(cached));
+      if (0 == memcmp(cached.tag, entry->tag, 4) && cached.raw_size == entry->raw_size
+          && cached.crc == entry->crc)
+      {
+         memcpy(dst, state_cache + offset, cached.pack_size);
+         return cached.pack_size;
+      }
+      offset += cached.pack_size;
+   }
+
+   return 0;
+}
+
+/* the cache owns data from now on */
+static void state_setcache(uint8_t *data)
+{
+   if (state_cache)
+      free(state_cache);
+
+   state_cache = data;
+}
+
+/* pack a state of state_save_mem, pack needs state_size() + STATE_PACK_DIR bytes */
+static size_t state_pack(const uint8_t *raw, size_t length, uint8_t *pack)
+{
+   packheader_t header;
+   packentry_t entry;
+   uint16_t *table;
+   size_t pos, out;
+   uint32_t i;
+   int reused = 0;
+
+   if (length < SNSS_HEADER_LENGTH || memcmp(raw, "SNSS", 4))
+      return 0;
+
+   header.magic = STATE_PACK_MAGIC;
+   header.blocks = read_be32(raw + 4);
+   if (header.blocks > STATE_PACK_BLOCKS)
+      return 0;
+
+   table = malloc(sizeof(uint16_t) << LZ_HASH_BITS);
+   if (NULL == table)
+      return 0;
+
+   memcpy(pack, &header, sizeof(header));
+   pos = SNSS_HEADER_LENGTH;
+   out = sizeof(header) + header.blocks * sizeof(packentry_t);
+
+   for (i = 0; i < header.blocks; i++)
+   {
+      if (pos + SNSS_BLOCK_HEADER > length
+          || read_be32(raw + pos + 8) > length - pos - SNSS_BLOCK_HEADER)
+      {
+         free(table);
+         return 0;
+      }
+
+      memcpy(entry.tag, raw + pos, 4);
+      entry.raw_size = SNSS_BLOCK_HEADER + read_be32(raw + pos + 8);
+      entry.crc = crc32_le(0, raw + pos, entry.raw_size);
+
+      entry.pack_size = state_reuseblock(&entry, pack + out);
+      if (entry.pack_size)
+         reused++;
+      else if (entry.raw_size <= LZ_MAX_BLOCK)
+         entry.pack_size = lz_pack(raw + pos, entry.raw_size, pack + out, entry.raw_size - 1, table);
+
+      /* didn't shrink, it's stored as is */
+      if (0 == entry.pack_size)
+      {
+         memcpy(pack + out, raw + pos, entry.raw_size);
+         entry.pack_size = entry.raw_size;
+      }
+
+      memcpy(pack + sizeof(header) + i * sizeof(entry), &entry, sizeof(entry));
+      out += entry.pack_size;
+      pos += entry.raw_size;
+   }
+
+   free(table);
+
+   nofrendo_log_printf("state packed from %d to %d bytes, %d of %d blocks reused\n",
+                       (int) length, (int) out, reused, (int) header.blocks);
+   return out;
+}
+
+/* rebuild the SNSS state of a packed file on raw, returns its length or 0 */
+static size_t state_unpack(const uint8_t *pack, size_t size, uint8_t *raw, size_t raw_size)
+{
+   packheader_t header;
+   packentry_t entry;
+   size_t offset, out;
+   uint32_t i;
+
+   if (size < sizeof(header))
+      return 0;
+
+   memcpy(&header, pack, sizeof(header));
+   if (STATE_PACK_MAGIC != header.magic || header.blocks > STATE_PACK_BLOCKS
+       || size < sizeof(header) + header.blocks * sizeof(entry) || raw_size < SNSS_HEADER_LENGTH)
+      return 0;
+
+   memcpy(raw, "SNSS", 4);
+   raw[4] = header.blocks >> 24;
+   raw[5] = header.blocks >> 16;
+   raw[6] = header.blocks >> 8;
+   raw[7] = header.blocks;
+
+   offset = sizeof(header) + header.blocks * sizeof(entry);
+   out = SNSS_HEADER_LENGTH;
+
+   for (i = 0; i < header.blocks; i++)
+   {
+      memcpy(&entry, pack + sizeof(header) + i * sizeof(entry), sizeof(entry));
+      if (entry.pack_size > size - offset || entry.raw_size > raw_size - out
+          || entry.pack_size > entry.raw_size)
+         return 0;
+
+      if (entry.pack_size == entry.raw_size)
+         memcpy(raw + out, pack + offset, entry.raw_size);
+      else if (lz_unpack(pack + offset, entry.pack_size, raw + out, entry.raw_size))
+         return 0;
+
+      if (crc32_le(0, raw + out, entry.raw_size) != entry.crc)
+      {
+         nofrendo_log_printf("state block %.4s is broken\n", entry.tag);
+         return 0;
+      }
+
+      offset += entry.pack_size;
+      out += entry.raw_size;
+   }
+
+   return out;
+}
+
+int state_save(void)
+{
+   char fn[PATH_MAX + 1];
+   uint8_t *raw, *pack;
+   size_t length;
+
+   if (osd_makestatename(fn, sizeof(fn), state_slot))
+      goto _error;
+
+   /* the state is serialized on RAM, the save writer puts it on the SD card */
+   raw = sd_save_alloc(state_size());
+   if (NULL == raw)
+      goto _error;
+
+   length = state_save_mem(raw);
+   pack = length ? sd_save_alloc(state_size() + STATE_PACK_DIR) : NULL;
+   if (NULL == pack)
+   {
+      free(raw);
+      goto _error;
+   }
+
+   length = state_pack(raw, length, pack);
+   free(raw);
+   if (0 == length)
+   {
+      free(pack);
+      goto _error;
+   }
+
+   /* the writer frees its copy, the next save reuses the blocks of this one. The file is
+   ** always written, the writer may still fail after this returns.
+   */
+   raw = sd_save_alloc(length);
+   if (raw)
+      memcpy(raw, pack, length);
+   state_setcache(raw);
+
+   if (!sd_save_write(fn, pack, length))
+      goto _error;
+
+   osd_statesaved(state_slot);
+   gui_sendmsg(GUI_GREEN, "State %d saved", state_slot);
+   return 0;
+
+_error:
+   gui_sendmsg(GUI_RED, "error: state not saved");
+   return -1;
+}
+
+int state_load(void)
+{
+   char fn[PATH_MAX + 1];
+   uint8_t *buf, *raw;
+   size_t size = 0, length;
+   int status = -1;
+
+   if (osd_makestatename(fn, sizeof(fn), state_slot))
+   {
+      gui_sendmsg(GUI_RED, "error: no state found");
+      return -1;
+   }
+
+   buf = sd_save_read(fn, &size);
+   if (NULL == buf)
+   {
+      gui_sendmsg(GUI_RED, "error: no state found");
+      return -1;
+   }
+
+   if (size >= SNSS_HEADER_LENGTH && 0 == memcmp(buf, "SNSS", 4))
+   {
+      status = state_load_mem(buf, size);
+      free(buf);
+   }
+   else
+   {
+      raw = sd_save_alloc(state_size());
+      length = raw ? state_unpack(buf, size, raw, state_size()) : 0;
+      if (length)
+         status = state_load_mem(raw, length);
+      free(raw);
+
+      /* the next save reuses the blocks of this file */
+      if (0 == status)
+         state_setcache(buf);
+      else
+         free(buf);
+   }
+
+   if (0 != status)
+   {
+      gui_sendmsg(GUI_RED, "error: state not restored");
+      return -1;
+   }
+
+   gui_sendmsg(GUI_GREEN, "State %d restored", state_slot);
+   return 0;
+}
+
 /*
 ** $Log: nesstate.c,v $
 ** Revision 1.2  2001/04/27 14:37:11  neil
@@ -26,9 +26,14 @@
 #ifndef _NESSTATE_H_
 #define _NESSTATE_H_
 
+#include <stdint.h>
+#include <stddef.h>
 #include "nes.h"
 
 extern void state_setslot(int slot);
+extern size_t state_size(void);
+extern size_t state_save_mem(uint8_t *buf);
+extern int state_load_mem(const uint8_t *buf, size_t size);
 extern int state_load();
 extern int state_save();
 
@@ -55,14 +55,6 @@ static struct
    bool quit;
 } console;
 
-/* our happy little timer ISR */
-volatile int nofrendo_ticks = 0;
-static void timer_isr(void)
-{
-   nofrendo_ticks++;
-}
-static void timer_isr_end(void) {} /* code marker for djgpp */
-
 static void shutdown_everything(void)
 {
    if (console.filename)
@@ -134,14 +126,6 @@ static system_t detect_systemtype(const char *filename)
    return system_unknown;
 }
 
-static int install_timer(int hertz)
-{
-   return osd_installtimer(hertz, (void *)timer_isr,
-                           (int)timer_isr_end - (int)timer_isr,
-                           (void *)&nofrendo_ticks,
-                           sizeof(nofrendo_ticks));
-}
-
 /* This assumes there is no current context */
 static int internal_insert(const char *filename, system_t type)
 {
@@ -172,9 +156,7 @@ static int internal_insert(const char *filename, system_t type)
 
       vid_setmode(NES_SCREEN_WIDTH, NES_SCREEN_HEIGHT);
 
-      if (install_timer(NES_REFRESH_RATE))
-         return -1;
-
+      /* nes_emulate paces itself on osd_getmicros */
       nes_emulate();
       break;
 
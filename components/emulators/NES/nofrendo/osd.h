@@ -83,8 +83,9 @@ extern int osd_init(void);
 extern void osd_shutdown(void);
 extern int osd_main(int argc, char *argv[]);
 
-extern int osd_installtimer(int frequency, void *func, int funcsize,
-                            void *counter, int countersize);
+/* timing */
+extern uint32 osd_getmicros(void);
+extern void osd_waitmicros(uint32 micros);
 
 /* input */
 extern void osd_getinput(void);
@@ -97,6 +98,11 @@ extern char *osd_newextension(char *string, char *ext);
 /* build a filename for a snapshot, return -ve for error */
 extern int osd_makesnapname(char *filename, int len);
 
+/* build the filename of a state slot, return -ve for error */
+extern int osd_makestatename(char *filename, int len, int slot);
+/* a state of the slot was queued to be written */
+extern void osd_statesaved(int slot);
+
 #endif /* !NSF_PLAYER */
 
 #endif /* _OSD_H_ */
@@ -311,57 +311,70 @@ static void vid_blitscreen(int num_dirties, rect_t *dirty_rects)
       driver->free_write(num_dirties, dirty_rects);
 }
 
-/* TODO: this code is sickly */
+/* a dirty rect is a run of changed lines, as wide as the frame */
+#define MAX_DIRTIES 32
+#define MAX_HASHED_LINES 256
 
-#define CHUNK_WIDTH 256
-#define CHUNK_HEIGHT 16
-#define MAX_DIRTIES ((256 / CHUNK_WIDTH) * (240 / CHUNK_HEIGHT))
-#define DIRTY_CUTOFF ((3 * MAX_DIRTIES) / 4)
+/* hashes of the lines of the last blitted frame */
+static uint32 line_hash[MAX_HASHED_LINES];
 
-#if 0
+/* FNV-1a over the words of a line, so no copy of the last frame is kept */
+INLINE uint32 calc_line_hash(const uint8 *line, int width)
+{
+   const uint32 *word = (const uint32 *) line;
+   uint32 hash = 2166136261u;
+   int i;
+
+   for (i = width >> 2; i; i--)
+      hash = (hash ^ *word++) * 16777619u;
+
+   return hash;
+}
+
+/* every line is hashed, even when the result is a full redraw, so the
+** next frame is compared against what was actually blitted
+*/
 INLINE int calc_dirties(rect_t *list)
 {
-   bool dirty;
    int num_dirties = 0;
-   int i = 0, j, line_offset = 0;
-   int iterations = primary_buffer->height / CHUNK_HEIGHT;
+   bool overflow = false;
+   uint32 hash;
+   int y;
 
-   for (i = 0; i < iterations; i++)
+   for (y = 0; y < primary_buffer->height; y++)
    {
-      dirty = false;
-
-      j = line_offset;
-      DUFFS_DEVICE(
-      { 
-         if (vid_memcmp(back_buffer->line[j], primary_buffer->line[j], 
-                        CHUNK_WIDTH))
-         { 
-            dirty = true; 
-            break; 
-         } 
-
-         j++; 
-      }, CHUNK_HEIGHT);
-
-      if (true == dirty)
+      if (y < MAX_HASHED_LINES)
       {
-         list->h = CHUNK_HEIGHT;
-         list->w = CHUNK_WIDTH;
-         list->x = 0;
-         list->y = line_offset;
-         list++;
-
-         /* totally arbitrary at this point */
-         if (++num_dirties > DIRTY_CUTOFF)
-            return -1;
+         hash = calc_line_hash(primary_buffer->line[y], primary_buffer->width);
+         if (hash == line_hash[y])
+            continue;
+         line_hash[y] = hash;
       }
 
-      line_offset += CHUNK_HEIGHT;
+      if (overflow)
+         continue;
+
+      /* grow the rect of the line above */
+      if (num_dirties && list[num_dirties - 1].y + list[num_dirties - 1].h == y)
+      {
+         list[num_dirties - 1].h++;
+      }
+      else if (num_dirties == MAX_DIRTIES)
+      {
+         overflow = true;
+      }
+      else
+      {
+         list[num_dirties].x = 0;
+         list[num_dirties].y = y;
+         list[num_dirties].w = primary_buffer->width;
+         list[num_dirties].h = 1;
+         num_dirties++;
+      }
    }
 
-   return num_dirties;
+   return overflow ? -1 : num_dirties;
 }
-#endif
 
 void vid_flush(void)
 {
@@ -371,22 +384,23 @@ void vid_flush(void)
 
    ASSERT(driver);
 
+   num_dirties = calc_dirties(dirty_rects);
+
    if (true == driver->invalidate)
    {
       driver->invalidate = false;
       num_dirties = -1;
    }
-   else
-   {
-      //num_dirties = calc_dirties(dirty_rects);
-      num_dirties = -1;
-   }
 
    if (driver->custom_blit)
       driver->custom_blit(primary_buffer, num_dirties, dirty_rects);
    else
       vid_blitscreen(num_dirties, dirty_rects);
 
+   /* the driver owns the frames, the blitted one isn't ours anymore */
+   if (driver->next_frame)
+      primary_buffer = driver->next_frame();
+
 #ifdef NOFRENDO_DOUBLE_FRAMEBUFFER
    /* Swap pointers to the main/back buffers */
    temp = back_buffer;
@@ -398,6 +412,18 @@ void vid_flush(void)
 /* emulated machine tells us which resolution it wants */
 int vid_setmode(int width, int height)
 {
+   /* frames given by the driver, they are allocated once */
+   if (driver && driver->next_frame)
+   {
+      if (NULL == primary_buffer)
+         primary_buffer = driver->next_frame();
+      if (NULL == primary_buffer)
+         return -1;
+
+      bmp_clear(primary_buffer, GUI_BLACK);
+      return 0;
+   }
+
    if (NULL != primary_buffer)
       bmp_destroy(&primary_buffer);
 #ifdef NOFRENDO_DOUBLE_FRAMEBUFFER
@@ -476,7 +502,9 @@ void vid_shutdown(void)
    if (NULL == driver)
       return;
 
-   if (NULL != primary_buffer)
+   if (driver->next_frame)
+      primary_buffer = NULL;
+   else if (NULL != primary_buffer)
       bmp_destroy(&primary_buffer);
 
 #ifdef NOFRENDO_DOUBLE_FRAMEBUFFER
@@ -51,6 +51,10 @@ typedef struct viddriver_s
                        rect_t *dirty_rects);
    /* immediately invalidate the buffer, i.e. full redraw */
    bool invalidate;
+   /* get the bitmap where the next frame is drawn, the last one was given
+   ** to custom_blit (can be NULL, then the same bitmap is always used)
+   */
+   bitmap_t *(*next_frame)(void);
 } viddriver_t;
 
 /* TODO: filth */
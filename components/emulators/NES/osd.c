@@ -1,10 +1,10 @@
 /* start rewrite from: https://github.com/espressif/esp32-nesemu.git */
 #include <freertos/FreeRTOS.h>
-#include <freertos/timers.h>
 #include <freertos/task.h>
 #include <freertos/queue.h>
 
 #include <esp_heap_caps.h>
+#include <esp_timer.h>
 
 #include <noftypes.h>
 
@@ -14,6 +14,7 @@
 #include <nes/nes.h>
 #include <nes/nes_pal.h>
 #include <nes/nesinput.h>
+#include <nes/nesstate.h>
 #include <nofconfig.h>
 #include <osd.h>
 #include <stdio.h>
@@ -26,12 +27,30 @@
 
 #include <driver/i2s.h>
 #include "system_manager.h"
-
-TimerHandle_t timer;
+#include "sd_slots.h"
+#include "rewind.h"
+
+/* frames drawn by the emulator and shown by the video task */
+#define NES_FRAMES 3
+#define NES_FRAME_SIZE (NES_SCREEN_WIDTH * NES_SCREEN_HEIGHT)
+/* the allocations are checked every 10 seconds of game */
+#define ALLOC_CHECK_FRAMES (NES_REFRESH_RATE * 10)
+/* frames emulated per drawn one while R is held, and drawn frames between speed updates */
+#define FAST_FORWARD_FRAMES 4
+#define FAST_FORWARD_REPORT 15
+
+static struct nes_frame frames[NES_FRAMES];
+/* lines of the dropped frames, they are drawn with the next shown one */
+static uint32_t dirty_carry[NES_DIRTY_WORDS];
+static portMUX_TYPE dirty_carry_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t mem_alloc_count = 0;
+static bool fast_forward = false;
 
 /* memory allocation */
 extern void *mem_alloc(int size, bool prefer_fast_memory)
 {
+	mem_alloc_count++;
+
 	if (prefer_fast_memory)
 	{
 		return heap_caps_malloc(size, MALLOC_CAP_8BIT);
@@ -60,7 +79,7 @@ void osd_stopsound(){
 
 
 void do_audio_frame(){
-    int left=DEFAULT_SAMPLERATE/NES_REFRESH_RATE;
+    int left=DEFAULT_SAMPLERATE/nes_getcontextptr()->refresh_rate;
     while(left) {
         int n=DEFAULT_FRAGSIZE;
         if (n>left) n=left;
@@ -73,7 +92,11 @@ void do_audio_frame(){
             audio_frame[i*2]= (short)sample;
             audio_frame[i*2+1] = (short)sample;
         }
-        audio_submit(audio_frame, n);
+        /* while fast forwarding, the samples the I2S can't take now are dropped */
+        if (fast_forward)
+            audio_submit_nowait(audio_frame, n);
+        else
+            audio_submit(audio_frame, n);
         left-=n;
     }
 }
@@ -96,13 +119,39 @@ static void displayTask(void *arg)
 	{
 		// xQueueReceive(vidQueue, &bmp, portMAX_DELAY); //skip one frame to drop to 30
 		xQueueReceive(vidQueue, &bmp, portMAX_DELAY);
-        display_HAL_NES_frame((const uint8_t **)bmp->line[0]);
+        display_HAL_NES_frame((const uint8_t *)bmp->line[0], NULL);
 	}
 }
 
 /* get info */
 static char fb[1]; //dummy
-bitmap_t *myBitmap;
+bitmap_t *myBitmap = NULL;
+
+/* The frames are allocated once, the emulator draws on the internal RAM if there is room.
+   Each frame is owned by the emulator, nofrendo_vidQueue or the video task, which returns
+   it through nofrendo_frameQueue once it's on the screen. */
+static int init_frames(void)
+{
+	nofrendo_frameQueue = xQueueCreate(NES_FRAMES, sizeof(struct nes_frame *));
+	if (NULL == nofrendo_frameQueue)
+		return -1;
+
+	for (int i = 0; i < NES_FRAMES; i++)
+	{
+		uint8 *data = heap_caps_malloc_prefer(NES_FRAME_SIZE, 2, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, MALLOC_CAP_SPIRAM);
+		if (NULL == data)
+			return -1;
+
+		frames[i].bmp = bmp_createhw(data, NES_SCREEN_WIDTH, NES_SCREEN_HEIGHT, NES_SCREEN_WIDTH);
+		if (NULL == frames[i].bmp)
+			return -1;
+
+		struct nes_frame *frame = &frames[i];
+		xQueueSend(nofrendo_frameQueue, &frame, 0);
+	}
+
+	return 0;
+}
 
 /* initialise video */
 int8 btn_ss;//Variable to save button state save selected option
@@ -150,20 +199,100 @@ static void clear(uint8 color)
 static bitmap_t *lock_write(void)
 {
 	// SDL_LockSurface(mySurface);
-	myBitmap = bmp_createhw((uint8 *)fb, NES_SCREEN_WIDTH, NES_SCREEN_HEIGHT, NES_SCREEN_WIDTH * 2);
+	// Only its size is used, the frames are drawn by the video task
+	if (NULL == myBitmap)
+		myBitmap = bmp_createhw((uint8 *)fb, NES_SCREEN_WIDTH, NES_SCREEN_HEIGHT, NES_SCREEN_WIDTH * 2);
 	return myBitmap;
 }
 
 /* release the resource */
 static void free_write(int num_dirties, rect_t *dirty_rects)
 {
-	bmp_destroy(&myBitmap);
 }
 
 static void custom_blit(bitmap_t *bmp, int num_dirties, rect_t *dirty_rects)
 {
-	xQueueSend(nofrendo_vidQueue, &bmp, 0);
+	static int frame_count = 0;
+	static uint32_t last_alloc_count = 0;
+	static uint32_t dirty_lines = 0;
+	struct nes_frame *frame = NULL;
+	int i, y;
+
+	for (i = 0; i < NES_FRAMES; i++)
+		if (frames[i].bmp == bmp)
+			frame = &frames[i];
+	if (NULL == frame)
+		return;
+
+	// Only the changed lines are scaled and sent to the display
+	if (-1 == num_dirties)
+	{
+		memset(frame->dirty, 0xFF, sizeof(frame->dirty));
+	}
+	else
+	{
+		memset(frame->dirty, 0, sizeof(frame->dirty));
+		for (i = 0; i < num_dirties; i++)
+			for (y = dirty_rects[i].y; y < dirty_rects[i].y + dirty_rects[i].h; y++)
+				frame->dirty[y >> 5] |= 1u << (y & 31);
+	}
+
+	for (i = 0; i < NES_DIRTY_WORDS; i++)
+		dirty_lines += __builtin_popcount(frame->dirty[i]);
+
+	// The frame is given to the video task, the emulator doesn't touch it anymore
+	xQueueSend(nofrendo_vidQueue, &frame, 0);
 	do_audio_frame();
+
+	if (++frame_count == ALLOC_CHECK_FRAMES)
+	{
+		if (mem_alloc_count != last_alloc_count)
+			nofrendo_log_printf("%d allocations on the last %d frames\n", (int)(mem_alloc_count - last_alloc_count), frame_count);
+		nofrendo_log_printf("%d%% of the lines redrawn\n", (int)(dirty_lines * 100 / (frame_count * NES_SCREEN_HEIGHT)));
+		last_alloc_count = mem_alloc_count;
+		dirty_lines = 0;
+		frame_count = 0;
+	}
+}
+
+/* get a free frame to draw the next one */
+static bitmap_t *next_frame(void)
+{
+	struct nes_frame *frame = NULL;
+	int i;
+
+	// If the display is late, the waiting frame is dropped instead of stopping the emulator.
+	// Its changed lines never reached the screen, so they are drawn with the next frame.
+	if (xQueueReceive(nofrendo_frameQueue, &frame, 0) != pdTRUE)
+	{
+		if (xQueueReceive(nofrendo_vidQueue, &frame, 0) == pdTRUE)
+		{
+			portENTER_CRITICAL(&dirty_carry_lock);
+			for (i = 0; i < NES_DIRTY_WORDS; i++)
+				dirty_carry[i] |= frame->dirty[i];
+			portEXIT_CRITICAL(&dirty_carry_lock);
+		}
+		else
+		{
+			xQueueReceive(nofrendo_frameQueue, &frame, portMAX_DELAY);
+		}
+	}
+
+	return frame->bmp;
+}
+
+/* lines of the frame to draw, plus the ones of the frames dropped before it */
+void NES_frame_lines(const struct nes_frame *frame, uint32_t *lines)
+{
+	int i;
+
+	portENTER_CRITICAL(&dirty_carry_lock);
+	for (i = 0; i < NES_DIRTY_WORDS; i++)
+	{
+		lines[i] = frame->dirty[i] | dirty_carry[i];
+		dirty_carry[i] = 0;
+	}
+	portEXIT_CRITICAL(&dirty_carry_lock);
 }
 
 viddriver_t sdlDriver =
@@ -177,7 +306,8 @@ viddriver_t sdlDriver =
 		lock_write,					/* lock_write */
 		free_write,					/* free_write */
 		custom_blit,				/* custom_blit */
-		false						/* invalidate flag */
+		false,						/* invalidate flag */
+		next_frame					/* next_frame */
 };
 
 void osd_getvideoinfo(vidinfo_t *info)
@@ -191,6 +321,34 @@ void osd_getvideoinfo(vidinfo_t *info)
 
 static void osd_initinput(){}
 
+/* R held runs the emulator unthrottled, the speed reached is shown on the frames */
+static void osd_fastforward(bool held)
+{
+	static int ff_frames = 0;
+	static uint32 start = 0;
+
+	if (held != fast_forward)
+	{
+		fast_forward = held;
+		nes_setfastforward(held ? FAST_FORWARD_FRAMES : 0);
+		if (false == held)
+			display_HAL_set_speed(0);
+		ff_frames = 0;
+		start = osd_getmicros();
+		return;
+	}
+
+	if (held && ++ff_frames == FAST_FORWARD_REPORT)
+	{
+		uint32 now = osd_getmicros();
+		uint32 emulated = ff_frames * FAST_FORWARD_FRAMES * (nes_getcontextptr()->frame_period / 1000);
+
+		display_HAL_set_speed(emulated * 10 / (now - start));
+		ff_frames = 0;
+		start = now;
+	}
+}
+
 static void osd_freeinput(void){}
 
 void osd_getinput(void)
@@ -205,6 +363,17 @@ void osd_getinput(void)
 	oldb = b;
 	event_t evh;
 
+	/* the input is read between frames, the states asked by the other tasks are done here */
+	NES_state_requests();
+
+	/* L held goes back through the rewind history */
+	if (!((b >> 13) & 1))
+		rewind_step(state_load_mem);
+	else
+		rewind_frame(state_save_mem);
+
+	osd_fastforward(!((b >> 5) & 1));
+
 	for (x = 0; x < 16; x++)
 	{
 		if (chg & 1)
@@ -235,6 +404,11 @@ int osd_init()
 	if (osd_init_sound())
 		return -1;
 
+	if (init_frames())
+		return -1;
+
+	rewind_init(state_size());
+
 	//display_init(); //TODO: Modified
     printf("osd_init\r\n");
 	//vidQueue = xQueueCreate(10, sizeof(bitmap_t *));
@@ -257,13 +431,30 @@ int osd_main(int argc, char *argv[])
 	return main_loop(argv[0], system_autodetect);
 }
 
-//Seemingly, this will be called only once. Should call func with a freq of frequency,
-int osd_installtimer(int frequency, void *func, int funcsize, void *counter, int countersize)
+/* microsecond clock of the frame scheduler, it wraps every ~71 minutes */
+uint32 osd_getmicros(void)
 {
-	nofrendo_log_printf("Timer install, configTICK_RATE_HZ=%d, freq=%d\n", configTICK_RATE_HZ, frequency);
-	timer = xTimerCreate("nes", configTICK_RATE_HZ / frequency, pdTRUE, NULL, func);
-	xTimerStart(timer, 0);
-	return 0;
+	return (uint32)esp_timer_get_time();
+}
+
+/* the RTOS tick is too coarse for a frame, only the part under a tick is spun */
+void osd_waitmicros(uint32 micros)
+{
+	uint32 end = osd_getmicros() + micros;
+	const uint32 tick_us = portTICK_PERIOD_MS * 1000;
+	int32 left;
+
+	/* the first delay ends on a tick boundary, from there the delays are whole ticks */
+	if (micros > tick_us)
+	{
+		vTaskDelay(1);
+		left = end - osd_getmicros();
+		if (left > (int32) tick_us)
+			vTaskDelay(left / tick_us);
+	}
+
+	while ((int32)(end - osd_getmicros()) > 0)
+		;
 }
 
 /* filename manipulation */
@@ -289,3 +480,23 @@ int osd_makesnapname(char *filename, int len)
 {
 	return -1;
 }
+
+/* the slots of a game are named after its ROM file */
+static const char *osd_gamename(void)
+{
+	const char *name = nes_getcontextptr()->rominfo->filename;
+	const char *slash = strrchr(name, '/');
+
+	return slash ? slash + 1 : name;
+}
+
+int osd_makestatename(char *filename, int len, int slot)
+{
+	return sd_slot_path(filename, len, NES, osd_gamename(), slot) ? 0 : -1;
+}
+
+/* the slot index gets a thumbnail of the last frame shown */
+void osd_statesaved(int slot)
+{
+	sd_slot_saved(NES, osd_gamename(), slot, display_HAL_thumbnail);
+}
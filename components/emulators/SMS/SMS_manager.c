@@ -9,13 +9,18 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #include "user_input.h"
 #include "display_HAL.h"
 #include "system_configuration.h"
 #include "system_manager.h"
 #include "sound_driver.h"
+#include "sd_save.h"
+#include "sd_slots.h"
+#include "rewind.h"
 
 #include "shared.h"
 
@@ -24,6 +29,10 @@
  *********************/
 #define AUDIO_SAMPLE_RATE (16000)
 
+#define FAST_FORWARD_FRAMES 4
+#define FAST_FORWARD_REPORT 60      // Frames between the updates of the speed shown
+#define STATE_TIMEOUT       2000    // ms to wait the emulator to reach the end of a frame
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -31,6 +40,11 @@ static void audioTask(void *arg);
 static void videoTask(void *arg);
 static void SMSTask(void *arg);
 static void input_set();
+static void fast_forward_speed();
+static bool load_save_data(uint8_t slot);
+static bool save_state(uint8_t slot);
+static size_t rewind_save(uint8_t *state);
+static int rewind_load(const uint8_t *state, size_t size);
 
 
 /**********************
@@ -59,11 +73,25 @@ volatile unsigned char *audioBuffer_ptr;
 volatile uint16_t audioBufferCount = 0;
 
 bool GAME_GEAR = false;
-bool load_game = false; //Variable to know if we want to load the save data.
+uint8_t load_game = GAME_LOAD_NONE; //Variable to know if we want to load the save data.
 char sms_game_name[300];
 
 bool button_ss_sega = false; //Variable to save if we want to use state save/load buttons
 
+// Slot to restore at the start of the next frame, -1 if none
+static volatile int8_t load_slot = -1;
+
+// Slot to save at the start of the next frame, -1 if none. The task which asks for it waits on save_done.
+static volatile int8_t save_slot = -1;
+static volatile bool save_ok = false;
+static SemaphoreHandle_t save_done = NULL;
+
+// The L button is held, the game goes back through the rewind history
+static bool rewind_held = false;
+
+// The R button is held, the game runs unthrottled drawing one of each FAST_FORWARD_FRAMES
+static bool fast_forward = false;
+
 static const char *TAG = "SMS_manager";
 
 /**********************
@@ -75,6 +103,7 @@ void SMS_start(){
     // Queue creation
     vidQueue = xQueueCreate(7, sizeof(uint16_t *));
     audioQueue = xQueueCreate(1, sizeof(uint32_t *));
+    if(save_done == NULL) save_done = xSemaphoreCreateBinary();
     
     button_ss_sega = system_get_config(SYS_STATE_SAV_BTN);
 
@@ -98,29 +127,31 @@ void SMS_suspend(){
     vTaskSuspend(audioTask_handler);
 }
 
-void SMS_save_game(){
-    //Create a new file or open if already exists
-    char save_rom_dir[300];
-    
-    if(GAME_GEAR) sprintf(save_rom_dir,"/sdcard/Game_Gear/Save_Data/%s.sav",sms_game_name);
-    else{
-        sprintf(save_rom_dir,"/sdcard/Master_System/Save_Data/%s.sav",sms_game_name);
-    }
-    
-    //Open the file with write permissions
-	FILE *fd = fopen(save_rom_dir, "w");
+bool SMS_save_game(uint8_t slot){
+    // The emulator saves between frames, a suspended one runs until there and is suspended again
+    bool suspended = eTaskGetState(SMSTask_handler) == eSuspended;
 
-    if(fd != NULL){
-        system_save_state(fd);
-        ESP_LOGI(TAG,"Game %s saved!", sms_game_name);  
-    }
-    else{
-        ESP_LOGE(TAG,"Error creating save game file.");
+    xSemaphoreTake(save_done, 0);
+    save_ok = false;
+    save_slot = slot;
+
+    if(suspended) vTaskResume(SMSTask_handler);
+    bool done = xSemaphoreTake(save_done, STATE_TIMEOUT / portTICK_RATE_MS) == pdTRUE;
+    if(suspended) vTaskSuspend(SMSTask_handler);
+
+    if(!done){
+        save_slot = -1;
+        ESP_LOGE(TAG, "SMS Plus didn't reach the end of a frame, slot %d not saved", slot);
+        return false;
     }
-    fclose(fd);   
+    return save_ok;
+}
+
+void SMS_load_game(uint8_t slot){
+    load_slot = slot;
 }
 
-bool SMS_execute_game(const char *game_name, uint8_t console, bool load){
+bool SMS_execute_game(const char *game_name, uint8_t console, uint8_t load){
 
     //Check the console to execute
     if(console == SMS) ESP_LOGI(TAG,"Loading Sega Master System ROM: %s",sms_game_name);
@@ -137,7 +168,7 @@ bool SMS_execute_game(const char *game_name, uint8_t console, bool load){
     }
 
     //Check if we want to load the save game.
-    if(load) load_game = true;
+    load_game = load;
 
     return true;
 }
@@ -146,30 +177,83 @@ bool SMS_execute_game(const char *game_name, uint8_t console, bool load){
  *   STATIC FUNCTIONS
  **********************/
 
-static void load_save_data(){
+static bool load_save_data(uint8_t slot){
     char save_rom_dir[300];
-    
-    if(GAME_GEAR) sprintf(save_rom_dir,"/sdcard/Game_Gear/Save_Data/%s.sav",sms_game_name);
-    else{
-        sprintf(save_rom_dir,"/sdcard/Master_System/Save_Data/%s.sav",sms_game_name);
-    }
+    if(!sd_slot_path(save_rom_dir, sizeof(save_rom_dir), GAME_GEAR ? GG : SMS, sms_game_name, slot)) return false;
     printf("%s\r\n",save_rom_dir);
 
-    FILE *fd = fopen(save_rom_dir, "rb");
+    size_t size = 0;
+    uint8_t *state = sd_save_read(save_rom_dir, &size);
 
-    if(fd != NULL){
-        //TODO: Implement properly save state
-        ESP_LOGI(TAG,"Found save game file of the ROM: %s",sms_game_name);
-        system_load_state(fd);
-    }
-    else{
+    if(state == NULL){
         ESP_LOGW(TAG,"Any save game available for this ROM.");
+        return false;
     }
-    fclose(fd);
 
+    ESP_LOGI(TAG,"Found save game file of the ROM: %s",sms_game_name);
+    bool ok = system_load_state(state, size) == 0;
+    if(!ok) ESP_LOGE(TAG,"Invalid save game file.");
+    free(state);
 
+    return ok;
 }
 
+// Emulated time against the real one, shown on the screen while fast forwarding
+static void fast_forward_speed(){
+    static bool measuring = false;
+    static int frames = 0;
+    static int64_t start = 0;
+
+    if(!fast_forward){
+        if(measuring) display_HAL_set_speed(0);
+        measuring = false;
+        return;
+    }
+
+    if(!measuring){
+        measuring = true;
+        frames = 0;
+        start = esp_timer_get_time();
+        return;
+    }
+
+    if(++frames == FAST_FORWARD_REPORT){
+        int64_t now = esp_timer_get_time();
+        int frame_us = (sms.display == DISPLAY_PAL) ? 20000 : 16667;
+        display_HAL_set_speed(frames * frame_us * 10LL / (now - start));
+        frames = 0;
+        start = now;
+    }
+}
+
+static bool save_state(uint8_t slot){
+    uint8_t console = GAME_GEAR ? GG : SMS;
+    char save_rom_dir[300];
+    if(!sd_slot_path(save_rom_dir, sizeof(save_rom_dir), console, sms_game_name, slot)) return false;
+    
+    //The state is serialized on the RAM, the save writer task puts it on the SD card
+    int size = system_state_size();
+    uint8_t *state = sd_save_alloc(size);
+
+    if(state == NULL){
+        ESP_LOGE(TAG,"Error creating save game file.");
+        return false;
+    }
+
+    system_save_state(state);
+    if(!sd_save_write(save_rom_dir, state, size)) return false;
+    ESP_LOGI(TAG,"Game %s saved!", sms_game_name);
+
+    return sd_slot_saved(console, sms_game_name, slot, display_HAL_thumbnail);
+}
+
+static size_t rewind_save(uint8_t *state){
+    return system_save_state(state);
+}
+
+static int rewind_load(const uint8_t *state, size_t size){
+    return system_load_state(state, size);
+}
 
 static void videoTask(void *arg){
     ESP_LOGI(TAG, "SMS Video Task Initialize");
@@ -255,7 +339,10 @@ static void SMSTask(void *arg){
     system_init2();
     system_reset();
 
-    if(load_game) load_save_data();
+    if(load_game == GAME_LOAD_RESUME) load_save_data(SD_SLOT_RESUME);
+    else if(load_game == GAME_LOAD_LATEST) load_save_data(sd_slot_latest(GAME_GEAR ? GG : SMS, sms_game_name));
+
+    rewind_init(system_state_size());
 
     uint32 frame = 0;
 
@@ -296,12 +383,24 @@ static void SMSTask(void *arg){
    
 
     while(1){
-        
+        // The state is saved and restored between frames, the menu may have suspended the task in the middle of one
+        if(save_slot >= 0){
+            save_ok = save_state(save_slot);
+            save_slot = -1;
+            xSemaphoreGive(save_done);
+        }
+
+        if(load_slot >= 0){
+            load_save_data(load_slot);
+            load_slot = -1;
+        }
+
         startTime = xthal_get_ccount();
         input_set();
+        if(rewind_held) rewind_step(rewind_load);
         //TODO: Coleco stuff
 
-        if ((frame % 2) == 0){
+        if ((frame % (fast_forward ? FAST_FORWARD_FRAMES : 2)) == 0){
             system_frame(0);
             xQueueSend(vidQueue, &bitmap.data, 0);
 
@@ -322,12 +421,15 @@ static void SMSTask(void *arg){
         }
 
         //Is necessary to check if it's GameGear to reduce a little bit the frame rate, if not goes too fast.
-        if(GAME_GEAR)  xQueueSend(audioQueue, &audioBuffer[audioBuffer_num], ( TickType_t ) 5);
-        else{
-             xQueueSend(audioQueue, &audioBuffer[audioBuffer_num], 0);
+        //A buffer the audio task didn't take is filled again on the next frame, the other one may be playing.
+        TickType_t audio_wait = (GAME_GEAR && !fast_forward) ? 5 : 0;
+        if(xQueueSend(audioQueue, &audioBuffer[audioBuffer_num], audio_wait) == pdPASS){
+            audioBuffer_num = audioBuffer_num ? 0 : 1;
         }
-       
-        audioBuffer_num = audioBuffer_num ? 0 : 1;
+
+        fast_forward_speed();
+
+        if(!rewind_held) rewind_frame(rewind_save);
 
         stopTime = xthal_get_ccount();
 
@@ -369,8 +471,11 @@ static void input_set(){
     if(!((inputs_value >> 12) & 0x01))  smsSystem |= INPUT_PAUSE;
 
     //Special function to instant load/save progress pushing x and y buttons
-    if(!((inputs_value >> 6) & 0x01) && button_ss_sega) load_save_data();
-    if(!((inputs_value >> 7) & 0x01) && button_ss_sega) SMS_save_game();
+    if(!((inputs_value >> 6) & 0x01) && button_ss_sega) load_save_data(0);
+    if(!((inputs_value >> 7) & 0x01) && button_ss_sega) save_state(0);
+
+    rewind_held = !((inputs_value >> 13) & 0x01);
+    fast_forward = !((inputs_value >> 5) & 0x01);
 
     input.pad[0] = smsButtons;
     input.system = smsSystem;
@@ -44,18 +44,36 @@ void SMS_suspend();
  * Arguments:
  * -name: Name of the game.
  * -console: Console to execute SMS(Sega Master System)/GG(Game Gear)
- * -load: If you want to load previous save game data.
+ * -load: State to restore, GAME_LOAD_NONE, GAME_LOAD_LATEST or GAME_LOAD_RESUME.
  * 
  *  Returns: True if it was loaded the selected game, otherwise false.
  */
-bool SMS_execute_game(const char *game_name, uint8_t console, bool load);
+bool SMS_execute_game(const char *game_name, uint8_t console, uint8_t load);
 
 /*
  * Function:  SMS_save_game 
  * --------------------
  * 
- * Save the progress of the game into a file on the SD card.
+ * Save the progress of the game on a slot of the SD card, with a thumbnail on the slot index.
+ * The emulator saves it at the end of the frame, a suspended emulator runs until there and is
+ * suspended again.
+ * 
+ * Arguments:
+ * -slot: Save slot, from 0 to SD_SLOT_NUM - 1.
+ * 
+ *  Returns: True if the state was queued to the save writer.
+ */
+bool SMS_save_game(uint8_t slot);
+
+/*
+ * Function:  SMS_load_game 
+ * --------------------
+ * 
+ * Restore the state of a slot. The emulator task loads it before its next frame.
+ * 
+ * Arguments:
+ * -slot: Save slot, from 0 to SD_SLOT_NUM - 1.
  * 
  *  Returns: Nothing
  */
-void SMS_save_game();
\ No newline at end of file
+void SMS_load_game(uint8_t slot);
\ No newline at end of file
@@ -22,6 +22,7 @@
 
 #include "shared.h"
 #include "system_manager.h"
+#include "sd_cart.h"
 
 extern unsigned long crc32(crc, buf, len);
 
@@ -403,39 +404,22 @@ bool load_rom(char *filename, uint8_t console)
     if(console == SMS ) sprintf(dir_aux,"/sdcard/Master_System/%s",filename);
     else if(console == GG) sprintf(dir_aux,"/sdcard/Game_Gear/%s",filename);
 
-    fd = fopen(dir_aux, "rb");
-    if (!fd)
+    /* Images under a 16k page are padded with the zeroed tail */
+    size_t actual_size = 0;
+    uint8 *image = sd_cart_load(dir_aux, &actual_size, 0x4000);
+    if (!image)
         return false;
 
-    /* Seek to end of file, and get size */
-
-    fseek(fd, 0, SEEK_END);
-    size_t actual_size = ftell(fd);
-    fseek(fd, 0, SEEK_SET);
-
     cart.size = actual_size;
     if (cart.size < 0x4000)
         cart.size = 0x4000;
 
-    //cart.rom = ESP32_PSRAM;
-    cart.rom = malloc(cart.size);
-    size_t cnt = fread(cart.rom, cart.size, 1, fd);
-    //if (cnt != 1) abort();
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("nop");
-    __asm__("memw");
-
-    fclose(fd);
-
-    //cart.sram = ESP32_PSRAM + 0x280000;
-
-    /* Take care of image header, if present */
+    /* Take care of image header, if present, the ROM starts past it */
+    cart.rom = image;
     if ((cart.size / 512) & 1)
     {
         cart.size -= 512;
-        memcpy(cart.rom, cart.rom + 512, cart.size);
+        cart.rom += 512;
     }
 
     /* 16k pages */
@@ -494,6 +494,47 @@ IRAM_ATTR void render_line(int line)
   }
 }
 
+/* Process a line of a frame that will not be displayed: only the state
+   the game can read back (sprite overflow and collision) is updated */
+IRAM_ATTR void render_line_skip(int line)
+{
+  /* ensure we have not already processed this line */
+  if (prev_line == line)
+    return;
+  prev_line = line;
+
+  /* Ensure we're within the VDP active area (incl. overscan) */
+  int top_border = active_border[sms.display][vdp.extended];
+  int vline = (line + top_border) % vdp.lpf;
+  if (vline >= active_range[sms.display])
+    return;
+
+  top_border = top_border + (vdp.height - bitmap.viewport.h) / 2;
+
+  /* Sprite limit flag is set at the beginning of the line */
+  if (vdp.spr_ovr)
+  {
+    vdp.spr_ovr = 0;
+    vdp.status |= 0x40;
+  }
+
+  /* Sprites are drawn over a blank line, background pixels never carry
+     the sprite marker so collisions are detected exactly as when rendering */
+  if ((vdp.reg[1] & 0x40) &&
+      ((vdp.mode > 7) || ((vline >= top_border) && (vline < (bitmap.viewport.h + top_border)))))
+  {
+    linebuf = &internal_buffer[0];
+    memset(linebuf, 0, 0x100 + 16);
+    render_obj(line);
+  }
+
+  /* Parse Sprites for next line */
+  if (vdp.mode > 7)
+    parse_satb(line);
+  else
+    parse_line(line);
+}
+
 uint8 data[8];
 static IRAM_ATTR void *tile_get(short attr, short line)
 {
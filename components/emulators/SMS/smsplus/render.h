@@ -44,6 +44,7 @@ extern void render_shutdown(void);
 extern void render_init(void);
 extern void render_reset(void);
 extern void render_line(int line);
+extern void render_line_skip(int line);
 extern void render_bg_sms(int line);
 extern void render_obj_sms(int line);
 extern void palette_sync(int index);
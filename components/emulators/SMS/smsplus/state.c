@@ -39,32 +39,37 @@ system_save_state: sizeof Z80=72
 system_save_state: sizeof SN76489_Context=92
 */
 
-int system_save_state(void *mem)
+int system_state_size(void)
 {
-  int i;
+  return sizeof(sms) + sizeof(vdp) + 4 + 0x8000 + sizeof(Z80) + SN76489_GetContextSize();
+}
 
-  printf("%s: sizeof sms=%d\n", __func__, sizeof(sms));
-  printf("%s: sizeof vdp=%d\n", __func__, sizeof(vdp));
-  printf("%s: sizeof Z80=%d\n", __func__, sizeof(Z80));
-  printf("%s: sizeof SN76489_Context=%d\n", __func__, sizeof(SN76489_Context));
+int system_save_state(uint8 *buf)
+{
+  int i;
+  uint8 *ptr = buf;
 
   /*** Save SMS Context ***/
-  fwrite(&sms, sizeof(sms), 1, mem);
+  memcpy(ptr, &sms, sizeof(sms));
+  ptr += sizeof(sms);
 
   /*** Save VDP state ***/
-  fwrite(&vdp, sizeof(vdp), 1, mem);
+  memcpy(ptr, &vdp, sizeof(vdp));
+  ptr += sizeof(vdp);
 
   /*** Save cart info ***/
   for (i = 0; i < 4; i++)
   {
-    fwrite(&cart.fcr[i], 1, 1, mem);
+    *ptr++ = cart.fcr[i];
   }
 
   /*** Save SRAM ***/
-  fwrite(&cart.sram[0], 0x8000, 1, mem);
+  memcpy(ptr, &cart.sram[0], 0x8000);
+  ptr += 0x8000;
 
   /*** Save Z80 Context ***/
-  fwrite(&Z80, sizeof(Z80), 1, mem);
+  memcpy(ptr, &Z80, sizeof(Z80));
+  ptr += sizeof(Z80);
 
 #if 0
   /*** Save YM2413 ***/
@@ -73,38 +78,41 @@ int system_save_state(void *mem)
 #endif
 
   /*** Save SN76489 ***/
-  fwrite(SN76489_GetContextPtr(0), SN76489_GetContextSize(), 1, mem);
+  memcpy(ptr, SN76489_GetContextPtr(0), SN76489_GetContextSize());
+  ptr += SN76489_GetContextSize();
 
-  return 0;
+  return ptr - buf;
 }
 
-void system_load_state(void *mem)
+int system_load_state(const uint8 *buf, int size)
 {
-  printf("load state!!!!!!!!!!!\r\n");
   int i;
-  uint8 *buf;
+  const uint8 *ptr = buf;
 
-  printf("%s: sizeof sms=%d\n", __func__, sizeof(sms));
-  printf("%s: sizeof vdp=%d\n", __func__, sizeof(vdp));
-  printf("%s: sizeof Z80=%d\n", __func__, sizeof(Z80));
-  printf("%s: sizeof SN76489_Context=%d\n", __func__, sizeof(SN76489_Context));
+  if (size < system_state_size())
+  {
+    printf("%s: Bad save data size %d\n", __func__, size);
+    return -1;
+  }
 
   /* Initialize everything */
   //system_reset();
 
   /*** Set SMS Context ***/
   sms_t sms_tmp;
-  fread(&sms_tmp, sizeof(sms_tmp), 1, mem);
+  memcpy(&sms_tmp, ptr, sizeof(sms_tmp));
+  ptr += sizeof(sms_tmp);
   if (sms.console != sms_tmp.console)
   {
     system_reset();
     printf("%s: Bad save data\n", __func__);
-    return;
+    return -1;
   }
   sms = sms_tmp;
 
   /*** Set vdp state ***/
-  fread(&vdp, sizeof(vdp), 1, mem);
+  memcpy(&vdp, ptr, sizeof(vdp));
+  ptr += sizeof(vdp);
 
   /** restore video & audio settings (needed if timing changed) ***/
   //vdp_init();
@@ -113,15 +121,17 @@ void system_load_state(void *mem)
   /*** Set cart info ***/
   for (i = 0; i < 4; i++)
   {
-    fread(&cart.fcr[i], 1, 1, mem);
+    cart.fcr[i] = *ptr++;
   }
 
   /*** Set SRAM ***/
-  fread(&cart.sram[0], 0x8000, 1, mem);
+  memcpy(&cart.sram[0], ptr, 0x8000);
+  ptr += 0x8000;
 
   /*** Set Z80 Context ***/
   int (*irq_cb)(int) = Z80.irq_callback;
-  fread(&Z80, sizeof(Z80), 1, mem);
+  memcpy(&Z80, ptr, sizeof(Z80));
+  ptr += sizeof(Z80);
   Z80.irq_callback = irq_cb;
 
 #if 0
@@ -139,7 +149,7 @@ void system_load_state(void *mem)
   float psg_dClock = psg->dClock;
 
   /*** Set SN76489 ***/
-  fread(SN76489_GetContextPtr(0), SN76489_GetContextSize(), 1, mem);
+  memcpy(SN76489_GetContextPtr(0), ptr, SN76489_GetContextSize());
 
   // Restore clock rate
   psg->Clock = psg_Clock;
@@ -183,4 +193,6 @@ void system_load_state(void *mem)
   /* Restore palette */
   for (i = 0; i < PALETTE_SIZE; i++)
     palette_sync(i);
+
+  return 0;
 }
@@ -29,7 +29,8 @@
 #define STATE_HEADER "SST\0" /* State file header */
 
 /* Function prototypes */
-extern int system_save_state(void *mem);
-extern void system_load_state(void *mem);
+extern int system_state_size(void);
+extern int system_save_state(uint8 *buf);
+extern int system_load_state(const uint8 *buf, int size);
 
 #endif /* _STATE_H_ */
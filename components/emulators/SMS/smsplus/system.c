@@ -74,6 +74,10 @@ void system_frame(int skip_render)
     {
       render_line(vdp.line);
     }
+    else
+    {
+      render_line_skip(vdp.line);
+    }
 
     /* Horizontal Interrupt */
     if (sms.console >= CONSOLE_SMS)
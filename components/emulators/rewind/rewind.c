@@ -0,0 +1,319 @@
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include "rewind.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+// The deltas are a list of 16 bit tokens. A token without DELTA_LITERAL skips token+1 equal bytes,
+// one with it is followed by (token & 0x7FFF)+1 bytes to XOR on the state.
+#define DELTA_LITERAL       0x8000
+#define DELTA_RUN_MAX       0x8000
+#define DELTA_MATCH         4       // Equal bytes which end a literal run, a skip token costs 2
+
+#define REWIND_STATS        64      // Snapshots between the cost logs
+
+// Delta of a snapshot against the next one, on the history ring
+struct rewind_entry{
+    uint32_t offset;
+    uint32_t size;
+    uint32_t state_size;    // Length of the state it gives
+};
+
+/**********************
+*  STATIC VARIABLES
+**********************/
+static const char *TAG = "rewind";
+
+static uint8_t *ring = NULL;
+static size_t ring_head = 0;
+static size_t ring_used = 0;
+
+static struct rewind_entry *entries = NULL;
+static uint16_t entry_first = 0;   // Oldest entry
+static uint16_t entry_count = 0;
+
+// state_prev is the newest snapshot, whole. state_next is the one being compared with it.
+static uint8_t *state_prev = NULL;
+static uint8_t *state_next = NULL;
+static uint8_t *delta = NULL;
+static size_t state_max = 0;
+static size_t prev_size = 0;
+static size_t next_size = 0;
+static size_t delta_size = 0;
+static size_t delta_pos = 0;
+
+static bool prev_valid = false;
+static bool prev_loaded = false;    // The emulator is on state_prev, the next step goes further back
+static bool encoding = false;
+static uint32_t frame_count = 0;
+
+// Cost of the captures since the last log
+static uint32_t stat_captures = 0;
+static uint32_t stat_raw = 0;
+static uint32_t stat_packed = 0;
+static uint32_t stat_save_us = 0;
+static uint32_t stat_delta_us = 0;
+static uint32_t stat_wraps = 0;     // Times the history went back to the start of the ring
+
+/**********************
+*  STATIC PROTOTYPES
+**********************/
+static void rewind_free();
+static void history_push(size_t size, size_t state_size);
+static void history_drop();
+static size_t delta_encode(const uint8_t *older, const uint8_t *newer, size_t length, uint8_t *out);
+static void delta_apply(uint8_t *state, const uint8_t *data, size_t size);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool rewind_init(size_t state_size){
+    rewind_free();
+
+    state_max = (state_size + 3) & ~3;
+
+    ring = heap_caps_malloc(REWIND_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+    entries = heap_caps_malloc(REWIND_ENTRIES * sizeof(struct rewind_entry), MALLOC_CAP_SPIRAM);
+    state_prev = heap_caps_malloc(state_max, MALLOC_CAP_SPIRAM);
+    state_next = heap_caps_malloc(state_max, MALLOC_CAP_SPIRAM);
+    // A literal run takes 2 bytes more than the state, but it's followed by DELTA_MATCH equal bytes
+    delta = heap_caps_malloc(state_max + state_max / 1024 + 64, MALLOC_CAP_SPIRAM);
+
+    if(ring == NULL || entries == NULL || state_prev == NULL || state_next == NULL || delta == NULL){
+        ESP_LOGW(TAG, "Not enough SPIRAM, rewind disabled");
+        rewind_free();
+        return false;
+    }
+
+    ESP_LOGI(TAG, "Rewind of %u KB, states of %u bytes", REWIND_BUFFER_SIZE / 1024, (unsigned int)state_max);
+    return true;
+}
+
+void rewind_frame(rewind_save_cb save){
+    if(ring == NULL) return;
+
+    frame_count++;
+
+    if(encoding){
+        uint32_t start = esp_timer_get_time();
+        size_t length = (prev_size > next_size) ? prev_size : next_size;
+        size_t chunk = (length - delta_pos > REWIND_CHUNK) ? REWIND_CHUNK : length - delta_pos;
+
+        delta_size += delta_encode(state_prev + delta_pos, state_next + delta_pos, chunk, delta + delta_size);
+        delta_pos += chunk;
+
+        if(delta_pos == length){
+            history_push(delta_size, prev_size);
+
+            uint8_t *swap = state_prev;
+            state_prev = state_next;
+            state_next = swap;
+            prev_size = next_size;
+            encoding = false;
+
+            stat_raw += next_size;
+            stat_packed += delta_size;
+        }
+
+        uint32_t elapsed = esp_timer_get_time() - start;
+        if(elapsed > stat_delta_us) stat_delta_us = elapsed;
+        return;
+    }
+
+    if(frame_count < REWIND_INTERVAL) return;
+    frame_count = 0;
+
+    uint32_t start = esp_timer_get_time();
+    size_t size = save(prev_valid ? state_next : state_prev);
+    uint32_t elapsed = esp_timer_get_time() - start;
+    if(size == 0 || size > state_max) return;
+
+    if(elapsed > stat_save_us) stat_save_us = elapsed;
+    prev_loaded = false;
+
+    if(!prev_valid){
+        prev_size = size;
+        prev_valid = true;
+        return;
+    }
+
+    next_size = size;
+    delta_size = 0;
+    delta_pos = 0;
+    encoding = true;
+
+    if(++stat_captures == REWIND_STATS && stat_packed > 0){
+        ESP_LOGI(TAG, "%u snapshots, %u KB, %u wraps, ratio %u.%u:1, save %u us, delta %u us/frame",
+                 entry_count, (unsigned int)(ring_used / 1024), stat_wraps, (unsigned int)(stat_raw / stat_packed),
+                 (unsigned int)(stat_raw * 10ULL / stat_packed % 10), stat_save_us, stat_delta_us);
+        stat_captures = stat_raw = stat_packed = stat_save_us = stat_delta_us = 0;
+    }
+}
+
+bool rewind_step(rewind_load_cb load){
+    if(ring == NULL || !prev_valid) return false;
+
+    // The snapshot being compared is newer than the one to restore
+    encoding = false;
+    frame_count = 0;
+
+    bool older = true;
+    if(prev_loaded){
+        if(entry_count > 0){
+            struct rewind_entry *entry = &entries[(entry_first + entry_count - 1) % REWIND_ENTRIES];
+            delta_apply(state_prev, ring + entry->offset, entry->size);
+            prev_size = entry->state_size;
+            ring_head = entry->offset;
+            ring_used -= entry->size;
+            entry_count--;
+        }
+        else older = false;
+    }
+
+    // The oldest snapshot is restored again, the game stays on it while the button is held
+    if(load(state_prev, prev_size) != 0){
+        ESP_LOGE(TAG, "Error restoring a snapshot");
+        return false;
+    }
+    prev_loaded = true;
+
+    return older;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void rewind_free(){
+    free(ring);
+    free(entries);
+    free(state_prev);
+    free(state_next);
+    free(delta);
+    ring = NULL;
+    entries = NULL;
+    state_prev = NULL;
+    state_next = NULL;
+    delta = NULL;
+
+    ring_head = ring_used = 0;
+    entry_first = entry_count = 0;
+    prev_valid = prev_loaded = encoding = false;
+    frame_count = 0;
+    stat_wraps = 0;
+}
+
+// The deltas are placed one after another and wrap to the start of the ring, the oldest
+// ones under the new delta are dropped.
+static void history_push(size_t size, size_t state_size){
+    if(size > REWIND_BUFFER_SIZE){
+        entry_count = 0;
+        ring_head = ring_used = 0;
+        return;
+    }
+
+    size_t offset = ring_head;
+    if(offset + size > REWIND_BUFFER_SIZE){
+        // The deltas past ring_head are older than the ones at the start of the ring, they go first
+        while(entry_count > 0 && entries[entry_first].offset >= ring_head) history_drop();
+        offset = 0;
+        stat_wraps++;
+    }
+
+    if(entry_count == REWIND_ENTRIES) history_drop();
+    while(entry_count > 0){
+        struct rewind_entry *oldest = &entries[entry_first];
+        if(oldest->offset < offset + size && oldest->offset + oldest->size > offset) history_drop();
+        else break;
+    }
+
+    memcpy(ring + offset, delta, size);
+
+    struct rewind_entry *entry = &entries[(entry_first + entry_count) % REWIND_ENTRIES];
+    entry->offset = offset;
+    entry->size = size;
+    entry->state_size = state_size;
+    entry_count++;
+
+    ring_head = offset + size;
+    ring_used += size;
+}
+
+static void history_drop(){
+    ring_used -= entries[entry_first].size;
+    entry_first = (entry_first + 1) % REWIND_ENTRIES;
+    entry_count--;
+}
+
+// older and newer are word aligned, the equal runs are compared 4 bytes at a time
+static size_t delta_encode(const uint8_t *older, const uint8_t *newer, size_t length, uint8_t *out){
+    size_t i = 0;
+    size_t o = 0;
+
+    while(i < length){
+        size_t start = i;
+        size_t end = (length - i > DELTA_RUN_MAX) ? i + DELTA_RUN_MAX : length;
+
+        while(i < end && (i & 3) && older[i] == newer[i]) i++;
+        if((i & 3) == 0){
+            while(i + 4 <= end && *(const uint32_t *)(older + i) == *(const uint32_t *)(newer + i)) i += 4;
+        }
+        while(i < end && older[i] == newer[i]) i++;
+
+        if(i > start){
+            out[o++] = (i - start - 1) & 0xFF;
+            out[o++] = (i - start - 1) >> 8;
+            continue;
+        }
+
+        size_t header = o;
+        size_t same = 0;
+        o += 2;
+
+        while(i < end){
+            uint8_t x = older[i] ^ newer[i];
+            out[o++] = x;
+            i++;
+
+            if(x != 0) same = 0;
+            else if(++same == DELTA_MATCH){
+                i -= same;
+                o -= same;
+                break;
+            }
+        }
+
+        out[header] = (i - start - 1) & 0xFF;
+        out[header + 1] = ((i - start - 1) | DELTA_LITERAL) >> 8;
+    }
+
+    return o;
+}
+
+static void delta_apply(uint8_t *state, const uint8_t *data, size_t size){
+    size_t i = 0;
+    size_t o = 0;
+
+    while(o + 2 <= size){
+        uint16_t token = data[o] | (data[o + 1] << 8);
+        size_t run = (token & (DELTA_LITERAL - 1)) + 1;
+        o += 2;
+
+        if(token & DELTA_LITERAL){
+            for(size_t j = 0; j < run; j++) state[i++] ^= data[o++];
+        }
+        else i += run;
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+/*********************
+ *      INCLUDES
+ *********************/
+#include "stdint.h"
+#include "stdbool.h"
+#include "stddef.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define REWIND_BUFFER_SIZE  (1024*1024) // SPIRAM for the history, the states are kept as deltas
+#define REWIND_INTERVAL     8           // Frames between snapshots
+#define REWIND_ENTRIES      512         // Most snapshots kept, ~68 seconds at 60 FPS
+#define REWIND_CHUNK        (16*1024)   // State bytes compared per frame, ~1 ms on the SPIRAM
+
+// Serialize the emulator on state, returns the length or 0 on error
+typedef size_t (*rewind_save_cb)(uint8_t *state);
+
+// Restore the emulator from a state of rewind_save_cb, returns 0 if it was loaded
+typedef int (*rewind_load_cb)(const uint8_t *state, size_t size);
+
+/*********************
+ *      FUNCTIONS
+ *********************/
+
+/*
+ * Function:  rewind_init
+ * --------------------
+ *
+ * Allocate the rewind history on the SPIRAM. The newest snapshot is kept whole, each older
+ * one is stored as the XOR against the next one with the runs of zeros removed, so a frame
+ * that changed a few KB takes a few KB. When the buffer is full, the oldest snapshots are dropped.
+ *
+ * Arguments:
+ *  -state_size: Biggest state given by the save function of the emulator.
+ *
+ * Returns: True if the history was allocated, the rewind stays disabled otherwise.
+ *
+ */
+bool rewind_init(size_t state_size);
+
+/*
+ * Function:  rewind_frame
+ * --------------------
+ *
+ * Call it once per emulated frame, between frames. Every REWIND_INTERVAL frames the state is
+ * serialized, and the delta is computed REWIND_CHUNK bytes per frame on the next ones,
+ * so the emulator never pays the whole comparison on a single frame.
+ *
+ * Arguments:
+ *  -save: Function which serializes the emulator.
+ *
+ * Returns: Nothing.
+ *
+ */
+void rewind_frame(rewind_save_cb save);
+
+/*
+ * Function:  rewind_step
+ * --------------------
+ *
+ * Go back one snapshot, call it between frames while the rewind button is held. The first
+ * call restores the newest snapshot, the next ones the older ones.
+ *
+ * Arguments:
+ *  -load: Function which restores the emulator.
+ *
+ * Returns: False once the oldest snapshot is reached, it's restored again on each call.
+ *
+ */
+bool rewind_step(rewind_load_cb load);
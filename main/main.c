@@ -9,6 +9,7 @@
 #include "esp_freertos_hooks.h"
 #include "freertos/semphr.h"
 #include "freertos/queue.h"
+#include "freertos/event_groups.h"
 #include <freertos/timers.h>
 
 
@@ -16,6 +17,7 @@
 #include "system_configuration.h"
 
 #include <esp_log.h>
+#include "esp_timer.h"
 
 #include "gnuboy_manager.h"
 #include "NES_manager.h"
@@ -26,6 +28,9 @@
 #include "boot_screen.h"
 #include "display_HAL.h"
 #include "sd_storage.h"
+#include "sd_worker.h"
+#include "sd_save.h"
+#include "sd_slots.h"
 #include "battery.h"
 #include "sound_driver.h"
 #include "GUI.h"
@@ -33,6 +38,26 @@
 #include "LED_notification.h"
 #include "backlight_ctrl.h"
 
+// Shortest time that the boot animation is shown, the boot continues as soon as it's elapsed
+// and the peripherals are ready.
+#define BOOT_ANI_MIN_MS     1000
+
+// Subsystems initialized in parallel by the boot orchestrator
+#define BOOT_AUDIO          BIT0
+#define BOOT_SD             BIT1
+#define BOOT_SD_WORKER      BIT2
+#define BOOT_INPUT          BIT3
+#define BOOT_BATTERY        BIT4
+#define BOOT_SAVE_WRITER    BIT5
+#define BOOT_ALL            (BOOT_AUDIO | BOOT_SD | BOOT_SD_WORKER | BOOT_INPUT | BOOT_BATTERY | BOOT_SAVE_WRITER)
+
+struct boot_job{
+    const char *name;
+    void (*init)(void);
+    EventBits_t depends;    // Jobs which have to finish before this one starts
+    EventBits_t done;
+};
+
 uint8_t console_running = NULL;
 
 TaskHandle_t gui_handler;
@@ -41,9 +66,68 @@ TimerHandle_t timer;
 
 bool boot_screen_ani = true;
 
+static EventGroupHandle_t boot_events;
+
+static bool gui_started = false;
+static char running_game[200] = "";
+
 
 static const char *TAG = "microByte_main";
 
+static void boot_audio(void){
+    audio_init(AUDIO_SAMPLE_32KHZ);
+}
+
+static void boot_sd(void){
+    sd_init();
+}
+
+// Each bus has its own job, so a slow SD card doesn't delay the I2S or the I2C expander.
+static const struct boot_job boot_jobs[] = {
+    { "Audio (I2S)",    boot_audio,     0,          BOOT_AUDIO },
+    { "SD card",        boot_sd,        0,          BOOT_SD },
+    { "SD worker",      sd_worker_init, BOOT_SD,    BOOT_SD_WORKER },
+    { "Save writer",    sd_save_init,   BOOT_SD,    BOOT_SAVE_WRITER },
+    { "Input (I2C)",    input_init,     0,          BOOT_INPUT },
+    { "Battery (ADC)",  battery_init,   0,          BOOT_BATTERY },
+};
+
+static void boot_job_task(void *arg){
+    const struct boot_job *job = arg;
+
+    if(job->depends) xEventGroupWaitBits(boot_events, job->depends, pdFALSE, pdTRUE, portMAX_DELAY);
+
+    uint8_t stage = system_boot_stage_start(job->name);
+    job->init();
+    system_boot_stage_end(stage);
+
+    xEventGroupSetBits(boot_events, job->done);
+    vTaskDelete(NULL);
+}
+
+
+// The GUI is started the first time it's shown, a quick resume boot goes to the game without drawing it
+static void gui_show(void){
+    if(!gui_started){
+        GUI_start(gui_handler);
+        gui_started = true;
+    }
+    vTaskResume(gui_handler);
+}
+
+// Quick resume snapshot: the state is written on its own file, out of the save slots of the player,
+// and the game on the NVS
+static void quick_resume_save(void){
+    if(running_game[0] == '\0') return;
+
+    if(console_running == NES) NES_save_game(SD_SLOT_RESUME);
+    else if(console_running == GAMEBOY_COLOR || console_running == GAMEBOY) gnuboy_save(SD_SLOT_RESUME);
+    else if(console_running == SMS || console_running == GG) SMS_save_game(SD_SLOT_RESUME);
+
+    // The record only points to a state which is already on the SD card
+    sd_save_sync();
+    system_save_resume(console_running, running_game);
+}
 
 static void timer_isr(void){
     printf("save\r\n");
@@ -77,6 +161,7 @@ static void timer_isr(void){
 void app_main(void){
 
     /**************** Basic initialization **************/
+    uint8_t stage = system_boot_stage_start("System");
     system_init_config();
     //And the light was done. Initialize the LED control thread and perfom an "fade animation"
     LED_init();
@@ -86,9 +171,11 @@ void app_main(void){
     system_info();
     ESP_LOGI(TAG, "Memory Status:\r\n -SPI_RAM: %i Bytes\r\n -INTERNAL_RAM: %i Bytes\r\n -DMA_RAM: %i Bytes\r\n", \
     system_memory(MEMORY_SPIRAM),system_memory(MEMORY_INTERNAL),system_memory(MEMORY_DMA));
+    system_boot_stage_end(stage);
 
     //Start the display Hardware Abstraction Layer (Basically just initi the display). This layer is just to simplify the port process if you want to use 
     // a different display. 
+    stage = system_boot_stage_start("Display");
     display_HAL_init();
 
     //This initialize the display's backlight control. This is a dirty backligh control module, I plan to change in a near future.
@@ -96,6 +183,7 @@ void app_main(void){
 
     int8_t backlight_level = system_get_config(SYS_BRIGHT);
     if(backlight_level > -1) backlight_set(backlight_level);
+    system_boot_stage_end(stage);
 
     /**************** Boot status **************/
 
@@ -108,9 +196,30 @@ void app_main(void){
         system_set_state(SYS_NORMAL_STATE);
     }
 
+    //Quick resume: after a power on, the last game played starts again with its saved state, without the
+    // animation and without drawing the GUI. The soft reset is used to go back to the menu, so it never resumes.
+    struct SYSTEM_MODE resume = {
+        .mode = MODE_GAME,
+        .status = 1,
+        .load_save_game = GAME_LOAD_RESUME,
+    };
+    bool quick_resume = false;
+    if(status != SYS_SOFT_RESET && system_get_resume(&resume.console, resume.game_name, sizeof(resume.game_name))){
+        ESP_LOGI(TAG, "Quick resume: %s", resume.game_name);
+        quick_resume = true;
+        boot_screen_ani = false;
+        //It's used only once, a game which can't be loaded must not be resumed on every boot
+        system_clear_resume();
+    }
+
     //The device can boot in 0.5 seconds, the magic of the micontrollers. But it think that it looks better
     // a fancy intro, and when it's showing the intro animation, all the peripherals are starting.
-    xTaskCreatePinnedToCore(boot_screen_task, "intro_task", 2048, ( void * ) boot_screen_ani, 1, &intro_handler, 0);
+    uint8_t ani_stage = BOOT_STAGE_MAX;
+    int64_t ani_start = esp_timer_get_time();
+    if(boot_screen_ani){
+        ani_stage = system_boot_stage_start("Boot animation");
+        xTaskCreatePinnedToCore(boot_screen_task, "intro_task", 2048, ( void * ) boot_screen_ani, 1, &intro_handler, 0);
+    }
     
     /**************** Message Queue initialization **************/
 
@@ -119,37 +228,57 @@ void app_main(void){
     batteryQueue = xQueueCreate(1, sizeof(struct BATTERY_STATUS));
     modeQueue = xQueueCreate(1, sizeof(struct SYSTEM_MODE));
 
-    
+    /**************** GUI initialization **************/
+
+    //The LVGL objects are built while the animation is running, the GUI doesn't touch the display until GUI_start.
+    xTaskCreatePinnedToCore(GUI_task, "Graphical User Interface", 1024*6, NULL, 1, &gui_handler, 0);
+
     /**************** Peripherals initialization **************/
-    //Initialize the peripherals
-    audio_init(AUDIO_SAMPLE_32KHZ);
-    sd_init();
 
-    // The gamepad control and battery run on thread to avoid block on the code execution while it's running.
-    input_init();
-    battery_init();
+    //Every peripheral starts on its own task and waits only for the ones it depends on. The jobs stay on core 0,
+    // so the driver interrupts are allocated on the same core than before and the core 1 is kept for the emulators.
+    boot_events = xEventGroupCreate();
+    for(int i = 0; i < sizeof(boot_jobs) / sizeof(boot_jobs[0]); i++){
+        xTaskCreatePinnedToCore(boot_job_task, "boot_job", 1024*4, ( void * ) &boot_jobs[i], 2, NULL, 0);
+    }
+
+    xEventGroupWaitBits(boot_events, BOOT_ALL, pdFALSE, pdTRUE, portMAX_DELAY);
+    vEventGroupDelete(boot_events);
 
     //If we are executing an update, and we reach this point, congratulations, the update was a succed!
     // Now we can disable the roll-back feature which is basically a bootloader tool which roll back to the previous
     //firmware if the new one doesn't work properly.
+    stage = system_boot_stage_start("OTA check");
     update_check();
+    system_boot_stage_end(stage);
 
-    //The boot animation is fancy, let's wait a little to see it
-    if(boot_screen_ani) vTaskDelay(2000 / portTICK_RATE_MS);
-    
-    //Once we don't need the boot screen, we will delete the task and free the resources.
-    vTaskDelete(intro_handler);
-    boot_screen_free();
+    if(boot_screen_ani){
+        //The boot animation is fancy, let's show it at least a little
+        uint32_t shown = (esp_timer_get_time() - ani_start) / 1000;
+        if(shown < BOOT_ANI_MIN_MS) vTaskDelay((BOOT_ANI_MIN_MS - shown) / portTICK_RATE_MS);
 
-    /**************** GUI initialization **************/
+        //Once we don't need the boot screen, we will delete the task and free the resources.
+        vTaskDelete(intro_handler);
+        boot_screen_free();
+        system_boot_stage_end(ani_stage);
+    }
 
     //This is embarrasing, is a temporary fix. The boot animation library use little endian logic and the rest of the firmware use big endian.
     //So, for now I'm not able to change it on the animation library. This function basically tell to the display to use big or little endian logic.
     display_HAL_change_endian();
 
-    //Now we are ready to execute the GUI.
-    xTaskCreatePinnedToCore(GUI_task, "Graphical User Interface", 1024*6, NULL, 1, &gui_handler, 0);
-   
+    //Now we are ready to draw the GUI, or to go to the game. The GUI is built anyway in case the menu button is pushed.
+    //The game is launched by the main loop, like if it was selected on the menu.
+    if(quick_resume && xQueueSend(modeQueue, &resume, 0) != pdPASS){
+        ESP_LOGE(TAG, "Quick resume queue send fail");
+        quick_resume = false;
+    }
+
+    if(quick_resume) GUI_resume_game(resume.console, resume.game_name);
+    else{
+        GUI_start(gui_handler);
+        gui_started = true;
+    }
 
     bool game_running = false;
     bool game_executed = false;
@@ -166,6 +295,10 @@ void app_main(void){
                     if(management.status == 1){//Execute the emulator.
                         battery_game_mode(true); //Block periodic battery status messages when your're playing.
 
+                        //A game started from the menu replaces the previous quick resume snapshot
+                        system_clear_resume();
+                        strcpy(running_game, management.game_name);
+
                         //Check which console you've selected, execute the LED load animation and load the game.
                         if(management.console == GAMEBOY_COLOR || management.console == GAMEBOY){
                             LED_mode(LED_LOAD_ANI);
@@ -185,9 +318,10 @@ void app_main(void){
                             vTaskSuspend(gui_handler);
                             NES_start(management.game_name);
                             //NES management it's slightly different so, it's necessary to first start the emulator.
-                            if(management.load_save_game){
+                            if(management.load_save_game != GAME_LOAD_NONE){
                                 vTaskDelay(1500 / portTICK_RATE_MS);
-                                NES_load_game();
+                                if(management.load_save_game == GAME_LOAD_RESUME) NES_load_game(SD_SLOT_RESUME);
+                                else NES_load_game(sd_slot_latest(NES, management.game_name));
                             }
                             game_executed = true;
                             game_running=true;
@@ -216,7 +350,7 @@ void app_main(void){
 
                             // To avoid noise whe is suspend the audio task, is necesary to clean the dma from previous data.
                             audio_terminate();
-                            vTaskResume(gui_handler);
+                            gui_show();
                             GUI_refresh();
                             // Refresh menu image
                             game_running=false;
@@ -235,9 +369,19 @@ void app_main(void){
                 break;
 
                 case MODE_SAVE_GAME:
-                    if(management.console == NES) NES_save_game();
-                    else if(management.console == GAMEBOY_COLOR || management.console == GAMEBOY) gnuboy_save();
-                    else if(management.console == SMS || management.console == GG) SMS_save_game();     
+                    if(management.console == NES) NES_save_game(management.slot);
+                    else if(management.console == GAMEBOY_COLOR || management.console == GAMEBOY) gnuboy_save(management.slot);
+                    else if(management.console == SMS || management.console == GG) SMS_save_game(management.slot);     
+                    //The quick resume snapshot is taken too, so the game resumes from here and not from an older one
+                    if(game_executed) quick_resume_save();
+                break;
+
+                case MODE_LOAD_GAME:
+                    //The emulators restore the state between frames. GNUBoy and SMS Plus do it once they're resumed,
+                    // nofrendo runs until the end of the frame and is suspended again.
+                    if(management.console == NES) NES_load_game(management.slot);
+                    else if(management.console == GAMEBOY_COLOR || management.console == GAMEBOY) gnuboy_load(management.slot);
+                    else if(management.console == SMS || management.console == GG) SMS_load_game(management.slot);
                 break;
 
                 case MODE_EXT_APP:
@@ -256,11 +400,17 @@ void app_main(void){
                 case MODE_BATTERY_ALERT:
                     //If in play mode, pause game and show if you wanna save
                     //If in the menu just show the message
-                    gnuboy_suspend();
+                    if(game_running){
+                        if(console_running == GAMEBOY_COLOR || console_running == GAMEBOY ) gnuboy_suspend();
+                        else if(console_running == NES) NES_suspend();
+                        else if(console_running == SMS || console_running == GG) SMS_suspend();
+                    }
                     audio_terminate();
                             // Is necessary this delay to avoid bouncing between suspend and delay state.
                     vTaskDelay(250 / portTICK_RATE_MS);
-                    vTaskResume(gui_handler);
+                    //The battery can run out at any moment, so the game is ready to be resumed
+                    if(game_executed) quick_resume_save();
+                    gui_show();
                     GUI_async_message();
                     GUI_refresh();
                     game_running=false;
@@ -281,6 +431,8 @@ void app_main(void){
                 break;
 
                 case MODE_OUT:
+                    if(game_executed) quick_resume_save();
+                    sd_save_sync();
                     system_set_state(SYS_SOFT_RESET);
                     ESP_LOGI(TAG,"System Soft Reset");
                     esp_restart();